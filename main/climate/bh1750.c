@@ -0,0 +1,214 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "i2c.h"
+#include "i2c_scheduler.h"
+#include "bh1750.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define BH1750_LOG  0
+
+#if (1 == BH1750_LOG)
+static const char * gTAG = "BH1750";
+#    define BH1750_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define BH1750_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#else
+#    define BH1750_LOGI(...)
+#    define BH1750_LOGE(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    /* The ADDR pin is low */
+    BH1750_I2C_ADDRESS      = 0x46,
+    BH1750_I2C_SPEED_HZ     = 400000,
+    BH1750_CMD_POWER_ON     = 0x01,
+    BH1750_CMD_CONTINUOUS_H = 0x10,
+    /* The high resolution measurement takes 180 ms at most */
+    BH1750_MEASURE_MS       = 180,
+    BH1750_PERIOD_MS        = 1000,
+    BH1750_RECOVERY_MS      = 5000,
+    /* lx = count / 1.2 */
+    BH1750_LUX_MUL          = 10,
+    BH1750_LUX_DIV          = 12,
+};
+
+/* The state is named by the action made when its waiting time is over */
+typedef enum
+{
+    BH1750_STATE_POWER_ON = 0,
+    BH1750_STATE_MODE,
+    BH1750_STATE_READ,
+    BH1750_STATE_PARSE,
+} bh1750_state_t;
+
+typedef struct
+{
+    i2c_device_p   p_dvc;
+    i2c_client_t   client;
+    i2c_xfer_t     xfer;
+    uint8_t        tx;
+    uint8_t        rx[2];
+    uint32_t       lux;
+    bh1750_state_t state;
+    uint32_t       errors;
+    bool           valid;
+} bh1750_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static bh1750_t gBh1750 = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+/* The count is big endian */
+static uint32_t bh1750_Lux(const uint8_t * p_rx)
+{
+    return (((p_rx[0] << 8) + p_rx[1]) * BH1750_LUX_MUL / BH1750_LUX_DIV);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void bh1750_Submit(uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz)
+{
+    gBh1750.xfer.p_dvc = gBh1750.p_dvc;
+    gBh1750.xfer.p_tx  = p_tx;
+    gBh1750.xfer.tx_sz = tx_sz;
+    gBh1750.xfer.p_rx  = p_rx;
+    gBh1750.xfer.rx_sz = rx_sz;
+    if (FW_SUCCESS != I2C_Scheduler_Submit(&gBh1750.xfer))
+    {
+        gBh1750.xfer.result = FW_ERROR;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void bh1750_Command(uint8_t command)
+{
+    gBh1750.tx = command;
+    bh1750_Submit(&gBh1750.tx, sizeof(gBh1750.tx), NULL, 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Makes one transfer per step, the transfer is made by the scheduler before the next step */
+static uint32_t bh1750_Step(void * p_ctx)
+{
+    /* The sensor is configured again after the failed transfer, it may be powered down */
+    if (FW_SUCCESS != gBh1750.xfer.result)
+    {
+        BH1750_LOGE("State: %d - Error: %04X", gBh1750.state, gBh1750.xfer.result);
+        gBh1750.errors++;
+        gBh1750.valid       = false;
+        gBh1750.xfer.result = FW_SUCCESS;
+        gBh1750.state       = BH1750_STATE_POWER_ON;
+        return BH1750_RECOVERY_MS;
+    }
+
+    switch (gBh1750.state)
+    {
+        case BH1750_STATE_POWER_ON:
+            bh1750_Command(BH1750_CMD_POWER_ON);
+            gBh1750.state = BH1750_STATE_MODE;
+            return 0;
+        case BH1750_STATE_MODE:
+            bh1750_Command(BH1750_CMD_CONTINUOUS_H);
+            gBh1750.state = BH1750_STATE_READ;
+            return BH1750_MEASURE_MS;
+        case BH1750_STATE_READ:
+            bh1750_Submit(NULL, 0, gBh1750.rx, sizeof(gBh1750.rx));
+            gBh1750.state = BH1750_STATE_PARSE;
+            return 0;
+        case BH1750_STATE_PARSE:
+            gBh1750.lux   = bh1750_Lux(gBh1750.rx);
+            gBh1750.valid = true;
+            gBh1750.state = BH1750_STATE_READ;
+            BH1750_LOGI("Light: %lu lx", gBh1750.lux);
+            return BH1750_PERIOD_MS;
+        default:
+            return UINT32_MAX;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void BH1750_Init(void)
+{
+    i2c_device_config_t dvc_config =
+    {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address  = (BH1750_I2C_ADDRESS >> 1),
+        .scl_speed_hz    = BH1750_I2C_SPEED_HZ,
+        .scl_wait_us     = 0,
+    };
+
+    if (NULL == gBh1750.p_dvc)
+    {
+        I2C_Init();
+        gBh1750.p_dvc = I2C_AddDevice(&dvc_config);
+    }
+    gBh1750.state          = BH1750_STATE_POWER_ON;
+    gBh1750.client.fp_step = bh1750_Step;
+    I2C_Scheduler_AddClient(&gBh1750.client);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool BH1750_IsValid(void)
+{
+    return gBh1750.valid;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t BH1750_GetErrors(void)
+{
+    return gBh1750.errors;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t BH1750_GetLux(void)
+{
+    return gBh1750.lux;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void BH1750_Test(void)
+{
+    /* The measurement results: the datasheet example, the dark, the sensor samples, the maximum */
+    static const struct
+    {
+        uint8_t  dump[2];
+        uint32_t lux;
+    } vectors[] =
+    {
+        {{0x83, 0x90}, 28066},
+        {{0x00, 0x00}, 0},
+        {{0x00, 0x01}, 0},
+        {{0x01, 0x2C}, 250},
+        {{0x3A, 0x98}, 12500},
+        {{0xFF, 0xFF}, 54612},
+    };
+    uint8_t idx    = 0;
+    bool    result = true;
+
+    for (idx = 0; idx < (sizeof(vectors) / sizeof(vectors[0])); idx++)
+    {
+        result &= (vectors[idx].lux == bh1750_Lux(vectors[idx].dump));
+    }
+
+    BH1750_LOGI("BH1750 Lux - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,557 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "climate_anomaly.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define ANOMALY_LOG  0
+
+#if (1 == ANOMALY_LOG)
+static const char * gTAG = "ANOMALY";
+#    define ANOMALY_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define ANOMALY_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define ANOMALY_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define ANOMALY_LOGI(...)
+#    define ANOMALY_LOGE(...)
+#    define ANOMALY_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+/* Every metric is smoothed by EWMA, its rate of change is the EWMA of the sample to sample   */
+/* rates. The Welford mean/variance of the values and of the rates are accumulated over the  */
+/* block, the completed block is the baseline of the next one, so the memory is O(1). The    */
+/* threshold is the floor of the metric plus K sigmas of the baseline. The spike rates do   */
+/* not enter the statistics, so the anomaly does not become the usual, while the drift does: */
+/* the new level (the changed setpoint) becomes the baseline in the next block.              */
+/* The filters are in the integer arithmetic (0.01 units scaled by the shift).                */
+enum
+{
+    ANOMALY_SHIFT         = 8,
+    /* The EWMA weight is 1/6, about 1 minute of the 10 s samples */
+    ANOMALY_EWMA_SAMPLES  = 6,
+    /* 1 hour of the 10 s samples */
+    ANOMALY_BLOCK_SAMPLES = 360,
+    /* The baseline needs the variance */
+    ANOMALY_BLOCK_MIN     = 2,
+    /* The threshold in sigmas of the baseline */
+    ANOMALY_SIGMA_K       = 4,
+    /* The detectors wait for the EWMA to settle */
+    ANOMALY_SETTLE        = ANOMALY_EWMA_SAMPLES,
+    ANOMALY_MINUTE_S      = 60,
+    /* The humidity rises by 1 % in 2 minutes of misting... */
+    ANOMALY_MIST_S        = 120,
+    ANOMALY_MIST_RISE     = 100,
+    /* ...unless it is saturated */
+    ANOMALY_SATURATION    = 9500,
+};
+
+typedef struct
+{
+    /* 0.01 units/min */
+    int32_t rate_floor;
+    /* 0.01 units */
+    int32_t drift_floor;
+} anomaly_param_t;
+
+typedef struct
+{
+    uint32_t count;
+    /* Scaled by the shift */
+    int32_t  mean;
+    int64_t  m2;
+} anomaly_welford_t, * anomaly_welford_p;
+
+typedef struct
+{
+    /* 0.01 units */
+    int32_t mean;
+    int32_t sigma;
+    bool    valid;
+} anomaly_baseline_t, * anomaly_baseline_p;
+
+typedef struct
+{
+    anomaly_welford_t  values;
+    anomaly_welford_t  rates;
+    anomaly_baseline_t value_base;
+    anomaly_baseline_t rate_base;
+    /* Scaled by the shift */
+    int32_t            ewma;
+    int32_t            rate;
+    int32_t            previous;
+    uint32_t           samples;
+    /* The raised events by their types */
+    uint8_t            active;
+} anomaly_metric_t, * anomaly_metric_p;
+
+typedef struct
+{
+    anomaly_metric_t        metrics[CLIMATE_ANOMALY_METRICS];
+    climate_anomaly_event_t events[CLIMATE_ANOMALY_EVENTS];
+    /* The time of misting (s) and the humidity EWMA at its start */
+    uint32_t                mist_elapsed;
+    int32_t                 mist_start;
+    uint16_t                sequence;
+    uint8_t                 head;
+} anomaly_state_t, * anomaly_state_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static const anomaly_param_t gcParams[CLIMATE_ANOMALY_METRICS] =
+{
+    /* 0.3 C/min, 2 C */
+    [CLIMATE_ANOMALY_TEMPERATURE] = {30, 200},
+    /* 3 %/min, 10 % */
+    [CLIMATE_ANOMALY_HUMIDITY]    = {300, 1000},
+};
+
+static anomaly_state_t gAnomaly = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t anomaly_Sqrt(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit    = (1ULL << 62);
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (0 != bit)
+    {
+        if (value >= (result + bit))
+        {
+            value  -= (result + bit);
+            result  = ((result >> 1) + bit);
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void anomaly_WelfordAdd(anomaly_welford_p p_welford, int32_t value)
+{
+    int32_t delta = (value - p_welford->mean);
+
+    p_welford->count++;
+    p_welford->mean += (delta / (int32_t)p_welford->count);
+    p_welford->m2   += ((int64_t)delta * (int64_t)(value - p_welford->mean));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The completed block becomes the baseline, the next block starts */
+static void anomaly_WelfordClose(anomaly_welford_p p_welford, anomaly_baseline_p p_baseline)
+{
+    uint64_t variance = 0;
+
+    if (ANOMALY_BLOCK_MIN <= p_welford->count)
+    {
+        variance              = ((uint64_t)MAX(p_welford->m2, 0) / (p_welford->count - 1));
+        p_baseline->mean      = (p_welford->mean >> ANOMALY_SHIFT);
+        p_baseline->sigma     = (int32_t)(anomaly_Sqrt(variance) >> ANOMALY_SHIFT);
+        p_baseline->valid     = true;
+    }
+    memset(p_welford, 0, sizeof(*p_welford));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The event is raised once when the condition appears */
+static void anomaly_Flag
+(
+    anomaly_state_p          p_state,
+    climate_anomaly_metric_t metric,
+    climate_anomaly_type_t   type,
+    bool                     on,
+    time_t                   now,
+    int32_t                  value
+)
+{
+    anomaly_metric_p        p_metric = &p_state->metrics[metric];
+    climate_anomaly_event_p p_event  = NULL;
+    uint8_t                 bit      = (uint8_t)(1 << type);
+
+    if (false == on)
+    {
+        p_metric->active &= (uint8_t)~bit;
+    }
+    else if (0 == (p_metric->active & bit))
+    {
+        p_metric->active |= bit;
+
+        /* 0 is no event */
+        p_state->sequence++;
+        if (0 == p_state->sequence)
+        {
+            p_state->sequence++;
+        }
+        p_event           = &p_state->events[p_state->head];
+        p_event->time     = (uint32_t)now;
+        p_event->value    = value;
+        p_event->sequence = p_state->sequence;
+        p_event->type     = type;
+        p_event->metric   = metric;
+        p_state->head     = ((p_state->head + 1) % CLIMATE_ANOMALY_EVENTS);
+        ANOMALY_LOGI("Event %u - metric %u - type %u - value %ld", p_event->sequence, metric, type, value);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void anomaly_Metric
+(
+    anomaly_state_p          p_state,
+    climate_anomaly_metric_t metric,
+    time_t                   now,
+    uint32_t                 dt,
+    int32_t                  value
+)
+{
+    const anomaly_param_t * p_param  = &gcParams[metric];
+    anomaly_metric_p        p_metric = &p_state->metrics[metric];
+    int32_t                 scaled   = (value << ANOMALY_SHIFT);
+    int32_t                 rate     = 0;
+    int32_t                 drift    = 0;
+    bool                    spike    = false;
+    bool                    drifted  = false;
+
+    if (0 == p_metric->samples)
+    {
+        p_metric->ewma = scaled;
+        p_metric->rate = 0;
+    }
+    else
+    {
+        rate            = (int32_t)((int64_t)(scaled - p_metric->previous) * ANOMALY_MINUTE_S / (int64_t)MAX(dt, 1));
+        p_metric->rate += ((rate - p_metric->rate) / ANOMALY_EWMA_SAMPLES);
+        p_metric->ewma += ((scaled - p_metric->ewma) / ANOMALY_EWMA_SAMPLES);
+    }
+    p_metric->previous = scaled;
+    p_metric->samples  = MIN((p_metric->samples + 1), UINT32_MAX - 1);
+    if (ANOMALY_SETTLE > p_metric->samples)
+    {
+        return;
+    }
+
+    rate  = (p_metric->rate >> ANOMALY_SHIFT);
+    drift = ((p_metric->ewma >> ANOMALY_SHIFT) - p_metric->value_base.mean);
+    if (true == p_metric->rate_base.valid)
+    {
+        spike = ((p_param->rate_floor + ANOMALY_SIGMA_K * p_metric->rate_base.sigma) < abs(rate));
+    }
+    if (true == p_metric->value_base.valid)
+    {
+        drifted = ((p_param->drift_floor + ANOMALY_SIGMA_K * p_metric->value_base.sigma) < abs(drift));
+    }
+    anomaly_Flag(p_state, metric, CLIMATE_ANOMALY_SPIKE, spike, now, rate);
+    anomaly_Flag(p_state, metric, CLIMATE_ANOMALY_DRIFT, drifted, now, drift);
+
+    if (false == spike)
+    {
+        anomaly_WelfordAdd(&p_metric->rates, p_metric->rate);
+    }
+    anomaly_WelfordAdd(&p_metric->values, scaled);
+    if (ANOMALY_BLOCK_SAMPLES <= p_metric->values.count)
+    {
+        anomaly_WelfordClose(&p_metric->values, &p_metric->value_base);
+    }
+    if (ANOMALY_BLOCK_SAMPLES <= p_metric->rates.count)
+    {
+        anomaly_WelfordClose(&p_metric->rates, &p_metric->rate_base);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void anomaly_Mist(anomaly_state_p p_state, time_t now, uint32_t dt, bool misting)
+{
+    anomaly_metric_p p_metric = &p_state->metrics[CLIMATE_ANOMALY_HUMIDITY];
+    int32_t          humidity = (p_metric->ewma >> ANOMALY_SHIFT);
+    bool             no_rise  = false;
+
+    if (true == misting)
+    {
+        if (0 == p_state->mist_elapsed)
+        {
+            p_state->mist_start = humidity;
+        }
+        p_state->mist_elapsed = MIN((p_state->mist_elapsed + dt), UINT32_MAX - dt);
+        no_rise = (ANOMALY_MIST_S <= p_state->mist_elapsed) &&
+                  (ANOMALY_MIST_RISE > (humidity - p_state->mist_start)) &&
+                  (ANOMALY_SATURATION > humidity);
+    }
+    else
+    {
+        p_state->mist_elapsed = 0;
+    }
+    anomaly_Flag(p_state, CLIMATE_ANOMALY_HUMIDITY, CLIMATE_ANOMALY_MIST_NO_RISE, no_rise, now, (humidity - p_state->mist_start));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void anomaly_Process(anomaly_state_p p_state, time_t now, uint32_t dt, const climate_anomaly_input_t * p_input)
+{
+    uint8_t metric = 0;
+
+    for (metric = 0; metric < CLIMATE_ANOMALY_METRICS; metric++)
+    {
+        anomaly_Metric(p_state, metric, now, dt, p_input->value[metric]);
+    }
+    anomaly_Mist(p_state, now, dt, p_input->misting);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint8_t anomaly_GetEvents(anomaly_state_p p_state, uint16_t since, climate_anomaly_event_p p_events, uint8_t max)
+{
+    climate_anomaly_event_p p_event = NULL;
+    uint8_t                 count   = 0;
+    uint8_t                 i       = 0;
+
+    /* The ring is walked from the oldest event, the sequence wraps */
+    for (i = 0; (i < CLIMATE_ANOMALY_EVENTS) && (count < max); i++)
+    {
+        p_event = &p_state->events[(p_state->head + i) % CLIMATE_ANOMALY_EVENTS];
+        if ((0 != p_event->sequence) && (0 < (int16_t)(p_event->sequence - since)))
+        {
+            p_events[count++] = *p_event;
+        }
+    }
+
+    return count;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Anomaly_Reset(void)
+{
+    memset(&gAnomaly, 0, sizeof(gAnomaly));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Anomaly_Process(time_t now, uint32_t dt, const climate_anomaly_input_t * p_input)
+{
+    anomaly_Process(&gAnomaly, now, dt, p_input);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint16_t Climate_Anomaly_GetSequence(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return gAnomaly.sequence;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t Climate_Anomaly_GetEvents(uint16_t since, climate_anomaly_event_p p_events, uint8_t max)
+{
+    /* This call is not thread safe but this is acceptable */
+    return anomaly_GetEvents(&gAnomaly, since, p_events, max);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef enum
+{
+    ANOMALY_TEST_NORMAL = 0,
+    ANOMALY_TEST_MIST_LOST,
+    ANOMALY_TEST_FAN_FAILED,
+} anomaly_test_fault_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t anomaly_TestNoise(uint32_t * p_seed, int32_t amplitude)
+{
+    *p_seed = (*p_seed * 1664525 + 1013904223);
+    return ((int32_t)((*p_seed >> 8) % (2 * amplitude + 1)) - amplitude);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The trace of the enclosure (10 s samples):                                                 */
+/*  - the temperature drifts slowly, the humidity follows the mist (2 of every 10 minutes);  */
+/*  - the lost mist does not raise the humidity since the fault;                             */
+/*  - the failed FAN lets the lights heat the enclosure by 0.9 C/min for 5 minutes.          */
+static void anomaly_TestTrace
+(
+    uint32_t                idx,
+    uint32_t *              p_seed,
+    anomaly_test_fault_t    fault,
+    uint32_t                fault_idx,
+    int32_t *               p_humidity,
+    climate_anomaly_input_p p_input
+)
+{
+    enum
+    {
+        PERIOD    = 60,
+        MIST      = 12,
+        RISE      = 40,
+        FALL      = 8,
+        HEAT      = 15,
+        HEAT_TIME = 30,
+    };
+    int32_t temperature = (2400 + (int32_t)(idx / 4));
+    bool    faulty      = (fault_idx <= idx);
+
+    p_input->misting = (MIST > (idx % PERIOD));
+    if (true == p_input->misting)
+    {
+        if ((ANOMALY_TEST_MIST_LOST != fault) || (false == faulty))
+        {
+            *p_humidity += RISE;
+        }
+    }
+    else
+    {
+        *p_humidity = MAX((*p_humidity - FALL), 6000);
+    }
+    if ((ANOMALY_TEST_FAN_FAILED == fault) && (true == faulty))
+    {
+        temperature += (HEAT * (int32_t)MIN((idx - fault_idx), HEAT_TIME));
+    }
+
+    p_input->value[CLIMATE_ANOMALY_TEMPERATURE] = (temperature + anomaly_TestNoise(p_seed, 5));
+    p_input->value[CLIMATE_ANOMALY_HUMIDITY]    = (*p_humidity + anomaly_TestNoise(p_seed, 30));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint8_t anomaly_TestReplay(anomaly_test_fault_t fault, uint32_t fault_idx, climate_anomaly_event_p p_events)
+{
+    enum
+    {
+        SAMPLES  = 1000,
+        SAMPLE_S = 10,
+        START    = 1700000000,
+    };
+    anomaly_state_t         state    = {0};
+    climate_anomaly_input_t input    = {0};
+    int32_t                 humidity = 6000;
+    uint32_t                seed     = 0x43;
+    uint32_t                idx      = 0;
+
+    for (idx = 0; idx < SAMPLES; idx++)
+    {
+        anomaly_TestTrace(idx, &seed, fault, fault_idx, &humidity, &input);
+        anomaly_Process(&state, (START + idx * SAMPLE_S), SAMPLE_S, &input);
+    }
+
+    return anomaly_GetEvents(&state, 0, p_events, CLIMATE_ANOMALY_EVENTS);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void anomaly_TestTraces(void)
+{
+    enum
+    {
+        /* After the baseline of the first hour */
+        FAULT_IDX = 800,
+    };
+    climate_anomaly_event_t events[CLIMATE_ANOMALY_EVENTS] = {0};
+    uint8_t                 count                          = 0;
+    uint8_t                 i                              = 0;
+    bool                    result                         = true;
+
+    /* The healthy enclosure is quiet */
+    count   = anomaly_TestReplay(ANOMALY_TEST_NORMAL, UINT32_MAX, events);
+    result &= (0 == count);
+    ANOMALY_LOGI("Anomaly Normal - events %u", count);
+
+    /* The lost mist is the only anomaly */
+    count   = anomaly_TestReplay(ANOMALY_TEST_MIST_LOST, FAULT_IDX, events);
+    result &= (0 < count);
+    for (i = 0; i < count; i++)
+    {
+        ANOMALY_LOGI("Anomaly Mist - metric %u - type %u - value %ld", events[i].metric, events[i].type, events[i].value);
+        result &= (CLIMATE_ANOMALY_HUMIDITY == events[i].metric);
+    }
+    result &= (0 < count) && (CLIMATE_ANOMALY_MIST_NO_RISE == events[0].type);
+
+    /* The failed FAN is seen as the temperature spike first, then as the drift */
+    count   = anomaly_TestReplay(ANOMALY_TEST_FAN_FAILED, FAULT_IDX, events);
+    result &= (2 == count);
+    for (i = 0; i < count; i++)
+    {
+        ANOMALY_LOGI("Anomaly FAN - metric %u - type %u - value %ld", events[i].metric, events[i].type, events[i].value);
+        result &= (CLIMATE_ANOMALY_TEMPERATURE == events[i].metric) && (0 < events[i].value);
+    }
+    result &= (2 == count) && (CLIMATE_ANOMALY_SPIKE == events[0].type) && (CLIMATE_ANOMALY_DRIFT == events[1].type);
+
+    ANOMALY_LOGI("Anomaly Traces - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void anomaly_TestEvents(void)
+{
+    anomaly_state_t         state                          = {0};
+    climate_anomaly_event_t events[CLIMATE_ANOMALY_EVENTS] = {0};
+    uint8_t                 idx                            = 0;
+    bool                    result                         = true;
+
+    /* The raised event is not repeated till the condition disappears */
+    anomaly_Flag(&state, CLIMATE_ANOMALY_TEMPERATURE, CLIMATE_ANOMALY_SPIKE, true, 1, 100);
+    anomaly_Flag(&state, CLIMATE_ANOMALY_TEMPERATURE, CLIMATE_ANOMALY_SPIKE, true, 2, 100);
+    result &= (1 == state.sequence);
+    anomaly_Flag(&state, CLIMATE_ANOMALY_TEMPERATURE, CLIMATE_ANOMALY_SPIKE, false, 3, 0);
+
+    /* The ring keeps the last events */
+    for (idx = 0; idx < 10; idx++)
+    {
+        anomaly_Flag(&state, CLIMATE_ANOMALY_HUMIDITY, CLIMATE_ANOMALY_DRIFT, true, idx, idx);
+        anomaly_Flag(&state, CLIMATE_ANOMALY_HUMIDITY, CLIMATE_ANOMALY_DRIFT, false, idx, idx);
+    }
+    result &= (11 == state.sequence);
+    result &= (CLIMATE_ANOMALY_EVENTS == anomaly_GetEvents(&state, 0, events, CLIMATE_ANOMALY_EVENTS));
+    result &= (4 == events[0].sequence) && (11 == events[CLIMATE_ANOMALY_EVENTS - 1].sequence);
+    result &= (1 == anomaly_GetEvents(&state, 10, events, CLIMATE_ANOMALY_EVENTS));
+    result &= (11 == events[0].sequence);
+    result &= (0 == anomaly_GetEvents(&state, 11, events, CLIMATE_ANOMALY_EVENTS));
+    result &= (2 == anomaly_GetEvents(&state, 0, events, 2));
+
+    /* The sequence wraps over 0 */
+    memset(&state, 0, sizeof(state));
+    state.sequence = (UINT16_MAX - 1);
+    for (idx = 0; idx < 3; idx++)
+    {
+        anomaly_Flag(&state, CLIMATE_ANOMALY_HUMIDITY, CLIMATE_ANOMALY_DRIFT, true, idx, idx);
+        anomaly_Flag(&state, CLIMATE_ANOMALY_HUMIDITY, CLIMATE_ANOMALY_DRIFT, false, idx, idx);
+    }
+    result &= (2 == state.sequence);
+    result &= (3 == anomaly_GetEvents(&state, (UINT16_MAX - 1), events, CLIMATE_ANOMALY_EVENTS));
+    result &= (UINT16_MAX == events[0].sequence) && (2 == events[2].sequence);
+
+    ANOMALY_LOGI("Anomaly Events - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Anomaly_Test(void)
+{
+    anomaly_TestTraces();
+    anomaly_TestEvents();
+}
+
+//-------------------------------------------------------------------------------------------------
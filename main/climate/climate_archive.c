@@ -0,0 +1,847 @@
+#include <string.h>
+#include <time.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+
+#include "types.h"
+#include "climate_archive.h"
+
+//-------------------------------------------------------------------------------------------------
+
+/* The archive is the log of the sectors used round robin (little endian):                 */
+/*                                                                                          */
+/* Sector - 16 blocks, the first one is the sector header:                                  */
+/*      0 :    4 : Magic "CLOG"                                                             */
+/*      4 :    4 : Sequence number, increased by every new sector                           */
+/*      8 :    4 : Reserved                                                                 */
+/*     12 :    4 : CRC32 of the header                                                      */
+/*                                                                                          */
+/* Block - 256 bytes (flash page), written once:                                            */
+/*      0 :    4 : Time of the first record                                                 */
+/*      4 :    1 : Records count                                                            */
+/*      5 :    3 : Reserved                                                                 */
+/*      8 :  240 : Records - Time offset (s), Temperature, Humidity, Pressure offset (Pa)   */
+/*    252 :    4 : CRC32 of the block                                                       */
+/*                                                                                          */
+/* The erased block is all 0xFF, the torn one (power loss) fails the CRC and is skipped.    */
+/* The newest sector has the highest sequence number, so the startup scan reads the sector  */
+/* headers and the blocks of the newest sector only.                                        */
+
+#define ARCHIVE_MAGIC              (0x474F4C43)
+#define ARCHIVE_PARTITION_SUBTYPE  (0x41)
+
+#define ARCH_LOG  0
+
+#if (1 == ARCH_LOG)
+static const char * gTAG = "ARCHIVE";
+#    define ARCH_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define ARCH_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define ARCH_LOGW(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define ARCH_LOGI(...)
+#    define ARCH_LOGE(...)
+#    define ARCH_LOGW(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    ARCHIVE_SECTOR_SIZE        = 4096,
+    ARCHIVE_BLOCK_SIZE         = 256,
+    ARCHIVE_BLOCKS             = (ARCHIVE_SECTOR_SIZE / ARCHIVE_BLOCK_SIZE),
+    ARCHIVE_SECTOR_HEADER_SIZE = 16,
+    ARCHIVE_BLOCK_HEADER_SIZE  = 8,
+    ARCHIVE_CRC_SIZE           = 4,
+    ARCHIVE_CRC_OFFSET         = (ARCHIVE_BLOCK_SIZE - ARCHIVE_CRC_SIZE),
+    ARCHIVE_RECORD_SIZE        = 8,
+    ARCHIVE_RECORDS            = ((ARCHIVE_CRC_OFFSET - ARCHIVE_BLOCK_HEADER_SIZE) / ARCHIVE_RECORD_SIZE),
+    ARCHIVE_PRESSURE_BASE      = 100000,
+    ARCHIVE_ERASED             = 0xFF,
+};
+
+typedef FW_RESULT (* archive_read_fp_t)(const void * p_ctx, uint32_t offset, void * p_dst, uint32_t size);
+typedef FW_RESULT (* archive_write_fp_t)(const void * p_ctx, uint32_t offset, const void * p_src, uint32_t size);
+typedef FW_RESULT (* archive_erase_fp_t)(const void * p_ctx, uint32_t offset, uint32_t size);
+
+typedef struct
+{
+    archive_read_fp_t  fp_read;
+    archive_write_fp_t fp_write;
+    archive_erase_fp_t fp_erase;
+} archive_flash_t;
+
+typedef struct
+{
+    const archive_flash_t * p_flash;
+    const void *            ctx;
+    uint32_t                sectors;
+    /* The newest sector, its sequence number (0 - the log is empty) and the next free block */
+    uint32_t                head;
+    uint32_t                seq;
+    uint8_t                 block;
+    /* The newest record time */
+    time_t                  last;
+    /* The block collecting the records */
+    time_t                  base;
+    uint8_t                 count;
+    uint8_t                 buffer[ARCHIVE_BLOCK_SIZE];
+} archive_t, * archive_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static archive_t gArchive = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t archive_GetU32(const uint8_t * p_data)
+{
+    return ((uint32_t)p_data[0] | ((uint32_t)p_data[1] << 8) |
+            ((uint32_t)p_data[2] << 16) | ((uint32_t)p_data[3] << 24));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint16_t archive_GetU16(const uint8_t * p_data)
+{
+    return (uint16_t)((uint32_t)p_data[0] | ((uint32_t)p_data[1] << 8));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void archive_PutU32(uint8_t * p_data, uint32_t value)
+{
+    p_data[0] = (uint8_t)(value);
+    p_data[1] = (uint8_t)(value >> 8);
+    p_data[2] = (uint8_t)(value >> 16);
+    p_data[3] = (uint8_t)(value >> 24);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void archive_PutU16(uint8_t * p_data, uint16_t value)
+{
+    p_data[0] = (uint8_t)(value);
+    p_data[1] = (uint8_t)(value >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_ReadPartition(const void * p_ctx, uint32_t offset, void * p_dst, uint32_t size)
+{
+    esp_err_t error = ESP_FAIL;
+
+    error = esp_partition_read((const esp_partition_t *)p_ctx, offset, p_dst, size);
+
+    return (ESP_OK == error) ? FW_SUCCESS : FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_WritePartition(const void * p_ctx, uint32_t offset, const void * p_src, uint32_t size)
+{
+    esp_err_t error = ESP_FAIL;
+
+    error = esp_partition_write((const esp_partition_t *)p_ctx, offset, p_src, size);
+
+    return (ESP_OK == error) ? FW_SUCCESS : FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_ErasePartition(const void * p_ctx, uint32_t offset, uint32_t size)
+{
+    esp_err_t error = ESP_FAIL;
+
+    error = esp_partition_erase_range((const esp_partition_t *)p_ctx, offset, size);
+
+    return (ESP_OK == error) ? FW_SUCCESS : FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static const archive_flash_t gcPartition =
+{
+    .fp_read  = archive_ReadPartition,
+    .fp_write = archive_WritePartition,
+    .fp_erase = archive_ErasePartition,
+};
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the sequence number of the valid sector, 0 - the sector is erased or corrupted */
+static uint32_t archive_ReadSectorSeq(archive_p p_arc, uint32_t sector)
+{
+    uint8_t   header[ARCHIVE_SECTOR_HEADER_SIZE] = {0};
+    FW_RESULT result                             = FW_ERROR;
+
+    result = p_arc->p_flash->fp_read(p_arc->ctx, (sector * ARCHIVE_SECTOR_SIZE), header, sizeof(header));
+    if ((FW_SUCCESS != result) ||
+        (ARCHIVE_MAGIC != archive_GetU32(&header[0])) ||
+        (esp_rom_crc32_le(0, header, 12) != archive_GetU32(&header[12])))
+    {
+        return 0;
+    }
+
+    return archive_GetU32(&header[4]);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool archive_IsErased(const uint8_t * p_data, uint32_t size)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < size; i++)
+    {
+        if (ARCHIVE_ERASED != p_data[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool archive_IsBlockValid(const uint8_t * p_block)
+{
+    return ((0 < p_block[4]) && (ARCHIVE_RECORDS >= p_block[4]) &&
+            (esp_rom_crc32_le(0, p_block, ARCHIVE_CRC_OFFSET) == archive_GetU32(&p_block[ARCHIVE_CRC_OFFSET])));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void archive_DecodeRecord(const uint8_t * p_block, uint8_t idx, climate_archive_record_p p_record)
+{
+    const uint8_t * p_data = &p_block[ARCHIVE_BLOCK_HEADER_SIZE + idx * ARCHIVE_RECORD_SIZE];
+
+    p_record->time        = ((time_t)archive_GetU32(&p_block[0]) + archive_GetU16(&p_data[0]));
+    p_record->temperature = (int16_t)archive_GetU16(&p_data[2]);
+    p_record->humidity    = archive_GetU16(&p_data[4]);
+    p_record->pressure    = (uint32_t)(ARCHIVE_PRESSURE_BASE + (int16_t)archive_GetU16(&p_data[6]));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void archive_ResetBuffer(archive_p p_arc)
+{
+    memset(p_arc->buffer, ARCHIVE_ERASED, sizeof(p_arc->buffer));
+    p_arc->count = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Scans the sector blocks, returns the first erased one and updates the newest record time */
+static uint8_t archive_ScanSector(archive_p p_arc, uint32_t sector)
+{
+    climate_archive_record_t record = {0};
+    uint8_t                  block  = 0;
+    uint32_t                 offset = 0;
+
+    for (block = 1; block < ARCHIVE_BLOCKS; block++)
+    {
+        offset = (sector * ARCHIVE_SECTOR_SIZE + block * ARCHIVE_BLOCK_SIZE);
+        if ((FW_SUCCESS != p_arc->p_flash->fp_read(p_arc->ctx, offset, p_arc->buffer, ARCHIVE_BLOCK_SIZE)) ||
+            (true == archive_IsErased(p_arc->buffer, ARCHIVE_BLOCK_SIZE)))
+        {
+            break;
+        }
+        /* The torn block is skipped, it is not written again till the sector is erased */
+        if (true == archive_IsBlockValid(p_arc->buffer))
+        {
+            archive_DecodeRecord(p_arc->buffer, (p_arc->buffer[4] - 1), &record);
+            p_arc->last = MAX(p_arc->last, record.time);
+        }
+    }
+
+    return block;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_Open(archive_p p_arc, const archive_flash_t * p_flash, const void * p_ctx, uint32_t sectors)
+{
+    uint32_t sector = 0;
+    uint32_t seq    = 0;
+
+    memset(p_arc, 0, sizeof(*p_arc));
+    p_arc->p_flash = p_flash;
+    p_arc->ctx     = p_ctx;
+    p_arc->sectors = sectors;
+    archive_ResetBuffer(p_arc);
+
+    if (2 > sectors)
+    {
+        return FW_ERROR;
+    }
+
+    /* The newest sector has the highest sequence number */
+    for (sector = 0; sector < sectors; sector++)
+    {
+        seq = archive_ReadSectorSeq(p_arc, sector);
+        if (seq > p_arc->seq)
+        {
+            p_arc->seq  = seq;
+            p_arc->head = sector;
+        }
+    }
+
+    if (0 < p_arc->seq)
+    {
+        p_arc->block = archive_ScanSector(p_arc, p_arc->head);
+        /* The newest sector can be just opened, the newest records are in the previous one */
+        if (1 == p_arc->block)
+        {
+            sector = ((p_arc->head + sectors - 1) % sectors);
+            if ((p_arc->seq - 1) == archive_ReadSectorSeq(p_arc, sector))
+            {
+                (void)archive_ScanSector(p_arc, sector);
+            }
+        }
+        archive_ResetBuffer(p_arc);
+    }
+
+    ARCH_LOGI("Sectors: %lu - Head: %lu - Seq: %lu - Block: %u", sectors, p_arc->head, p_arc->seq, p_arc->block);
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Erases the oldest sector and makes it the newest one */
+static FW_RESULT archive_OpenSector(archive_p p_arc)
+{
+    uint8_t   header[ARCHIVE_SECTOR_HEADER_SIZE] = {0};
+    uint32_t  sector                             = 0;
+    FW_RESULT result                             = FW_ERROR;
+
+    sector = (0 == p_arc->seq) ? 0 : ((p_arc->head + 1) % p_arc->sectors);
+
+    archive_PutU32(&header[0], ARCHIVE_MAGIC);
+    archive_PutU32(&header[4], (p_arc->seq + 1));
+    archive_PutU32(&header[12], esp_rom_crc32_le(0, header, 12));
+
+    result = p_arc->p_flash->fp_erase(p_arc->ctx, (sector * ARCHIVE_SECTOR_SIZE), ARCHIVE_SECTOR_SIZE);
+    if (FW_SUCCESS == result)
+    {
+        result = p_arc->p_flash->fp_write(p_arc->ctx, (sector * ARCHIVE_SECTOR_SIZE), header, sizeof(header));
+    }
+    if (FW_SUCCESS != result)
+    {
+        ARCH_LOGE("Sector %lu open error", sector);
+        return result;
+    }
+
+    p_arc->head  = sector;
+    p_arc->seq  += 1;
+    p_arc->block = 1;
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Writes the collected records, they are dropped on the error */
+static FW_RESULT archive_WriteBlock(archive_p p_arc)
+{
+    uint32_t  offset = 0;
+    FW_RESULT result = FW_SUCCESS;
+
+    if (0 == p_arc->count)
+    {
+        return FW_SUCCESS;
+    }
+
+    archive_PutU32(&p_arc->buffer[0], (uint32_t)p_arc->base);
+    p_arc->buffer[4] = p_arc->count;
+    p_arc->buffer[5] = 0;
+    p_arc->buffer[6] = 0;
+    p_arc->buffer[7] = 0;
+    archive_PutU32
+    (
+        &p_arc->buffer[ARCHIVE_CRC_OFFSET],
+        esp_rom_crc32_le(0, p_arc->buffer, ARCHIVE_CRC_OFFSET)
+    );
+
+    if ((0 == p_arc->seq) || (ARCHIVE_BLOCKS <= p_arc->block))
+    {
+        result = archive_OpenSector(p_arc);
+    }
+    if (FW_SUCCESS == result)
+    {
+        offset = (p_arc->head * ARCHIVE_SECTOR_SIZE + p_arc->block * ARCHIVE_BLOCK_SIZE);
+        result = p_arc->p_flash->fp_write(p_arc->ctx, offset, p_arc->buffer, ARCHIVE_BLOCK_SIZE);
+        /* The failed block can be partially written, so it is never used again */
+        p_arc->block++;
+    }
+    if (FW_SUCCESS != result)
+    {
+        ARCH_LOGE("Block write error - %u records are lost", p_arc->count);
+    }
+    archive_ResetBuffer(p_arc);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_Append(archive_p p_arc, const climate_archive_record_t * p_record)
+{
+    uint8_t * p_data   = NULL;
+    int32_t   pressure = 0;
+    FW_RESULT result   = FW_SUCCESS;
+
+    if ((0 == p_arc->sectors) || (p_record->time <= p_arc->last))
+    {
+        return FW_ERROR;
+    }
+
+    /* The time offset is 16 bits, the long gap starts the new block */
+    if ((0 < p_arc->count) && (UINT16_MAX < (p_record->time - p_arc->base)))
+    {
+        result = archive_WriteBlock(p_arc);
+    }
+    if (0 == p_arc->count)
+    {
+        p_arc->base = p_record->time;
+    }
+
+    pressure = ((int32_t)p_record->pressure - ARCHIVE_PRESSURE_BASE);
+    pressure = MIN(MAX(pressure, INT16_MIN), INT16_MAX);
+
+    p_data = &p_arc->buffer[ARCHIVE_BLOCK_HEADER_SIZE + p_arc->count * ARCHIVE_RECORD_SIZE];
+    archive_PutU16(&p_data[0], (uint16_t)(p_record->time - p_arc->base));
+    archive_PutU16(&p_data[2], (uint16_t)p_record->temperature);
+    archive_PutU16(&p_data[4], p_record->humidity);
+    archive_PutU16(&p_data[6], (uint16_t)(int16_t)pressure);
+    p_arc->count++;
+    p_arc->last = p_record->time;
+
+    if (ARCHIVE_RECORDS == p_arc->count)
+    {
+        result = archive_WriteBlock(p_arc);
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Visits the records from the oldest to the newest one, the collected ones are included. */
+/* The blocks older than the time are not decoded.                                       */
+static size_t archive_Replay(archive_p p_arc, time_t from, climate_archive_fp_t fp_record, void * p_ctx)
+{
+    uint8_t                  block[ARCHIVE_BLOCK_SIZE];
+    climate_archive_record_t record = {0};
+    uint32_t                 sector = 0;
+    uint32_t                 seq    = 0;
+    uint32_t                 offset = 0;
+    uint32_t                 i      = 0;
+    uint8_t                  b      = 0;
+    uint8_t                  r      = 0;
+    size_t                   result = 0;
+
+    for (i = 1; (0 < p_arc->seq) && (i <= p_arc->sectors); i++)
+    {
+        /* The oldest sector follows the newest one */
+        sector = ((p_arc->head + i) % p_arc->sectors);
+        seq    = archive_ReadSectorSeq(p_arc, sector);
+        if ((0 == seq) || (seq > p_arc->seq) || ((p_arc->seq - seq) >= p_arc->sectors))
+        {
+            continue;
+        }
+
+        for (b = 1; b < ARCHIVE_BLOCKS; b++)
+        {
+            offset = (sector * ARCHIVE_SECTOR_SIZE + b * ARCHIVE_BLOCK_SIZE);
+            if ((FW_SUCCESS != p_arc->p_flash->fp_read(p_arc->ctx, offset, block, sizeof(block))) ||
+                (true == archive_IsErased(block, sizeof(block))))
+            {
+                break;
+            }
+            if (false == archive_IsBlockValid(block))
+            {
+                continue;
+            }
+            archive_DecodeRecord(block, (block[4] - 1), &record);
+            if (record.time < from)
+            {
+                continue;
+            }
+            for (r = 0; r < block[4]; r++)
+            {
+                archive_DecodeRecord(block, r, &record);
+                if (record.time >= from)
+                {
+                    fp_record(&record, p_ctx);
+                    result++;
+                }
+            }
+        }
+    }
+
+    /* The records are not written yet */
+    archive_PutU32(&p_arc->buffer[0], (uint32_t)p_arc->base);
+    for (r = 0; r < p_arc->count; r++)
+    {
+        archive_DecodeRecord(p_arc->buffer, r, &record);
+        if (record.time >= from)
+        {
+            fp_record(&record, p_ctx);
+            result++;
+        }
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT Climate_Archive_Init(void)
+{
+    const esp_partition_t * p_part = NULL;
+
+    p_part = esp_partition_find_first
+             (
+                 ESP_PARTITION_TYPE_DATA,
+                 (esp_partition_subtype_t)ARCHIVE_PARTITION_SUBTYPE,
+                 "history"
+             );
+    if (NULL == p_part)
+    {
+        ARCH_LOGE("Partition is absent - the history is not kept");
+        memset(&gArchive, 0, sizeof(gArchive));
+        return FW_ERROR;
+    }
+
+    return archive_Open(&gArchive, &gcPartition, p_part, (p_part->size / ARCHIVE_SECTOR_SIZE));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The records are written by the blocks, so the last ones are lost on the power loss */
+FW_RESULT Climate_Archive_Append(const climate_archive_record_t * p_record)
+{
+    return archive_Append(&gArchive, p_record);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT Climate_Archive_Flush(void)
+{
+    return archive_WriteBlock(&gArchive);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Climate_Archive_Replay(time_t from, climate_archive_fp_t fp_record, void * p_ctx)
+{
+    return archive_Replay(&gArchive, from, fp_record, p_ctx);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The newest record time, 0 - the log is empty */
+time_t Climate_Archive_GetLast(void)
+{
+    return gArchive.last;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    ARCHIVE_TEST_SECTORS = 4,
+    ARCHIVE_TEST_START   = 1700000000,
+    ARCHIVE_TEST_PERIOD  = 60,
+};
+
+/* The RAM flash: the bits are only cleared by the writes, the power is cut when the write */
+/* budget is over - the write in progress is torn, the erase in progress is incomplete.    */
+typedef struct
+{
+    uint8_t * data;
+    int32_t   budget;
+    uint32_t  reads;
+    uint32_t  erases[ARCHIVE_TEST_SECTORS];
+} archive_test_flash_t, * archive_test_flash_p;
+
+typedef struct
+{
+    time_t   first;
+    time_t   last;
+    uint32_t count;
+    uint32_t holes;
+    bool     valid;
+} archive_test_replay_t, * archive_test_replay_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_Test_Read(const void * p_ctx, uint32_t offset, void * p_dst, uint32_t size)
+{
+    archive_test_flash_p p_flash = (archive_test_flash_p)p_ctx;
+
+    if ((offset + size) > (ARCHIVE_TEST_SECTORS * ARCHIVE_SECTOR_SIZE))
+    {
+        return FW_ERROR;
+    }
+    memcpy(p_dst, &p_flash->data[offset], size);
+    p_flash->reads++;
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_Test_Write(const void * p_ctx, uint32_t offset, const void * p_src, uint32_t size)
+{
+    archive_test_flash_p p_flash = (archive_test_flash_p)p_ctx;
+    const uint8_t *      p_data  = p_src;
+    uint32_t             length  = size;
+    uint32_t             i       = 0;
+
+    if ((offset + size) > (ARCHIVE_TEST_SECTORS * ARCHIVE_SECTOR_SIZE))
+    {
+        return FW_ERROR;
+    }
+    if (0 <= p_flash->budget)
+    {
+        length           = MIN(size, (uint32_t)p_flash->budget);
+        p_flash->budget -= length;
+    }
+    for (i = 0; i < length; i++)
+    {
+        p_flash->data[offset + i] &= p_data[i];
+    }
+
+    return (length == size) ? FW_SUCCESS : FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT archive_Test_Erase(const void * p_ctx, uint32_t offset, uint32_t size)
+{
+    archive_test_flash_p p_flash = (archive_test_flash_p)p_ctx;
+
+    if (0 == p_flash->budget)
+    {
+        /* The header survives, the blocks are half erased */
+        memset(&p_flash->data[offset + size / 2], ARCHIVE_ERASED, (size / 2));
+        return FW_ERROR;
+    }
+    memset(&p_flash->data[offset], ARCHIVE_ERASED, size);
+    p_flash->erases[offset / ARCHIVE_SECTOR_SIZE]++;
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static const archive_flash_t gcTestFlash =
+{
+    .fp_read  = archive_Test_Read,
+    .fp_write = archive_Test_Write,
+    .fp_erase = archive_Test_Erase,
+};
+
+//-------------------------------------------------------------------------------------------------
+
+/* The values are derived from the time, so every record can be verified */
+static void archive_Test_Record(uint32_t idx, climate_archive_record_p p_record)
+{
+    p_record->time        = (ARCHIVE_TEST_START + (time_t)idx * ARCHIVE_TEST_PERIOD);
+    p_record->temperature = (int16_t)(2000 + (idx % 700) - 350);
+    p_record->humidity    = (uint16_t)(5000 + (idx % 4000));
+    p_record->pressure    = (99000 + (idx % 2000));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void archive_Test_Visit(const climate_archive_record_t * p_record, void * p_ctx)
+{
+    archive_test_replay_p    p_replay = (archive_test_replay_p)p_ctx;
+    climate_archive_record_t expected = {0};
+    uint32_t                 idx      = ((p_record->time - ARCHIVE_TEST_START) / ARCHIVE_TEST_PERIOD);
+
+    archive_Test_Record(idx, &expected);
+    if (0 != memcmp(&expected, p_record, sizeof(expected)))
+    {
+        p_replay->valid = false;
+    }
+    if ((0 < p_replay->count) && (p_record->time <= p_replay->last))
+    {
+        p_replay->valid = false;
+    }
+    if ((0 < p_replay->count) && (p_record->time != (p_replay->last + ARCHIVE_TEST_PERIOD)))
+    {
+        p_replay->holes++;
+    }
+    if (0 == p_replay->count)
+    {
+        p_replay->first = p_record->time;
+    }
+    p_replay->last = p_record->time;
+    p_replay->count++;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static archive_test_replay_t archive_Test_Replay(archive_p p_arc, time_t from)
+{
+    archive_test_replay_t replay = {0};
+
+    replay.valid = true;
+    (void)archive_Replay(p_arc, from, archive_Test_Visit, &replay);
+
+    return replay;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Many times wrapped log: the newest records are kept, the sectors are worn evenly */
+static bool archive_Test_Wrap(archive_test_flash_p p_flash)
+{
+    enum
+    {
+        COUNT    = 10000,
+        CAPACITY = ((ARCHIVE_TEST_SECTORS - 1) * (ARCHIVE_BLOCKS - 1) * ARCHIVE_RECORDS),
+        WINDOW   = 100,
+    };
+    static archive_t         arc    = {0};
+    climate_archive_record_t record = {0};
+    archive_test_replay_t    replay = {0};
+    uint32_t                 idx    = 0;
+    uint32_t                 min    = UINT32_MAX;
+    uint32_t                 max    = 0;
+    bool                     result = true;
+
+    memset(p_flash->data, ARCHIVE_ERASED, (ARCHIVE_TEST_SECTORS * ARCHIVE_SECTOR_SIZE));
+    p_flash->budget = -1;
+    memset(p_flash->erases, 0, sizeof(p_flash->erases));
+
+    result &= (FW_SUCCESS == archive_Open(&arc, &gcTestFlash, p_flash, ARCHIVE_TEST_SECTORS));
+    for (idx = 0; idx < COUNT; idx++)
+    {
+        archive_Test_Record(idx, &record);
+        result &= (FW_SUCCESS == archive_Append(&arc, &record));
+    }
+    /* The time stepped back is rejected */
+    result &= (FW_ERROR == archive_Append(&arc, &record));
+
+    /* The collected records are replayed before the flush */
+    replay  = archive_Test_Replay(&arc, 0);
+    result &= ((true == replay.valid) && (0 == replay.holes) && (record.time == replay.last));
+    result &= (FW_SUCCESS == archive_WriteBlock(&arc));
+
+    /* The restart: only the headers and the newest sector are read */
+    p_flash->reads = 0;
+    result &= (FW_SUCCESS == archive_Open(&arc, &gcTestFlash, p_flash, ARCHIVE_TEST_SECTORS));
+    result &= (p_flash->reads <= (ARCHIVE_TEST_SECTORS + 2 * ARCHIVE_BLOCKS));
+    result &= (record.time == arc.last);
+
+    replay  = archive_Test_Replay(&arc, 0);
+    result &= ((true == replay.valid) && (0 == replay.holes) && (record.time == replay.last));
+    result &= ((CAPACITY <= replay.count) && (COUNT > replay.count));
+
+    for (idx = 0; idx < ARCHIVE_TEST_SECTORS; idx++)
+    {
+        min = MIN(min, p_flash->erases[idx]);
+        max = MAX(max, p_flash->erases[idx]);
+    }
+    result &= ((max - min) <= 1);
+    ARCH_LOGI("Records: %lu - Erases: %lu..%lu", (uint32_t)replay.count, min, max);
+
+    /* The window: the replay starts at its first record */
+    replay  = archive_Test_Replay(&arc, (record.time - WINDOW * ARCHIVE_TEST_PERIOD));
+    result &= ((true == replay.valid) && (0 == replay.holes) && (record.time == replay.last));
+    result &= (((WINDOW + 1) == replay.count) && ((record.time - WINDOW * ARCHIVE_TEST_PERIOD) == replay.first));
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The power is cut at every write step: the written blocks survive, the log can be continued */
+static bool archive_Test_PowerCut(archive_test_flash_p p_flash)
+{
+    enum
+    {
+        COUNT = 1000,
+        STEP  = 53,
+        CUTS  = (COUNT * ARCHIVE_RECORD_SIZE * 2),
+    };
+    static archive_t         arc     = {0};
+    climate_archive_record_t record  = {0};
+    archive_test_replay_t    replay  = {0};
+    time_t                   durable = 0;
+    int32_t                  cut     = 0;
+    uint32_t                 idx     = 0;
+    bool                     result  = true;
+
+    for (cut = 0; (cut < CUTS) && (true == result); cut += STEP)
+    {
+        memset(p_flash->data, ARCHIVE_ERASED, (ARCHIVE_TEST_SECTORS * ARCHIVE_SECTOR_SIZE));
+        p_flash->budget = -1;
+
+        /* The log is wrapped once, then the power is cut */
+        (void)archive_Open(&arc, &gcTestFlash, p_flash, ARCHIVE_TEST_SECTORS);
+        for (idx = 0; idx < (2 * COUNT); idx++)
+        {
+            if (COUNT == idx)
+            {
+                p_flash->budget = cut;
+            }
+            archive_Test_Record(idx, &record);
+            if ((FW_SUCCESS == archive_Append(&arc, &record)) && (0 == arc.count))
+            {
+                durable = record.time;
+            }
+            if ((0 == p_flash->budget) && (0 == arc.count))
+            {
+                break;
+            }
+        }
+
+        /* The restart: every written record is replayed */
+        p_flash->budget = -1;
+        result &= (FW_SUCCESS == archive_Open(&arc, &gcTestFlash, p_flash, ARCHIVE_TEST_SECTORS));
+        replay  = archive_Test_Replay(&arc, 0);
+        result &= ((true == replay.valid) && (0 == replay.holes) && (durable == replay.last));
+
+        /* The log is continued after the lost records */
+        for (idx = (idx + 1); idx < (2 * COUNT + ARCHIVE_RECORDS); idx++)
+        {
+            archive_Test_Record(idx, &record);
+            result &= (FW_SUCCESS == archive_Append(&arc, &record));
+        }
+        result &= (FW_SUCCESS == archive_WriteBlock(&arc));
+        result &= (FW_SUCCESS == archive_Open(&arc, &gcTestFlash, p_flash, ARCHIVE_TEST_SECTORS));
+        replay  = archive_Test_Replay(&arc, 0);
+        result &= ((true == replay.valid) && (1 >= replay.holes) && (record.time == replay.last));
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Archive_Test(void)
+{
+    static uint8_t       data[ARCHIVE_TEST_SECTORS * ARCHIVE_SECTOR_SIZE];
+    archive_test_flash_t flash = {data, -1, 0, {0}};
+
+    ARCH_LOGI("Climate Archive Wrap - %s", (true == archive_Test_Wrap(&flash)) ? "PASS" : "FAIL");
+    ARCH_LOGI("Climate Archive Power Cut - %s", (true == archive_Test_PowerCut(&flash)) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,488 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "climate_fusion.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define FUSION_LOG  0
+
+#if (1 == FUSION_LOG)
+static const char * gTAG = "FUSION";
+#    define FUSION_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define FUSION_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define FUSION_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define FUSION_LOGI(...)
+#    define FUSION_LOGE(...)
+#    define FUSION_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+/* Every sensor keeps the window of its readings. The reading far from the window median     */
+/* (more than 3 sigma estimated by MAD) is the outlier. The quantity is estimated by the     */
+/* random walk Kalman filter: every accepted reading updates it with the sensor noise scaled */
+/* by the sensor confidence. The step seen by both sensors is the real change, not outlier. */
+/* The filter is in the integer arithmetic (0.01 units).                                    */
+enum
+{
+    FUSION_WINDOW              = 7,
+    /* The threshold in sigmas */
+    FUSION_HAMPEL_K            = 3,
+    /* sigma = MAD * 1.4826 */
+    FUSION_MAD_SCALE           = 1483,
+    FUSION_MAD_DIVIDER         = 1000,
+    FUSION_CONFIDENCE_MAX      = 100,
+    FUSION_CONFIDENCE_MIN      = 10,
+    FUSION_CONFIDENCE_INITIAL  = 50,
+    FUSION_CONFIDENCE_HEALTHY  = 30,
+    FUSION_CONFIDENCE_ACCEPTED = 10,
+    FUSION_CONFIDENCE_REJECTED = 25,
+    /* The samples without the accepted readings (1 minute) */
+    FUSION_MISSES_MAX          = 6,
+    FUSION_GAIN_SHIFT          = 16,
+    FUSION_VARIANCE_MAX        = 100000000,
+};
+
+typedef struct
+{
+    /* The process noise per sample, (0.01)^2 */
+    uint32_t q;
+    /* The sensors noise, (0.01)^2 */
+    uint32_t r[CLIMATE_FUSION_SENSORS];
+    /* The minimal sigma of the Hampel filter, 0.01 */
+    int32_t  sigma_min;
+    /* The sensors agreement, 0.01 */
+    int32_t  agreement;
+} fusion_param_t;
+
+typedef struct
+{
+    int32_t window[FUSION_WINDOW];
+    uint8_t count;
+    uint8_t idx;
+    uint8_t confidence;
+} fusion_channel_t, * fusion_channel_p;
+
+typedef struct
+{
+    fusion_channel_t channels[CLIMATE_FUSION_SENSORS];
+    int32_t          estimate;
+    uint32_t         variance;
+    uint32_t         rejected;
+    uint8_t          misses;
+    bool             initialized;
+} fusion_quantity_t, * fusion_quantity_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static const fusion_param_t gcParams[CLIMATE_FUSION_QUANTITIES] =
+{
+    /* BME280: +/-1 C, +/-3 %, SHT41: +/-0.2 C, +/-1.8 % */
+    [CLIMATE_FUSION_TEMPERATURE] = {(10 * 10), {(30 * 30), (15 * 15)}, 10, 50},
+    [CLIMATE_FUSION_HUMIDITY]    = {(100 * 100), {(300 * 300), (150 * 150)}, 50, 300},
+};
+
+static fusion_quantity_t gQuantities[CLIMATE_FUSION_QUANTITIES] = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t fusion_Median(int32_t * p_values, uint8_t count)
+{
+    int32_t value = 0;
+    uint8_t i     = 0;
+    uint8_t j     = 0;
+
+    /* The insertion sort of the short window */
+    for (i = 1; i < count; i++)
+    {
+        value = p_values[i];
+        for (j = i; (0 < j) && (p_values[j - 1] > value); j--)
+        {
+            p_values[j] = p_values[j - 1];
+        }
+        p_values[j] = value;
+    }
+
+    return p_values[count / 2];
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Adds the reading to the window, returns false if it is the outlier */
+static bool fusion_Hampel(fusion_channel_p p_channel, int32_t value, int32_t sigma_min)
+{
+    int32_t sorted[FUSION_WINDOW];
+    int32_t median = 0;
+    int32_t sigma  = 0;
+    uint8_t count  = 0;
+    uint8_t i      = 0;
+
+    p_channel->window[p_channel->idx] = value;
+    p_channel->idx   = ((p_channel->idx + 1) % FUSION_WINDOW);
+    p_channel->count = MIN((p_channel->count + 1), FUSION_WINDOW);
+    count            = p_channel->count;
+
+    /* The median is not reliable yet */
+    if ((FUSION_WINDOW / 2) >= count)
+    {
+        return true;
+    }
+
+    memcpy(sorted, p_channel->window, (count * sizeof(sorted[0])));
+    median = fusion_Median(sorted, count);
+    for (i = 0; i < count; i++)
+    {
+        sorted[i] = abs(p_channel->window[i] - median);
+    }
+    sigma = (fusion_Median(sorted, count) * FUSION_MAD_SCALE / FUSION_MAD_DIVIDER);
+    sigma = MAX(sigma, sigma_min);
+
+    return ((FUSION_HAMPEL_K * sigma) >= abs(value - median));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fusion_Update(fusion_quantity_p p_quantity, int32_t value, uint32_t r)
+{
+    uint32_t gain = 0;
+
+    if (false == p_quantity->initialized)
+    {
+        p_quantity->estimate    = value;
+        p_quantity->variance    = r;
+        p_quantity->initialized = true;
+        return;
+    }
+
+    gain = (uint32_t)(((uint64_t)p_quantity->variance << FUSION_GAIN_SHIFT) / (p_quantity->variance + r));
+    p_quantity->estimate +=
+    (
+        (int32_t)((((int64_t)(value - p_quantity->estimate) * gain) + (1 << (FUSION_GAIN_SHIFT - 1))) >> FUSION_GAIN_SHIFT)
+    );
+    p_quantity->variance -= (uint32_t)(((uint64_t)p_quantity->variance * gain) >> FUSION_GAIN_SHIFT);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Fusion_Reset(void)
+{
+    uint8_t q = 0;
+    uint8_t s = 0;
+
+    memset(gQuantities, 0, sizeof(gQuantities));
+    for (q = 0; q < CLIMATE_FUSION_QUANTITIES; q++)
+    {
+        for (s = 0; s < CLIMATE_FUSION_SENSORS; s++)
+        {
+            gQuantities[q].channels[s].confidence = FUSION_CONFIDENCE_INITIAL;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int32_t Climate_Fusion_Process(climate_fusion_quantity_t quantity, const climate_fusion_input_t * p_input)
+{
+    const fusion_param_t * p_param    = &gcParams[quantity];
+    fusion_quantity_p      p_quantity = &gQuantities[quantity];
+    fusion_channel_p       p_channel  = NULL;
+    uint32_t               r          = 0;
+    bool                   inlier[CLIMATE_FUSION_SENSORS];
+    bool                   accepted   = false;
+    uint8_t                s          = 0;
+
+    p_quantity->variance = MIN((p_quantity->variance + p_param->q), FUSION_VARIANCE_MAX);
+
+    for (s = 0; s < CLIMATE_FUSION_SENSORS; s++)
+    {
+        inlier[s] = (true == p_input->valid[s]) &&
+                    (true == fusion_Hampel(&p_quantity->channels[s], p_input->value[s], p_param->sigma_min));
+    }
+    /* The step seen by both sensors is the real change, the estimate is restarted from it */
+    if ((true == p_input->valid[CLIMATE_FUSION_BME280]) && (true == p_input->valid[CLIMATE_FUSION_SHT41]) &&
+        ((false == inlier[CLIMATE_FUSION_BME280]) || (false == inlier[CLIMATE_FUSION_SHT41])) &&
+        (p_param->agreement >= abs(p_input->value[CLIMATE_FUSION_BME280] - p_input->value[CLIMATE_FUSION_SHT41])))
+    {
+        inlier[CLIMATE_FUSION_BME280] = true;
+        inlier[CLIMATE_FUSION_SHT41]  = true;
+        p_quantity->variance          = FUSION_VARIANCE_MAX;
+    }
+
+    for (s = 0; s < CLIMATE_FUSION_SENSORS; s++)
+    {
+        p_channel = &p_quantity->channels[s];
+        /* The excluded reading does not say anything about the sensor */
+        if (false == p_input->valid[s])
+        {
+            continue;
+        }
+        if (false == inlier[s])
+        {
+            FUSION_LOGV("Q%u S%u outlier: %ld", quantity, s, p_input->value[s]);
+            p_channel->confidence = (uint8_t)MAX(((int32_t)p_channel->confidence - FUSION_CONFIDENCE_REJECTED), 0);
+            p_quantity->rejected++;
+            continue;
+        }
+        p_channel->confidence = MIN((p_channel->confidence + FUSION_CONFIDENCE_ACCEPTED), FUSION_CONFIDENCE_MAX);
+
+        /* The less confident sensor is the noisier one */
+        r = (p_param->r[s] * FUSION_CONFIDENCE_MAX / MAX(p_channel->confidence, FUSION_CONFIDENCE_MIN));
+        fusion_Update(p_quantity, p_input->value[s], r);
+        accepted = true;
+    }
+
+    p_quantity->misses = (true == accepted) ? 0 : MIN((p_quantity->misses + 1), UINT8_MAX);
+
+    return p_quantity->estimate;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int32_t Climate_Fusion_Get(climate_fusion_quantity_t quantity)
+{
+    return gQuantities[quantity].estimate;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t Climate_Fusion_GetConfidence(climate_fusion_quantity_t quantity, climate_fusion_sensor_t sensor)
+{
+    return gQuantities[quantity].channels[sensor].confidence;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Every quantity is updated recently by the confident sensor */
+bool Climate_Fusion_IsHealthy(void)
+{
+    fusion_quantity_p p_quantity = NULL;
+    uint8_t           confidence = 0;
+    uint8_t           q          = 0;
+    uint8_t           s          = 0;
+
+    for (q = 0; q < CLIMATE_FUSION_QUANTITIES; q++)
+    {
+        p_quantity = &gQuantities[q];
+        confidence = 0;
+        for (s = 0; s < CLIMATE_FUSION_SENSORS; s++)
+        {
+            confidence = MAX(confidence, p_quantity->channels[s].confidence);
+        }
+        if ((false == p_quantity->initialized) ||
+            (FUSION_MISSES_MAX <= p_quantity->misses) ||
+            (FUSION_CONFIDENCE_HEALTHY > confidence))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    int32_t  truth[CLIMATE_FUSION_QUANTITIES];
+    climate_fusion_input_t input[CLIMATE_FUSION_QUANTITIES];
+} fusion_test_sample_t, * fusion_test_sample_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t fusion_TestNoise(uint32_t * p_seed, int32_t amplitude)
+{
+    *p_seed = (*p_seed * 1664525 + 1013904223);
+    return ((int32_t)((*p_seed >> 8) % (2 * amplitude + 1)) - amplitude);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The trace of the enclosure with the humidifier (10 s samples):                          */
+/*  - the temperature drifts slowly, the humidity follows the humidifier cycles (20 min);  */
+/*  - the mist hits the sensors now and then;                                              */
+/*  - the SHT41 is heated every 1000 s, its readings are excluded for 2 samples;           */
+/*  - the SHT41 is saturated for 1 minute.                                                 */
+static void fusion_TestTrace(uint32_t idx, uint32_t * p_seed, fusion_test_sample_p p_sample)
+{
+    enum
+    {
+        PERIOD = 120,
+    };
+    climate_fusion_input_p p_temp = &p_sample->input[CLIMATE_FUSION_TEMPERATURE];
+    climate_fusion_input_p p_hum  = &p_sample->input[CLIMATE_FUSION_HUMIDITY];
+    int32_t                phase  = (idx % PERIOD);
+    int32_t                hum    = 0;
+
+    hum = (6000 + ((phase < (PERIOD / 2)) ? (phase * 20) : ((PERIOD - phase) * 20)));
+
+    p_sample->truth[CLIMATE_FUSION_TEMPERATURE] = (2400 + (int32_t)(idx / 4));
+    p_sample->truth[CLIMATE_FUSION_HUMIDITY]    = hum;
+
+    p_temp->value[CLIMATE_FUSION_BME280] = (p_sample->truth[0] + fusion_TestNoise(p_seed, 15));
+    p_temp->value[CLIMATE_FUSION_SHT41]  = (p_sample->truth[0] + fusion_TestNoise(p_seed, 5));
+    p_hum->value[CLIMATE_FUSION_BME280]  = (hum + fusion_TestNoise(p_seed, 80));
+    p_hum->value[CLIMATE_FUSION_SHT41]   = (hum + fusion_TestNoise(p_seed, 30));
+    p_temp->valid[CLIMATE_FUSION_BME280] = true;
+    p_temp->valid[CLIMATE_FUSION_SHT41]  = true;
+    p_hum->valid[CLIMATE_FUSION_BME280]  = true;
+    p_hum->valid[CLIMATE_FUSION_SHT41]   = true;
+
+    /* The mist */
+    if (5 == (idx % 37))
+    {
+        p_hum->value[CLIMATE_FUSION_SHT41]  += 1500;
+        p_temp->value[CLIMATE_FUSION_SHT41] -= 150;
+    }
+    if (7 == (idx % 53))
+    {
+        p_hum->value[CLIMATE_FUSION_BME280] += 2000;
+    }
+    /* The heater */
+    if (50 == (idx % 100))
+    {
+        p_temp->value[CLIMATE_FUSION_SHT41] += 1000;
+        p_hum->value[CLIMATE_FUSION_SHT41]  -= 2500;
+    }
+    if ((50 == (idx % 100)) || (51 == (idx % 100)))
+    {
+        p_temp->valid[CLIMATE_FUSION_SHT41] = false;
+        p_hum->valid[CLIMATE_FUSION_SHT41]  = false;
+    }
+    /* The saturation */
+    if ((200 <= idx) && (206 > idx))
+    {
+        p_hum->value[CLIMATE_FUSION_SHT41] = 10000;
+        p_hum->valid[CLIMATE_FUSION_SHT41] = false;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fusion_TestReplay(void)
+{
+    enum
+    {
+        SAMPLES     = 720,
+        /* The filter is not settled yet */
+        SETTLING    = 10,
+        T_ERROR_MAX = 20,
+        H_ERROR_MAX = 150,
+    };
+    fusion_test_sample_t sample                               = {0};
+    int32_t              error[CLIMATE_FUSION_QUANTITIES]     = {0};
+    int32_t              average[CLIMATE_FUSION_QUANTITIES]   = {0};
+    int32_t              value                                = 0;
+    uint32_t             seed                                 = 0x41;
+    uint32_t             idx                                  = 0;
+    uint8_t              q                                    = 0;
+    bool                 healthy                              = true;
+    bool                 result                               = true;
+
+    Climate_Fusion_Reset();
+    for (idx = 0; idx < SAMPLES; idx++)
+    {
+        fusion_TestTrace(idx, &seed, &sample);
+        for (q = 0; q < CLIMATE_FUSION_QUANTITIES; q++)
+        {
+            value = Climate_Fusion_Process(q, &sample.input[q]);
+            if (SETTLING <= idx)
+            {
+                error[q]   = MAX(error[q], abs(value - sample.truth[q]));
+                /* The plain average of the sensors for the comparison */
+                value      = ((sample.input[q].value[0] + sample.input[q].value[1]) / 2);
+                average[q] = MAX(average[q], abs(value - sample.truth[q]));
+            }
+        }
+        healthy &= ((SETTLING > idx) || (true == Climate_Fusion_IsHealthy()));
+    }
+
+    result &= (true == healthy);
+    result &= (T_ERROR_MAX >= error[CLIMATE_FUSION_TEMPERATURE]);
+    result &= (H_ERROR_MAX >= error[CLIMATE_FUSION_HUMIDITY]);
+    result &= (0 < gQuantities[CLIMATE_FUSION_HUMIDITY].rejected);
+    FUSION_LOGI
+    (
+        "Fusion Replay - T error %ld (average %ld) - H error %ld (average %ld) - rejected %lu - %s",
+        error[CLIMATE_FUSION_TEMPERATURE],
+        average[CLIMATE_FUSION_TEMPERATURE],
+        error[CLIMATE_FUSION_HUMIDITY],
+        average[CLIMATE_FUSION_HUMIDITY],
+        gQuantities[CLIMATE_FUSION_HUMIDITY].rejected,
+        (true == result) ? "PASS" : "FAIL"
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fusion_TestHealth(void)
+{
+    enum
+    {
+        STEP      = 1500,
+        SETTLED   = 3,
+        ERROR_MAX = 100,
+    };
+    climate_fusion_input_t input  = {{6000, 6000}, {true, true}};
+    uint8_t                idx    = 0;
+    bool                   result = true;
+
+    Climate_Fusion_Reset();
+    result &= (false == Climate_Fusion_IsHealthy());
+    for (idx = 0; idx < 20; idx++)
+    {
+        (void)Climate_Fusion_Process(CLIMATE_FUSION_TEMPERATURE, &input);
+        (void)Climate_Fusion_Process(CLIMATE_FUSION_HUMIDITY, &input);
+    }
+    result &= (true == Climate_Fusion_IsHealthy());
+    result &= (6000 == Climate_Fusion_Get(CLIMATE_FUSION_HUMIDITY));
+
+    /* The real step is seen by both sensors, it is followed at once */
+    input.value[0] += STEP;
+    input.value[1] += STEP;
+    for (idx = 0; idx < SETTLED; idx++)
+    {
+        (void)Climate_Fusion_Process(CLIMATE_FUSION_HUMIDITY, &input);
+    }
+    result &= (ERROR_MAX >= abs(Climate_Fusion_Get(CLIMATE_FUSION_HUMIDITY) - input.value[0]));
+
+    /* Both sensors are excluded: the estimate is kept, the health is lost */
+    input.valid[0] = false;
+    input.valid[1] = false;
+    for (idx = 0; idx < FUSION_MISSES_MAX; idx++)
+    {
+        (void)Climate_Fusion_Process(CLIMATE_FUSION_HUMIDITY, &input);
+    }
+    result &= (false == Climate_Fusion_IsHealthy());
+    input.valid[0] = true;
+    (void)Climate_Fusion_Process(CLIMATE_FUSION_HUMIDITY, &input);
+    result &= (true == Climate_Fusion_IsHealthy());
+
+    /* The sensor stuck at the wrong value loses the confidence */
+    for (idx = 0; idx < 3; idx++)
+    {
+        input.value[0] = ((0 == (idx % 2)) ? 0 : 10000);
+        (void)Climate_Fusion_Process(CLIMATE_FUSION_HUMIDITY, &input);
+    }
+    result &= (FUSION_CONFIDENCE_HEALTHY > Climate_Fusion_GetConfidence(CLIMATE_FUSION_HUMIDITY, CLIMATE_FUSION_BME280));
+    FUSION_LOGI("Fusion Health - %s", (true == result) ? "PASS" : "FAIL");
+
+    Climate_Fusion_Reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Fusion_Test(void)
+{
+    fusion_TestReplay();
+    fusion_TestHealth();
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,664 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "types.h"
+#include "climate_history.h"
+#include "bench.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define HIST_LOG  0
+
+#if (1 == HIST_LOG)
+static const char * gTAG = "HISTORY";
+#    define HIST_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define HIST_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define HIST_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define HIST_LOGI(...)
+#    define HIST_LOGE(...)
+#    define HIST_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+/* Every level is the ring of the buckets aligned to its period. The latest bucket is updated */
+/* in place by every sample, the ring advances when the sample opens the next period, so the */
+/* append is O(1). The skipped periods (no samples) are marked empty.                        */
+/* The values are packed to 16 bits: the pressure is the delta from the base.                */
+/* The CO2 and the light are kept by the raw level only.                                     */
+/* The days of the 20 minutes level are set by menuconfig, the minute and the 20 minutes     */
+/* levels are allocated once, in PSRAM when it is present.                                   */
+enum
+{
+    HIST_RAW_PERIOD_S    = 10,
+    HIST_RAW_COUNT       = (60 * 60 / HIST_RAW_PERIOD_S),
+    HIST_MINUTE_PERIOD_S = 60,
+    HIST_MINUTE_COUNT    = (24 * 60 * 60 / HIST_MINUTE_PERIOD_S),
+    HIST_LONG_PERIOD_S   = (20 * 60),
+    HIST_LONG_COUNT      = (CONFIG_CLIMATE_HISTORY_DAYS * 24 * 60 * 60 / HIST_LONG_PERIOD_S),
+    /* Pa */
+    HIST_PRESSURE_BASE   = 100000,
+    /* 2 lx */
+    HIST_LIGHT_SCALE     = 2,
+    HIST_EMPTY           = INT16_MIN,
+};
+
+enum
+{
+    HIST_CHANNEL_TEMPERATURE = 0,
+    HIST_CHANNEL_HUMIDITY,
+    HIST_CHANNEL_PRESSURE,
+    HIST_CHANNEL_CO2,
+    HIST_CHANNEL_LIGHT,
+    HIST_CHANNELS,
+    /* The channels of the buckets */
+    HIST_CHANNELS_CLIMATE = HIST_CHANNEL_CO2,
+};
+
+enum
+{
+    HIST_STAT_MEAN = 0,
+    HIST_STAT_MIN,
+    HIST_STAT_MAX,
+    HIST_STATS,
+};
+
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    int32_t  sum[HIST_CHANNELS];
+    int32_t  min[HIST_CHANNELS];
+    int32_t  max[HIST_CHANNELS];
+    uint32_t count;
+} hist_accumulator_t;
+
+typedef struct
+{
+    /* [capacity][channels][stats] */
+    int16_t *          p_data;
+    uint32_t           period;
+    uint16_t           capacity;
+    uint8_t            channels;
+    uint8_t            stats;
+    /* The latest bucket */
+    uint16_t           head;
+    uint16_t           count;
+    /* The start of the latest bucket */
+    time_t             last;
+    hist_accumulator_t acc;
+} hist_level_t, * hist_level_p;
+
+//-------------------------------------------------------------------------------------------------
+
+/* The raw samples are single, only their values are stored */
+static int16_t gRaw[HIST_RAW_COUNT][HIST_CHANNELS];
+
+/* The minute and the 20 minutes buckets are allocated by the init, the level without */
+/* the memory keeps nothing                                                            */
+static hist_level_t gLevels[CLIMATE_HISTORY_LEVELS] =
+{
+    [CLIMATE_HISTORY_LEVEL_RAW]    = {&gRaw[0][0], HIST_RAW_PERIOD_S,    HIST_RAW_COUNT,    HIST_CHANNELS,         1},
+    [CLIMATE_HISTORY_LEVEL_MINUTE] = {NULL,        HIST_MINUTE_PERIOD_S, HIST_MINUTE_COUNT, HIST_CHANNELS_CLIMATE, HIST_STATS},
+    [CLIMATE_HISTORY_LEVEL_LONG]   = {NULL,        HIST_LONG_PERIOD_S,   HIST_LONG_COUNT,   HIST_CHANNELS_CLIMATE, HIST_STATS},
+};
+
+static SemaphoreHandle_t gHistoryMutex = NULL;
+
+//-------------------------------------------------------------------------------------------------
+
+static int16_t hist_Pack(uint8_t channel, int32_t value)
+{
+    if (HIST_CHANNEL_PRESSURE == channel)
+    {
+        value -= HIST_PRESSURE_BASE;
+    }
+    if (HIST_CHANNEL_LIGHT == channel)
+    {
+        value /= HIST_LIGHT_SCALE;
+    }
+    /* The minimal value is the empty bucket marker */
+    return (int16_t)MIN(MAX(value, (HIST_EMPTY + 1)), INT16_MAX);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t hist_Unpack(uint8_t channel, int16_t value)
+{
+    if (HIST_CHANNEL_PRESSURE == channel)
+    {
+        return (value + HIST_PRESSURE_BASE);
+    }
+    if (HIST_CHANNEL_LIGHT == channel)
+    {
+        return (value * HIST_LIGHT_SCALE);
+    }
+
+    return value;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int16_t * hist_Bucket(hist_level_p p_level, uint16_t idx)
+{
+    return &p_level->p_data[(uint32_t)idx * p_level->channels * p_level->stats];
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void hist_MarkEmpty(hist_level_p p_level, uint16_t idx)
+{
+    int16_t * p_bucket = hist_Bucket(p_level, idx);
+    uint8_t   i        = 0;
+
+    for (i = 0; i < (p_level->channels * p_level->stats); i++)
+    {
+        p_bucket[i] = HIST_EMPTY;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Moves the head to the bucket of the sample, returns false if the sample is outdated */
+static bool hist_Advance(hist_level_p p_level, time_t start)
+{
+    uint32_t gap = 0;
+
+    if ((0 < p_level->count) && (start == p_level->last))
+    {
+        return true;
+    }
+    /* The time was stepped back: the samples are skipped till the latest bucket is over */
+    if ((0 < p_level->count) && (start < p_level->last))
+    {
+        return false;
+    }
+
+    gap = (0 < p_level->count) ? ((start - p_level->last) / p_level->period) : p_level->capacity;
+    if (p_level->capacity <= gap)
+    {
+        /* The whole ring is outdated */
+        p_level->head  = 0;
+        p_level->count = 1;
+    }
+    else
+    {
+        /* Only the long absence of the samples makes the gap */
+        while (1 < gap--)
+        {
+            p_level->head = ((p_level->head + 1) % p_level->capacity);
+            hist_MarkEmpty(p_level, p_level->head);
+            p_level->count = MIN((p_level->count + 1), p_level->capacity);
+        }
+        p_level->head  = ((p_level->head + 1) % p_level->capacity);
+        p_level->count = MIN((p_level->count + 1), p_level->capacity);
+    }
+    p_level->last = start;
+    memset(&p_level->acc, 0, sizeof(p_level->acc));
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void hist_Accumulate(hist_level_p p_level, const int32_t * p_values)
+{
+    int16_t * p_bucket = hist_Bucket(p_level, p_level->head);
+    uint8_t   c        = 0;
+
+    p_level->acc.count++;
+    for (c = 0; c < p_level->channels; c++)
+    {
+        if (1 == p_level->acc.count)
+        {
+            p_level->acc.min[c] = p_values[c];
+            p_level->acc.max[c] = p_values[c];
+        }
+        p_level->acc.sum[c] += p_values[c];
+        p_level->acc.min[c]  = MIN(p_level->acc.min[c], p_values[c]);
+        p_level->acc.max[c]  = MAX(p_level->acc.max[c], p_values[c]);
+
+        /* The latest bucket is always up to date */
+        p_bucket[c * p_level->stats + HIST_STAT_MEAN] =
+        (
+            hist_Pack(c, (p_level->acc.sum[c] / (int32_t)p_level->acc.count))
+        );
+        if (HIST_STATS == p_level->stats)
+        {
+            p_bucket[c * p_level->stats + HIST_STAT_MIN] = hist_Pack(c, p_level->acc.min[c]);
+            p_bucket[c * p_level->stats + HIST_STAT_MAX] = hist_Pack(c, p_level->acc.max[c]);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void hist_UnpackStat(hist_level_p p_level, int16_t * p_bucket, uint8_t c, climate_history_stat_t * p_stat)
+{
+    uint8_t stats = p_level->stats;
+
+    /* The channel is not kept by the level */
+    if (p_level->channels <= c)
+    {
+        memset(p_stat, 0, sizeof(climate_history_stat_t));
+        return;
+    }
+
+    p_stat->mean = hist_Unpack(c, p_bucket[c * stats + HIST_STAT_MEAN]);
+    p_stat->min  = p_stat->mean;
+    p_stat->max  = p_stat->mean;
+    if (HIST_STATS == stats)
+    {
+        p_stat->min = hist_Unpack(c, p_bucket[c * stats + HIST_STAT_MIN]);
+        p_stat->max = hist_Unpack(c, p_bucket[c * stats + HIST_STAT_MAX]);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static size_t hist_GetSize(hist_level_p p_level)
+{
+    return ((size_t)p_level->capacity * p_level->channels * p_level->stats * sizeof(int16_t));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* PSRAM first, the internal heap otherwise */
+static void hist_Alloc(hist_level_p p_level)
+{
+    if (NULL != p_level->p_data)
+    {
+        return;
+    }
+
+    p_level->p_data = heap_caps_calloc_prefer
+    (
+        1,
+        hist_GetSize(p_level),
+        2,
+        (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT),
+        MALLOC_CAP_8BIT
+    );
+    if (NULL == p_level->p_data)
+    {
+        HIST_LOGE("Allocation of %u bytes failed", hist_GetSize(p_level));
+        p_level->capacity = 0;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_History_Init(void)
+{
+    uint8_t l = 0;
+
+    if (NULL == gHistoryMutex)
+    {
+        gHistoryMutex = xSemaphoreCreateMutex();
+        hist_Alloc(&gLevels[CLIMATE_HISTORY_LEVEL_MINUTE]);
+        hist_Alloc(&gLevels[CLIMATE_HISTORY_LEVEL_LONG]);
+    }
+
+    (void)xSemaphoreTake(gHistoryMutex, portMAX_DELAY);
+    for (l = 0; l < CLIMATE_HISTORY_LEVELS; l++)
+    {
+        gLevels[l].head  = 0;
+        gLevels[l].count = 0;
+        gLevels[l].last  = 0;
+        memset(&gLevels[l].acc, 0, sizeof(gLevels[l].acc));
+    }
+    (void)xSemaphoreGive(gHistoryMutex);
+
+    HIST_LOGI("Footprint: %u bytes - free heap %u", Climate_History_GetFootprint(), esp_get_free_heap_size());
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_History_Append(time_t t, int16_t temperature, uint16_t humidity, uint32_t pressure, uint16_t co2, uint32_t light)
+{
+    int32_t values[HIST_CHANNELS] =
+    {
+        [HIST_CHANNEL_TEMPERATURE] = temperature,
+        [HIST_CHANNEL_HUMIDITY]    = humidity,
+        [HIST_CHANNEL_PRESSURE]    = (int32_t)pressure,
+        [HIST_CHANNEL_CO2]         = co2,
+        [HIST_CHANNEL_LIGHT]       = (int32_t)light,
+    };
+    uint8_t l = 0;
+
+    (void)xSemaphoreTake(gHistoryMutex, portMAX_DELAY);
+    for (l = 0; l < CLIMATE_HISTORY_LEVELS; l++)
+    {
+        if (0 == gLevels[l].capacity)
+        {
+            continue;
+        }
+        if (true == hist_Advance(&gLevels[l], (t - (t % gLevels[l].period))))
+        {
+            hist_Accumulate(&gLevels[l], values);
+        }
+    }
+    (void)xSemaphoreGive(gHistoryMutex);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the finest level which keeps the time */
+climate_history_level_t Climate_History_GetLevel(time_t from)
+{
+    climate_history_level_t result = CLIMATE_HISTORY_LEVEL_RAW;
+    time_t                  oldest = 0;
+
+    for (result = CLIMATE_HISTORY_LEVEL_RAW; result < CLIMATE_HISTORY_LEVEL_LONG; result++)
+    {
+        oldest = (gLevels[result].last - (time_t)(gLevels[result].capacity - 1) * gLevels[result].period);
+        if (from >= oldest)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t Climate_History_GetPeriod(climate_history_level_t level)
+{
+    return gLevels[level].period;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The time kept by the full level */
+uint32_t Climate_History_GetSpan(climate_history_level_t level)
+{
+    return (gLevels[level].period * gLevels[level].capacity);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Copies the non-empty buckets overlapping the range in the chronological order */
+size_t Climate_History_Query(climate_history_level_t level, time_t from, time_t to, climate_history_point_p p_points, size_t count)
+{
+    hist_level_p p_level  = &gLevels[level];
+    int16_t *    p_bucket = NULL;
+    time_t       oldest   = 0;
+    time_t       start    = 0;
+    uint32_t     skip     = 0;
+    uint32_t     i        = 0;
+    uint16_t     idx      = 0;
+    size_t       result   = 0;
+
+    (void)xSemaphoreTake(gHistoryMutex, portMAX_DELAY);
+
+    oldest = (p_level->last - (time_t)(p_level->count - 1) * p_level->period);
+    if (from > oldest)
+    {
+        skip = ((from - oldest) / p_level->period);
+    }
+
+    for (i = skip; (i < p_level->count) && (result < count); i++)
+    {
+        start = (oldest + (time_t)i * p_level->period);
+        if (start >= to)
+        {
+            break;
+        }
+        idx      = ((p_level->head + p_level->capacity - (p_level->count - 1) + i) % p_level->capacity);
+        p_bucket = hist_Bucket(p_level, idx);
+        if (HIST_EMPTY == p_bucket[HIST_STAT_MEAN])
+        {
+            continue;
+        }
+        p_points[result].time = start;
+        hist_UnpackStat(p_level, p_bucket, HIST_CHANNEL_TEMPERATURE, &p_points[result].temperature);
+        hist_UnpackStat(p_level, p_bucket, HIST_CHANNEL_HUMIDITY, &p_points[result].humidity);
+        hist_UnpackStat(p_level, p_bucket, HIST_CHANNEL_PRESSURE, &p_points[result].pressure);
+        hist_UnpackStat(p_level, p_bucket, HIST_CHANNEL_CO2, &p_points[result].co2);
+        hist_UnpackStat(p_level, p_bucket, HIST_CHANNEL_LIGHT, &p_points[result].light);
+        result++;
+    }
+
+    (void)xSemaphoreGive(gHistoryMutex);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Climate_History_GetFootprint(void)
+{
+    return
+    (
+        hist_GetSize(&gLevels[CLIMATE_HISTORY_LEVEL_RAW]) +
+        hist_GetSize(&gLevels[CLIMATE_HISTORY_LEVEL_MINUTE]) +
+        hist_GetSize(&gLevels[CLIMATE_HISTORY_LEVEL_LONG]) +
+        sizeof(gLevels)
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+#define CHECK_STAT(s,a,b,c) ((a == s.mean) && (b == s.min) && (c == s.max))
+
+//-------------------------------------------------------------------------------------------------
+
+/* The temperature changes within the minute, the humidity within 20 minutes, the pressure */
+/* within 20 minutes too and below the base                                                */
+static void hist_TestAppend(time_t t0, uint32_t from, uint32_t to)
+{
+    uint32_t i = 0;
+
+    for (i = from; i < to; i++)
+    {
+        Climate_History_Append
+        (
+            (t0 + (time_t)i * HIST_RAW_PERIOD_S),
+            (2000 + (i % 6) * 10),
+            (5000 + (i / 6 % 20) * 10),
+            (99950 + (i % 120)),
+            (400 + (i % 6)),
+            (40000 + (i % 6) * 2)
+        );
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Counts the points by the chunks, returns the latest one */
+static size_t hist_TestCount(climate_history_level_t level, time_t from, time_t to, climate_history_point_p p_last)
+{
+    enum
+    {
+        CHUNK = 16,
+    };
+    climate_history_point_t points[CHUNK];
+    size_t                  count  = 0;
+    size_t                  result = 0;
+
+    do
+    {
+        count   = Climate_History_Query(level, from, to, points, CHUNK);
+        result += count;
+        if (0 < count)
+        {
+            *p_last = points[count - 1];
+            from    = (points[count - 1].time + (time_t)Climate_History_GetPeriod(level));
+        }
+    } while (CHUNK == count);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_History_Test(void)
+{
+    enum
+    {
+        DAY_S = (24 * 60 * 60),
+        DAYS  = 31,
+    };
+    /* Aligned to 20 minutes */
+    const time_t                   t0      = 1699999200;
+    climate_history_point_t        points[2];
+    climate_history_point_t        last    = {0};
+    uint32_t                       samples = (DAYS * DAY_S / HIST_RAW_PERIOD_S);
+    time_t                         now     = (t0 + (time_t)(samples - 1) * HIST_RAW_PERIOD_S);
+    time_t                         end     = (now + HIST_RAW_PERIOD_S);
+    size_t                         count   = 0;
+    bool                           result  = true;
+
+    HIST_LOGI
+    (
+        "Footprint: %u bytes - raw %u - minute %u - 20 minutes %u",
+        Climate_History_GetFootprint(),
+        hist_GetSize(&gLevels[CLIMATE_HISTORY_LEVEL_RAW]),
+        hist_GetSize(&gLevels[CLIMATE_HISTORY_LEVEL_MINUTE]),
+        hist_GetSize(&gLevels[CLIMATE_HISTORY_LEVEL_LONG])
+    );
+
+    Climate_History_Init();
+    hist_TestAppend(t0, 0, samples);
+
+    /* The raw samples of the last hour */
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_RAW, 0, (now + 1), &last);
+    result &= (HIST_RAW_COUNT == count);
+    result &= (now == last.time);
+    result &= CHECK_STAT(last.temperature, 2050, 2050, 2050);
+    result &= CHECK_STAT(last.pressure, 100069, 100069, 100069);
+    result &= CHECK_STAT(last.co2, 405, 405, 405);
+    result &= CHECK_STAT(last.light, 40010, 40010, 40010);
+    count   = Climate_History_Query(CLIMATE_HISTORY_LEVEL_RAW, 0, (now + 1), points, 1);
+    result &= ((now - (HIST_RAW_COUNT - 1) * HIST_RAW_PERIOD_S) == points[0].time);
+
+    /* The minutes of the last day */
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_MINUTE, 0, (now + 1), &last);
+    result &= (HIST_MINUTE_COUNT == count);
+    count   = Climate_History_Query(CLIMATE_HISTORY_LEVEL_MINUTE, 0, (now + 1), points, 1);
+    result &= CHECK_STAT(points[0].temperature, 2025, 2000, 2050);
+    result &= CHECK_STAT(points[0].humidity, points[0].humidity.mean, points[0].humidity.mean, points[0].humidity.mean);
+    result &= CHECK_STAT(points[0].co2, 0, 0, 0);
+
+    /* The 20 minutes of the last days, the oldest ones are overwritten */
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_LONG, 0, (now + 1), &last);
+    result &= (HIST_LONG_COUNT == count);
+    count   = Climate_History_Query(CLIMATE_HISTORY_LEVEL_LONG, 0, (now + 1), points, 1);
+    result &= ((t0 + (DAYS - CONFIG_CLIMATE_HISTORY_DAYS) * DAY_S) == points[0].time);
+    result &= CHECK_STAT(points[0].temperature, 2025, 2000, 2050);
+    result &= CHECK_STAT(points[0].humidity, 5095, 5000, 5190);
+    result &= CHECK_STAT(points[0].pressure, 100009, 99950, 100069);
+
+    /* Any range: the finest level keeping it is selected */
+    result &= (CLIMATE_HISTORY_LEVEL_RAW == Climate_History_GetLevel(now - 1800));
+    result &= (CLIMATE_HISTORY_LEVEL_MINUTE == Climate_History_GetLevel(now - 7200));
+    result &= (CLIMATE_HISTORY_LEVEL_LONG == Climate_History_GetLevel(now - 10 * DAY_S));
+    result &= (CLIMATE_HISTORY_LEVEL_LONG == Climate_History_GetLevel(now - 40 * DAY_S));
+    result &= ((CONFIG_CLIMATE_HISTORY_DAYS * DAY_S) == Climate_History_GetSpan(CLIMATE_HISTORY_LEVEL_LONG));
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_LONG, (end - DAY_S), (end - DAY_S + 3600), &last);
+    result &= (3 == count);
+    HIST_LOGI("Climate History Rollups - %s", (true == result) ? "PASS" : "FAIL");
+
+    /* The 2 hours without the samples, then 10 minutes */
+    result = true;
+    hist_TestAppend(t0, (samples + 720), (samples + 780));
+    end     = (now + HIST_RAW_PERIOD_S);
+    now     = (t0 + (time_t)(samples + 779) * HIST_RAW_PERIOD_S);
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_RAW, 0, (now + 1), &last);
+    result &= (60 == count);
+    /* The last hour before the gap and the minutes after it */
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_MINUTE, (end - 3600), (now + 1), &last);
+    result &= ((60 + 10) == count);
+    count   = Climate_History_Query(CLIMATE_HISTORY_LEVEL_MINUTE, (end - 60), (now + 1), points, 2);
+    result &= ((points[1].time - points[0].time) == (2 * 3600 + 60));
+    /* The time stepped back is skipped */
+    Climate_History_Append((now - 3600), 0, 0, 0, 0, 0);
+    count   = hist_TestCount(CLIMATE_HISTORY_LEVEL_RAW, 0, (now + 1), &last);
+    result &= (60 == count);
+    HIST_LOGI("Climate History Gaps - %s", (true == result) ? "PASS" : "FAIL");
+
+    Climate_History_Init();
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Benchmarks ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    time_t                  t;
+    climate_history_point_t points[60];
+    volatile uint32_t       sum;
+} hist_bench_t, * hist_bench_p;
+
+//-------------------------------------------------------------------------------------------------
+
+/* The sample is rolled up to the minute and the 20 minutes buckets */
+static void hist_BenchAppend(void * p_ctx, uint32_t count)
+{
+    hist_bench_p p_bench = (hist_bench_p)p_ctx;
+    uint32_t     idx     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        p_bench->t += HIST_RAW_PERIOD_S;
+        Climate_History_Append
+        (
+            p_bench->t,
+            (2000 + (idx % 6) * 10),
+            (5000 + (idx / 6 % 20) * 10),
+            (99950 + (idx % 120)),
+            (400 + (idx % 6)),
+            (40000 + (idx % 6) * 2)
+        );
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The last hour of the minute buckets */
+static void hist_BenchQuery(void * p_ctx, uint32_t count)
+{
+    hist_bench_p p_bench = (hist_bench_p)p_ctx;
+    uint32_t     idx     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        p_bench->sum += Climate_History_Query
+        (
+            CLIMATE_HISTORY_LEVEL_MINUTE,
+            (p_bench->t - 60 * 60),
+            p_bench->t,
+            p_bench->points,
+            (sizeof(p_bench->points) / sizeof(p_bench->points[0]))
+        );
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The history is reset like by the test, the live measurements are lost */
+void Climate_History_Bench(void)
+{
+    static hist_bench_t bench = {0};
+
+    /* Aligned to 20 minutes */
+    bench.t = 1699999200;
+    Climate_History_Init();
+    Bench_Run("history", "Climate_History_Append", hist_BenchAppend, &bench, NULL);
+    Bench_Run("history", "Climate_History_Query", hist_BenchQuery, &bench, NULL);
+    Climate_History_Init();
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,544 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "types.h"
+#include "climate_series.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define SERIES_LOG  0
+
+#if (1 == SERIES_LOG)
+static const char * gTAG = "SERIES";
+#    define SERIES_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SERIES_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define SERIES_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define SERIES_LOGI(...)
+#    define SERIES_LOGE(...)
+#    define SERIES_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+/* The first sample of the chunk is written as is (32 bits per the time and every value).   */
+/* The next times are the delta-of-delta and the next values are the delta (the values are */
+/* the integers of 0.01 units, their noisy low bits make XOR twice longer than the delta), */
+/* both in the variable length buckets: '0' - zero, '10', '110', '1110' + the short        */
+/* signed value, '1111' + 32 bits. The bits are written MSB first.                         */
+enum
+{
+    SERIES_WORD_BITS      = 32,
+    SERIES_BUCKETS        = 4,
+    SERIES_MAX_BITS       = (SERIES_BUCKETS + SERIES_WORD_BITS),
+    /* The history is read by this count of points */
+    SERIES_QUERY_POINTS   = 8,
+};
+
+typedef struct
+{
+    /* The bucket covers [-(1 << (bits - 1)), (1 << (bits - 1)) - 1] */
+    uint8_t prefix;
+    uint8_t prefix_bits;
+    uint8_t bits;
+} series_bucket_t;
+
+//-------------------------------------------------------------------------------------------------
+
+/* The periods are regular, the changes are the jitter and the lost buckets */
+static const series_bucket_t gcTimeBuckets[SERIES_BUCKETS] =
+{
+    {0x02, 2, 7},
+    {0x06, 3, 9},
+    {0x0E, 4, 12},
+    {0x0F, 4, SERIES_WORD_BITS},
+};
+
+/* The sensors noise is a few units */
+static const series_bucket_t gcValueBuckets[SERIES_BUCKETS] =
+{
+    {0x02, 2, 4},
+    {0x06, 3, 7},
+    {0x0E, 4, 12},
+    {0x0F, 4, SERIES_WORD_BITS},
+};
+
+//-------------------------------------------------------------------------------------------------
+
+static void series_Write(climate_series_codec_p p_codec, uint32_t value, uint8_t bits)
+{
+    uint8_t bit = 0;
+
+    for (bit = bits; 0 < bit; bit--)
+    {
+        if (0 != ((value >> (bit - 1)) & 1))
+        {
+            p_codec->p_data[p_codec->bits / 8] |= (uint8_t)(0x80 >> (p_codec->bits % 8));
+        }
+        p_codec->bits++;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool series_Read(climate_series_codec_p p_codec, uint8_t bits, uint32_t * p_value)
+{
+    uint32_t value = 0;
+    uint8_t  bit   = 0;
+
+    if ((p_codec->size * 8) < (p_codec->bits + bits))
+    {
+        return false;
+    }
+    for (bit = 0; bit < bits; bit++)
+    {
+        value = ((value << 1) | ((p_codec->p_data[p_codec->bits / 8] >> (7 - (p_codec->bits % 8))) & 1));
+        p_codec->bits++;
+    }
+    *p_value = value;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void series_EncodeBucket(climate_series_codec_p p_codec, const series_bucket_t * p_buckets, int32_t value)
+{
+    uint8_t i = 0;
+
+    if (0 == value)
+    {
+        series_Write(p_codec, 0, 1);
+        return;
+    }
+    for (i = 0; i < (SERIES_BUCKETS - 1); i++)
+    {
+        if ((-(1L << (p_buckets[i].bits - 1)) <= value) && ((1L << (p_buckets[i].bits - 1)) > value))
+        {
+            break;
+        }
+    }
+    series_Write(p_codec, p_buckets[i].prefix, p_buckets[i].prefix_bits);
+    series_Write(p_codec, (uint32_t)value, p_buckets[i].bits);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool series_DecodeBucket(climate_series_codec_p p_codec, const series_bucket_t * p_buckets, int32_t * p_value)
+{
+    uint32_t value  = 0;
+    uint8_t  prefix = 0;
+    uint8_t  i      = 0;
+
+    /* The prefix is the ones up to the zero or the longest one */
+    for (i = 0; i < SERIES_BUCKETS; i++)
+    {
+        if (false == series_Read(p_codec, 1, &value))
+        {
+            return false;
+        }
+        if (0 == value)
+        {
+            break;
+        }
+        prefix++;
+    }
+    *p_value = 0;
+    if (0 < prefix)
+    {
+        i = (uint8_t)(prefix - 1);
+        if (false == series_Read(p_codec, p_buckets[i].bits, &value))
+        {
+            return false;
+        }
+        /* The sign extension */
+        if ((SERIES_WORD_BITS > p_buckets[i].bits) && (0 != (value >> (p_buckets[i].bits - 1))))
+        {
+            value |= (0xFFFFFFFFUL << p_buckets[i].bits);
+        }
+        *p_value = (int32_t)value;
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void series_Sample(const climate_history_point_t * p_point, climate_series_sample_p p_sample)
+{
+    p_sample->time                               = (uint32_t)p_point->time;
+    p_sample->values[CLIMATE_SERIES_TEMPERATURE] = p_point->temperature.mean;
+    p_sample->values[CLIMATE_SERIES_HUMIDITY]    = p_point->humidity.mean;
+    p_sample->values[CLIMATE_SERIES_PRESSURE]    = p_point->pressure.mean;
+    p_sample->values[CLIMATE_SERIES_CO2]         = p_point->co2.mean;
+    p_sample->values[CLIMATE_SERIES_LIGHT]       = p_point->light.mean;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Series_EncoderInit(climate_series_codec_p p_codec, uint8_t fields, uint8_t * p_data, size_t size)
+{
+    memset(p_codec, 0, sizeof(*p_codec));
+    memset(p_data, 0, size);
+    p_codec->p_data = p_data;
+    p_codec->size   = size;
+    p_codec->fields = (fields & CLIMATE_SERIES_ALL);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Climate_Series_Encode(climate_series_codec_p p_codec, const climate_series_sample_t * p_sample)
+{
+    size_t  worst = SERIES_MAX_BITS;
+    int32_t delta = 0;
+    uint8_t field = 0;
+
+    for (field = 0; field < CLIMATE_SERIES_FIELDS; field++)
+    {
+        worst += ((0 != (p_codec->fields & (1 << field))) ? SERIES_MAX_BITS : 0);
+    }
+    if ((p_codec->size * 8) < (p_codec->bits + worst))
+    {
+        return false;
+    }
+
+    /* The first sample is the reference, its delta is 0 */
+    if (0 == p_codec->count)
+    {
+        series_Write(p_codec, p_sample->time, SERIES_WORD_BITS);
+    }
+    else
+    {
+        delta = (int32_t)(p_sample->time - p_codec->time);
+        series_EncodeBucket(p_codec, gcTimeBuckets, (int32_t)((uint32_t)delta - (uint32_t)p_codec->delta));
+        p_codec->delta = delta;
+    }
+    p_codec->time = p_sample->time;
+    for (field = 0; field < CLIMATE_SERIES_FIELDS; field++)
+    {
+        if (0 == (p_codec->fields & (1 << field)))
+        {
+            continue;
+        }
+        if (0 == p_codec->count)
+        {
+            series_Write(p_codec, (uint32_t)p_sample->values[field], SERIES_WORD_BITS);
+        }
+        else
+        {
+            delta = (int32_t)((uint32_t)p_sample->values[field] - (uint32_t)p_codec->values[field]);
+            series_EncodeBucket(p_codec, gcValueBuckets, delta);
+        }
+        p_codec->values[field] = p_sample->values[field];
+    }
+    p_codec->count++;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Climate_Series_GetSize(const climate_series_codec_t * p_codec)
+{
+    return ((p_codec->bits + 7) / 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Series_DecoderInit(climate_series_codec_p p_codec, uint8_t fields, const uint8_t * p_data, size_t size)
+{
+    memset(p_codec, 0, sizeof(*p_codec));
+    /* The decoder only reads the data */
+    p_codec->p_data = (uint8_t *)p_data;
+    p_codec->size   = size;
+    p_codec->fields = (fields & CLIMATE_SERIES_ALL);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Climate_Series_Decode(climate_series_codec_p p_codec, uint32_t count, climate_series_sample_p p_sample)
+{
+    uint32_t value = 0;
+    int32_t  delta = 0;
+    uint8_t  field = 0;
+
+    if (count <= p_codec->count)
+    {
+        return false;
+    }
+    memset(p_sample, 0, sizeof(*p_sample));
+    if (0 == p_codec->count)
+    {
+        if (false == series_Read(p_codec, SERIES_WORD_BITS, &p_codec->time))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (false == series_DecodeBucket(p_codec, gcTimeBuckets, &delta))
+        {
+            return false;
+        }
+        p_codec->delta = (int32_t)((uint32_t)p_codec->delta + (uint32_t)delta);
+        p_codec->time += (uint32_t)p_codec->delta;
+    }
+    p_sample->time = p_codec->time;
+    for (field = 0; field < CLIMATE_SERIES_FIELDS; field++)
+    {
+        if (0 == (p_codec->fields & (1 << field)))
+        {
+            continue;
+        }
+        if (0 == p_codec->count)
+        {
+            if (false == series_Read(p_codec, SERIES_WORD_BITS, &value))
+            {
+                return false;
+            }
+            p_codec->values[field] = (int32_t)value;
+        }
+        else
+        {
+            if (false == series_DecodeBucket(p_codec, gcValueBuckets, &delta))
+            {
+                return false;
+            }
+            p_codec->values[field] = (int32_t)((uint32_t)p_codec->values[field] + (uint32_t)delta);
+        }
+        p_sample->values[field] = p_codec->values[field];
+    }
+    p_codec->count++;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Climate_Series_Export
+(
+    climate_history_level_t level,
+    time_t                  from,
+    time_t                  to,
+    uint8_t                 fields,
+    uint8_t *               p_data,
+    size_t                  size,
+    uint32_t *              p_count,
+    time_t *                p_next
+)
+{
+    climate_history_point_t points[SERIES_QUERY_POINTS];
+    climate_series_sample_t sample = {0};
+    climate_series_codec_t  codec  = {0};
+    size_t                  count  = 0;
+    size_t                  i      = 0;
+    bool                    full   = false;
+
+    Climate_Series_EncoderInit(&codec, fields, p_data, size);
+    *p_next = to;
+    while ((false == full) && (from < to))
+    {
+        count = Climate_History_Query(level, from, to, points, SERIES_QUERY_POINTS);
+        for (i = 0; i < count; i++)
+        {
+            series_Sample(&points[i], &sample);
+            if (false == Climate_Series_Encode(&codec, &sample))
+            {
+                /* The next chunk starts from this point */
+                *p_next = points[i].time;
+                full    = true;
+                break;
+            }
+        }
+        if (SERIES_QUERY_POINTS > count)
+        {
+            break;
+        }
+        from = (points[count - 1].time + (time_t)Climate_History_GetPeriod(level));
+    }
+    *p_count = codec.count;
+
+    return Climate_Series_GetSize(&codec);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static int32_t series_TestNoise(uint32_t * p_seed, int32_t amplitude)
+{
+    *p_seed = (*p_seed * 1664525 + 1013904223);
+    return ((int32_t)((*p_seed >> 8) % (2 * amplitude + 1)) - amplitude);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The day of the 1 minute means: the temperature and the humidity follow the day, the     */
+/* pressure drifts, the CO2 and the light are missing (0), some minutes are lost.           */
+static void series_TestTrace(uint32_t idx, uint32_t * p_seed, climate_series_sample_p p_sample)
+{
+    enum
+    {
+        START  = 1700000000,
+        PERIOD = 60,
+    };
+    int32_t day = (int32_t)(idx % 1440);
+    int32_t sun = ((720 > day) ? day : (1440 - day));
+
+    /* The lost minutes shift the times */
+    p_sample->time                               = (START + (idx * PERIOD) + (((idx / 97) % 3) * PERIOD));
+    p_sample->values[CLIMATE_SERIES_TEMPERATURE] = (2200 + (sun * 600 / 720) + series_TestNoise(p_seed, 3));
+    p_sample->values[CLIMATE_SERIES_HUMIDITY]    = (7500 - (sun * 1500 / 720) + series_TestNoise(p_seed, 20));
+    p_sample->values[CLIMATE_SERIES_PRESSURE]    = (101325 + (int32_t)(idx / 30) + series_TestNoise(p_seed, 2));
+    p_sample->values[CLIMATE_SERIES_CO2]         = 0;
+    p_sample->values[CLIMATE_SERIES_LIGHT]       = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The trace is encoded to the chunks of the size and decoded back */
+static bool series_TestRoundTrip(uint8_t fields, size_t size, uint32_t samples, size_t * p_bytes, uint32_t * p_chunks)
+{
+    enum
+    {
+        CHUNK_MAX = 512,
+    };
+    uint8_t                 chunk[CHUNK_MAX];
+    climate_series_codec_t  encoder  = {0};
+    climate_series_codec_t  decoder  = {0};
+    climate_series_sample_t sample   = {0};
+    climate_series_sample_t expected = {0};
+    climate_series_sample_t decoded  = {0};
+    uint32_t                seed     = 0x44;
+    uint32_t                check    = 0x44;
+    uint32_t                idx      = 0;
+    uint32_t                next     = 0;
+    uint8_t                 field    = 0;
+    bool                    result   = true;
+
+    *p_bytes  = 0;
+    *p_chunks = 0;
+    series_TestTrace(idx, &seed, &sample);
+    while (idx < samples)
+    {
+        /* Every chunk continues from the sample that did not fit the previous one */
+        Climate_Series_EncoderInit(&encoder, fields, chunk, size);
+        while ((idx < samples) && (true == Climate_Series_Encode(&encoder, &sample)))
+        {
+            if (++idx < samples)
+            {
+                series_TestTrace(idx, &seed, &sample);
+            }
+        }
+        result    &= (0 < encoder.count);
+        *p_bytes  += Climate_Series_GetSize(&encoder);
+        (*p_chunks)++;
+
+        Climate_Series_DecoderInit(&decoder, fields, chunk, Climate_Series_GetSize(&encoder));
+        while (true == Climate_Series_Decode(&decoder, encoder.count, &decoded))
+        {
+            series_TestTrace(next++, &check, &expected);
+            result &= (expected.time == decoded.time);
+            for (field = 0; field < CLIMATE_SERIES_FIELDS; field++)
+            {
+                result &= (0 == (fields & (1 << field))) || (expected.values[field] == decoded.values[field]);
+            }
+        }
+        result &= (decoder.count == encoder.count);
+        if (false == result)
+        {
+            break;
+        }
+    }
+    result &= (samples == next);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void series_TestCodec(void)
+{
+    climate_series_codec_t  codec  = {0};
+    climate_series_sample_t sample = {0};
+    climate_series_sample_t check  = {0};
+    uint8_t                 data[64];
+    size_t                  bytes  = 0;
+    uint32_t                chunks = 0;
+    uint32_t                idx    = 0;
+    bool                    result = true;
+
+    /* The extremes: the large time jumps back and forth, the sign flips, the full words */
+    Climate_Series_EncoderInit(&codec, CLIMATE_SERIES_ALL, data, sizeof(data));
+    for (idx = 0; idx < 2; idx++)
+    {
+        sample.time      = ((0 == idx) ? 0xFFFFFF00UL : 100);
+        sample.values[0] = ((0 == idx) ? INT32_MIN : INT32_MAX);
+        sample.values[1] = ((0 == idx) ? -1 : 1);
+        sample.values[4] = ((0 == idx) ? 0 : 0x40000000L);
+        result &= (true == Climate_Series_Encode(&codec, &sample));
+    }
+    Climate_Series_DecoderInit(&codec, CLIMATE_SERIES_ALL, data, sizeof(data));
+    result &= (true == Climate_Series_Decode(&codec, 2, &check));
+    result &= (true == Climate_Series_Decode(&codec, 2, &check));
+    result &= (0 == memcmp(&check, &sample, sizeof(sample)));
+    result &= (false == Climate_Series_Decode(&codec, 2, &check));
+
+    /* The day in the chunks of the web frame and of the tight TCP window, the field subsets */
+    result &= series_TestRoundTrip(CLIMATE_SERIES_ALL, 512, 1440, &bytes, &chunks);
+    result &= series_TestRoundTrip((1 << CLIMATE_SERIES_HUMIDITY), 48, 1440, &bytes, &chunks);
+    result &= series_TestRoundTrip(((1 << CLIMATE_SERIES_TEMPERATURE) | (1 << CLIMATE_SERIES_PRESSURE)), 100, 500, &bytes, &chunks);
+
+    SERIES_LOGI("Series Codec - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The week of the minutes against the day measurements of the web page, they take 8 bytes */
+/* per point (the pressure, the temperature and the humidity, the time is implied)         */
+static void series_TestRatio(void)
+{
+    enum
+    {
+        SAMPLES   = (7 * 1440),
+        RAW_BYTES = 8,
+    };
+    uint8_t  fields  = ((1 << CLIMATE_SERIES_TEMPERATURE) | (1 << CLIMATE_SERIES_HUMIDITY) | (1 << CLIMATE_SERIES_PRESSURE));
+    size_t   bytes   = 0;
+    uint32_t chunks  = 0;
+    int64_t  elapsed = esp_timer_get_time();
+    bool     result  = true;
+
+    result  &= series_TestRoundTrip(fields, 512, SAMPLES, &bytes, &chunks);
+    elapsed  = (esp_timer_get_time() - elapsed);
+    /* The noisy minutes take less than 0.4 of the raw points */
+    result  &= ((2 * SAMPLES * RAW_BYTES / 5) > bytes);
+
+    SERIES_LOGI
+    (
+        "Series Ratio - %lu samples - %u bytes in %lu chunks - %u.%02u bits/sample - ratio %u.%02u - %lld us - %s",
+        (uint32_t)SAMPLES,
+        (unsigned int)bytes,
+        chunks,
+        (unsigned int)(bytes * 8 / SAMPLES),
+        (unsigned int)((bytes * 800 / SAMPLES) % 100),
+        (unsigned int)(SAMPLES * RAW_BYTES / bytes),
+        (unsigned int)((SAMPLES * RAW_BYTES * 100 / bytes) % 100),
+        elapsed,
+        (true == result) ? "PASS" : "FAIL"
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Climate_Series_Test(void)
+{
+    series_TestCodec();
+    series_TestRatio();
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -1,6 +1,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
+#include <sys/param.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -12,7 +14,13 @@
 #include "types.h"
 #include "fan.h"
 #include "humidifier.h"
+#include "scd4x.h"
+#include "bh1750.h"
+#include "i2c_scheduler.h"
+#include "climate_history.h"
+#include "climate_archive.h"
 #include "climate_task.h"
+#include "profiler.h"
 
 //-------------------------------------------------------------------------------------------------
 
@@ -34,6 +42,64 @@ static const char * gTAG = "CLIMATE";
 
 //-------------------------------------------------------------------------------------------------
 
+/* The humidity is controlled by PI on every sensors sample. The Humidifier is on/off only,  */
+/* so the PI output (duty) is converted to the pulses no shorter than the minimum on/off    */
+/* times: the demand is accumulated while the Humidifier is off and spent while it is on.   */
+/* The output is in 0.001 % of the duty, the humidity is in 0.01 %.                          */
+enum
+{
+    CLT_HUMIDITY_SAMPLE_S    = 10,
+    /* 10 % of the duty per 1 % of the humidity error */
+    CLT_HUMIDITY_KP          = 100,
+    CLT_HUMIDITY_TI_S        = 1200,
+    CLT_HUMIDITY_OUTPUT_MAX  = 100000,
+    /* The ultrasonic module wears out by the frequent switching */
+    CLT_HUMIDITY_MIN_ON_S    = 60,
+    CLT_HUMIDITY_MIN_OFF_S   = 120,
+    /* The demand of the duty accumulated while off is limited by this time */
+    CLT_HUMIDITY_WINDOW_S    = 300,
+    /* The control is paused after the manual command */
+    CLT_HUMIDITY_HOLD_S      = (10 * 60),
+};
+
+/* The FAN speed is the largest of the demands: the temperature over the setpoint, the  */
+/* humidity over the setpoint with the margin, the CO2 out of the range (when measured) */
+/* and the time since the last air exchange.                                            */
+/* The FAN is turned on when the demand exceeds the stall duty with the hysteresis.     */
+/* The duty is in FAN_MCPWM_PERIOD units, the temperature is in 0.01 C, the CO2 in ppm. */
+enum
+{
+    CLT_FAN_POWER_ON_TIMEOUT_MS = 250,
+    /* The full speed at 2 C over the setpoint */
+    CLT_FAN_TEMPERATURE_SPAN    = 200,
+    /* The Humidifier overshoot is not vented */
+    CLT_FAN_HUMIDITY_MARGIN     = 500,
+    /* The full speed at 10 % over the setpoint with the margin */
+    CLT_FAN_HUMIDITY_SPAN       = 1000,
+    /* The plants deplete the CO2 under the light, the room air is brought in below this... */
+    CLT_FAN_CO2_LOW             = 350,
+    /* ...with the full speed at this depletion */
+    CLT_FAN_CO2_LOW_SPAN        = 100,
+    /* The stale air is vented over this... */
+    CLT_FAN_CO2_HIGH            = 1200,
+    /* ...with the full speed at this excess */
+    CLT_FAN_CO2_HIGH_SPAN       = 800,
+    /* The air is exchanged at least once per this interval... */
+    CLT_FAN_EXCHANGE_INTERVAL_S = (30 * 60),
+    /* ...with the demand rising to the half speed during this time... */
+    CLT_FAN_EXCHANGE_RAMP_S     = (5 * 60),
+    CLT_FAN_EXCHANGE_DUTY       = (FAN_MCPWM_PERIOD / 2),
+    /* ...till this time of the full speed is accumulated */
+    CLT_FAN_EXCHANGE_S          = 60,
+    CLT_FAN_HYSTERESIS          = (FAN_MCPWM_PERIOD / 10),
+    /* The duty changes less than this are not applied */
+    CLT_FAN_DEADBAND            = (FAN_MCPWM_PERIOD / 100),
+    /* The control is paused after the manual command */
+    CLT_FAN_HOLD_S              = (10 * 60),
+};
+
+//-------------------------------------------------------------------------------------------------
+
 typedef struct
 {
     uint32_t interval;
@@ -59,6 +125,27 @@ typedef struct
     climate_time_t    time;
 } humidifier_t;
 
+typedef struct
+{
+    int32_t  integral;
+    int32_t  output;
+    int32_t  demand;
+    uint32_t elapsed;
+    uint32_t hold;
+    uint16_t setpoint;
+    bool     on;
+    bool     active;
+} humidity_ctrl_t, * humidity_ctrl_p;
+
+typedef struct
+{
+    uint32_t duty;
+    uint32_t since;
+    uint32_t volume;
+    uint32_t hold;
+    bool     active;
+} fan_ctrl_t, * fan_ctrl_p;
+
 typedef struct
 {
     time_t shrt_term;
@@ -68,28 +155,18 @@ typedef struct
 
 typedef struct
 {
-    uint64_t pressure;
-    uint32_t temperature;
-    uint32_t humidity;
-    uint32_t count;
-} accumulator_t, * accumulator_p;
-
-typedef struct
-{
-    climate_measurements_t     minute;
-    climate_day_measurements_t day;
-    uint32_t                   key;
+    climate_measurements_t minute;
+    uint32_t               key;
 } measurements_t, * measurements_p;
 
 typedef struct
 {
     alarms_t       alarms;
-    accumulator_t  acc_midl;
-    accumulator_t  acc_long;
     measurements_p meas;
     struct
     {
         uint8_t meas_updated : 1;
+        uint8_t acquiring    : 1;
     };
 } sensors_t;
 
@@ -97,19 +174,18 @@ typedef struct
 
 static measurements_t RTC_NOINIT_ATTR gMeasurements;
 
-static QueueHandle_t gClimateQueue = {0};
-static fan_t         gFAN          = {0};
-static humidifier_t  gHumidifier   = {0};
-static sensors_t     gSensors      = {0};
+static QueueHandle_t         gClimateQueue = {0};
+static fan_t                 gFAN          = {0};
+static humidifier_t          gHumidifier   = {0};
+static sensors_t             gSensors      = {0};
+static humidity_ctrl_t       gHumidity     = {0};
+static fan_ctrl_t            gFanCtrl      = {0};
+static climate_schedule_fp_t gScheduleFp   = NULL;
 
 //-------------------------------------------------------------------------------------------------
 
 static void clt_ProcessFAN(void)
 {
-    enum
-    {
-        FAN_POWER_ON_TIMEOUT = 250,
-    };
     if (CLIMATE_CMD_EMPTY != gFAN.command)
     {
         if ((0 < gFAN.time.duration) && (gFAN.time.duration < gFAN.time.interval))
@@ -118,7 +194,7 @@ static void clt_ProcessFAN(void)
             {
                 CLT_LOGI("FAN Speed: %d - C: %lu", gFAN.speed, gFAN.time.counter);
                 FAN_SetSpeed(FAN_SPEED_FULL);
-                vTaskDelay(pdMS_TO_TICKS(FAN_POWER_ON_TIMEOUT));
+                vTaskDelay(pdMS_TO_TICKS(CLT_FAN_POWER_ON_TIMEOUT_MS));
                 FAN_SetSpeed(gFAN.speed);
             }
             else if (gFAN.time.duration == gFAN.time.counter)
@@ -145,7 +221,7 @@ static void clt_ProcessFAN(void)
             if (FAN_SPEED_NONE < gFAN.speed)
             {
                 FAN_SetSpeed(FAN_SPEED_FULL);
-                vTaskDelay(pdMS_TO_TICKS(FAN_POWER_ON_TIMEOUT));
+                vTaskDelay(pdMS_TO_TICKS(CLT_FAN_POWER_ON_TIMEOUT_MS));
             }
             FAN_SetSpeed(gFAN.speed);
             memset(&gFAN, 0, sizeof(gFAN));
@@ -166,13 +242,12 @@ static void clt_ProcessHumidifier(void)
             if (0 == gHumidifier.time.counter)
             {
                 CLT_LOGI("Humidifier: %d - C: %lu", gHumidifier.on, gHumidifier.time.counter);
-                Humidifier_OnOffButtonClick();
+                Humidifier_SetMist(true);
             }
             else if (gHumidifier.time.duration == gHumidifier.time.counter)
             {
                 CLT_LOGI("Humidifier: 0 - C: %lu", gHumidifier.time.counter);
-                Humidifier_PowerOff();
-                Humidifier_PowerOn();
+                Humidifier_SetMist(false);
             }
             else if (gHumidifier.time.interval == gHumidifier.time.counter)
             {
@@ -180,8 +255,7 @@ static void clt_ProcessHumidifier(void)
                 {
                     CLT_LOGI("Humidifier: 0 - C: %lu", gHumidifier.time.counter);
                     memset(&gHumidifier, 0, sizeof(gHumidifier));
-                    Humidifier_PowerOff();
-                    Humidifier_PowerOn();
+                    Humidifier_SetMist(false);
                 }
                 /* Let the counter to overflow in the following code */
                 gHumidifier.time.counter = UINT32_MAX;
@@ -191,15 +265,7 @@ static void clt_ProcessHumidifier(void)
         else
         {
             CLT_LOGI("Humidifier: %d - Permanent", gHumidifier.on);
-            if (true == gHumidifier.on)
-            {
-                Humidifier_OnOffButtonClick();
-            }
-            else
-            {
-                Humidifier_PowerOff();
-                Humidifier_PowerOn();
-            }
+            Humidifier_SetMist(gHumidifier.on);
             memset(&gHumidifier, 0, sizeof(gHumidifier));
         }
     }
@@ -207,6 +273,279 @@ static void clt_ProcessHumidifier(void)
 
 //-------------------------------------------------------------------------------------------------
 
+static void clt_HumidityReset(humidity_ctrl_p p_ctrl)
+{
+    memset(p_ctrl, 0, sizeof(humidity_ctrl_t));
+    /* The Humidifier can be turned on right after the start */
+    p_ctrl->elapsed = CLT_HUMIDITY_MIN_OFF_S;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Makes the PI step for the humidity sample, returns the requested Humidifier state */
+static bool clt_HumidityControl(humidity_ctrl_p p_ctrl, uint16_t setpoint, uint16_t humidity, uint32_t dt)
+{
+    int32_t error    = ((int32_t)setpoint - (int32_t)humidity);
+    int32_t p_term   = (CLT_HUMIDITY_KP * error);
+    int32_t integral = (p_ctrl->integral + (p_term * (int32_t)dt) / CLT_HUMIDITY_TI_S);
+
+    p_ctrl->setpoint = setpoint;
+
+    /* Anti-windup: the integral is frozen while the output is saturated by the error */
+    if (((CLT_HUMIDITY_OUTPUT_MAX < (p_term + integral)) && (0 < error)) ||
+        ((0 > (p_term + integral)) && (0 > error)))
+    {
+        integral = p_ctrl->integral;
+    }
+    p_ctrl->integral = MIN(MAX(integral, 0), CLT_HUMIDITY_OUTPUT_MAX);
+    p_ctrl->output   = MIN(MAX((p_term + p_ctrl->integral), 0), CLT_HUMIDITY_OUTPUT_MAX);
+
+    /* The duty is accumulated all the time and spent while the Humidifier is on */
+    p_ctrl->demand += (p_ctrl->output * (int32_t)dt);
+    if (true == p_ctrl->on)
+    {
+        p_ctrl->demand -= (CLT_HUMIDITY_OUTPUT_MAX * (int32_t)dt);
+    }
+    p_ctrl->demand = MAX(p_ctrl->demand, -(CLT_HUMIDITY_OUTPUT_MAX * CLT_HUMIDITY_MIN_ON_S));
+    p_ctrl->demand = MIN(p_ctrl->demand, (CLT_HUMIDITY_OUTPUT_MAX * CLT_HUMIDITY_WINDOW_S));
+
+    p_ctrl->elapsed += dt;
+    if ((false == p_ctrl->on) &&
+        (CLT_HUMIDITY_MIN_OFF_S <= p_ctrl->elapsed) &&
+        ((CLT_HUMIDITY_OUTPUT_MAX * CLT_HUMIDITY_MIN_ON_S) <= p_ctrl->demand))
+    {
+        p_ctrl->on      = true;
+        p_ctrl->elapsed = 0;
+    }
+    else if ((true == p_ctrl->on) &&
+             (CLT_HUMIDITY_MIN_ON_S <= p_ctrl->elapsed) &&
+             (0 >= p_ctrl->demand))
+    {
+        p_ctrl->on      = false;
+        p_ctrl->elapsed = 0;
+    }
+
+    return p_ctrl->on;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_ProcessHumidity(climate_setpoint_p p_setpoint)
+{
+    bool on = false;
+
+    if (0 < gHumidity.hold)
+    {
+        gHumidity.hold -= MIN(gHumidity.hold, CLT_HUMIDITY_SAMPLE_S);
+        return;
+    }
+
+    /* The timed command controls the Humidifier, the unhealthy sensors do not */
+    if ((NULL == p_setpoint) || (CLIMATE_CMD_EMPTY != gHumidifier.command) ||
+        (false == Humidifier_IsSensorsHealthy()))
+    {
+        if ((true == gHumidity.active) && (true == gHumidity.on))
+        {
+            Humidifier_SetMist(false);
+        }
+        gHumidity.active = false;
+        return;
+    }
+
+    if (false == gHumidity.active)
+    {
+        clt_HumidityReset(&gHumidity);
+        gHumidity.active = true;
+    }
+
+    on = gHumidity.on;
+    if (on != clt_HumidityControl(&gHumidity, p_setpoint->humidity, Humidifier_GetHumidity(), CLT_HUMIDITY_SAMPLE_S))
+    {
+        Humidifier_SetMist(gHumidity.on);
+    }
+    CLT_LOGI
+    (
+        "Humidity - S: %4u - H: %4u - Out: %6ld - On: %d",
+        gHumidity.setpoint,
+        Humidifier_GetHumidity(),
+        gHumidity.output,
+        gHumidity.on
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_FanReset(fan_ctrl_p p_ctrl)
+{
+    memset(p_ctrl, 0, sizeof(fan_ctrl_t));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Scales the error over the threshold to the duty, the full speed is at the span */
+static int32_t clt_FanDemand(int32_t value, int32_t threshold, int32_t span)
+{
+    return MIN(MAX(((value - threshold) * FAN_MCPWM_PERIOD / span), 0), FAN_MCPWM_PERIOD);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Makes the FAN control step for the sensors sample, returns the requested duty */
+static uint32_t clt_FanControl
+(
+    fan_ctrl_p         p_ctrl,
+    climate_setpoint_p p_setpoint,
+    int16_t            temperature,
+    uint16_t           humidity,
+    uint16_t           co2,
+    uint32_t           dt
+)
+{
+    int32_t demand = 0;
+    int32_t duty   = 0;
+
+    /* The air exchanged by the current duty */
+    p_ctrl->volume += (p_ctrl->duty * dt);
+    if ((FAN_MCPWM_PERIOD * CLT_FAN_EXCHANGE_S) <= p_ctrl->volume)
+    {
+        p_ctrl->volume = 0;
+        p_ctrl->since  = 0;
+    }
+    else
+    {
+        p_ctrl->since += dt;
+    }
+
+    demand = clt_FanDemand(temperature, p_setpoint->temperature, CLT_FAN_TEMPERATURE_SPAN);
+    demand = MAX
+    (
+        demand,
+        clt_FanDemand(humidity, (p_setpoint->humidity + CLT_FAN_HUMIDITY_MARGIN), CLT_FAN_HUMIDITY_SPAN)
+    );
+    /* 0 - the CO2 is not measured */
+    if (0 < co2)
+    {
+        demand = MAX(demand, clt_FanDemand(-(int32_t)co2, -CLT_FAN_CO2_LOW, CLT_FAN_CO2_LOW_SPAN));
+        demand = MAX(demand, clt_FanDemand(co2, CLT_FAN_CO2_HIGH, CLT_FAN_CO2_HIGH_SPAN));
+    }
+    demand = MAX
+    (
+        demand,
+        MIN
+        (
+            clt_FanDemand(p_ctrl->since, CLT_FAN_EXCHANGE_INTERVAL_S, CLT_FAN_EXCHANGE_RAMP_S),
+            CLT_FAN_EXCHANGE_DUTY
+        )
+    );
+
+    /* The FAN is started over the stall duty with the hysteresis and runs not slower than */
+    /* the stall duty till all the demands are satisfied                                   */
+    if ((0 == p_ctrl->duty) && ((FAN_DUTY_MIN + CLT_FAN_HYSTERESIS) > demand))
+    {
+        duty = 0;
+    }
+    else if (0 == demand)
+    {
+        duty = 0;
+    }
+    else
+    {
+        duty = MAX(demand, FAN_DUTY_MIN);
+        if ((0 < p_ctrl->duty) && (CLT_FAN_DEADBAND > abs(duty - (int32_t)p_ctrl->duty)))
+        {
+            duty = p_ctrl->duty;
+        }
+    }
+    p_ctrl->duty = duty;
+
+    return p_ctrl->duty;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_FanSwitch(uint32_t duty)
+{
+    /* The FAN needs the full power to start spinning */
+    if ((0 == FAN_GetDuty()) && (0 < duty))
+    {
+        FAN_SetDuty(FAN_MCPWM_PERIOD);
+        vTaskDelay(pdMS_TO_TICKS(CLT_FAN_POWER_ON_TIMEOUT_MS));
+    }
+    FAN_SetDuty(duty);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_ProcessFanControl(climate_setpoint_p p_setpoint)
+{
+    uint32_t duty = 0;
+
+    if (0 < gFanCtrl.hold)
+    {
+        gFanCtrl.hold -= MIN(gFanCtrl.hold, CLT_HUMIDITY_SAMPLE_S);
+        return;
+    }
+
+    /* The timed command controls the FAN */
+    if ((NULL == p_setpoint) || (CLIMATE_CMD_EMPTY != gFAN.command))
+    {
+        if ((true == gFanCtrl.active) && (0 < gFanCtrl.duty))
+        {
+            clt_FanSwitch(0);
+        }
+        gFanCtrl.active = false;
+        return;
+    }
+
+    if (false == gFanCtrl.active)
+    {
+        clt_FanReset(&gFanCtrl);
+        gFanCtrl.active = true;
+    }
+
+    duty = clt_FanControl
+    (
+        &gFanCtrl,
+        p_setpoint,
+        Humidifier_GetTemperature(),
+        Humidifier_GetHumidity(),
+        SCD4x_GetCO2(),
+        CLT_HUMIDITY_SAMPLE_S
+    );
+    if (duty != FAN_GetDuty())
+    {
+        clt_FanSwitch(duty);
+    }
+    CLT_LOGI
+    (
+        "FAN - S: %4d - T: %4d - Since: %4lu - Duty: %5lu",
+        p_setpoint->temperature,
+        Humidifier_GetTemperature(),
+        gFanCtrl.since,
+        gFanCtrl.duty
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_ProcessControl(time_t now)
+{
+    climate_setpoint_t setpoint   = {0};
+    climate_setpoint_p p_setpoint = NULL;
+
+    if ((NULL != gScheduleFp) && (true == gScheduleFp(now, &setpoint)))
+    {
+        p_setpoint = &setpoint;
+    }
+
+    /* The lost click is repeated before the new request */
+    Humidifier_ObserveMist(CLT_HUMIDITY_SAMPLE_S);
+    clt_ProcessHumidity(p_setpoint);
+    clt_ProcessFanControl(p_setpoint);
+}
+
+//-------------------------------------------------------------------------------------------------
+
 static void clt_SetSensorsShortTermAlarm(time_t * p_now, time_t * p_alarm)
 {
     struct tm dt = {0};
@@ -256,104 +595,114 @@ static void clt_SetSensorsAlarms(void)
 
 //-------------------------------------------------------------------------------------------------
 
-static void clt_SensorsAcummulateMiddleTerm(void)
+static void clt_SensorsAppend(time_t now)
 {
-    gSensors.acc_midl.pressure    += Humidifier_GetPressure();
-    gSensors.acc_midl.temperature += Humidifier_GetTemperature();
-    gSensors.acc_midl.humidity    += Humidifier_GetHumidity();
-    gSensors.acc_midl.count++;
+    Climate_History_Append
+    (
+        now,
+        Humidifier_GetTemperature(),
+        Humidifier_GetHumidity(),
+        (Humidifier_GetPressure() / 1000),
+        SCD4x_GetCO2(),
+        ((true == BH1750_IsValid()) ? BH1750_GetLux() : 0)
+    );
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void clt_SensorsUpdateMiddleTermMeasurements(void)
+static void clt_SensorsAnomaly(time_t now)
 {
-    gSensors.meas->minute.pressure =
-    (
-        gSensors.acc_midl.pressure / gSensors.acc_midl.count / 1000
-    );
-    gSensors.meas->minute.temperature =
-    (
-        gSensors.acc_midl.temperature / gSensors.acc_midl.count
-    );
-    gSensors.meas->minute.humidity =
-    (
-        gSensors.acc_midl.humidity / gSensors.acc_midl.count
-    );
+    climate_anomaly_input_t input = {0};
 
-    CLT_LOGI
-    (
-        "Minute - T: %4u - H: %4u - P: %6lu",
-        gSensors.meas->minute.temperature,
-        gSensors.meas->minute.humidity,
-        gSensors.meas->minute.pressure
-    );
+    /* The sensors failure is not the enclosure drift */
+    if (false == Humidifier_IsSensorsHealthy())
+    {
+        return;
+    }
+    input.value[CLIMATE_ANOMALY_TEMPERATURE] = Humidifier_GetTemperature();
+    input.value[CLIMATE_ANOMALY_HUMIDITY]    = Humidifier_GetHumidity();
+    input.misting                            = Humidifier_IsMistOn();
+    Climate_Anomaly_Process(now, CLT_HUMIDITY_SAMPLE_S, &input);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void clt_SensorsAcummulateLongTerm(void)
+static void clt_SensorsRestore(const climate_archive_record_t * p_record, void * p_ctx)
 {
-    gSensors.acc_long.pressure    += gSensors.acc_midl.pressure;
-    gSensors.acc_long.temperature += gSensors.acc_midl.temperature;
-    gSensors.acc_long.humidity    += gSensors.acc_midl.humidity;
-    gSensors.acc_long.count       += gSensors.acc_midl.count;
-    memset(&gSensors.acc_midl, 0, sizeof(gSensors.acc_midl));
+    /* The CO2 and the light are not archived */
+    Climate_History_Append(p_record->time, p_record->temperature, p_record->humidity, p_record->pressure, 0, 0);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void clt_SensorsUpdateLongTermMeasurements(void)
+static void clt_SensorsUpdateMiddleTermCO2AndLight(time_t now, time_t period)
 {
-    uint8_t idx = (CLIMATE_DAY_MEASUREMENTS_COUNT - 1);
-    void *  p_dst = NULL;
-    void *  p_src = NULL;
-    size_t  size  = 0;
+    enum
+    {
+        POINTS_MAX = 8,
+    };
+    climate_history_point_t points[POINTS_MAX] = {0};
+    size_t                  count              = 0;
+    uint32_t                co2                = 0;
+    uint32_t                co2_count          = 0;
+    uint32_t                light              = 0;
+
+    /* The CO2 and the light are kept by the raw samples only, the missing CO2 is 0 */
+    count = Climate_History_Query(CLIMATE_HISTORY_LEVEL_RAW, (now - period), now, points, POINTS_MAX);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (0 < points[i].co2.mean)
+        {
+            co2 += points[i].co2.mean;
+            co2_count++;
+        }
+        light += points[i].light.mean;
+    }
+    gSensors.meas->minute.co2   = (0 < co2_count) ? (co2 / co2_count) : 0;
+    gSensors.meas->minute.light = (0 < count) ? (light / count) : 0;
+}
 
-    /* Free the space for the latest element */
-    p_dst = &gSensors.meas->day.pressure[0];
-    p_src = &gSensors.meas->day.pressure[1];
-    size  = (sizeof(gSensors.meas->day.pressure) - sizeof(gSensors.meas->day.pressure[0]));
-    memmove(p_dst, p_src, size);
-    /* Store to the last item in array */
-    gSensors.meas->day.pressure[idx] =
-    (
-        gSensors.acc_long.pressure / gSensors.acc_long.count / 1000
-    );
+//-------------------------------------------------------------------------------------------------
 
-    /* Free the space for the latest element */
-    p_dst = &gSensors.meas->day.temperature[0];
-    p_src = &gSensors.meas->day.temperature[1];
-    size  = (sizeof(gSensors.meas->day.temperature) - sizeof(gSensors.meas->day.temperature[0]));
-    memmove(p_dst, p_src, size);
-    /* Store to the last item in array */
-    gSensors.meas->day.temperature[idx] =
-    (
-        gSensors.acc_long.temperature / gSensors.acc_long.count
-    );
+static void clt_SensorsUpdateMiddleTermMeasurements(time_t now)
+{
+    climate_history_point_t  point  = {0};
+    climate_archive_record_t record = {0};
+    time_t                   period = Climate_History_GetPeriod(CLIMATE_HISTORY_LEVEL_MINUTE);
 
-    /* Free the space for the latest element */
-    p_dst = &gSensors.meas->day.humidity[0];
-    p_src = &gSensors.meas->day.humidity[1];
-    size  = (sizeof(gSensors.meas->day.humidity) - sizeof(gSensors.meas->day.humidity[0]));
-    memmove(p_dst, p_src, size);
-    /* Store to the last item in array */
-    gSensors.meas->day.humidity[idx] =
+    /* The last completed minute */
+    if (0 < Climate_History_Query(CLIMATE_HISTORY_LEVEL_MINUTE, (now - period), now, &point, 1))
+    {
+        gSensors.meas->minute.pressure    = point.pressure.mean;
+        gSensors.meas->minute.temperature = point.temperature.mean;
+        gSensors.meas->minute.humidity    = point.humidity.mean;
+
+        /* Keep the minute in flash, so the history survives the power loss */
+        record.time        = point.time;
+        record.temperature = point.temperature.mean;
+        record.humidity    = point.humidity.mean;
+        record.pressure    = point.pressure.mean;
+        (void)Climate_Archive_Append(&record);
+    }
+    clt_SensorsUpdateMiddleTermCO2AndLight(now, period);
+
+    CLT_LOGI
     (
-        gSensors.acc_long.humidity / gSensors.acc_long.count
+        "Minute - T: %4u - H: %4u - P: %6lu - CO2: %4u - L: %6lu",
+        gSensors.meas->minute.temperature,
+        gSensors.meas->minute.humidity,
+        gSensors.meas->minute.pressure,
+        gSensors.meas->minute.co2,
+        gSensors.meas->minute.light
     );
+}
 
-    memset(&gSensors.acc_long, 0, sizeof(gSensors.acc_long));
+//-------------------------------------------------------------------------------------------------
 
+static void clt_SensorsUpdateLongTermMeasurements(void)
+{
+    /* The 20 minutes measurements are kept by the history, only the readers are notified */
     gSensors.meas_updated = true;
-
-    CLT_LOGI
-    (
-        "20 Minutes - T: %4u - H: %4u - P: %6lu",
-        gSensors.meas->day.temperature[idx],
-        gSensors.meas->day.humidity[idx],
-        gSensors.meas->day.pressure[idx]
-    );
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -379,11 +728,23 @@ static void clt_ProcessSensors(void)
         CLT_LOGI("Alarm 10 S! - %s", string);
         clt_SetSensorsShortTermAlarm(&now, &gSensors.alarms.shrt_term);
 
-        /* Read sensors' values */
+        /* Start the sensors acquisition, the sample is processed when it is completed */
         Humidifier_ReadSensors();
+        gSensors.acquiring = true;
+    }
 
-        /* Accumulate the middle term values */
-        clt_SensorsAcummulateMiddleTerm();
+    if ((true == gSensors.acquiring) && (false == Humidifier_IsSensorsBusy()))
+    {
+        gSensors.acquiring = false;
+
+        /* Store the sample to the history */
+        clt_SensorsAppend(now);
+
+        /* Detect the enclosure drift on every sample, before the control reacts to it */
+        clt_SensorsAnomaly(now);
+
+        /* Control the humidity and the FAN on every sample */
+        clt_ProcessControl(now);
 
         if (now >= gSensors.alarms.midl_term)
         {
@@ -391,10 +752,7 @@ static void clt_ProcessSensors(void)
             clt_SetSensorsMiddleTermAlarm(&now, &gSensors.alarms.midl_term);
 
             /* Update the middle term measurements */
-            clt_SensorsUpdateMiddleTermMeasurements();
-
-            /* Accumulate the long term values */
-            clt_SensorsAcummulateLongTerm();
+            clt_SensorsUpdateMiddleTermMeasurements(now);
 
             if (now >= gSensors.alarms.long_term)
             {
@@ -415,6 +773,9 @@ static void clt_ProcessMsg(climate_message_p p_msg)
     switch (p_msg->command)
     {
         case CLIMATE_CMD_FAN:
+            /* The manual command has the priority over the FAN control */
+            gFanCtrl.active = false;
+            gFanCtrl.hold   = CLT_FAN_HOLD_S;
             memset(&gFAN, 0, sizeof(gFAN));
             gFAN.command       = p_msg->command;
             gFAN.speed         = p_msg->speed;
@@ -424,6 +785,9 @@ static void clt_ProcessMsg(climate_message_p p_msg)
             clt_ProcessFAN();
             break;
         case CLIMATE_CMD_HUMIDIFY:
+            /* The manual command has the priority over the humidity control */
+            gHumidity.active = false;
+            gHumidity.hold   = CLT_HUMIDITY_HOLD_S;
             memset(&gHumidifier, 0, sizeof(gHumidifier));
             gHumidifier.command       = p_msg->command;
             gHumidifier.on            = p_msg->on;
@@ -444,45 +808,84 @@ void clt_Sensors_Init(void)
     /* Initialize the measurements if needed */
     if (CLIMATE_TASK_KEY != gMeasurements.key)
     {
-        CLT_LOGE("Day Measurements were lost!");
+        CLT_LOGE("Measurements were lost!");
         memset(&gMeasurements, 0, sizeof(gMeasurements));
         gMeasurements.key = CLIMATE_TASK_KEY;
     }
 
     /* Initialize the link to the measurements */
     gSensors.meas = &gMeasurements;
+
+    Climate_History_Init();
+    Climate_Anomaly_Reset();
+
+    /* Restore the history from flash, the log is longer than the history keeps. The clock */
+    /* can be not synchronized yet, so the window ends at the newest record.                 */
+    if (FW_SUCCESS == Climate_Archive_Init())
+    {
+        (void)Climate_Archive_Replay
+        (
+            (Climate_Archive_GetLast() - (time_t)Climate_History_GetSpan(CLIMATE_HISTORY_LEVEL_LONG)),
+            clt_SensorsRestore,
+            NULL
+        );
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
 
 static void vClimate_Task(void * pvParameters)
 {
-    BaseType_t        status = pdFAIL;
-    climate_message_t msg    = {0};
+    BaseType_t        status  = pdFAIL;
+    climate_message_t msg     = {0};
+    TickType_t        tick    = 0;
+    TickType_t        elapsed = 0;
+    TickType_t        timeout = 0;
+    uint32_t          wait    = 0;
 
     CLT_LOGI("Climate Task started...");
 
     FAN_Init();
     Humidifier_Init();
+    SCD4x_Init();
+    BH1750_Init();
     Humidifier_PowerOn();
 
     clt_Sensors_Init();
     clt_SetSensorsAlarms();
 
+    tick = xTaskGetTickCount();
     while (FW_TRUE)
     {
-        status = xQueueReceive(gClimateQueue, (void *)&msg, CLIMATE_TASK_TICK_MS);
+        /* The I2C bus work wakes the task up as soon as its waiting is over */
+        wait    = I2C_Scheduler_Process();
+        elapsed = (xTaskGetTickCount() - tick);
+        timeout = (CLIMATE_TASK_TICK_MS > elapsed) ? (CLIMATE_TASK_TICK_MS - elapsed) : 0;
+        if (0 == wait)
+        {
+            /* The pending bus work goes on at once, the messages are checked in between */
+            timeout = 0;
+        }
+        else if (pdMS_TO_TICKS(wait) < timeout)
+        {
+            /* Round the waiting up to the next tick */
+            timeout = (pdMS_TO_TICKS(wait) + 1);
+        }
+
+        status = xQueueReceive(gClimateQueue, (void *)&msg, timeout);
 
         if (pdTRUE == status)
         {
             clt_ProcessMsg(&msg);
         }
-        else
+        if (CLIMATE_TASK_TICK_MS <= (xTaskGetTickCount() - tick))
         {
+            tick += CLIMATE_TASK_TICK_MS;
+            FAN_Process(1);
             clt_ProcessFAN();
             clt_ProcessHumidifier();
-            clt_ProcessSensors();
         }
+        clt_ProcessSensors();
     }
 }
 
@@ -491,6 +894,7 @@ static void vClimate_Task(void * pvParameters)
 void Climate_Task_Init(void)
 {
     gClimateQueue = xQueueCreate(20, sizeof(climate_message_t));
+    Profiler_AddQueue("Climate", gClimateQueue);
 
     (void)xTaskCreatePinnedToCore(vClimate_Task, "Climate", 4096, NULL, 2, NULL, CORE0);
 }
@@ -504,6 +908,13 @@ void Climate_Task_SendMsg(climate_message_p p_msg)
 
 //-------------------------------------------------------------------------------------------------
 
+void Climate_Task_SetSchedule(climate_schedule_fp_t fp_schedule)
+{
+    gScheduleFp = fp_schedule;
+}
+
+//-------------------------------------------------------------------------------------------------
+
 fan_speed_t Climate_Task_GetFanSpeed(void)
 {
     /* This call is not thread safe but this is acceptable */
@@ -512,10 +923,46 @@ fan_speed_t Climate_Task_GetFanSpeed(void)
 
 //-------------------------------------------------------------------------------------------------
 
+uint32_t Climate_Task_GetFanDuty(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return FAN_GetDuty();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t Climate_Task_GetFanRpm(void)
+{
+    return FAN_GetRpm();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t Climate_Task_GetFanAlarms(void)
+{
+    return FAN_GetAlarms();
+}
+
+//-------------------------------------------------------------------------------------------------
+
 bool Climate_Task_IsHumidifierOn(void)
 {
     /* This call is not thread safe but this is acceptable */
-    return Humidifier_IsPoweredOn();
+    return Humidifier_IsMistOn();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint16_t Climate_Task_GetEventsSequence(void)
+{
+    return Climate_Anomaly_GetSequence();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t Climate_Task_GetEvents(uint16_t since, climate_anomaly_event_p p_events, uint8_t max)
+{
+    return Climate_Anomaly_GetEvents(since, p_events, max);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -530,8 +977,26 @@ void Climate_Task_GetMeasurements(climate_measurements_p p_meas)
 
 void Climate_Task_GetDayMeasurements(climate_day_measurements_p p_meas)
 {
-    /* This call is not thread safe but this is acceptable */
-    memcpy(p_meas, &gSensors.meas->day, sizeof(gSensors.meas->day));
+    climate_history_point_t point  = {0};
+    time_t                  period = Climate_History_GetPeriod(CLIMATE_HISTORY_LEVEL_LONG);
+    time_t                  start  = 0;
+    time_t                  now    = 0;
+    uint8_t                 i      = 0;
+
+    time(&now);
+
+    /* The last completed 20 minutes periods, the missing ones are zeros */
+    memset(p_meas, 0, sizeof(*p_meas));
+    for (i = 0; i < CLIMATE_DAY_MEASUREMENTS_COUNT; i++)
+    {
+        start = (now - (now % period) - (time_t)(CLIMATE_DAY_MEASUREMENTS_COUNT - i) * period);
+        if (0 < Climate_History_Query(CLIMATE_HISTORY_LEVEL_LONG, start, (start + period), &point, 1))
+        {
+            p_meas->pressure[i]    = point.pressure.mean;
+            p_meas->temperature[i] = point.temperature.mean;
+            p_meas->humidity[i]    = point.humidity.mean;
+        }
+    }
     gSensors.meas_updated = false;
 }
 
@@ -642,8 +1107,288 @@ void clt_TestHumidifier(void)
 
 //-------------------------------------------------------------------------------------------------
 
+/* The enclosure model: the humidity tends to the ambient one with the time constant, the     */
+/* Humidifier adds the constant rate, the sensor sees it with the delay (fog propagation).    */
+typedef struct
+{
+    double   humidity;
+    double   ambient;
+    uint32_t time;
+    uint32_t history;
+    uint32_t switches;
+    uint32_t violations;
+    uint32_t last_switch;
+    bool     on;
+} clt_test_plant_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_TestPlantStep(clt_test_plant_t * p_plant, bool on)
+{
+    enum
+    {
+        TAU_S       = 900,
+        DEAD_TIME_S = 30,
+    };
+    /* The Humidifier alone keeps ~50 % over the ambient humidity */
+    const double gain = (50.0 / TAU_S);
+    uint32_t     t    = 0;
+
+    /* The minimum on/off times are checked on every switch */
+    if (on != p_plant->on)
+    {
+        if ((0 < p_plant->switches) &&
+            (((true == on) && (CLT_HUMIDITY_MIN_OFF_S > (p_plant->time - p_plant->last_switch))) ||
+             ((false == on) && (CLT_HUMIDITY_MIN_ON_S > (p_plant->time - p_plant->last_switch)))))
+        {
+            p_plant->violations++;
+        }
+        p_plant->on          = on;
+        p_plant->last_switch = p_plant->time;
+        p_plant->switches++;
+    }
+
+    for (t = 0; t < CLT_HUMIDITY_SAMPLE_S; t++)
+    {
+        /* The history of the Humidifier state (1 bit per second) */
+        p_plant->history = ((p_plant->history << 1) | ((true == on) ? 1 : 0));
+        p_plant->humidity += ((p_plant->ambient - p_plant->humidity) / TAU_S);
+        if (0 != (p_plant->history & (1UL << (DEAD_TIME_S - 1))))
+        {
+            p_plant->humidity += gain;
+        }
+        p_plant->time++;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_TestHumidityControl(void)
+{
+    enum
+    {
+        HOUR_S = 3600,
+    };
+    clt_test_plant_t plant     = {0};
+    humidity_ctrl_t  ctrl      = {0};
+    uint16_t         setpoint  = 0;
+    uint16_t         humidity  = 0;
+    uint32_t         t         = 0;
+    uint32_t         count     = 0;
+    double           error     = 0;
+    double           sum       = 0;
+    double           max_error = 0;
+    bool             on        = false;
+    bool             result    = true;
+
+    /* Tracking of the day/night setpoints */
+    plant.humidity = 45.0;
+    plant.ambient  = 45.0;
+    clt_HumidityReset(&ctrl);
+    for (t = 0; t < (12 * HOUR_S); t += CLT_HUMIDITY_SAMPLE_S)
+    {
+        setpoint = ((6 * HOUR_S) > t) ? 8000 : 6500;
+        humidity = (uint16_t)(plant.humidity * 100);
+        on = clt_HumidityControl(&ctrl, setpoint, humidity, CLT_HUMIDITY_SAMPLE_S);
+        clt_TestPlantStep(&plant, on);
+        /* The error is checked after the settling time */
+        if (HOUR_S <= (t % (6 * HOUR_S)))
+        {
+            error     = fabs(plant.humidity - setpoint / 100.0);
+            sum      += error;
+            max_error = MAX(max_error, error);
+            count++;
+        }
+    }
+    /* The minimum on time pulse makes the ripple of ~3 % */
+    result &= (1.5 > (sum / count));
+    result &= (4.0 > max_error);
+    result &= (0 == plant.violations);
+    /* 1 pulse per 5 minutes at most */
+    result &= ((12 * 12 * 2) > plant.switches);
+    CLT_LOGI
+    (
+        "Tracking - mean error %.2f %% - max error %.2f %% - %lu switches",
+        (sum / count),
+        max_error,
+        plant.switches
+    );
+    CLT_LOGI("Humidity Control Tracking - %s", (true == result) ? "PASS" : "FAIL");
+
+    /* The unreachable setpoint does not wind the integral up */
+    result = true;
+    memset(&plant, 0, sizeof(plant));
+    plant.humidity = 45.0;
+    plant.ambient  = 45.0;
+    clt_HumidityReset(&ctrl);
+    for (t = 0; t < (2 * HOUR_S); t += CLT_HUMIDITY_SAMPLE_S)
+    {
+        on = clt_HumidityControl(&ctrl, 9900, (uint16_t)(plant.humidity * 100), CLT_HUMIDITY_SAMPLE_S);
+        clt_TestPlantStep(&plant, on);
+    }
+    result &= (CLT_HUMIDITY_OUTPUT_MAX > ctrl.integral);
+    count = UINT32_MAX;
+    sum   = 0;
+    for (t = 0; t < HOUR_S; t += CLT_HUMIDITY_SAMPLE_S)
+    {
+        on = clt_HumidityControl(&ctrl, 6000, (uint16_t)(plant.humidity * 100), CLT_HUMIDITY_SAMPLE_S);
+        clt_TestPlantStep(&plant, on);
+        if ((false == on) && (UINT32_MAX == count))
+        {
+            count = t;
+        }
+        if ((HOUR_S / 2) <= t)
+        {
+            sum += plant.humidity;
+        }
+    }
+    /* The Humidifier is off as soon as the minimum on time allows */
+    result &= ((CLT_HUMIDITY_MIN_ON_S + CLT_HUMIDITY_SAMPLE_S) >= count);
+    /* The humidity settles at the reachable setpoint again */
+    result &= (1.0 > fabs(sum / (HOUR_S / 2 / CLT_HUMIDITY_SAMPLE_S) - 60.0));
+    result &= (0 == plant.violations);
+    CLT_LOGI("Humidity Control Anti-Windup - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The enclosure air model: the temperature and the humidity tend to the room ones, the FAN */
+/* multiplies the air exchange rate. The lights heat the enclosure up during the day, the  */
+/* plants and the substrate evaporate the water all the time. The plants take the CO2 up   */
+/* under the lights and release it by the night.                                          */
+typedef struct
+{
+    double   temperature;
+    double   humidity;
+    double   co2;
+    /* The FAN energy (Wh) */
+    double   energy;
+    uint32_t duty;
+    uint32_t switches;
+    uint32_t off;
+    uint32_t max_off;
+} clt_test_air_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_TestAirStep(clt_test_air_t * p_air, uint32_t duty, bool lights)
+{
+    enum
+    {
+        TAU_S         = 1800,
+        ROOM_T        = 24,
+        ROOM_H        = 50,
+        ROOM_CO2      = 420,
+        /* The FAN at the full speed exchanges the air 10 times faster than the leaks */
+        EXCHANGE_GAIN = 10,
+    };
+    /* The lights alone keep +6 C, the evaporation alone keeps +30 % over the room */
+    const double heat      = (6.0 / TAU_S);
+    const double vapour    = (30.0 / TAU_S);
+    /* The photosynthesis alone keeps -150 ppm, the respiration alone keeps +40 ppm */
+    const double uptake    = (((true == lights) ? -150.0 : 40.0) / TAU_S);
+    /* The FAN power is proportional to the cube of the speed */
+    const double power_max = 1.2;
+    const double flow      = ((double)duty / FAN_MCPWM_PERIOD);
+    const double rate      = ((1.0 + EXCHANGE_GAIN * flow) / TAU_S);
+    uint32_t     t         = 0;
+
+    if ((0 == p_air->duty) != (0 == duty))
+    {
+        p_air->switches++;
+    }
+    p_air->duty = duty;
+
+    for (t = 0; t < CLT_HUMIDITY_SAMPLE_S; t++)
+    {
+        p_air->temperature += (((ROOM_T - p_air->temperature) * rate) + ((true == lights) ? heat : 0));
+        p_air->humidity    += (((ROOM_H - p_air->humidity) * rate) + vapour);
+        p_air->co2         += (((ROOM_CO2 - p_air->co2) * rate) + uptake);
+        p_air->energy      += (power_max * flow * flow * flow / 3600);
+    }
+
+    p_air->off     = (0 == duty) ? (p_air->off + CLT_HUMIDITY_SAMPLE_S) : 0;
+    p_air->max_off = MAX(p_air->max_off, p_air->off);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void clt_TestFanControl(void)
+{
+    enum
+    {
+        HOUR_S = 3600,
+    };
+    climate_setpoint_t setpoint    = {.temperature = 2600, .humidity = 7000};
+    clt_test_air_t     air         = {0};
+    fan_ctrl_t         ctrl        = {0};
+    uint32_t           duty        = 0;
+    uint32_t           t           = 0;
+    uint32_t           count       = 0;
+    double             temperature = 0;
+    double             humidity    = 0;
+    double             co2         = 1000;
+    bool               lights      = false;
+    bool               result      = true;
+
+    /* The day with the lights on and the night */
+    air.temperature = 24.0;
+    air.humidity    = 60.0;
+    air.co2         = 420.0;
+    clt_FanReset(&ctrl);
+    for (t = 0; t < (24 * HOUR_S); t += CLT_HUMIDITY_SAMPLE_S)
+    {
+        lights = ((12 * HOUR_S) > t);
+        duty   = clt_FanControl
+        (
+            &ctrl,
+            &setpoint,
+            (int16_t)(air.temperature * 100),
+            (uint16_t)(air.humidity * 100),
+            (uint16_t)air.co2,
+            CLT_HUMIDITY_SAMPLE_S
+        );
+        result &= ((0 == duty) || ((FAN_DUTY_MIN <= duty) && (FAN_MCPWM_PERIOD >= duty)));
+        clt_TestAirStep(&air, duty, lights);
+        /* The tracking error is checked after the settling time */
+        if (HOUR_S <= t)
+        {
+            temperature += MAX((air.temperature - setpoint.temperature / 100.0), 0);
+            humidity    += MAX((air.humidity - (setpoint.humidity + CLT_FAN_HUMIDITY_MARGIN) / 100.0), 0);
+            co2          = MIN(co2, air.co2);
+            count++;
+        }
+    }
+    CLT_LOGI
+    (
+        "FAN Control - mean excess %.2f C / %.2f %% - min CO2 %.0f ppm - %.3f Wh - %lu switches - max off %lu s",
+        (temperature / count),
+        (humidity / count),
+        co2,
+        air.energy,
+        air.switches,
+        air.max_off
+    );
+    result &= (0.5 > (temperature / count));
+    result &= (1.0 > (humidity / count));
+    /* The CO2 depletion under the lights is replenished from the room */
+    result &= ((CLT_FAN_CO2_LOW - CLT_FAN_CO2_LOW_SPAN / 2) < co2);
+    /* The air is exchanged even when neither the temperature nor the humidity demand it */
+    result &= ((CLT_FAN_EXCHANGE_INTERVAL_S + CLT_FAN_EXCHANGE_RAMP_S) >= air.max_off);
+    /* 1 start per 10 minutes at most */
+    result &= ((24 * 6 * 2) > air.switches);
+    /* Cheaper than the stall duty all the time */
+    result &= ((24 * 1.2 * pow(((double)FAN_DUTY_MIN / FAN_MCPWM_PERIOD), 3)) > air.energy);
+    CLT_LOGI("FAN Control - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
 void Climate_Task_Test(void)
 {
+    clt_TestHumidityControl();
+    clt_TestFanControl();
+
     /* Wait till the task initializes all the pripherals */
     vTaskDelay(pdMS_TO_TICKS(5000));
 
@@ -1,14 +1,33 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
 #include "driver/mcpwm_prelude.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
 #include "fan.h"
 
 //-------------------------------------------------------------------------------------------------
 
+#define FAN_LOG  0
+
+#if (1 == FAN_LOG)
+static const char * gTAG = "FAN";
+#    define FAN_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define FAN_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#else
+#    define FAN_LOGI(...)
+#    define FAN_LOGE(...)
+#endif
+
 #define FAN_MCPWM_TIMER_RESOLUTION_HZ 1000000 /* 1 MHz, 1 tick = 1 us */
-#define FAN_MCPWM_PERIOD              65000   /* 65000 us, 65 ms, 15.38 Hz */
 #define FAN_MCPWM_DUTY                27000   /* 27000 us, 27 ms */
 
 //-------------------------------------------------------------------------------------------------
@@ -18,11 +37,77 @@ enum
     FAN_GROUP_ID = 1,
 };
 
+/* The tachometer is powered by the FAN, so its edges are seen in the on phase of the PWM only. */
+/* The period is measured between the edges of the same on phase, the speed of the FAN with the */
+/* on phase shorter than the period is estimated by the edges count.                           */
+enum
+{
+    /* The tachometer gives 2 pulses per revolution */
+    FAN_TACH_PULSES    = 2,
+    /* The edges closer than this are the glitches of the switching */
+    FAN_TACH_GLITCH_US = 1000,
+    /* The longer periods span the stop of the FAN (150 RPM) */
+    FAN_TACH_GAP_US    = 200000,
+    /* The first edge of the on phase starts the period */
+    FAN_TACH_SKIP      = 1,
+};
+
+/* The target RPM is set by the duty with the nominal FAN curve (the RPM is proportional to  */
+/* the duty), the PI corrects the feedforward duty by the measured RPM                       */
+enum
+{
+    /* The proportional gain is the half of the nominal curve slope */
+    FAN_CTRL_KP_DIV = 2,
+    FAN_CTRL_TI_S   = 4,
+    /* The FAN reaches the speed after the start */
+    FAN_SPINUP_S    = 3,
+    /* The FAN does not rotate */
+    FAN_STALL_S     = 5,
+    /* The worn bearing needs the more duty than the nominal curve gives */
+    FAN_WEAR_PCT    = 30,
+    FAN_WEAR_S      = (10 * 60),
+};
+
+typedef struct
+{
+    /* The capture timer ticks */
+    uint32_t glitch;
+    uint32_t gap;
+    uint32_t last;
+    uint64_t sum;
+    uint32_t periods;
+    uint32_t edges;
+    uint32_t skip;
+} fan_tach_t, * fan_tach_p;
+
+typedef struct
+{
+    /* RPM */
+    uint32_t target;
+    uint32_t rpm;
+    /* FAN_MCPWM_PERIOD units */
+    int32_t  output;
+    int32_t  integral;
+    /* s */
+    uint32_t running;
+    uint32_t stalled;
+    uint32_t worn;
+    uint8_t  alarms;
+} fan_ctrl_t, * fan_ctrl_p;
+
 //-------------------------------------------------------------------------------------------------
 
-static mcpwm_cmpr_handle_t gComparator = NULL;
-static mcpwm_gen_handle_t  gGenerator  = NULL;
-static fan_speed_t         gSpeed      = FAN_SPEED_NONE;
+static mcpwm_cmpr_handle_t        gComparator     = NULL;
+static mcpwm_gen_handle_t         gGenerator      = NULL;
+static uint32_t                   gDuty           = 0;
+static mcpwm_cap_channel_handle_t gCapture        = NULL;
+static uint32_t                   gTachResolution = 0;
+static int64_t                    gTachStart      = 0;
+static fan_tach_t                 gTach           = {0};
+static fan_ctrl_t                 gCtrl           = {0};
+/* The output is read by the PWM interrupt */
+static volatile uint32_t          gOutput         = 0;
+static portMUX_TYPE               gTachLock       = portMUX_INITIALIZER_UNLOCKED;
 
 static uint8_t gSpeeds[] =
 {
@@ -35,6 +120,238 @@ static uint8_t gSpeeds[] =
 
 //-------------------------------------------------------------------------------------------------
 
+static void IRAM_ATTR fan_TachEdge(fan_tach_p p_tach, uint32_t capture)
+{
+    /* The capture timer wraps */
+    uint32_t period = (capture - p_tach->last);
+
+    if ((0 == p_tach->skip) && (p_tach->glitch > period))
+    {
+        return;
+    }
+
+    p_tach->edges++;
+    if (0 < p_tach->skip)
+    {
+        p_tach->skip--;
+    }
+    else if (p_tach->gap >= period)
+    {
+        p_tach->sum += period;
+        p_tach->periods++;
+    }
+    p_tach->last = capture;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The power of the tachometer is restored, the period over the off phase is not measured */
+static void IRAM_ATTR fan_TachPhase(fan_tach_p p_tach)
+{
+    p_tach->skip = FAN_TACH_SKIP;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the RPM of the edges captured in the window (us) with the output duty, 0 - stalled */
+static uint32_t fan_TachRpm(fan_tach_p p_tach, uint32_t resolution, uint32_t window, uint32_t duty)
+{
+    if (0 < p_tach->periods)
+    {
+        return (uint32_t)((60ULL * resolution * p_tach->periods) / (FAN_TACH_PULSES * p_tach->sum));
+    }
+    if ((0 == p_tach->edges) || (0 == window) || (0 == duty))
+    {
+        return 0;
+    }
+
+    /* The edges are seen in the on phase only */
+    return (uint32_t)
+    (
+        (60ULL * 1000000 * p_tach->edges * FAN_MCPWM_PERIOD) / ((uint64_t)FAN_TACH_PULSES * window * duty)
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t fan_Feedforward(uint32_t rpm)
+{
+    return (int32_t)MIN(((rpm * FAN_MCPWM_PERIOD) / CONFIG_FAN_RPM_MAX), FAN_MCPWM_PERIOD);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Makes the control step for the measured RPM dt (s) after the previous one, returns the duty */
+static uint32_t fan_Control(fan_ctrl_p p_ctrl, uint32_t rpm, uint32_t dt)
+{
+    int32_t error    = ((int32_t)p_ctrl->target - (int32_t)rpm);
+    int32_t ff       = fan_Feedforward(p_ctrl->target);
+    int32_t p_term   = ((error * FAN_MCPWM_PERIOD) / (CONFIG_FAN_RPM_MAX * FAN_CTRL_KP_DIV));
+    int32_t integral = 0;
+    bool    wear     = false;
+
+    p_ctrl->rpm = rpm;
+    if (0 == p_ctrl->target)
+    {
+        p_ctrl->output   = 0;
+        p_ctrl->integral = 0;
+        p_ctrl->running  = 0;
+        p_ctrl->stalled  = 0;
+        p_ctrl->alarms  &= ~FAN_ALARM_STALL;
+        return 0;
+    }
+
+    p_ctrl->running += dt;
+    if (FAN_SPINUP_S <= p_ctrl->running)
+    {
+        /* The stalled FAN gets the full duty from the integral, it is the kick */
+        p_ctrl->stalled = (0 == rpm) ? (p_ctrl->stalled + dt) : 0;
+        if (FAN_STALL_S <= p_ctrl->stalled)
+        {
+            p_ctrl->alarms |= FAN_ALARM_STALL;
+        }
+        else if (0 == p_ctrl->stalled)
+        {
+            p_ctrl->alarms &= ~FAN_ALARM_STALL;
+        }
+
+        /* Anti-windup: the integral is frozen while the output is saturated by the error */
+        integral = (p_ctrl->integral + ((error * FAN_MCPWM_PERIOD * (int32_t)dt) / (CONFIG_FAN_RPM_MAX * FAN_CTRL_TI_S)));
+        if (((FAN_MCPWM_PERIOD <= (ff + p_term + p_ctrl->integral)) && (0 < error)) ||
+            ((FAN_DUTY_MIN >= (ff + p_term + p_ctrl->integral)) && (0 > error)))
+        {
+            integral = p_ctrl->integral;
+        }
+        p_ctrl->integral = MIN(MAX(integral, -ff), (FAN_MCPWM_PERIOD - ff));
+    }
+    else
+    {
+        p_term = 0;
+    }
+    p_ctrl->output = MIN(MAX((ff + p_term + p_ctrl->integral), FAN_DUTY_MIN), FAN_MCPWM_PERIOD);
+
+    /* The bearing wear is seen by the duty over the nominal curve for a long time */
+    if ((FAN_SPINUP_S <= p_ctrl->running) && (0 < rpm))
+    {
+        wear = ((p_ctrl->output * 100) > (MAX(ff, FAN_DUTY_MIN) * (100 + FAN_WEAR_PCT))) ||
+               ((FAN_MCPWM_PERIOD == p_ctrl->output) && ((rpm * 100) < (p_ctrl->target * (100 - FAN_WEAR_PCT))));
+        p_ctrl->worn = (true == wear) ? MIN((p_ctrl->worn + dt), FAN_WEAR_S) : (p_ctrl->worn - MIN(p_ctrl->worn, dt));
+        if (FAN_WEAR_S == p_ctrl->worn)
+        {
+            p_ctrl->alarms |= FAN_ALARM_WEAR;
+        }
+        else if (0 == p_ctrl->worn)
+        {
+            p_ctrl->alarms &= ~FAN_ALARM_WEAR;
+        }
+    }
+
+    return (uint32_t)p_ctrl->output;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fan_Apply(uint32_t duty)
+{
+    gOutput = duty;
+
+    if (0 == duty)
+    {
+        ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, 0, true));
+    }
+    else if (FAN_MCPWM_PERIOD == duty)
+    {
+        ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, 1, true));
+    }
+    else
+    {
+        ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(gComparator, duty));
+        ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, -1, true));
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool IRAM_ATTR fan_TachCallback
+(
+    mcpwm_cap_channel_handle_t         cap_chan,
+    const mcpwm_capture_event_data_t * p_data,
+    void *                             p_ctx
+)
+{
+    portENTER_CRITICAL_ISR(&gTachLock);
+    fan_TachEdge(&gTach, p_data->cap_value);
+    portEXIT_CRITICAL_ISR(&gTachLock);
+
+    return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The FAN is powered on the PWM timer empty, it is not powered off by the full duty */
+static bool IRAM_ATTR fan_PwmCallback
+(
+    mcpwm_timer_handle_t             timer,
+    const mcpwm_timer_event_data_t * p_data,
+    void *                           p_ctx
+)
+{
+    if (FAN_MCPWM_PERIOD > gOutput)
+    {
+        portENTER_CRITICAL_ISR(&gTachLock);
+        fan_TachPhase(&gTach);
+        portEXIT_CRITICAL_ISR(&gTachLock);
+    }
+
+    return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fan_TachInit(mcpwm_timer_handle_t timer)
+{
+    mcpwm_cap_timer_handle_t cap_timer = NULL;
+    mcpwm_capture_timer_config_t cap_timer_config =
+    {
+        .group_id = FAN_GROUP_ID,
+        .clk_src  = MCPWM_CAPTURE_CLK_SRC_DEFAULT,
+    };
+    ESP_ERROR_CHECK(mcpwm_new_capture_timer(&cap_timer_config, &cap_timer));
+
+    /* The tachometer is the open collector output */
+    mcpwm_capture_channel_config_t cap_channel_config =
+    {
+        .gpio_num       = CONFIG_FAN_TACH_GPIO,
+        .prescale       = 1,
+        .flags.neg_edge = true,
+        .flags.pull_up  = true,
+    };
+    ESP_ERROR_CHECK(mcpwm_new_capture_channel(cap_timer, &cap_channel_config, &gCapture));
+
+    mcpwm_capture_event_callbacks_t cap_callbacks =
+    {
+        .on_cap = fan_TachCallback,
+    };
+    ESP_ERROR_CHECK(mcpwm_capture_channel_register_event_callbacks(gCapture, &cap_callbacks, NULL));
+
+    mcpwm_timer_event_callbacks_t timer_callbacks =
+    {
+        .on_empty = fan_PwmCallback,
+    };
+    ESP_ERROR_CHECK(mcpwm_timer_register_event_callbacks(timer, &timer_callbacks, NULL));
+
+    ESP_ERROR_CHECK(mcpwm_capture_channel_enable(gCapture));
+    ESP_ERROR_CHECK(mcpwm_capture_timer_enable(cap_timer));
+    ESP_ERROR_CHECK(mcpwm_capture_timer_start(cap_timer));
+    ESP_ERROR_CHECK(mcpwm_capture_timer_get_resolution(cap_timer, &gTachResolution));
+
+    gTach.glitch = (FAN_TACH_GLITCH_US * (gTachResolution / 1000000));
+    gTach.gap    = (FAN_TACH_GAP_US * (gTachResolution / 1000000));
+    gTachStart   = esp_timer_get_time();
+}
+
+//-------------------------------------------------------------------------------------------------
+
 void FAN_Init(void)
 {
     /* Create timer and operator */
@@ -109,6 +426,12 @@ void FAN_Init(void)
     /* Turn off all the FAN */
     ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, 0, true));
 
+    /* The FAN without the tachometer is controlled by the duty only */
+    if (0 <= CONFIG_FAN_TACH_GPIO)
+    {
+        fan_TachInit(timer);
+    }
+
     /* Start the MCPWM timer */
     ESP_ERROR_CHECK(mcpwm_timer_enable(timer));
     ESP_ERROR_CHECK(mcpwm_timer_start_stop(timer, MCPWM_TIMER_START_NO_STOP));
@@ -118,37 +441,236 @@ void FAN_Init(void)
 
 void FAN_SetSpeed(fan_speed_t value)
 {
-    uint32_t duty = 0;
+    FAN_SetDuty(gSpeeds[value] * FAN_MCPWM_PERIOD / UINT8_MAX);
+}
+
+//-------------------------------------------------------------------------------------------------
 
-    gSpeed = value;
+/* Returns the highest speed level the current duty reaches */
+fan_speed_t FAN_GetSpeed(void)
+{
+    fan_speed_t result = FAN_SPEED_NONE;
 
-    if (FAN_SPEED_NONE == value)
+    while ((FAN_SPEED_FULL > result) && ((gSpeeds[result + 1] * FAN_MCPWM_PERIOD / UINT8_MAX) <= gDuty))
     {
-        ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, 0, true));
+        result++;
     }
-    else if (FAN_SPEED_FULL == value)
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The duty sets the target RPM of the nominal FAN curve, the FAN with the tachometer keeps it */
+void FAN_SetDuty(uint32_t duty)
+{
+    gDuty = (FAN_MCPWM_PERIOD < duty) ? FAN_MCPWM_PERIOD : duty;
+    gCtrl.target = ((gDuty * CONFIG_FAN_RPM_MAX) / FAN_MCPWM_PERIOD);
+
+    if (NULL == gCapture)
     {
-        ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, 1, true));
+        fan_Apply(gDuty);
     }
     else
     {
-        duty = (gSpeeds[value] * FAN_MCPWM_PERIOD / UINT8_MAX);
-        ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(gComparator, duty));
-        ESP_ERROR_CHECK(mcpwm_generator_set_force_level(gGenerator, -1, true));
+        fan_Apply(fan_Control(&gCtrl, gCtrl.rpm, 0));
     }
 }
 
 //-------------------------------------------------------------------------------------------------
 
-fan_speed_t FAN_GetSpeed(void)
+uint32_t FAN_GetDuty(void)
+{
+    return gDuty;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Measures the RPM and regulates the duty, it is called every dt (s) */
+void FAN_Process(uint32_t dt)
+{
+    fan_tach_t tach   = {0};
+    int64_t    now    = esp_timer_get_time();
+    uint32_t   rpm    = 0;
+    uint32_t   output = 0;
+    uint8_t    alarms = gCtrl.alarms;
+
+    if (NULL == gCapture)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&gTachLock);
+    tach          = gTach;
+    gTach.sum     = 0;
+    gTach.periods = 0;
+    gTach.edges   = 0;
+    portEXIT_CRITICAL(&gTachLock);
+
+    rpm        = fan_TachRpm(&tach, gTachResolution, (uint32_t)(now - gTachStart), gOutput);
+    gTachStart = now;
+    output     = fan_Control(&gCtrl, rpm, dt);
+    if (output != gOutput)
+    {
+        fan_Apply(output);
+    }
+    if (alarms != gCtrl.alarms)
+    {
+        FAN_LOGE("Alarms: %02X - RPM: %lu - Duty: %lu", gCtrl.alarms, rpm, output);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t FAN_GetRpm(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return gCtrl.rpm;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t FAN_GetAlarms(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return gCtrl.alarms;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* Captures the edges of the FAN rotating at the RPM with the PWM duty (us) for 1 s, every 5th */
+/* edge is followed by the glitch. The capture timer of 1 MHz wraps during the window.         */
+static uint32_t fan_TestTach(uint32_t rpm, uint32_t duty)
+{
+    enum
+    {
+        WINDOW_US = 1000000,
+        STEP_US   = 10,
+        GLITCH_US = 300,
+        BASE      = (UINT32_MAX - 300000),
+    };
+    fan_tach_t tach   = {0};
+    uint32_t   period = ((60 * 1000000) / (FAN_TACH_PULSES * rpm));
+    uint32_t   next   = (period / 3);
+    uint32_t   phase  = 0;
+    uint32_t   time   = 0;
+    uint32_t   glitch = UINT32_MAX;
+    uint32_t   edge   = 0;
+
+    tach.glitch = FAN_TACH_GLITCH_US;
+    tach.gap    = FAN_TACH_GAP_US;
+    for (time = 0; time < WINDOW_US; time += STEP_US)
+    {
+        phase = (time % FAN_MCPWM_PERIOD);
+        if ((FAN_MCPWM_PERIOD > duty) && (0 == phase))
+        {
+            fan_TachPhase(&tach);
+        }
+        if ((glitch == time) && (phase < duty))
+        {
+            fan_TachEdge(&tach, (BASE + time));
+        }
+        if (next <= time)
+        {
+            if (phase < duty)
+            {
+                fan_TachEdge(&tach, (BASE + time));
+            }
+            if (0 == (++edge % 5))
+            {
+                glitch = (time + GLITCH_US);
+            }
+            /* The jitter of the magnet poles */
+            next += (period + (((time / STEP_US) % 3) - 1) * (period / 100));
+        }
+    }
+
+    return fan_TachRpm(&tach, FAN_MCPWM_TIMER_RESOLUTION_HZ, WINDOW_US, duty);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The FAN model reaches the RPM of its capacity (% of the nominal curve) with the 2 s lag */
+static bool fan_TestControl(fan_ctrl_p p_ctrl, uint32_t capacity, uint32_t target, uint32_t seconds, uint32_t * p_rpm)
 {
-    return gSpeed;
+    enum
+    {
+        LAG_S = 2,
+    };
+    uint32_t second = 0;
+    uint32_t rpm    = *p_rpm;
+    uint32_t steady = 0;
+    uint32_t duty   = 0;
+
+    p_ctrl->target = target;
+    duty = fan_Control(p_ctrl, rpm, 0);
+    for (second = 0; second < seconds; second++)
+    {
+        steady = ((duty * CONFIG_FAN_RPM_MAX / FAN_MCPWM_PERIOD) * capacity / 100);
+        rpm    = (uint32_t)((int32_t)rpm + ((int32_t)steady - (int32_t)rpm) / LAG_S);
+        duty   = fan_Control(p_ctrl, rpm, 1);
+    }
+    *p_rpm = rpm;
+
+    /* Within 2 % */
+    return ((abs((int32_t)target - (int32_t)rpm) * 50) <= target);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fan_TestRegulation(void)
+{
+    fan_ctrl_t ctrl   = {0};
+    uint32_t   rpm    = 0;
+    uint32_t   value  = 0;
+    bool       result = true;
+
+    /* The capture math: the periods of the on phases, the edges of the short ones */
+    value   = fan_TestTach(1500, FAN_MCPWM_PERIOD);
+    result &= ((1470 <= value) && (1530 >= value));
+    value   = fan_TestTach(1200, (FAN_MCPWM_PERIOD * 6 / 10));
+    result &= ((1176 <= value) && (1224 >= value));
+    FAN_LOGI("Tach 1200 RPM at 60 %%: %lu", value);
+    value   = fan_TestTach(500, FAN_DUTY_MIN);
+    result &= ((375 <= value) && (625 >= value));
+    FAN_LOGI("Tach 500 RPM at the minimum: %lu", value);
+    value   = fan_TestTach(1, FAN_MCPWM_PERIOD);
+    result &= (0 == value);
+
+    /* The weaker FAN is regulated to the target without the alarms */
+    result &= fan_TestControl(&ctrl, 85, 1000, 20, &rpm);
+    result &= (0 == ctrl.alarms);
+    FAN_LOGI("Control - RPM: %lu - Duty: %ld", rpm, ctrl.output);
+
+    /* The locked rotor gets the full duty and the stall alarm, it is cleared by the rotation */
+    rpm     = 0;
+    (void)fan_TestControl(&ctrl, 0, 1000, (FAN_STALL_S + 1), &rpm);
+    result &= (FAN_ALARM_STALL == ctrl.alarms) && (FAN_MCPWM_PERIOD == ctrl.output);
+    result &= fan_TestControl(&ctrl, 85, 1000, 30, &rpm);
+    result &= (0 == ctrl.alarms);
+
+    /* The worn FAN keeps the speed with the more duty, the alarm follows in time */
+    result &= fan_TestControl(&ctrl, 60, 800, (FAN_WEAR_S / 2), &rpm);
+    result &= (0 == ctrl.alarms);
+    result &= fan_TestControl(&ctrl, 60, 800, FAN_WEAR_S, &rpm);
+    result &= (FAN_ALARM_WEAR == ctrl.alarms);
+    FAN_LOGI("Wear - RPM: %lu - Duty: %ld", rpm, ctrl.output);
+
+    /* The stop clears the stall, not the wear */
+    (void)fan_TestControl(&ctrl, 60, 0, 1, &rpm);
+    result &= (0 == ctrl.output) && (FAN_ALARM_WEAR == ctrl.alarms);
+
+    FAN_LOGI("FAN Regulation - %s", (true == result) ? "PASS" : "FAIL");
 }
 
 //-------------------------------------------------------------------------------------------------
 
 void FAN_Test(void)
 {
+    fan_TestRegulation();
+
     FAN_Init();
     FAN_SetSpeed(FAN_SPEED_FULL);
     vTaskDelay(pdMS_TO_TICKS(5000));
@@ -160,6 +682,8 @@ void FAN_Test(void)
     vTaskDelay(pdMS_TO_TICKS(5000));
     FAN_SetSpeed(FAN_SPEED_LOW);
     vTaskDelay(pdMS_TO_TICKS(10000));
+    FAN_SetDuty(FAN_DUTY_MIN);
+    vTaskDelay(pdMS_TO_TICKS(10000));
     FAN_SetSpeed(FAN_SPEED_NONE);
     vTaskDelay(pdMS_TO_TICKS(300));
 }
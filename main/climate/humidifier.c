@@ -1,12 +1,22 @@
+#include <string.h>
+#include <sys/param.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "driver/gpio.h"
 #include "sdkconfig.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
 
+#include "types.h"
 #include "humidifier.h"
+#include "climate_fusion.h"
 #include "i2c.h"
+#include "i2c_scheduler.h"
+#include "trace.h"
+#include "bench.h"
 
 //-------------------------------------------------------------------------------------------------
 
@@ -28,7 +38,7 @@ static const char * gTAG = "HUMIDIFIER";
 enum
 {
     BME280_I2C_ADDRESS        = 0xEC,
-    BME280_I2C_SPEED_HZ       = 100000,
+    BME280_I2C_SPEED_HZ       = 400000,
     /* Specific values */
     BME280_CHIP_ID_VALUE      = 0x60,
     BME280_SOFT_RESET_VALUE   = 0xB6,
@@ -118,6 +128,38 @@ typedef struct
     int16_t  H6;
 } bme280_calibration_t;
 
+/* The calibration terms are folded once after the NVM read, so the compensation evaluates */
+/* only the terms of the measurement: the pressure and the humidity polynomials of t_fine */
+/* are evaluated by Horner. All the terms are exact, so the result is bit-exact with DS.  */
+typedef struct
+{
+    int32_t t1;
+    /* T1 * 2 */
+    int32_t t1_x2;
+    int32_t t2;
+    int32_t t3;
+    int64_t p1;
+    /* P2 * 2^20 */
+    int64_t p2_x2p20;
+    int64_t p3;
+    /* P4 * 2^35 */
+    int64_t p4_x2p35;
+    /* P5 * 2^17 */
+    int64_t p5_x2p17;
+    int64_t p6;
+    /* P7 * 2^4 */
+    int64_t p7_x2p4;
+    int64_t p8;
+    int64_t p9;
+    int32_t h1;
+    int32_t h2;
+    int32_t h3;
+    /* 2^14 - H4 * 2^20 */
+    int32_t h4_offset;
+    int32_t h5;
+    int32_t h6;
+} bme280_compensation_t;
+
 typedef struct
 {
     uint8_t press_msb;
@@ -277,7 +319,7 @@ typedef struct
 enum
 {
     SHT41_I2C_ADDRESS     = 0x88,
-    SHT41_I2C_SPEED_HZ    = 100000,
+    SHT41_I2C_SPEED_HZ    = 400000,
     /* Specific values */
     SHT41_MEASURE         = 0xFD,
     SHT41_SOFT_RESET      = 0x94,
@@ -301,64 +343,222 @@ typedef struct
     uint16_t humidity;
 } sht41_measurement_t;
 
+/* The sensors are acquired by the state machine stepped from the Climate task. Every step */
+/* makes one bus transaction at most and the states wait by the time instead of delays.    */
+/* The state is named by the action made when its waiting time is over.                   */
+typedef enum
+{
+    SENSORS_STATE_OFF = 0,
+    SENSORS_STATE_SHT41_RESET,
+    SENSORS_STATE_BME280_ID,
+    SENSORS_STATE_BME280_RESET,
+    SENSORS_STATE_BME280_NVM,
+    SENSORS_STATE_BME280_CALIBRATION,
+    SENSORS_STATE_BME280_CONFIGURE,
+    SENSORS_STATE_IDLE,
+    SENSORS_STATE_READOUT,
+} sensors_state_t;
+
+enum
+{
+    /* The power of the Humidifier board (the sensors too) is stabilized */
+    SENSORS_POWER_UP_MS        = 900,
+    SENSORS_SHT41_RESET_MS     = 2,
+    SENSORS_BME280_BOOT_MS     = 10,
+    SENSORS_BME280_NVM_POLL_MS = 10,
+    SENSORS_BME280_NVM_POLLS   = 20,
+    /* The first measurement of the normal mode with the x16 oversampling is ready */
+    SENSORS_BME280_FIRST_MS    = 120,
+    SENSORS_SHT41_MEASURE_MS   = 10,
+    /* The heater is on for 0.1 s, then the measurement is made */
+    SENSORS_SHT41_HEAT_MS      = 120,
+    /* The SHT41 readings are excluded from the fusion till it is cooled after the heating */
+    SENSORS_SHT41_COOL_MS      = 15000,
+    /* The backoff after the failed transaction is doubled on every retry */
+    SENSORS_RECOVERY_MS        = 50,
+    SENSORS_RECOVERY_SHIFT_MAX = 5,
+    /* The acquisition fails after this count of the failed transactions */
+    SENSORS_RETRIES            = 3,
+};
+
+typedef struct
+{
+    FW_RESULT (* tx)(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz);
+    FW_RESULT (* rx)(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz);
+    FW_RESULT (* txrx)(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz);
+    void      (* recover)(void);
+} sensors_bus_t;
+
+typedef struct
+{
+    sensors_state_t state;
+    uint32_t        start;
+    uint32_t        wait;
+    uint32_t        polls;
+    uint32_t        retries;
+    uint32_t        errors;
+    uint32_t        heated;
+    bool            trigger;
+    bool            busy;
+    bool            heat;
+    bool            cooling;
+} sensors_t;
+
+/* The mist state can not be read, it is observed by the humidity response to the click: the */
+/* mist raises the humidity rate. The click is repeated only when the observed state differs */
+/* from the requested one, the power cycle resyncs the device which ignores the clicks.      */
+enum
+{
+    /* The slope is fitted over these humidity samples */
+    MIST_SAMPLES    = 4,
+    /* The samples after the click are skipped till the mist reaches the sensors */
+    MIST_SETTLE     = 2,
+    /* 0.01 %/min, the mist raises the humidity rate at least by this */
+    MIST_SLOPE      = 50,
+    /* 0.01 %, the rise is not observable over this */
+    MIST_SATURATION = 9500,
+    /* The clicks repeated before the power cycle */
+    MIST_RETRIES    = 2,
+};
+
+typedef enum
+{
+    MIST_ACTION_NONE = 0,
+    MIST_ACTION_CLICK,
+    /* The power cycle turns the mist off, the click follows if the mist is requested */
+    MIST_ACTION_CYCLE,
+} mist_action_t;
+
+typedef struct
+{
+    /* 0.01 %, the oldest sample is at the index */
+    int32_t  samples[MIST_SAMPLES];
+    uint32_t index;
+    uint32_t filled;
+    /* s */
+    uint32_t dt;
+    /* The samples since the click */
+    uint32_t elapsed;
+    /* 0.01 %/min, the humidity rate before the click */
+    int32_t  baseline;
+    uint32_t retries;
+    uint32_t clicks;
+    uint32_t repeats;
+    uint32_t cycles;
+    /* The requested state */
+    bool     on;
+    /* The requested state is not confirmed yet */
+    bool     pending;
+    bool     based;
+} mist_observer_t, * mist_observer_p;
+
 //-------------------------------------------------------------------------------------------------
 
-static i2c_device_p         gBme280             = NULL;
-static bme280_calibration_t gBme280Calibrartion = {0};
-static bme280_measurement_t gBme280Measurement  = {0};
-static bool                 gOn                 = false;
-static i2c_device_p         gSht41              = NULL;
-static sht41_measurement_t  gSht41Measurement   = {0};
+static i2c_device_p          gBme280             = NULL;
+static bme280_calibration_t  gBme280Calibrartion = {0};
+static bme280_compensation_t gBme280Compensation = {0};
+static bme280_measurement_t  gBme280Measurement  = {0};
+static i2c_device_p          gSht41              = NULL;
+static sht41_measurement_t   gSht41Measurement   = {0};
+static sensors_t             gSensors            = {0};
+static i2c_client_t          gSensorsClient      = {0};
+static mist_observer_t       gMist               = {0};
+
+static const sensors_bus_t gcI2CBus = {I2C_Tx, I2C_Rx, I2C_TxRx, I2C_Recover};
+static const sensors_bus_t * gBus   = &gcI2CBus;
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_Rd(uint8_t offset, uint8_t * p_buffer, uint8_t length)
+static FW_RESULT bme280_Rd(uint8_t offset, uint8_t * p_buffer, uint8_t length)
 {
-    I2C_TxRx(gBme280, &offset, sizeof(offset), p_buffer, length);
+    return gBus->txrx(gBme280, &offset, sizeof(offset), p_buffer, length);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_Wr(uint8_t offset, uint8_t value)
+static FW_RESULT bme280_Wr(uint8_t offset, uint8_t value)
 {
     uint8_t buffer[sizeof(offset) + sizeof(value)] = {offset, value};
-    I2C_Tx(gBme280, buffer, sizeof(buffer));
+    return gBus->tx(gBme280, buffer, sizeof(buffer));
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static bool bme280_IsReadingCalibration(void)
+static FW_RESULT bme280_IsReadingCalibration(bool * p_reading)
 {
     bme280_status_t status = {0};
-    bme280_Rd(BME280_REG_ADDR_STATUS, (uint8_t *)&status, sizeof(status));
-    return (0 != status.im_update);
+    FW_RESULT       result = bme280_Rd(BME280_REG_ADDR_STATUS, (uint8_t *)&status, sizeof(status));
+
+    *p_reading = (0 != status.im_update);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT bme280_CheckChipId(void)
+{
+    uint8_t   chip_id = 0;
+    FW_RESULT result  = bme280_Rd(BME280_REG_ADDR_CHIPID, &chip_id, sizeof(chip_id));
+
+    if ((FW_SUCCESS == result) && (BME280_CHIP_ID_VALUE != chip_id))
+    {
+        HUMDFR_LOGE("Incorrect BME280 chip ID!");
+        result = FW_ERROR;
+    }
+
+    return result;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static bool bme280_IsChipIdCorrect(void)
+static FW_RESULT bme280_SoftReset(void)
 {
-    uint8_t chip_id = 0;
-    bme280_Rd(BME280_REG_ADDR_CHIPID, &chip_id, sizeof(chip_id));
-    return (BME280_CHIP_ID_VALUE == chip_id);
+    return bme280_Wr(BME280_REG_ADDR_SOFTRESET, BME280_SOFT_RESET_VALUE);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_SoftReset(void)
+static void bme280_Precompute(const bme280_calibration_t * p_cal, bme280_compensation_t * p_comp)
 {
-    bme280_Wr(BME280_REG_ADDR_SOFTRESET, BME280_SOFT_RESET_VALUE);
+    p_comp->t1        = p_cal->T1;
+    p_comp->t1_x2     = ((int32_t)p_cal->T1 << 1);
+    p_comp->t2        = p_cal->T2;
+    p_comp->t3        = p_cal->T3;
+    p_comp->p1        = p_cal->P1;
+    p_comp->p2_x2p20  = ((int64_t)p_cal->P2 * ((int64_t)1 << 20));
+    p_comp->p3        = p_cal->P3;
+    p_comp->p4_x2p35  = ((int64_t)p_cal->P4 * ((int64_t)1 << 35));
+    p_comp->p5_x2p17  = ((int64_t)p_cal->P5 * ((int64_t)1 << 17));
+    p_comp->p6        = p_cal->P6;
+    p_comp->p7_x2p4   = ((int64_t)p_cal->P7 * 16);
+    p_comp->p8        = p_cal->P8;
+    p_comp->p9        = p_cal->P9;
+    p_comp->h1        = p_cal->H1;
+    p_comp->h2        = p_cal->H2;
+    p_comp->h3        = p_cal->H3;
+    p_comp->h4_offset = (int32_t)(16384 - ((uint32_t)(int32_t)p_cal->H4 << 20));
+    p_comp->h5        = p_cal->H5;
+    p_comp->h6        = p_cal->H6;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_ReadCalibration(void)
+static FW_RESULT bme280_ReadCalibration(void)
 {
     bme280_nvm_calibration_part_a_t part_a = {0};
     bme280_nvm_calibration_part_b_t part_b = {0};
+    FW_RESULT                       result = FW_SUCCESS;
 
-    bme280_Rd(BME280_REG_ADDR_DIG_T1, (uint8_t *)&part_a, sizeof(part_a));
-    bme280_Rd(BME280_REG_ADDR_DIG_H2, (uint8_t *)&part_b, sizeof(part_b));
+    result = bme280_Rd(BME280_REG_ADDR_DIG_T1, (uint8_t *)&part_a, sizeof(part_a));
+    if (FW_SUCCESS == result)
+    {
+        result = bme280_Rd(BME280_REG_ADDR_DIG_H2, (uint8_t *)&part_b, sizeof(part_b));
+    }
+    if (FW_SUCCESS != result)
+    {
+        return result;
+    }
 
     HUMDFR_LOGI("dig_T1 = %04X - %d", part_a.dig_T1, part_a.dig_T1);
     HUMDFR_LOGI("dig_T2 = %04X - %d", part_a.dig_T2, part_a.dig_T2);
@@ -420,153 +620,127 @@ static void bme280_ReadCalibration(void)
     HUMDFR_LOGI("H4 = %04X: %d", gBme280Calibrartion.H4, gBme280Calibrartion.H4);
     HUMDFR_LOGI("H5 = %04X: %d", gBme280Calibrartion.H5, gBme280Calibrartion.H5);
     HUMDFR_LOGI("H6 = %04X: %d", gBme280Calibrartion.H6, gBme280Calibrartion.H6);
+
+    bme280_Precompute(&gBme280Calibrartion, &gBme280Compensation);
+
+    return result;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_SetSampling(void)
+static FW_RESULT bme280_SetSampling(void)
 {
     bme280_config_t    config    = {0};
     bme280_ctrl_meas_t ctrl_meas = {0};
     bme280_ctrl_hum_t  ctrl_hum  = {0};
+    FW_RESULT          result    = FW_SUCCESS;
 
     /* Changes to "ctrl_hum" register only become effective after a write operation to "ctrl_meas"
      * register, otherwise the values won't be applied (see DS 5.4.3) */
     ctrl_hum.osrs_h = BME280_SAMPLING_X16;
-    bme280_Wr(BME280_REG_ADDR_CTRL_HUM, ctrl_hum.raw);
+    result = bme280_Wr(BME280_REG_ADDR_CTRL_HUM, ctrl_hum.raw);
 
     /* Config */
     config.filter = BME280_FILTER_OFF;
     config.t_sb   = BME280_STANDBY_MS_10;
-    bme280_Wr(BME280_REG_ADDR_CONFIG, config.raw);
+    if (FW_SUCCESS == result)
+    {
+        result = bme280_Wr(BME280_REG_ADDR_CONFIG, config.raw);
+    }
    
     /* Ctrl_meas */
     ctrl_meas.mode   = BME280_MODE_NORMAL;
     ctrl_meas.osrs_p = BME280_SAMPLING_X16;
     ctrl_meas.osrs_t = BME280_SAMPLING_X16;
-    bme280_Wr(BME280_REG_ADDR_CTRL_MEAS, ctrl_meas.raw);
+    if (FW_SUCCESS == result)
+    {
+        result = bme280_Wr(BME280_REG_ADDR_CTRL_MEAS, ctrl_meas.raw);
+    }
+
+    return result;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_CompensateT(uint32_t temp_adc, int32_t * p_temp_fine)
+static int16_t bme280_CompensateT(const bme280_compensation_t * p_comp, uint32_t temp_adc, int32_t * p_temp_fine)
 {
     int32_t var1        = 0;
     int32_t var2        = 0;
     int32_t temperature = 0;
 
-    var1 = (int32_t)((temp_adc >> 3) - ((int32_t)gBme280Calibrartion.T1 << 1));
-    var1 = ((var1 * ((int32_t)gBme280Calibrartion.T2)) >> 11);
-    var2 = (int32_t)((temp_adc >> 4) - ((int32_t)gBme280Calibrartion.T1));
-    var2 = ((((var2 * var2) >> 12) * ((int32_t)gBme280Calibrartion.T3)) >> 14);
+    var1 = ((((int32_t)(temp_adc >> 3) - p_comp->t1_x2) * p_comp->t2) >> 11);
+    var2 = ((int32_t)(temp_adc >> 4) - p_comp->t1);
+    var2 = ((((var2 * var2) >> 12) * p_comp->t3) >> 14);
     *p_temp_fine = (var1 + var2);
-    temperature = ((*p_temp_fine * 5 + 128) >> 8);
-
-    if (-4000 > temperature)
-    {
-        temperature = -4000;
-    }
-    else if (8500 < temperature)
-    {
-        temperature = 8500;
-    }
+    temperature  = ((*p_temp_fine * 5 + 128) >> 8);
 
-    gBme280Measurement.temperature = temperature;
-
-    HUMDFR_LOGI("Temperature = %d", (int)temperature);
+    return (int16_t)MIN(MAX(temperature, -4000), 8500);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_CompensateP(uint32_t press_adc, int32_t temp_fine)
+/* Returns the pressure in 0.001 Pa */
+static uint32_t bme280_CompensateP(const bme280_compensation_t * p_comp, uint32_t press_adc, int32_t temp_fine)
 {
+    int64_t  t        = 0;
     int64_t  var1     = 0;
     int64_t  var2     = 0;
-    int64_t  var3     = 0;
-    int64_t  var4     = 0;
-    uint32_t pressure = 0;
+    int64_t  p        = 0;
+    uint32_t pressure = 3000000;
 
-    var1 = (((int64_t)temp_fine) - 128000);
-    var2 = (var1 * var1 * (int64_t)gBme280Calibrartion.P6);
-    var2 = (var2 + ((var1 * (int64_t)gBme280Calibrartion.P5) << 17));
-    var2 = (var2 + (((int64_t)gBme280Calibrartion.P4) << 35));
-    var3 = ((var1 * var1 * (int64_t)gBme280Calibrartion.P3) >> 8);
-    var1 = (var3 + ((var1 * ((int64_t)gBme280Calibrartion.P2) << 12)));
-    var3 = (((int64_t)1) << 47);
-    var1 = ((var3 + var1) * ((int64_t)gBme280Calibrartion.P1) >> 33);
+    /* var2 = P6 * t^2 + P5 * 2^17 * t + P4 * 2^35                     */
+    /* var1 = (((P3 * t^2 + P2 * 2^20 * t + 2^55) >> 8) * P1) >> 33     */
+    t    = ((int64_t)temp_fine - 128000);
+    var2 = ((t * p_comp->p6 + p_comp->p5_x2p17) * t + p_comp->p4_x2p35);
+    var1 = (((t * p_comp->p3 + p_comp->p2_x2p20) * t + ((int64_t)1 << 55)) >> 8);
+    var1 = ((var1 * p_comp->p1) >> 33);
 
     /* To avoid divide by zero exception */
-    if (var1 != 0)
-    {
-        var4 = (1048576 - press_adc);
-        var4 = ((((var4 << 31) - var2) * 3125) / var1);
-        var1 = ((((int64_t)gBme280Calibrartion.P9) * (var4 >> 13) * (var4 >> 13)) >> 25);
-        var2 = ((((int64_t)gBme280Calibrartion.P8) * var4) >> 19);
-        var4 = ((var4 + var1 + var2) >> 8) + (((int64_t)gBme280Calibrartion.P7) << 4);
-        pressure = (uint32_t)(((var4 >> 1) * 100) >> 7);
-
-        if (3000000 > pressure)
-        {
-            pressure = 3000000;
-        }
-        else if (11000000 < pressure)
-        {
-            pressure = 11000000;
-        }
-    }
-    else
+    if (0 != var1)
     {
-        pressure = 3000000;
+        p        = ((((((int64_t)1048576 - press_adc) << 31) - var2) * 3125) / var1);
+        var1     = ((p_comp->p9 * (p >> 13) * (p >> 13)) >> 25);
+        var2     = ((p_comp->p8 * p) >> 19);
+        p        = (((p + var1 + var2) >> 8) + p_comp->p7_x2p4);
+        pressure = (uint32_t)(((p >> 1) * 100) >> 7);
+        pressure = MIN(MAX(pressure, 3000000), 11000000);
     }
-    pressure *= 10;
 
-    gBme280Measurement.pressure = pressure;
-
-    HUMDFR_LOGI("Pressure    = %d", (int)pressure);
+    return (pressure * 10);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_CompensateH(uint32_t hum_adc, int32_t temp_fine)
+/* Returns the humidity in 0.01 % */
+static uint16_t bme280_CompensateH(const bme280_compensation_t * p_comp, uint32_t hum_adc, int32_t temp_fine)
 {
-    int32_t  var1         = 0;
-    int32_t  var2         = 0;
-    int32_t  var3         = 0;
-    int32_t  var4         = 0;
-    int32_t  var5         = 0;
-    uint32_t humidity     = 0;
-
-    var1 = (temp_fine - ((int32_t)76800));
-    var2 = (int32_t)(hum_adc << 14);
-    var3 = (int32_t)(((int32_t)gBme280Calibrartion.H4) << 20);
-    var4 = (((int32_t)gBme280Calibrartion.H5) * var1);
-    var5 = ((((var2 - var3) - var4) + (int32_t)16384) >> 15);
-    var2 = ((var1 * ((int32_t)gBme280Calibrartion.H6)) >> 10);
-    var3 = ((var1 * ((int32_t)gBme280Calibrartion.H3)) >> 11);
-    var4 = (((var2 * (var3 + (int32_t)32768)) / 1024) + (int32_t)2097152);
-    var2 = (((var4 * ((int32_t)gBme280Calibrartion.H2)) + 8192) >> 14);
-    var3 = (var5 * var2);
-    var4 = (((var3 >> 15) * (var3 >> 15)) >> 7);
-    var5 = (var3 - ((var4 * ((int32_t)gBme280Calibrartion.H1)) >> 4));
-    var5 = (var5 < 0 ? 0 : var5);
-    var5 = (var5 > 419430400 ? 419430400 : var5);
-    humidity = (uint32_t)(var5 >> 12);
-
-    if (102400 < humidity)
-    {
-        humidity = 102400;
-    }
-
-    humidity = (uint32_t)(100.0 * humidity / 1024);
-
-    gBme280Measurement.humidity = humidity;
-
-    HUMDFR_LOGI("Humidity    = %d", (int)humidity);
+    int32_t  t        = 0;
+    int32_t  var1     = 0;
+    int32_t  var2     = 0;
+    int32_t  var3     = 0;
+    uint32_t humidity = 0;
+
+    t    = (temp_fine - 76800);
+    /* The temperature dependent scale */
+    var1 = ((t * p_comp->h6) >> 10);
+    var2 = ((t * p_comp->h3) >> 11);
+    var2 = (((var1 * (var2 + 32768)) / 1024) + 2097152);
+    var2 = (((var2 * p_comp->h2) + 8192) >> 14);
+    /* The offset corrected ADC */
+    var1 = ((((int32_t)(hum_adc << 14) - (p_comp->h5 * t)) + p_comp->h4_offset) >> 15);
+    var1 = (var1 * var2);
+    var3 = (((var1 >> 15) * (var1 >> 15)) >> 7);
+    var1 = (var1 - ((var3 * p_comp->h1) >> 4));
+    var1 = MIN(MAX(var1, 0), 419430400);
+    humidity = MIN((uint32_t)(var1 >> 12), 102400);
+
+    /* 1/1024 % -> 0.01 % */
+    return (uint16_t)((humidity * 100) >> 10);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_Readout(void)
+static FW_RESULT bme280_Readout(void)
 {
     enum
     {
@@ -578,9 +752,15 @@ static void bme280_Readout(void)
     uint32_t                temp_adc  = 0;
     uint32_t                hum_adc   = 0;
     int32_t                 temp_fine = 0;
+    FW_RESULT               result    = FW_SUCCESS;
 
+    TRACE_SPAN(TRACE_BME280_READOUT);
     /* Burst read */
-    bme280_Rd(BME280_REG_ADDR_PRESS, (uint8_t *)&meas, sizeof(meas));
+    result = bme280_Rd(BME280_REG_ADDR_PRESS, (uint8_t *)&meas, sizeof(meas));
+    if (FW_SUCCESS != result)
+    {
+        return result;
+    }
 
     press_adc = ((meas.press_msb << 12) | (meas.press_lsb << 4) | (meas.press_xlsb));
     temp_adc  = ((meas.temp_msb << 12) | (meas.temp_lsb << 4) | (meas.temp_xlsb));
@@ -592,154 +772,108 @@ static void bme280_Readout(void)
 
     if (DISABLED_20BITS != temp_adc)
     {
-        bme280_CompensateT(temp_adc, &temp_fine);
+        gBme280Measurement.temperature = bme280_CompensateT(&gBme280Compensation, temp_adc, &temp_fine);
+        HUMDFR_LOGI("Temperature = %d", (int)gBme280Measurement.temperature);
 
         if (DISABLED_20BITS != press_adc)
         {
-            bme280_CompensateP(press_adc, temp_fine);
+            gBme280Measurement.pressure = bme280_CompensateP(&gBme280Compensation, press_adc, temp_fine);
+            HUMDFR_LOGI("Pressure    = %d", (int)gBme280Measurement.pressure);
         }
         if (DISABLED_16BITS != hum_adc)
         {
-            bme280_CompensateH(hum_adc, temp_fine);
+            gBme280Measurement.humidity = bme280_CompensateH(&gBme280Compensation, hum_adc, temp_fine);
+            HUMDFR_LOGI("Humidity    = %d", (int)gBme280Measurement.humidity);
         }
     }
+
+    return result;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_Init(void)
+static FW_RESULT sht41_Rd(uint8_t * p_buffer, uint8_t length)
 {
-    enum
-    {
-        WAKE_UP_DELAY = 300,
-        WAITING_DELAY = 50,
-    };
-
-    if (NULL == gBme280)
-    {
-        i2c_device_config_t bme280_dvc_config =
-        {
-            .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-            .device_address  = (BME280_I2C_ADDRESS >> 1),
-            .scl_speed_hz    = BME280_I2C_SPEED_HZ,
-            .scl_wait_us     = 0,
-        };
-
-        HUMDFR_LOGI("Init the BME280 I2C");
-        I2C_Init();
-
-        gBme280 = I2C_AddDevice(&bme280_dvc_config);
-
-        /* Check if BME280 chip ID is correct */
-        if (false == bme280_IsChipIdCorrect())
-        {
-            HUMDFR_LOGE("Incorrect BME280 chip ID!");
-            ESP_ERROR_CHECK(ESP_FAIL);
-        }
-
-        /* Reset the BME280 using soft-reset. This makes sure the IIR is off, etc. */
-        bme280_SoftReset();
-
-        /* Wait for chip to wake up */
-        vTaskDelay(pdMS_TO_TICKS(WAKE_UP_DELAY));
-
-        /* If the chip is still reading calibration - delay */
-        while (true == bme280_IsReadingCalibration())
-        {
-            vTaskDelay(pdMS_TO_TICKS(WAITING_DELAY));
-        }
-
-        /* Read trimming parameters, see DS 4.2.2 */
-        bme280_ReadCalibration();
-    }
-
-    HUMDFR_LOGI("Init of BME280 is finished");
+    return gBus->rx(gSht41, p_buffer, length);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void bme280_StartMeasuring(void)
+static FW_RESULT sht41_Wr(uint8_t value)
 {
-    enum
-    {
-        WAKE_UP_DELAY = 300,
-        WAITING_DELAY = 50,
-    };
-
-    /* Check if BME280 chip ID is correct */
-    if (false == bme280_IsChipIdCorrect())
-    {
-        HUMDFR_LOGE("Incorrect BME280 chip ID!");
-        ESP_ERROR_CHECK(ESP_FAIL);
-    }
-    /* Reset the BME280 using soft-reset. This makes sure the IIR is off, etc. */
-    bme280_SoftReset();
-    /* Wait for chip to wake up */
-    vTaskDelay(pdMS_TO_TICKS(WAKE_UP_DELAY));
-    /* If the chip is still reading calibration - delay */
-    while (true == bme280_IsReadingCalibration())
-    {
-        vTaskDelay(pdMS_TO_TICKS(WAITING_DELAY));
-    }
-    /* Start measuring */
-    bme280_SetSampling();
-    /* Wait for the first measurements are ready */
-    vTaskDelay(pdMS_TO_TICKS(WAKE_UP_DELAY));
-    /* Readuot the measurements */
-    bme280_Readout();
+    uint8_t buffer[sizeof(value)] = {value};
+    return gBus->tx(gSht41, buffer, sizeof(buffer));
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void sht41_Rd(uint8_t * p_buffer, uint8_t length)
+static FW_RESULT sht41_SoftReset(void)
 {
-    I2C_Rx(gSht41, p_buffer, length);
+    return sht41_Wr(SHT41_SOFT_RESET);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void sht41_Wr(uint8_t value)
+static FW_RESULT sht41_StartMeasuring(void)
 {
-    uint8_t buffer[sizeof(value)] = {value};
-    I2C_Tx(gSht41, buffer, sizeof(buffer));
+    return sht41_Wr(SHT41_MEASURE);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void sht41_SoftReset(void)
+static FW_RESULT sht41_Heat(void)
 {
-    sht41_Wr(SHT41_SOFT_RESET);
+    return sht41_Wr(SHT41_HEAT_110MW_0P1S);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void sht41_StartMeasuring(void)
+/* CRC-8 of the measurement word: polynomial 0x31, initial value 0xFF */
+static uint8_t sht41_Crc(uint8_t msb, uint8_t lsb)
 {
-    sht41_Wr(SHT41_MEASURE);
-}
+    uint8_t data[] = {msb, lsb};
+    uint8_t crc    = 0xFF;
+    uint8_t i      = 0;
+    uint8_t bit    = 0;
 
-//-------------------------------------------------------------------------------------------------
+    for (i = 0; i < sizeof(data); i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (0 != (crc & 0x80)) ? ((crc << 1) ^ 0x31) : (crc << 1);
+        }
+    }
 
-static void sht41_Heat(void)
-{
-    sht41_Wr(SHT41_HEAT_110MW_0P1S);
+    return crc;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void sht41_Readout(void)
+static FW_RESULT sht41_Readout(void)
 {
     enum
     {
         HUMIDITY_MIN = 0,
         HUMIDITY_MAX = 10000,
     };
-    sht41_vm_measurement_t meas = {0};
-    int32_t                temp = 0;
-    int32_t                hum  = 0;
-
-    /* Burst read */
-    sht41_Rd((uint8_t *)&meas, sizeof(meas));
+    sht41_vm_measurement_t meas   = {0};
+    int32_t                temp   = 0;
+    int32_t                hum    = 0;
+    FW_RESULT              result = FW_SUCCESS;
+
+    /* Burst read, the SHT41 NACKs it till the measurement is ready */
+    result = sht41_Rd((uint8_t *)&meas, sizeof(meas));
+    if (FW_SUCCESS != result)
+    {
+        return result;
+    }
+    if ((meas.temp_crc != sht41_Crc(meas.temp_msb, meas.temp_lsb)) ||
+        (meas.hum_crc != sht41_Crc(meas.hum_msb, meas.hum_lsb)))
+    {
+        HUMDFR_LOGE("SHT41 CRC error!");
+        return FW_ERROR;
+    }
 
     temp = (-4500 + 17500 * ((meas.temp_msb << 8) + meas.temp_lsb) / 65535);
     hum  = (-600 + 12500 * ((meas.hum_msb << 8) + meas.hum_lsb) / 65535);
@@ -757,210 +891,1241 @@ static void sht41_Readout(void)
 
     HUMDFR_LOGI("T = %08X : %d", (int)temp, gSht41Measurement.temperature);
     HUMDFR_LOGI("H = %08X : %d", (int)hum, gSht41Measurement.humidity);
+
+    return result;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void sht41_Init(void)
+static uint32_t sensors_Now(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void sensors_Enter(sensors_state_t state, uint32_t wait)
+{
+    gSensors.state = state;
+    gSensors.start = sensors_Now();
+    gSensors.wait  = wait;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Fuses the BME280 and SHT41 readings, the SHT41 is excluded during and after the heating */
+static void sensors_Fuse(void)
 {
     enum
     {
-        WAITING_DELAY = 30,
+        HUMIDITY_MAX = 10000,
     };
+    climate_fusion_input_t input = {0};
+    bool                   sht41 = true;
 
-    if (NULL == gSht41)
+    if ((true == gSensors.cooling) && (SENSORS_SHT41_COOL_MS <= (sensors_Now() - gSensors.heated)))
     {
-        i2c_device_config_t sht41_dvc_config =
-        {
-            .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-            .device_address  = (SHT41_I2C_ADDRESS >> 1),
-            .scl_speed_hz    = SHT41_I2C_SPEED_HZ,
-            .scl_wait_us     = 0,
-        };
-
-        HUMDFR_LOGI("Init the SHT41 I2C");
-        I2C_Init();
+        gSensors.cooling = false;
+    }
+    sht41 = (false == gSensors.cooling);
+
+    input.value[CLIMATE_FUSION_BME280] = gBme280Measurement.temperature;
+    input.value[CLIMATE_FUSION_SHT41]  = gSht41Measurement.temperature;
+    input.valid[CLIMATE_FUSION_BME280] = true;
+    input.valid[CLIMATE_FUSION_SHT41]  = sht41;
+    (void)Climate_Fusion_Process(CLIMATE_FUSION_TEMPERATURE, &input);
+
+    /* The saturated SHT41 is wet, it does not measure the air */
+    input.value[CLIMATE_FUSION_BME280] = gBme280Measurement.humidity;
+    input.value[CLIMATE_FUSION_SHT41]  = gSht41Measurement.humidity;
+    input.valid[CLIMATE_FUSION_SHT41]  = (true == sht41) && (HUMIDITY_MAX != gSht41Measurement.humidity);
+    (void)Climate_Fusion_Process(CLIMATE_FUSION_HUMIDITY, &input);
+}
 
-        gSht41 = I2C_AddDevice(&sht41_dvc_config);
+//-------------------------------------------------------------------------------------------------
 
-        HUMDFR_LOGI("SHT41 Start measuring");
-        sht41_StartMeasuring();
+/* Releases the bus and initializes the sensors again after the backoff */
+static void sensors_Recover(sensors_state_t state, FW_RESULT result)
+{
+    HUMDFR_LOGE("Sensors - State: %d - Error: %04X", state, result);
 
-        vTaskDelay(pdMS_TO_TICKS(WAITING_DELAY));
+    gSensors.errors++;
+    gSensors.retries++;
+    gBus->recover();
 
-        HUMDFR_LOGI("SHT41 Readout");
-        sht41_Readout();
+    /* The pending acquisition is failed, the last measurements are kept */
+    if (SENSORS_RETRIES <= gSensors.retries)
+    {
+        gSensors.trigger = false;
+        gSensors.busy    = false;
     }
 
-    HUMDFR_LOGI("Init of SHT41 is finished");
+    sensors_Enter
+    (
+        SENSORS_STATE_SHT41_RESET,
+        (SENSORS_RECOVERY_MS << MIN((gSensors.retries - 1), SENSORS_RECOVERY_SHIFT_MAX))
+    );
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void Humidifier_Init(void)
+/* Makes the step of the acquisition, returns the time (ms) till the next step is needed */
+static uint32_t sensors_Step(void)
 {
     enum
     {
-        START_UP_DELAY = 100,
+        HUMIDITY_MAX = 10000,
     };
+    sensors_state_t state   = gSensors.state;
+    FW_RESULT       result  = FW_SUCCESS;
+    bool            reading = false;
 
-    /* Init the power/button pins */
-    gpio_config_t humidifier_gpio_config =
+    switch (state)
     {
-        .mode = GPIO_MODE_OUTPUT,
-        .pin_bit_mask = 
-        (
-            (1ULL << CONFIG_HUMIDIFIER_POWER_GPIO) |
-            (1ULL << CONFIG_HUMIDIFIER_BUTTON_GPIO)
-        ),
-    };
-    ESP_ERROR_CHECK(gpio_config(&humidifier_gpio_config));
-    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 0);
-    gpio_set_level(CONFIG_HUMIDIFIER_BUTTON_GPIO, 0);
-
-    /* Power on the humidifier */
-    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 1);
-
-    /* Wait some time for power stabilization */
-    vTaskDelay(pdMS_TO_TICKS(START_UP_DELAY));
-
-    /* Initialize the BME280 */
-    bme280_Init();
+        case SENSORS_STATE_SHT41_RESET:
+            result = sht41_SoftReset();
+            sensors_Enter(SENSORS_STATE_BME280_ID, SENSORS_SHT41_RESET_MS);
+            break;
+        case SENSORS_STATE_BME280_ID:
+            result = bme280_CheckChipId();
+            sensors_Enter(SENSORS_STATE_BME280_RESET, 0);
+            break;
+        case SENSORS_STATE_BME280_RESET:
+            /* This makes sure the IIR is off, etc. */
+            result = bme280_SoftReset();
+            gSensors.polls = 0;
+            sensors_Enter(SENSORS_STATE_BME280_NVM, SENSORS_BME280_BOOT_MS);
+            break;
+        case SENSORS_STATE_BME280_NVM:
+            result = bme280_IsReadingCalibration(&reading);
+            if (false == reading)
+            {
+                sensors_Enter(SENSORS_STATE_BME280_CALIBRATION, 0);
+            }
+            else if (SENSORS_BME280_NVM_POLLS > ++gSensors.polls)
+            {
+                sensors_Enter(SENSORS_STATE_BME280_NVM, SENSORS_BME280_NVM_POLL_MS);
+            }
+            else
+            {
+                result = FW_TIMEOUT;
+            }
+            break;
+        case SENSORS_STATE_BME280_CALIBRATION:
+            /* Read trimming parameters, see DS 4.2.2 */
+            result = bme280_ReadCalibration();
+            sensors_Enter(SENSORS_STATE_BME280_CONFIGURE, 0);
+            break;
+        case SENSORS_STATE_BME280_CONFIGURE:
+            result = bme280_SetSampling();
+            sensors_Enter(SENSORS_STATE_IDLE, SENSORS_BME280_FIRST_MS);
+            break;
+        case SENSORS_STATE_IDLE:
+            if (false == gSensors.trigger)
+            {
+                return UINT32_MAX;
+            }
+            /* The saturated sensor is dried by the heater, the measurement follows the heating */
+            if ((true == gSensors.heat) || (HUMIDITY_MAX == gSht41Measurement.humidity))
+            {
+                gSensors.heat    = false;
+                gSensors.heated  = sensors_Now();
+                gSensors.cooling = true;
+                result = sht41_Heat();
+                sensors_Enter(SENSORS_STATE_READOUT, SENSORS_SHT41_HEAT_MS);
+            }
+            else
+            {
+                result = sht41_StartMeasuring();
+                sensors_Enter(SENSORS_STATE_READOUT, SENSORS_SHT41_MEASURE_MS);
+            }
+            break;
+        case SENSORS_STATE_READOUT:
+            /* The BME280 measures continuously in the normal mode */
+            result = sht41_Readout();
+            if (FW_SUCCESS == result)
+            {
+                result = bme280_Readout();
+            }
+            if (FW_SUCCESS == result)
+            {
+                sensors_Fuse();
+                gSensors.retries = 0;
+                gSensors.trigger = false;
+                gSensors.busy    = false;
+            }
+            sensors_Enter(SENSORS_STATE_IDLE, 0);
+            break;
+        default:
+            return UINT32_MAX;
+    }
 
-    /* Initialize the SHT41 */
-    sht41_Init();
+    if (FW_SUCCESS != result)
+    {
+        sensors_Recover(state, result);
+    }
 
-    /* Power off the humidifier */
-    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 0);
+    return gSensors.wait;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void Humidifier_PowerOn(void)
+static uint32_t sensors_Client(void * p_ctx)
 {
-    enum
-    {
-        POWER_ON_DELAY = 900,
-        HEAT_DELAY     = 200,
-        STARTUP_DELAY  = 200,
-    };
-    /* Power on the humidifier */
-    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 1);
-    vTaskDelay(pdMS_TO_TICKS(POWER_ON_DELAY));
-    sht41_SoftReset();
-    vTaskDelay(pdMS_TO_TICKS(STARTUP_DELAY));
-    sht41_Heat();
-    vTaskDelay(pdMS_TO_TICKS(HEAT_DELAY));
-    bme280_StartMeasuring();
-    sht41_StartMeasuring();
-    vTaskDelay(pdMS_TO_TICKS(STARTUP_DELAY));
+    return Humidifier_ProcessSensors();
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void Humidifier_PowerOff(void)
+/* The least squares slope of the humidity samples, 0.01 %/min */
+static int32_t mist_Slope(mist_observer_p p_mist)
 {
-    enum
+    int32_t  sum = 0;
+    uint32_t idx = 0;
+
+    for (idx = 0; idx < MIST_SAMPLES; idx++)
     {
-        POWER_OFF_DELAY = 400,
-    };
-    /* Power off the humidifier */
-    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 0);
-    vTaskDelay(pdMS_TO_TICKS(POWER_OFF_DELAY));
-    gOn = false;
+        sum += (((int32_t)(2 * idx) - (MIST_SAMPLES - 1)) * p_mist->samples[(p_mist->index + idx) % MIST_SAMPLES]);
+    }
+
+    return ((sum * 6 * 60) / (MIST_SAMPLES * (MIST_SAMPLES * MIST_SAMPLES - 1) * (int32_t)p_mist->dt));
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void Humidifier_OnOffButtonClick(void)
+/* The click is observed against the humidity rate before it */
+static void mist_Start(mist_observer_p p_mist)
 {
-    enum
-    {
-        HOLD_DELAY    = 80,
-        RELEASE_DELAY = 120,
-    };
-    /* Heat the sensor before humidification */
-    sht41_Heat();
-    /* Click the button */
-    gpio_set_level(CONFIG_HUMIDIFIER_BUTTON_GPIO, 1);
-    vTaskDelay(pdMS_TO_TICKS(HOLD_DELAY));
-    gpio_set_level(CONFIG_HUMIDIFIER_BUTTON_GPIO, 0);
-    vTaskDelay(pdMS_TO_TICKS(RELEASE_DELAY));
-    gOn = true;
+    p_mist->based    = (MIST_SAMPLES <= p_mist->filled);
+    p_mist->baseline = (true == p_mist->based) ? mist_Slope(p_mist) : 0;
+    p_mist->elapsed  = 0;
+    p_mist->pending  = true;
+    p_mist->clicks++;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-bool Humidifier_IsPoweredOn(void)
+/* The mist is off after the power on */
+static void mist_Reset(mist_observer_p p_mist)
 {
-    return gOn;
+    p_mist->on      = false;
+    p_mist->pending = false;
+    p_mist->retries = 0;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void Humidifier_ReadSensors(void)
+static mist_action_t mist_Request(mist_observer_p p_mist, bool on)
 {
-    enum
-    {
-        HUMIDITY_MAX = 10000,
-    };
-    bme280_Readout();
-    sht41_Readout();
-    if (HUMIDITY_MAX == gSht41Measurement.humidity)
-    {
-        sht41_Heat();
-    }
-    else
+    if (on == p_mist->on)
     {
-        sht41_StartMeasuring();
+        return MIST_ACTION_NONE;
     }
-}
 
-//-------------------------------------------------------------------------------------------------
+    p_mist->on      = on;
+    p_mist->retries = 0;
+    mist_Start(p_mist);
 
-int16_t Humidifier_GetTemperature(void)
-{
-    return ((gBme280Measurement.temperature + gSht41Measurement.temperature) / 2);
+    return MIST_ACTION_CLICK;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-uint32_t Humidifier_GetPressure(void)
+/* The sample of the unhealthy sensors does not count, the observation waits for the new ones */
+static void mist_Skip(mist_observer_p p_mist)
 {
-    return gBme280Measurement.pressure;
+    p_mist->filled  = 0;
+    p_mist->elapsed = 0;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-uint16_t Humidifier_GetHumidity(void)
+/* Observes the humidity sample (0.01 %) made dt (s) after the previous one, returns the action */
+/* which resyncs the device when the observed mist differs from the requested one              */
+static mist_action_t mist_Observe(mist_observer_p p_mist, int32_t humidity, uint32_t dt)
 {
-    return gSht41Measurement.humidity;
-}
+    int32_t slope = 0;
+    bool    agree = false;
 
-//-------------------------------------------------------------------------------------------------
+    p_mist->samples[p_mist->index] = humidity;
+    p_mist->index   = ((p_mist->index + 1) % MIST_SAMPLES);
+    p_mist->filled  = MIN((p_mist->filled + 1), MIST_SAMPLES);
+    p_mist->dt      = MAX(dt, 1);
+    p_mist->elapsed++;
 
-void Humidifier_Test(void)
-{
-    enum
+    /* The verdict is made when all the samples of the slope follow the settling */
+    if ((false == p_mist->pending) || ((MIST_SETTLE + MIST_SAMPLES) > p_mist->elapsed))
     {
-        COUNT_ON  = 10,
-        COUNT_OFF = 100,
-    };
-    uint8_t cnt = 0;
+        return MIST_ACTION_NONE;
+    }
+    p_mist->pending = false;
 
-    HUMDFR_LOGI("Init the Humidifier");
-    Humidifier_Init();
+    slope = mist_Slope(p_mist);
+    if (true == p_mist->on)
+    {
+        agree = (MIST_SLOPE <= slope) || (MIST_SATURATION <= humidity) ||
+                ((true == p_mist->based) && (MIST_SLOPE <= (slope - p_mist->baseline)));
+    }
+    else
+    {
+        agree = (MIST_SLOPE > slope) ||
+                ((true == p_mist->based) && (MIST_SLOPE <= (p_mist->baseline - slope)));
+    }
+    HUMDFR_LOGI("Mist - On: %d - Slope: %ld - Base: %ld - Agree: %d", p_mist->on, slope, p_mist->baseline, agree);
+
+    if (true == agree)
+    {
+        p_mist->retries = 0;
+        return MIST_ACTION_NONE;
+    }
+
+    /* The click was lost */
+    if (MIST_RETRIES > p_mist->retries)
+    {
+        p_mist->retries++;
+        p_mist->repeats++;
+        mist_Start(p_mist);
+        return MIST_ACTION_CLICK;
+    }
+
+    /* The device ignores the clicks */
+    p_mist->retries = 0;
+    p_mist->cycles++;
+    if (true == p_mist->on)
+    {
+        mist_Start(p_mist);
+    }
+
+    return MIST_ACTION_CYCLE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Humidifier_Init(void)
+{
+    i2c_device_config_t bme280_dvc_config =
+    {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address  = (BME280_I2C_ADDRESS >> 1),
+        .scl_speed_hz    = BME280_I2C_SPEED_HZ,
+        .scl_wait_us     = 0,
+    };
+    i2c_device_config_t sht41_dvc_config =
+    {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address  = (SHT41_I2C_ADDRESS >> 1),
+        .scl_speed_hz    = SHT41_I2C_SPEED_HZ,
+        .scl_wait_us     = 0,
+    };
+
+    /* Init the power/button pins */
+    gpio_config_t humidifier_gpio_config =
+    {
+        .mode = GPIO_MODE_OUTPUT,
+        .pin_bit_mask = 
+        (
+            (1ULL << CONFIG_HUMIDIFIER_POWER_GPIO) |
+            (1ULL << CONFIG_HUMIDIFIER_BUTTON_GPIO)
+        ),
+    };
+    ESP_ERROR_CHECK(gpio_config(&humidifier_gpio_config));
+    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 0);
+    gpio_set_level(CONFIG_HUMIDIFIER_BUTTON_GPIO, 0);
+
+    /* The sensors are initialized by the acquisition after the power on */
+    if (NULL == gBme280)
+    {
+        HUMDFR_LOGI("Init the sensors I2C");
+        I2C_Init();
+        gBme280 = I2C_AddDevice(&bme280_dvc_config);
+        gSht41  = I2C_AddDevice(&sht41_dvc_config);
+    }
+    memset(&gSensors, 0, sizeof(gSensors));
+    /* The acquisition is stepped by the I2C scheduler when it is started */
+    gSensorsClient.fp_step = sensors_Client;
+    I2C_Scheduler_AddClient(&gSensorsClient);
+    Climate_Fusion_Reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_PowerOn(void)
+{
+    /* Power on the humidifier */
+    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 1);
+    /* The sensors are initialized when the power is stable, the SHT41 is dried at first */
+    gSensors.retries = 0;
+    gSensors.heat    = true;
+    sensors_Enter(SENSORS_STATE_SHT41_RESET, SENSORS_POWER_UP_MS);
+    I2C_Scheduler_Wake(&gSensorsClient);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_PowerOff(void)
+{
+    enum
+    {
+        POWER_OFF_DELAY = 400,
+    };
+    /* Power off the humidifier */
+    gpio_set_level(CONFIG_HUMIDIFIER_POWER_GPIO, 0);
+    /* The pending acquisition is failed, the last measurements are kept */
+    gSensors.trigger = false;
+    gSensors.busy    = false;
+    sensors_Enter(SENSORS_STATE_OFF, 0);
+    vTaskDelay(pdMS_TO_TICKS(POWER_OFF_DELAY));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_Click(void)
+{
+    enum
+    {
+        HOLD_DELAY    = 80,
+        RELEASE_DELAY = 120,
+    };
+    /* Heat the sensor on the next acquisition */
+    gSensors.heat = true;
+    /* Click the button */
+    gpio_set_level(CONFIG_HUMIDIFIER_BUTTON_GPIO, 1);
+    vTaskDelay(pdMS_TO_TICKS(HOLD_DELAY));
+    gpio_set_level(CONFIG_HUMIDIFIER_BUTTON_GPIO, 0);
+    vTaskDelay(pdMS_TO_TICKS(RELEASE_DELAY));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_Act(mist_action_t action)
+{
+    if (MIST_ACTION_CYCLE == action)
+    {
+        HUMDFR_LOGE("Mist - Power cycle");
+        humidifier_PowerOff();
+        humidifier_PowerOn();
+    }
+    if ((MIST_ACTION_CLICK == action) || ((MIST_ACTION_CYCLE == action) && (true == gMist.on)))
+    {
+        humidifier_Click();
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Humidifier_PowerOn(void)
+{
+    mist_Reset(&gMist);
+    humidifier_PowerOn();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Humidifier_PowerOff(void)
+{
+    humidifier_PowerOff();
+    mist_Reset(&gMist);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Clicks the button if the mist is not in the requested state already */
+void Humidifier_SetMist(bool on)
+{
+    humidifier_Act(mist_Request(&gMist, on));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Observes the humidity sample made dt (s) after the previous one, the lost click is repeated */
+void Humidifier_ObserveMist(uint32_t dt)
+{
+    if (false == Climate_Fusion_IsHealthy())
+    {
+        mist_Skip(&gMist);
+        return;
+    }
+
+    humidifier_Act(mist_Observe(&gMist, Climate_Fusion_Get(CLIMATE_FUSION_HUMIDITY), dt));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Humidifier_IsMistOn(void)
+{
+    return gMist.on;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Starts the acquisition, it is completed by the following I2C scheduler steps */
+void Humidifier_ReadSensors(void)
+{
+    if (SENSORS_STATE_OFF != gSensors.state)
+    {
+        gSensors.trigger = true;
+        gSensors.busy    = true;
+        I2C_Scheduler_Wake(&gSensorsClient);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Steps the acquisition if its waiting time is over, returns the time (ms) to the next step */
+uint32_t Humidifier_ProcessSensors(void)
+{
+    uint32_t elapsed = (sensors_Now() - gSensors.start);
+
+    if (elapsed < gSensors.wait)
+    {
+        return (gSensors.wait - elapsed);
+    }
+
+    return sensors_Step();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Humidifier_IsSensorsBusy(void)
+{
+    return gSensors.busy;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t Humidifier_GetSensorsErrors(void)
+{
+    return gSensors.errors;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Humidifier_IsSensorsHealthy(void)
+{
+    return Climate_Fusion_IsHealthy();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int16_t Humidifier_GetTemperature(void)
+{
+    return (int16_t)Climate_Fusion_Get(CLIMATE_FUSION_TEMPERATURE);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t Humidifier_GetPressure(void)
+{
+    return gBme280Measurement.pressure;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint16_t Humidifier_GetHumidity(void)
+{
+    return (uint16_t)Climate_Fusion_Get(CLIMATE_FUSION_HUMIDITY);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The fake bus with the BME280 and SHT41 models injects the faults into the transactions */
+typedef struct
+{
+    uint8_t  bme280[UINT8_MAX + 1];
+    uint8_t  sht41[sizeof(sht41_vm_measurement_t)];
+    uint32_t sht41_ready;
+    uint32_t nvm_polls;
+    uint32_t nacks;
+    uint32_t stalls;
+    uint32_t corruptions;
+    uint32_t recoveries;
+} humidifier_test_bus_t;
+
+static humidifier_test_bus_t gTestBus = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT humidifier_TestFault(void)
+{
+    enum
+    {
+        /* The same as the I2C transaction timeout */
+        STALL_MS = 10,
+    };
+    uint32_t start = sensors_Now();
+
+    if (0 < gTestBus.stalls)
+    {
+        gTestBus.stalls--;
+        while (STALL_MS > (sensors_Now() - start)) {};
+        return FW_TIMEOUT;
+    }
+    if (0 < gTestBus.nacks)
+    {
+        gTestBus.nacks--;
+        return FW_ERROR;
+    }
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT humidifier_TestTx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz)
+{
+    FW_RESULT result = humidifier_TestFault();
+
+    if (FW_SUCCESS != result)
+    {
+        return result;
+    }
+    if ((i2c_device_p)gTestBus.sht41 == p_dvc)
+    {
+        if (SHT41_MEASURE == p_tx[0])
+        {
+            gTestBus.sht41_ready = (sensors_Now() + SENSORS_SHT41_MEASURE_MS - 1);
+        }
+        else if (SHT41_HEAT_110MW_0P1S == p_tx[0])
+        {
+            gTestBus.sht41_ready = (sensors_Now() + SENSORS_SHT41_HEAT_MS - 10);
+        }
+    }
+    else if (1 < tx_sz)
+    {
+        gTestBus.bme280[p_tx[0]] = p_tx[1];
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT humidifier_TestRx(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz)
+{
+    FW_RESULT result = humidifier_TestFault();
+
+    if (FW_SUCCESS != result)
+    {
+        return result;
+    }
+    /* The SHT41 NACKs the read during the measurement */
+    if ((int32_t)(sensors_Now() - gTestBus.sht41_ready) < 0)
+    {
+        return FW_ERROR;
+    }
+    memcpy(p_rx, gTestBus.sht41, rx_sz);
+    if (0 < gTestBus.corruptions)
+    {
+        gTestBus.corruptions--;
+        p_rx[1] ^= 0x01;
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT humidifier_TestTxRx
+(
+    i2c_device_p p_dvc,
+    uint8_t *    p_tx,
+    uint8_t      tx_sz,
+    uint8_t *    p_rx,
+    uint8_t      rx_sz
+)
+{
+    FW_RESULT result = humidifier_TestFault();
+
+    if (FW_SUCCESS != result)
+    {
+        return result;
+    }
+    memcpy(p_rx, &gTestBus.bme280[p_tx[0]], rx_sz);
+    /* The NVM copying is in progress for a while after the reset */
+    if ((BME280_REG_ADDR_STATUS == p_tx[0]) && (0 < gTestBus.nvm_polls))
+    {
+        gTestBus.nvm_polls--;
+        p_rx[0] = 0x01;
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_TestRecover(void)
+{
+    gTestBus.recoveries++;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_TestBusInit(void)
+{
+    /* The BME280 compensation example of the datasheet (8.1) */
+    static const uint8_t calibration_a[] =
+    {
+        0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC, 0x7D, 0x8E, 0x43, 0xD6, 0xD0, 0x0B, 0x27, 0x0B,
+        0x8C, 0x00, 0xF9, 0xFF, 0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17, 0x00, 0x4B,
+    };
+    static const uint8_t calibration_b[] = {0x6A, 0x01, 0x00, 0x13, 0x29, 0x03, 0x1E};
+    /* P: 415148, T: 519888, H: 27500 */
+    static const uint8_t measurement[]   = {0x65, 0x5A, 0xC0, 0x7E, 0xED, 0x00, 0x6B, 0x6C};
+
+    memset(&gTestBus, 0, sizeof(gTestBus));
+    gTestBus.bme280[BME280_REG_ADDR_CHIPID] = BME280_CHIP_ID_VALUE;
+    memcpy(&gTestBus.bme280[BME280_REG_ADDR_DIG_T1], calibration_a, sizeof(calibration_a));
+    memcpy(&gTestBus.bme280[BME280_REG_ADDR_DIG_H2], calibration_b, sizeof(calibration_b));
+    memcpy(&gTestBus.bme280[BME280_REG_ADDR_PRESS], measurement, sizeof(measurement));
+    gTestBus.nvm_polls = 2;
+    /* T: 25.08 C, H: 41.06 %, the same as the BME280 */
+    gTestBus.sht41[0] = 0x66;
+    gTestBus.sht41[1] = 0x84;
+    gTestBus.sht41[2] = sht41_Crc(0x66, 0x84);
+    gTestBus.sht41[3] = 0x60;
+    gTestBus.sht41[4] = 0x61;
+    gTestBus.sht41[5] = sht41_Crc(0x60, 0x61);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Steps the acquisition till it is completed, returns the longest step (us) */
+static uint32_t humidifier_TestAcquire(void)
+{
+    enum
+    {
+        TIMEOUT_MS = 5000,
+    };
+    uint32_t start  = sensors_Now();
+    uint32_t wait   = 0;
+    int64_t  step   = 0;
+    uint32_t result = 0;
+
+    Humidifier_ReadSensors();
+    while ((true == Humidifier_IsSensorsBusy()) && (TIMEOUT_MS > (sensors_Now() - start)))
+    {
+        step   = esp_timer_get_time();
+        wait   = Humidifier_ProcessSensors();
+        step   = (esp_timer_get_time() - step);
+        result = MAX(result, (uint32_t)step);
+        vTaskDelay(pdMS_TO_TICKS(MIN(wait, 10)) + 1);
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_TestSensors(void)
+{
+    enum
+    {
+        /* The stalled transaction is bounded by the I2C timeout */
+        STEP_MAX_US    = 12000,
+        TEMPERATURE    = 2508,
+        HUMIDITY       = 4106,
+        PRESSURE       = 100653250,
+    };
+    static const sensors_bus_t test_bus =
+    {
+        humidifier_TestTx,
+        humidifier_TestRx,
+        humidifier_TestTxRx,
+        humidifier_TestRecover,
+    };
+    i2c_device_p bme280 = gBme280;
+    i2c_device_p sht41  = gSht41;
+    uint32_t     step   = 0;
+    uint32_t     stall  = 0;
+    uint32_t     errors = 0;
+    bool         result = true;
+
+    humidifier_TestBusInit();
+    gBus    = &test_bus;
+    gBme280 = (i2c_device_p)gTestBus.bme280;
+    gSht41  = (i2c_device_p)gTestBus.sht41;
+    memset(&gSensors, 0, sizeof(gSensors));
+    memset(&gBme280Measurement, 0, sizeof(gBme280Measurement));
+    memset(&gSht41Measurement, 0, sizeof(gSht41Measurement));
+    Climate_Fusion_Reset();
+    sensors_Enter(SENSORS_STATE_SHT41_RESET, 0);
+
+    /* The clean bus: the initialization and the acquisition */
+    step    = humidifier_TestAcquire();
+    result &= (TEMPERATURE == Humidifier_GetTemperature());
+    result &= (HUMIDITY == Humidifier_GetHumidity());
+    result &= (PRESSURE == Humidifier_GetPressure());
+    result &= (0 == Humidifier_GetSensorsErrors());
+    HUMDFR_LOGI("Sensors Clean Bus - step %lu us - %s", step, (true == result) ? "PASS" : "FAIL");
+
+    /* The NACKs, the stall and the corrupted data are recovered within the acquisition */
+    result               = true;
+    gTestBus.nacks       = 1;
+    step                 = humidifier_TestAcquire();
+    gTestBus.stalls      = 1;
+    stall                = humidifier_TestAcquire();
+    gTestBus.corruptions = 1;
+    step                 = MAX(step, humidifier_TestAcquire());
+    result &= (STEP_MAX_US > step);
+    result &= (STEP_MAX_US > stall);
+    result &= (3 == Humidifier_GetSensorsErrors());
+    result &= (3 == gTestBus.recoveries);
+    result &= (TEMPERATURE == Humidifier_GetTemperature());
+    result &= (HUMIDITY == Humidifier_GetHumidity());
+    HUMDFR_LOGI
+    (
+        "Sensors Faults - step %lu us - stall %lu us - %s",
+        step,
+        stall,
+        (true == result) ? "PASS" : "FAIL"
+    );
+
+    /* The dead bus fails the acquisition and keeps the last measurements */
+    result         = true;
+    errors         = Humidifier_GetSensorsErrors();
+    gTestBus.nacks = UINT32_MAX;
+    step           = humidifier_TestAcquire();
+    result &= (false == Humidifier_IsSensorsBusy());
+    result &= ((errors + SENSORS_RETRIES) == Humidifier_GetSensorsErrors());
+    result &= (TEMPERATURE == Humidifier_GetTemperature());
+    result &= (HUMIDITY == Humidifier_GetHumidity());
+    /* The bus is alive again */
+    gTestBus.nacks = 0;
+    stall          = humidifier_TestAcquire();
+    step           = MAX(step, stall);
+    result &= (false == Humidifier_IsSensorsBusy());
+    result &= (SENSORS_STATE_IDLE == gSensors.state);
+    result &= (0 == gSensors.retries);
+    result &= (STEP_MAX_US > step);
+    HUMDFR_LOGI("Sensors Dead Bus - step %lu us - %s", step, (true == result) ? "PASS" : "FAIL");
+
+    gBus    = &gcI2CBus;
+    gBme280 = bme280;
+    gSht41  = sht41;
+    memset(&gSensors, 0, sizeof(gSensors));
+    Climate_Fusion_Reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The compensation formulas of the datasheet (4.2.3) as they are */
+static int16_t humidifier_TestReferenceT(const bme280_calibration_t * p_cal, uint32_t temp_adc, int32_t * p_temp_fine)
+{
+    int32_t var1        = 0;
+    int32_t var2        = 0;
+    int32_t temperature = 0;
+
+    var1 = (int32_t)((temp_adc >> 3) - ((int32_t)p_cal->T1 << 1));
+    var1 = ((var1 * ((int32_t)p_cal->T2)) >> 11);
+    var2 = (int32_t)((temp_adc >> 4) - ((int32_t)p_cal->T1));
+    var2 = ((((var2 * var2) >> 12) * ((int32_t)p_cal->T3)) >> 14);
+    *p_temp_fine = (var1 + var2);
+    temperature = ((*p_temp_fine * 5 + 128) >> 8);
+
+    if (-4000 > temperature)
+    {
+        temperature = -4000;
+    }
+    else if (8500 < temperature)
+    {
+        temperature = 8500;
+    }
+
+    return (int16_t)temperature;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t humidifier_TestReferenceP(const bme280_calibration_t * p_cal, uint32_t press_adc, int32_t temp_fine)
+{
+    int64_t  var1     = 0;
+    int64_t  var2     = 0;
+    int64_t  var3     = 0;
+    int64_t  var4     = 0;
+    uint32_t pressure = 0;
+
+    var1 = (((int64_t)temp_fine) - 128000);
+    var2 = (var1 * var1 * (int64_t)p_cal->P6);
+    var2 = (var2 + ((var1 * (int64_t)p_cal->P5) << 17));
+    var2 = (var2 + (((int64_t)p_cal->P4) << 35));
+    var3 = ((var1 * var1 * (int64_t)p_cal->P3) >> 8);
+    var1 = (var3 + ((var1 * ((int64_t)p_cal->P2) << 12)));
+    var3 = (((int64_t)1) << 47);
+    var1 = ((var3 + var1) * ((int64_t)p_cal->P1) >> 33);
+
+    /* To avoid divide by zero exception */
+    if (var1 != 0)
+    {
+        var4 = (1048576 - press_adc);
+        var4 = ((((var4 << 31) - var2) * 3125) / var1);
+        var1 = ((((int64_t)p_cal->P9) * (var4 >> 13) * (var4 >> 13)) >> 25);
+        var2 = ((((int64_t)p_cal->P8) * var4) >> 19);
+        var4 = ((var4 + var1 + var2) >> 8) + (((int64_t)p_cal->P7) << 4);
+        pressure = (uint32_t)(((var4 >> 1) * 100) >> 7);
+
+        if (3000000 > pressure)
+        {
+            pressure = 3000000;
+        }
+        else if (11000000 < pressure)
+        {
+            pressure = 11000000;
+        }
+    }
+    else
+    {
+        pressure = 3000000;
+    }
+    pressure *= 10;
+
+    return pressure;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint16_t humidifier_TestReferenceH(const bme280_calibration_t * p_cal, uint32_t hum_adc, int32_t temp_fine)
+{
+    int32_t  var1         = 0;
+    int32_t  var2         = 0;
+    int32_t  var3         = 0;
+    int32_t  var4         = 0;
+    int32_t  var5         = 0;
+    uint32_t humidity     = 0;
+
+    var1 = (temp_fine - ((int32_t)76800));
+    var2 = (int32_t)(hum_adc << 14);
+    var3 = (int32_t)(((int32_t)p_cal->H4) << 20);
+    var4 = (((int32_t)p_cal->H5) * var1);
+    var5 = ((((var2 - var3) - var4) + (int32_t)16384) >> 15);
+    var2 = ((var1 * ((int32_t)p_cal->H6)) >> 10);
+    var3 = ((var1 * ((int32_t)p_cal->H3)) >> 11);
+    var4 = (((var2 * (var3 + (int32_t)32768)) / 1024) + (int32_t)2097152);
+    var2 = (((var4 * ((int32_t)p_cal->H2)) + 8192) >> 14);
+    var3 = (var5 * var2);
+    var4 = (((var3 >> 15) * (var3 >> 15)) >> 7);
+    var5 = (var3 - ((var4 * ((int32_t)p_cal->H1)) >> 4));
+    var5 = (var5 < 0 ? 0 : var5);
+    var5 = (var5 > 419430400 ? 419430400 : var5);
+    humidity = (uint32_t)(var5 >> 12);
+
+    if (102400 < humidity)
+    {
+        humidity = 102400;
+    }
+
+    humidity = (uint32_t)(100.0 * humidity / 1024);
+
+    return (uint16_t)humidity;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t humidifier_TestRandom(uint32_t * p_seed)
+{
+    *p_seed = (*p_seed * 1664525 + 1013904223);
+    return (*p_seed >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t humidifier_TestSpread(uint32_t * p_seed, int32_t value)
+{
+    return (value + value * ((int32_t)(humidifier_TestRandom(p_seed) % 257) - 128) / 1024);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The calibration of the datasheet example (see humidifier_TestBusInit) spread by 12.5 % */
+static void humidifier_TestCalibration(uint32_t * p_seed, bme280_calibration_t * p_cal)
+{
+    p_cal->T1 = (uint16_t)humidifier_TestSpread(p_seed, 27504);
+    p_cal->T2 = (int16_t)humidifier_TestSpread(p_seed, 26435);
+    p_cal->T3 = (int16_t)humidifier_TestSpread(p_seed, -1000);
+    p_cal->P1 = (uint16_t)humidifier_TestSpread(p_seed, 36477);
+    p_cal->P2 = (int16_t)humidifier_TestSpread(p_seed, -10685);
+    p_cal->P3 = (int16_t)humidifier_TestSpread(p_seed, 3024);
+    p_cal->P4 = (int16_t)humidifier_TestSpread(p_seed, 2855);
+    p_cal->P5 = (int16_t)humidifier_TestSpread(p_seed, 140);
+    p_cal->P6 = (int16_t)humidifier_TestSpread(p_seed, -7);
+    p_cal->P7 = (int16_t)humidifier_TestSpread(p_seed, 15500);
+    p_cal->P8 = (int16_t)humidifier_TestSpread(p_seed, -14600);
+    p_cal->P9 = (int16_t)humidifier_TestSpread(p_seed, 6000);
+    p_cal->H1 = (uint16_t)humidifier_TestSpread(p_seed, 75);
+    p_cal->H2 = (int16_t)humidifier_TestSpread(p_seed, 362);
+    p_cal->H3 = (uint16_t)(humidifier_TestRandom(p_seed) % 8);
+    p_cal->H4 = (int16_t)humidifier_TestSpread(p_seed, 313);
+    p_cal->H5 = (int16_t)humidifier_TestSpread(p_seed, 50);
+    p_cal->H6 = (int16_t)humidifier_TestSpread(p_seed, 30);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The precomputed compensation is bit-exact with the datasheet on the whole sensor range */
+static void humidifier_TestCompensation(void)
+{
+    enum
+    {
+        CALIBRATIONS = 4,
+        T_FROM       = 0x40000,
+        T_TO         = 0x90000,
+        T_STEP       = 4099,
+        P_FROM       = 0x20000,
+        P_TO         = 0xB0000,
+        P_STEP       = 8191,
+        H_STEP       = 521,
+        BENCH_COUNT  = 256,
+    };
+    bme280_calibration_t  cal       = {0};
+    bme280_compensation_t comp      = {0};
+    uint32_t              seed      = 0x280;
+    uint32_t              temp_adc  = 0;
+    uint32_t              adc       = 0;
+    int32_t               temp_fine = 0;
+    int32_t               ref_fine  = 0;
+    uint32_t              vectors   = 0;
+    uint32_t              errors    = 0;
+    uint32_t              cycles    = 0;
+    uint32_t              reference = 0;
+    uint32_t              sum       = 0;
+    uint16_t              idx       = 0;
+
+    for (idx = 0; idx < CALIBRATIONS; idx++)
+    {
+        humidifier_TestCalibration(&seed, &cal);
+        bme280_Precompute(&cal, &comp);
+
+        for (temp_adc = T_FROM; temp_adc < T_TO; temp_adc += T_STEP)
+        {
+            vectors++;
+            if ((humidifier_TestReferenceT(&cal, temp_adc, &ref_fine) !=
+                 bme280_CompensateT(&comp, temp_adc, &temp_fine)) || (ref_fine != temp_fine))
+            {
+                errors++;
+            }
+            /* The pressure and the humidity at the different temperatures */
+            adc = (P_FROM + (humidifier_TestRandom(&seed) % P_STEP));
+            for (; adc < P_TO; adc += P_STEP)
+            {
+                vectors++;
+                if (humidifier_TestReferenceP(&cal, adc, temp_fine) != bme280_CompensateP(&comp, adc, temp_fine))
+                {
+                    errors++;
+                }
+            }
+            for (adc = (humidifier_TestRandom(&seed) % H_STEP); adc <= UINT16_MAX; adc += H_STEP)
+            {
+                vectors++;
+                if (humidifier_TestReferenceH(&cal, adc, temp_fine) != bme280_CompensateH(&comp, adc, temp_fine))
+                {
+                    errors++;
+                }
+            }
+        }
+    }
+
+    HUMDFR_LOGI
+    (
+        "BME280 Compensation - %lu vectors - %lu errors - %s",
+        vectors,
+        errors,
+        (0 == errors) ? "PASS" : "FAIL"
+    );
+
+    /* The cycles of the complete sample (T, P, H) */
+    cycles = esp_cpu_get_cycle_count();
+    for (idx = 0; idx < BENCH_COUNT; idx++)
+    {
+        sum += humidifier_TestReferenceT(&cal, (519888 + idx), &temp_fine);
+        sum += humidifier_TestReferenceP(&cal, (415148 + idx), temp_fine);
+        sum += humidifier_TestReferenceH(&cal, (27500 + idx), temp_fine);
+    }
+    reference = ((esp_cpu_get_cycle_count() - cycles) / BENCH_COUNT);
+
+    cycles = esp_cpu_get_cycle_count();
+    for (idx = 0; idx < BENCH_COUNT; idx++)
+    {
+        sum -= bme280_CompensateT(&comp, (519888 + idx), &temp_fine);
+        sum -= bme280_CompensateP(&comp, (415148 + idx), temp_fine);
+        sum -= bme280_CompensateH(&comp, (27500 + idx), temp_fine);
+    }
+    cycles = ((esp_cpu_get_cycle_count() - cycles) / BENCH_COUNT);
+
+    HUMDFR_LOGI
+    (
+        "BME280 Compensation - datasheet %lu cycles - precomputed %lu cycles - %s",
+        reference,
+        cycles,
+        (0 == sum) ? "PASS" : "FAIL"
+    );
+}
+//-------------------------------------------------------------------------------------------------
+
+/* The enclosure model: the humidity leaks to the room, the mist raises it with the delay. */
+/* The button loses every miss-th click, the stuck device ignores them till the power cycle */
+typedef struct
+{
+    /* 0.01 % */
+    int32_t  humidity;
+    int32_t  room;
+    /* 0.01 % per sample */
+    int32_t  mist;
+    uint32_t clicks;
+    uint32_t miss;
+    bool     on;
+    bool     stuck;
+} humidifier_test_mist_t, * humidifier_test_mist_p;
+
+enum
+{
+    TEST_MIST_DT_S  = 10,
+    TEST_MIST_TAU_S = 600,
+    /* 0.01 % per sample, 4 %/min */
+    TEST_MIST_GAIN  = 67,
+    TEST_MIST_NOISE = 8,
+    /* The requests of the Humidity control with the minimal on time */
+    TEST_MIST_ON    = 6,
+    TEST_MIST_CYCLE = 20,
+};
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_TestMistAct(humidifier_test_mist_p p_model, mist_observer_p p_mist, mist_action_t action)
+{
+    if (MIST_ACTION_CYCLE == action)
+    {
+        p_model->on    = false;
+        p_model->stuck = false;
+    }
+    if ((MIST_ACTION_CLICK == action) || ((MIST_ACTION_CYCLE == action) && (true == p_mist->on)))
+    {
+        p_model->clicks++;
+        if ((false == p_model->stuck) && ((0 == p_model->miss) || (0 != (p_model->clicks % p_model->miss))))
+        {
+            p_model->on = !p_model->on;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Runs the requests (the permanent or the cycled ones), returns the samples the mist differs */
+static uint32_t humidifier_TestMistRun
+(
+    humidifier_test_mist_p p_model,
+    mist_observer_p        p_mist,
+    uint32_t *             p_seed,
+    uint32_t               samples,
+    bool                   permanent
+)
+{
+    uint32_t sample = 0;
+    uint32_t differ = 0;
+    int32_t  noise  = 0;
+    bool     on     = false;
+
+    for (sample = 0; sample < samples; sample++)
+    {
+        p_model->mist     += (((true == p_model->on) ? TEST_MIST_GAIN : 0) - p_model->mist) / 2;
+        p_model->humidity += (((p_model->room - p_model->humidity) * TEST_MIST_DT_S) / TEST_MIST_TAU_S);
+        p_model->humidity  = MIN((p_model->humidity + p_model->mist), 10000);
+
+        noise = ((int32_t)(humidifier_TestRandom(p_seed) % (2 * TEST_MIST_NOISE + 1)) - TEST_MIST_NOISE);
+        humidifier_TestMistAct(p_model, p_mist, mist_Observe(p_mist, (p_model->humidity + noise), TEST_MIST_DT_S));
+
+        /* The on time varies over the cycles */
+        on = (true == permanent) ||
+             ((sample % TEST_MIST_CYCLE) < (TEST_MIST_ON + 2 * ((sample / TEST_MIST_CYCLE) % 3)));
+        humidifier_TestMistAct(p_model, p_mist, mist_Request(p_mist, on));
+
+        differ += (p_model->on != p_mist->on) ? 1 : 0;
+    }
+
+    return differ;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void humidifier_TestMist(void)
+{
+    enum
+    {
+        SAMPLES = 720,
+        VERDICT = (MIST_SETTLE + MIST_SAMPLES),
+    };
+    humidifier_test_mist_t model  = {0};
+    mist_observer_t        mist   = {0};
+    uint32_t               seed   = 41;
+    uint32_t               differ = 0;
+    bool                   result = true;
+
+    /* The reliable button is clicked once per request */
+    model.humidity = 6000;
+    model.room     = 5000;
+    differ  = humidifier_TestMistRun(&model, &mist, &seed, SAMPLES, false);
+    result &= (0 == differ) && (0 == mist.repeats) && (0 == mist.cycles) && (model.clicks == mist.clicks);
+    HUMDFR_LOGI("Mist Reliable - Clicks: %lu - Repeats: %lu - Differ: %lu", mist.clicks, mist.repeats, differ);
+
+    /* The lost clicks are repeated in the verdict time */
+    memset(&mist, 0, sizeof(mist));
+    model.clicks = 0;
+    model.miss   = 4;
+    differ  = humidifier_TestMistRun(&model, &mist, &seed, SAMPLES, false);
+    result &= (0 < mist.repeats) && (0 == mist.cycles) && (differ <= (mist.repeats * VERDICT));
+    result &= (mist.repeats <= (model.clicks / (model.miss - 1)));
+    HUMDFR_LOGI("Mist Lost - Clicks: %lu - Repeats: %lu - Differ: %lu", mist.clicks, mist.repeats, differ);
+
+    /* The stuck device is power cycled once */
+    mist_Reset(&mist);
+    mist.repeats = 0;
+    model.on     = false;
+    model.miss   = 0;
+    model.stuck  = true;
+    differ  = humidifier_TestMistRun(&model, &mist, &seed, (SAMPLES / 4), true);
+    result &= (1 == mist.cycles) && (MIST_RETRIES == mist.repeats) && (true == model.on);
+    result &= (differ <= ((MIST_RETRIES + 1) * VERDICT));
+    HUMDFR_LOGI("Mist Stuck - Cycles: %lu - Repeats: %lu - Differ: %lu", mist.cycles, mist.repeats, differ);
+
+    /* The saturated air does not show the mist, it is not clicked again */
+    memset(&mist, 0, sizeof(mist));
+    memset(&model, 0, sizeof(model));
+    model.humidity = 9700;
+    model.room     = 9700;
+    differ  = humidifier_TestMistRun(&model, &mist, &seed, SAMPLES, false);
+    result &= (0 == differ) && (0 == mist.repeats) && (0 == mist.cycles);
+
+    HUMDFR_LOGI("Mist Observer - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Humidifier_Test(void)
+{
+    enum
+    {
+        COUNT_ON  = 10,
+        COUNT_OFF = 100,
+    };
+    uint8_t cnt = 0;
+
+    humidifier_TestCompensation();
+    humidifier_TestSensors();
+    humidifier_TestMist();
+
+    HUMDFR_LOGI("Init the Humidifier");
+    Humidifier_Init();
 
     /* Test Sensors work during the Ultrasonic is on */
     HUMDFR_LOGI("Power On");
     Humidifier_PowerOn();
     HUMDFR_LOGI("Humidification");
-    Humidifier_OnOffButtonClick();
+    Humidifier_SetMist(true);
     HUMDFR_LOGI("Read sensors");
     for (cnt = 0; cnt < COUNT_ON; cnt++)
     {
         HUMDFR_LOGI("---------------------------");
-        Humidifier_ReadSensors();
+        (void)humidifier_TestAcquire();
         vTaskDelay(pdMS_TO_TICKS(20));
     }
     HUMDFR_LOGI("Power off");
@@ -968,7 +2133,7 @@ void Humidifier_Test(void)
 
     /* On */
     Humidifier_PowerOn();
-    Humidifier_OnOffButtonClick();
+    Humidifier_SetMist(true);
     /* Humidify */
     vTaskDelay(pdMS_TO_TICKS(3000));
     /* Off */
@@ -980,7 +2145,7 @@ void Humidifier_Test(void)
     for (cnt = 0; cnt < COUNT_OFF; cnt++)
     {
         HUMDFR_LOGI("---------------------------");
-        Humidifier_ReadSensors();
+        (void)humidifier_TestAcquire();
         vTaskDelay(pdMS_TO_TICKS(1000));
     }
     /* Off */
@@ -988,3 +2153,42 @@ void Humidifier_Test(void)
 }
 
 //-------------------------------------------------------------------------------------------------
+//--- Benchmarks ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The complete sample (T, P, H) of the sensor range */
+static void humidifier_BenchCompensation(void * p_ctx, uint32_t count)
+{
+    static bme280_compensation_t comp      = {0};
+    static bool                  ready     = false;
+    volatile uint32_t          * p_sum     = (volatile uint32_t *)p_ctx;
+    bme280_calibration_t         cal       = {0};
+    uint32_t                     seed      = 0x280;
+    int32_t                      temp_fine = 0;
+    uint32_t                     idx       = 0;
+
+    if (false == ready)
+    {
+        humidifier_TestCalibration(&seed, &cal);
+        bme280_Precompute(&cal, &comp);
+        ready = true;
+    }
+
+    for (idx = 0; idx < count; idx++)
+    {
+        *p_sum += bme280_CompensateT(&comp, (519888 + (idx & 0xFFF)), &temp_fine);
+        *p_sum += bme280_CompensateP(&comp, (415148 + (idx & 0xFFF)), temp_fine);
+        *p_sum += bme280_CompensateH(&comp, (27500 + (idx & 0xFFF)), temp_fine);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Humidifier_Bench(void)
+{
+    volatile uint32_t sum = 0;
+
+    Bench_Run("bme280", "bme280_CompensateT+P+H", humidifier_BenchCompensation, (void *)&sum, NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,17 @@
+#ifndef __BH1750_H__
+#define __BH1750_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* This interface reads the BH1750 ambient light sensor in the continuous high resolution */
+/* mode (1 lx), the sensor is stepped by the I2C scheduler                               */
+
+void     BH1750_Init(void);
+bool     BH1750_IsValid(void);
+uint32_t BH1750_GetErrors(void);
+/* lx */
+uint32_t BH1750_GetLux(void);
+void     BH1750_Test(void);
+
+#endif /* __BH1750_H__ */
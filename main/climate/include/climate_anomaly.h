@@ -0,0 +1,64 @@
+#ifndef __CLIMATE_ANOMALY_H__
+#define __CLIMATE_ANOMALY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+/* This interface detects the enclosure drift on every sensors sample with O(1) memory:   */
+/*  - every metric keeps its EWMA and the Welford mean/variance of the last hour;         */
+/*  - the rate of change over the usual rates of the last hour is the spike;               */
+/*  - the EWMA far from the mean of the last hour is the drift;                            */
+/*  - the humidity not rising while misting is the Humidifier failure.                     */
+/* The events are kept in the ring, the readers poll them by the sequence number.         */
+
+enum
+{
+    CLIMATE_ANOMALY_EVENTS = 8,
+};
+
+typedef enum
+{
+    CLIMATE_ANOMALY_TEMPERATURE = 0,
+    CLIMATE_ANOMALY_HUMIDITY,
+    CLIMATE_ANOMALY_METRICS,
+} climate_anomaly_metric_t;
+
+typedef enum
+{
+    CLIMATE_ANOMALY_NONE = 0,
+    /* The value is the rate, 0.01 units/min */
+    CLIMATE_ANOMALY_SPIKE,
+    /* The value is the EWMA deviation from the mean of the last hour, 0.01 units */
+    CLIMATE_ANOMALY_DRIFT,
+    /* The value is the humidity rise since the mist start, 0.01 % */
+    CLIMATE_ANOMALY_MIST_NO_RISE,
+} climate_anomaly_type_t;
+
+typedef struct
+{
+    uint32_t time;
+    int32_t  value;
+    /* 0 - no event */
+    uint16_t sequence;
+    uint8_t  type;
+    uint8_t  metric;
+} climate_anomaly_event_t, * climate_anomaly_event_p;
+
+typedef struct
+{
+    /* 0.01 C or 0.01 % */
+    int32_t value[CLIMATE_ANOMALY_METRICS];
+    bool    misting;
+} climate_anomaly_input_t, * climate_anomaly_input_p;
+
+void     Climate_Anomaly_Reset(void);
+/* dt - the time since the previous sample (s) */
+void     Climate_Anomaly_Process(time_t now, uint32_t dt, const climate_anomaly_input_t * p_input);
+/* The sequence of the last event, 0 - none */
+uint16_t Climate_Anomaly_GetSequence(void);
+/* Copies the events after the sequence (the oldest first), returns their count */
+uint8_t  Climate_Anomaly_GetEvents(uint16_t since, climate_anomaly_event_p p_events, uint8_t max);
+void     Climate_Anomaly_Test(void);
+
+#endif /* __CLIMATE_ANOMALY_H__ */
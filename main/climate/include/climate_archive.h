@@ -0,0 +1,35 @@
+#ifndef __CLIMATE_ARCHIVE_H__
+#define __CLIMATE_ARCHIVE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "types.h"
+
+/* This interface keeps the 1 minute climate measurements in the "history" flash partition: */
+/*  - the records are appended to the log in the CRC protected page sized blocks;          */
+/*  - the sectors are used round robin, so they are worn evenly;                           */
+/*  - the oldest sector is erased when the log is full.                                    */
+
+typedef struct
+{
+    time_t   time;
+    /* 0.01 C */
+    int16_t  temperature;
+    /* 0.01 % */
+    uint16_t humidity;
+    /* Pa */
+    uint32_t pressure;
+} climate_archive_record_t, * climate_archive_record_p;
+
+typedef void (* climate_archive_fp_t)(const climate_archive_record_t * p_record, void * p_ctx);
+
+FW_RESULT Climate_Archive_Init(void);
+FW_RESULT Climate_Archive_Append(const climate_archive_record_t * p_record);
+FW_RESULT Climate_Archive_Flush(void);
+size_t    Climate_Archive_Replay(time_t from, climate_archive_fp_t fp_record, void * p_ctx);
+time_t    Climate_Archive_GetLast(void);
+void      Climate_Archive_Test(void);
+
+#endif /* __CLIMATE_ARCHIVE_H__ */
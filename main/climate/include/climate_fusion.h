@@ -0,0 +1,41 @@
+#ifndef __CLIMATE_FUSION_H__
+#define __CLIMATE_FUSION_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* This interface fuses the BME280 and SHT41 readings of the same quantity:             */
+/*  - the spikes (the mist on the sensor) are rejected by the Hampel filter per sensor; */
+/*  - the sensor confidence drops on the rejected and the excluded readings;            */
+/*  - the accepted readings are fused by the Kalman filter weighted by the confidence.  */
+
+typedef enum
+{
+    CLIMATE_FUSION_TEMPERATURE = 0,
+    CLIMATE_FUSION_HUMIDITY,
+    CLIMATE_FUSION_QUANTITIES,
+} climate_fusion_quantity_t;
+
+typedef enum
+{
+    CLIMATE_FUSION_BME280 = 0,
+    CLIMATE_FUSION_SHT41,
+    CLIMATE_FUSION_SENSORS,
+} climate_fusion_sensor_t;
+
+typedef struct
+{
+    /* 0.01 C or 0.01 % */
+    int32_t value[CLIMATE_FUSION_SENSORS];
+    /* false - the reading is excluded (the heater, the saturation) */
+    bool    valid[CLIMATE_FUSION_SENSORS];
+} climate_fusion_input_t, * climate_fusion_input_p;
+
+void    Climate_Fusion_Reset(void);
+int32_t Climate_Fusion_Process(climate_fusion_quantity_t quantity, const climate_fusion_input_t * p_input);
+int32_t Climate_Fusion_Get(climate_fusion_quantity_t quantity);
+uint8_t Climate_Fusion_GetConfidence(climate_fusion_quantity_t quantity, climate_fusion_sensor_t sensor);
+bool    Climate_Fusion_IsHealthy(void);
+void    Climate_Fusion_Test(void);
+
+#endif /* __CLIMATE_FUSION_H__ */
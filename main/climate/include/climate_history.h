@@ -0,0 +1,54 @@
+#ifndef __CLIMATE_HISTORY_H__
+#define __CLIMATE_HISTORY_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+/* This interface keeps the climate measurements in the circular multi-resolution store: */
+/*  - the 10 seconds samples for 1 hour, the CO2 and the light are kept by them only;   */
+/*  - the 1 minute min/max/mean buckets for 24 hours;                                   */
+/*  - the 20 minutes min/max/mean buckets for up to 30 days (menuconfig).               */
+
+typedef enum
+{
+    CLIMATE_HISTORY_LEVEL_RAW = 0,
+    CLIMATE_HISTORY_LEVEL_MINUTE,
+    CLIMATE_HISTORY_LEVEL_LONG,
+    CLIMATE_HISTORY_LEVELS,
+} climate_history_level_t;
+
+typedef struct
+{
+    int32_t mean;
+    int32_t min;
+    int32_t max;
+} climate_history_stat_t;
+
+typedef struct
+{
+    /* The start of the bucket */
+    time_t                 time;
+    /* 0.01 C */
+    climate_history_stat_t temperature;
+    /* 0.01 % */
+    climate_history_stat_t humidity;
+    /* Pa */
+    climate_history_stat_t pressure;
+    /* ppm, the raw level only */
+    climate_history_stat_t co2;
+    /* lx, the raw level only */
+    climate_history_stat_t light;
+} climate_history_point_t, * climate_history_point_p;
+
+void                    Climate_History_Init(void);
+void                    Climate_History_Append(time_t t, int16_t temperature, uint16_t humidity, uint32_t pressure, uint16_t co2, uint32_t light);
+climate_history_level_t Climate_History_GetLevel(time_t from);
+uint32_t                Climate_History_GetPeriod(climate_history_level_t level);
+uint32_t                Climate_History_GetSpan(climate_history_level_t level);
+size_t                  Climate_History_Query(climate_history_level_t level, time_t from, time_t to, climate_history_point_p p_points, size_t count);
+size_t                  Climate_History_GetFootprint(void);
+void                    Climate_History_Test(void);
+void                    Climate_History_Bench(void);
+
+#endif /* __CLIMATE_HISTORY_H__ */
@@ -0,0 +1,72 @@
+#ifndef __CLIMATE_SERIES_H__
+#define __CLIMATE_SERIES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "climate_history.h"
+
+/* This interface encodes the climate history to the compact chunks (the Gorilla style):   */
+/*  - the times are the delta-of-delta in the variable length buckets;                     */
+/*  - the values are the delta from the previous ones in the variable length buckets;      */
+/*  - every chunk is decoded on its own, the export continues from the returned time.      */
+
+typedef enum
+{
+    CLIMATE_SERIES_TEMPERATURE = 0,
+    CLIMATE_SERIES_HUMIDITY,
+    CLIMATE_SERIES_PRESSURE,
+    CLIMATE_SERIES_CO2,
+    CLIMATE_SERIES_LIGHT,
+    CLIMATE_SERIES_FIELDS,
+} climate_series_field_t;
+
+enum
+{
+    CLIMATE_SERIES_ALL = ((1 << CLIMATE_SERIES_FIELDS) - 1),
+};
+
+typedef struct
+{
+    uint32_t time;
+    /* The means of the fields, the missing fields are 0 */
+    int32_t  values[CLIMATE_SERIES_FIELDS];
+} climate_series_sample_t, * climate_series_sample_p;
+
+typedef struct
+{
+    uint8_t * p_data;
+    size_t    size;
+    size_t    bits;
+    uint32_t  count;
+    uint32_t  time;
+    int32_t   delta;
+    int32_t   values[CLIMATE_SERIES_FIELDS];
+    uint8_t   fields;
+} climate_series_codec_t, * climate_series_codec_p;
+
+void   Climate_Series_EncoderInit(climate_series_codec_p p_codec, uint8_t fields, uint8_t * p_data, size_t size);
+/* false - the chunk is full, the sample is not encoded */
+bool   Climate_Series_Encode(climate_series_codec_p p_codec, const climate_series_sample_t * p_sample);
+/* The bytes of the encoded chunk */
+size_t Climate_Series_GetSize(const climate_series_codec_t * p_codec);
+void   Climate_Series_DecoderInit(climate_series_codec_p p_codec, uint8_t fields, const uint8_t * p_data, size_t size);
+/* false - the chunk is over */
+bool   Climate_Series_Decode(climate_series_codec_p p_codec, uint32_t count, climate_series_sample_p p_sample);
+/* Encodes the history [from, to) to the chunk, returns its bytes, *p_next - the time to continue from */
+size_t Climate_Series_Export
+(
+    climate_history_level_t level,
+    time_t                  from,
+    time_t                  to,
+    uint8_t                 fields,
+    uint8_t *               p_data,
+    size_t                  size,
+    uint32_t *              p_count,
+    time_t *                p_next
+);
+void   Climate_Series_Test(void);
+
+#endif /* __CLIMATE_SERIES_H__ */
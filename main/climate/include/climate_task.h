@@ -2,7 +2,10 @@
 #define __CLIMATE_TASK_H__
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
 #include "fan.h"
+#include "climate_anomaly.h"
 
 enum
 {
@@ -21,6 +24,10 @@ typedef struct
     uint32_t pressure;
     uint16_t temperature;
     uint16_t humidity;
+    /* ppm, 0 - not measured */
+    uint16_t co2;
+    /* lx */
+    uint32_t light;
 } climate_measurements_t, * climate_measurements_p;
 
 typedef struct
@@ -46,10 +53,28 @@ typedef struct
     uint32_t duration;
 } climate_message_t, * climate_message_p;
 
+typedef struct
+{
+    /* The FAN cools the enclosure down to this temperature (0.01 C) */
+    int16_t  temperature;
+    /* The Humidifier keeps this humidity (0.01 %) */
+    uint16_t humidity;
+} climate_setpoint_t, * climate_setpoint_p;
+
+/* Returns the climate setpoints at the time, false - the climate is not controlled */
+typedef bool (* climate_schedule_fp_t)(time_t t, climate_setpoint_p p_setpoint);
+
 void        Climate_Task_Init(void);
 void        Climate_Task_SendMsg(climate_message_p p_msg);
+void        Climate_Task_SetSchedule(climate_schedule_fp_t fp_schedule);
 fan_speed_t Climate_Task_GetFanSpeed(void);
+uint32_t    Climate_Task_GetFanDuty(void);
+uint32_t    Climate_Task_GetFanRpm(void);
+uint8_t     Climate_Task_GetFanAlarms(void);
 bool        Climate_Task_IsHumidifierOn(void);
+/* The sequence of the last anomaly event, 0 - none */
+uint16_t    Climate_Task_GetEventsSequence(void);
+uint8_t     Climate_Task_GetEvents(uint16_t since, climate_anomaly_event_p p_events, uint8_t max);
 void        Climate_Task_GetMeasurements(climate_measurements_p p_meas);
 void        Climate_Task_GetDayMeasurements(climate_day_measurements_p p_meas);
 bool        Climate_Task_IsNewDayMeasurementsAvailable(void);
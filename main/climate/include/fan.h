@@ -12,11 +12,32 @@ typedef enum
     FAN_SPEED_FULL,
 } fan_speed_t;
 
-/* This interface controls the 12V FAN */
+typedef enum
+{
+    FAN_ALARM_NONE  = 0x00,
+    /* The FAN does not rotate with the duty */
+    FAN_ALARM_STALL = 0x01,
+    /* The FAN needs much more duty than the nominal one for the speed */
+    FAN_ALARM_WEAR  = 0x02,
+} fan_alarm_t;
+
+/* The PWM period (us), the duty is set with its resolution */
+#define FAN_MCPWM_PERIOD 65000
+/* The FAN stalls below this duty */
+#define FAN_DUTY_MIN     (FAN_MCPWM_PERIOD * 75 / 255)
+
+/* This interface controls the 12V FAN, the FAN with the tachometer keeps the speed of the duty */
 
 void        FAN_Init(void);
 void        FAN_SetSpeed(fan_speed_t value);
 fan_speed_t FAN_GetSpeed(void);
+void        FAN_SetDuty(uint32_t duty);
+uint32_t    FAN_GetDuty(void);
+void        FAN_Process(uint32_t dt);
+/* 0 - stalled or no tachometer */
+uint32_t    FAN_GetRpm(void);
+/* fan_alarm_t flags */
+uint8_t     FAN_GetAlarms(void);
 void        FAN_Test(void);
 
 #endif /* __FAN_H__ */
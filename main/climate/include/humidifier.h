@@ -9,12 +9,19 @@
 void     Humidifier_Init(void);
 void     Humidifier_PowerOn(void);
 void     Humidifier_PowerOff(void);
-void     Humidifier_OnOffButtonClick(void);
-bool     Humidifier_IsPoweredOn(void);
+/* The mist is switched by the button clicks observed by the humidity response */
+void     Humidifier_SetMist(bool on);
+void     Humidifier_ObserveMist(uint32_t dt);
+bool     Humidifier_IsMistOn(void);
 void     Humidifier_ReadSensors(void);
+uint32_t Humidifier_ProcessSensors(void);
+bool     Humidifier_IsSensorsBusy(void);
+uint32_t Humidifier_GetSensorsErrors(void);
+bool     Humidifier_IsSensorsHealthy(void);
 int16_t  Humidifier_GetTemperature(void);
 uint32_t Humidifier_GetPressure(void);
 uint16_t Humidifier_GetHumidity(void);
 void     Humidifier_Test(void);
+void     Humidifier_Bench(void);
 
 #endif /* __HUMIDIFIER_H__ */
@@ -0,0 +1,21 @@
+#ifndef __SCD4X_H__
+#define __SCD4X_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* This interface reads the SCD4x CO2 sensor in the periodic measurement mode (5 s), */
+/* the sensor is stepped by the I2C scheduler                                        */
+
+void     SCD4x_Init(void);
+bool     SCD4x_IsValid(void);
+uint32_t SCD4x_GetErrors(void);
+/* ppm, 0 - no valid measurement */
+uint16_t SCD4x_GetCO2(void);
+/* 0.01 C */
+int16_t  SCD4x_GetTemperature(void);
+/* 0.01 % */
+uint16_t SCD4x_GetHumidity(void);
+void     SCD4x_Test(void);
+
+#endif /* __SCD4X_H__ */
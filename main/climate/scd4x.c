@@ -0,0 +1,341 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "i2c.h"
+#include "i2c_scheduler.h"
+#include "scd4x.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define SCD4X_LOG  0
+
+#if (1 == SCD4X_LOG)
+static const char * gTAG = "SCD4X";
+#    define SCD4X_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SCD4X_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#else
+#    define SCD4X_LOGI(...)
+#    define SCD4X_LOGE(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    SCD4X_I2C_ADDRESS  = 0xC4,
+    SCD4X_I2C_SPEED_HZ = 100000,
+    SCD4X_CMD_START    = 0x21B1,
+    SCD4X_CMD_READ     = 0xEC05,
+    SCD4X_CMD_STOP     = 0x3F86,
+    /* The sensor is ready 1 s after the power up, the stop takes 0.5 s */
+    SCD4X_POWER_UP_MS  = 1000,
+    SCD4X_STOP_MS      = 500,
+    /* The response is ready 1 ms after the command */
+    SCD4X_COMMAND_MS   = 5,
+    SCD4X_PERIOD_MS    = 5000,
+    /* The sensor is restarted after this count of the failed readings */
+    SCD4X_RETRIES      = 3,
+    SCD4X_RECOVERY_MS  = 1000,
+};
+
+/* The state is named by the action made when its waiting time is over */
+typedef enum
+{
+    SCD4X_STATE_POWER_UP = 0,
+    SCD4X_STATE_STOP,
+    SCD4X_STATE_START,
+    SCD4X_STATE_COMMAND,
+    SCD4X_STATE_READ,
+    SCD4X_STATE_PARSE,
+} scd4x_state_t;
+
+#pragma pack(push, 1)
+
+/* The words are big endian, every word is followed by its CRC */
+typedef struct
+{
+    uint8_t co2_msb;
+    uint8_t co2_lsb;
+    uint8_t co2_crc;
+    uint8_t temp_msb;
+    uint8_t temp_lsb;
+    uint8_t temp_crc;
+    uint8_t hum_msb;
+    uint8_t hum_lsb;
+    uint8_t hum_crc;
+} scd4x_vm_measurement_t;
+
+#pragma pack(pop)
+
+typedef struct
+{
+    uint16_t co2;
+    int16_t  temperature;
+    uint16_t humidity;
+} scd4x_measurement_t, * scd4x_measurement_p;
+
+typedef struct
+{
+    i2c_device_p           p_dvc;
+    i2c_client_t           client;
+    i2c_xfer_t             xfer;
+    uint8_t                tx[2];
+    scd4x_vm_measurement_t rx;
+    scd4x_measurement_t    meas;
+    scd4x_state_t          state;
+    uint32_t               retries;
+    uint32_t               errors;
+    bool                   valid;
+} scd4x_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static scd4x_t gScd4x = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+/* CRC-8 of the word: polynomial 0x31, initial value 0xFF */
+static uint8_t scd4x_Crc(uint8_t msb, uint8_t lsb)
+{
+    uint8_t data[] = {msb, lsb};
+    uint8_t crc    = 0xFF;
+    uint8_t i      = 0;
+    uint8_t bit    = 0;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (0 != (crc & 0x80)) ? ((crc << 1) ^ 0x31) : (crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT scd4x_Parse(const scd4x_vm_measurement_t * p_vm, scd4x_measurement_p p_meas)
+{
+    uint32_t temp = 0;
+    uint32_t hum  = 0;
+
+    if ((p_vm->co2_crc != scd4x_Crc(p_vm->co2_msb, p_vm->co2_lsb)) ||
+        (p_vm->temp_crc != scd4x_Crc(p_vm->temp_msb, p_vm->temp_lsb)) ||
+        (p_vm->hum_crc != scd4x_Crc(p_vm->hum_msb, p_vm->hum_lsb)))
+    {
+        return FW_ERROR;
+    }
+
+    temp = ((p_vm->temp_msb << 8) + p_vm->temp_lsb);
+    hum  = ((p_vm->hum_msb << 8) + p_vm->hum_lsb);
+
+    p_meas->co2         = ((p_vm->co2_msb << 8) + p_vm->co2_lsb);
+    p_meas->temperature = (int16_t)(-4500 + (int32_t)(17500 * temp / 65535));
+    p_meas->humidity    = (uint16_t)(10000 * hum / 65535);
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void scd4x_Submit(uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz)
+{
+    gScd4x.xfer.p_dvc = gScd4x.p_dvc;
+    gScd4x.xfer.p_tx  = p_tx;
+    gScd4x.xfer.tx_sz = tx_sz;
+    gScd4x.xfer.p_rx  = p_rx;
+    gScd4x.xfer.rx_sz = rx_sz;
+    if (FW_SUCCESS != I2C_Scheduler_Submit(&gScd4x.xfer))
+    {
+        gScd4x.xfer.result = FW_ERROR;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void scd4x_Command(uint16_t command)
+{
+    gScd4x.tx[0] = (uint8_t)(command >> 8);
+    gScd4x.tx[1] = (uint8_t)command;
+    scd4x_Submit(gScd4x.tx, sizeof(gScd4x.tx), NULL, 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The missing sensor is retried by the slow backoff, the last measurement is kept */
+static uint32_t scd4x_Fail(void)
+{
+    SCD4X_LOGE("State: %d - Error: %04X", gScd4x.state, gScd4x.xfer.result);
+
+    gScd4x.errors++;
+    gScd4x.xfer.result = FW_SUCCESS;
+    if (SCD4X_RETRIES <= ++gScd4x.retries)
+    {
+        gScd4x.retries = 0;
+        gScd4x.valid   = false;
+        gScd4x.state   = SCD4X_STATE_STOP;
+        return SCD4X_RECOVERY_MS;
+    }
+    gScd4x.state = SCD4X_STATE_COMMAND;
+
+    return SCD4X_PERIOD_MS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Makes one transfer per step, the transfer is made by the scheduler before the next step */
+static uint32_t scd4x_Step(void * p_ctx)
+{
+    scd4x_measurement_t meas = {0};
+
+    /* The stop is NACKed by the sensor in the idle mode */
+    if ((SCD4X_STATE_START != gScd4x.state) && (FW_SUCCESS != gScd4x.xfer.result))
+    {
+        return scd4x_Fail();
+    }
+
+    switch (gScd4x.state)
+    {
+        case SCD4X_STATE_POWER_UP:
+            gScd4x.state = SCD4X_STATE_STOP;
+            return SCD4X_POWER_UP_MS;
+        case SCD4X_STATE_STOP:
+            scd4x_Command(SCD4X_CMD_STOP);
+            gScd4x.state = SCD4X_STATE_START;
+            return SCD4X_STOP_MS;
+        case SCD4X_STATE_START:
+            scd4x_Command(SCD4X_CMD_START);
+            gScd4x.state = SCD4X_STATE_COMMAND;
+            return SCD4X_PERIOD_MS;
+        case SCD4X_STATE_COMMAND:
+            scd4x_Command(SCD4X_CMD_READ);
+            gScd4x.state = SCD4X_STATE_READ;
+            return SCD4X_COMMAND_MS;
+        case SCD4X_STATE_READ:
+            scd4x_Submit(NULL, 0, (uint8_t *)&gScd4x.rx, sizeof(gScd4x.rx));
+            gScd4x.state = SCD4X_STATE_PARSE;
+            return 0;
+        case SCD4X_STATE_PARSE:
+            gScd4x.xfer.result = scd4x_Parse(&gScd4x.rx, &meas);
+            if (FW_SUCCESS != gScd4x.xfer.result)
+            {
+                return scd4x_Fail();
+            }
+            SCD4X_LOGI("CO2: %u - T: %d - H: %u", meas.co2, meas.temperature, meas.humidity);
+            gScd4x.meas    = meas;
+            gScd4x.valid   = true;
+            gScd4x.retries = 0;
+            gScd4x.state   = SCD4X_STATE_COMMAND;
+            return SCD4X_PERIOD_MS;
+        default:
+            return UINT32_MAX;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void SCD4x_Init(void)
+{
+    i2c_device_config_t dvc_config =
+    {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address  = (SCD4X_I2C_ADDRESS >> 1),
+        .scl_speed_hz    = SCD4X_I2C_SPEED_HZ,
+        .scl_wait_us     = 0,
+    };
+
+    if (NULL == gScd4x.p_dvc)
+    {
+        I2C_Init();
+        gScd4x.p_dvc = I2C_AddDevice(&dvc_config);
+    }
+    gScd4x.state          = SCD4X_STATE_POWER_UP;
+    gScd4x.client.fp_step = scd4x_Step;
+    I2C_Scheduler_AddClient(&gScd4x.client);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool SCD4x_IsValid(void)
+{
+    return gScd4x.valid;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t SCD4x_GetErrors(void)
+{
+    return gScd4x.errors;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint16_t SCD4x_GetCO2(void)
+{
+    return (true == gScd4x.valid) ? gScd4x.meas.co2 : 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int16_t SCD4x_GetTemperature(void)
+{
+    return gScd4x.meas.temperature;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint16_t SCD4x_GetHumidity(void)
+{
+    return gScd4x.meas.humidity;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t   dump[sizeof(scd4x_vm_measurement_t)];
+    FW_RESULT result;
+    uint16_t  co2;
+    int16_t   temperature;
+    uint16_t  humidity;
+} scd4x_test_vector_t;
+
+//-------------------------------------------------------------------------------------------------
+
+void SCD4x_Test(void)
+{
+    /* The read measurement responses: the datasheet example, the sensor samples, the corrupted */
+    static const scd4x_test_vector_t vectors[] =
+    {
+        {{0x01, 0xF4, 0x33, 0x66, 0x67, 0xA2, 0x5E, 0xB9, 0x3C}, FW_SUCCESS, 500, 2500, 3700},
+        {{0x04, 0xD2, 0x64, 0x6A, 0x3D, 0xB3, 0x80, 0x00, 0xA2}, FW_SUCCESS, 1234, 2762, 5000},
+        {{0x01, 0x90, 0x4C, 0x5C, 0x29, 0xDC, 0xB8, 0x52, 0x3B}, FW_SUCCESS, 400, 1800, 7200},
+        {{0x01, 0xF4, 0x33, 0x66, 0x67, 0xA3, 0x5E, 0xB9, 0x3C}, FW_ERROR, 0, 0, 0},
+        {{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, FW_ERROR, 0, 0, 0},
+    };
+    scd4x_measurement_t meas   = {0};
+    FW_RESULT           status = FW_SUCCESS;
+    uint8_t             idx    = 0;
+    bool                result = true;
+
+    for (idx = 0; idx < (sizeof(vectors) / sizeof(vectors[0])); idx++)
+    {
+        memset(&meas, 0, sizeof(meas));
+        status  = scd4x_Parse((const scd4x_vm_measurement_t *)vectors[idx].dump, &meas);
+        result &= (vectors[idx].result == status);
+        result &= (vectors[idx].co2 == meas.co2);
+        result &= (vectors[idx].temperature == meas.temperature);
+        result &= (vectors[idx].humidity == meas.humidity);
+    }
+
+    SCD4X_LOGI("SCD4x Parse - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
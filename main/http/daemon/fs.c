@@ -52,6 +52,9 @@
 #if LWIP_HTTPD_CUSTOM_FILES
 int fs_open_custom(struct fs_file *file, const char *name);
 void fs_close_custom(struct fs_file *file);
+#if LWIP_HTTPD_DYNAMIC_FILE_READ
+int fs_read_custom(struct fs_file *file, char *buffer, int count);
+#endif /* LWIP_HTTPD_DYNAMIC_FILE_READ */
 #if LWIP_HTTPD_FS_ASYNC_READ
 u8_t fs_canread_custom(struct fs_file *file);
 u8_t fs_wait_read_custom(struct fs_file *file, fs_wait_cb callback_fn, void *callback_arg);
@@ -123,6 +126,17 @@ fs_read(struct fs_file *file, char *buffer, int count)
 {
   int read;
 
+#if LWIP_HTTPD_CUSTOM_FILES
+  /* The custom file with the extension is read by parts (its len is the upper bound) */
+  if (file->is_custom_file && (file->pextension != NULL)) {
+#if LWIP_HTTPD_FS_ASYNC_READ
+    LWIP_UNUSED_ARG(callback_fn);
+    LWIP_UNUSED_ARG(callback_arg);
+#endif /* LWIP_HTTPD_FS_ASYNC_READ */
+    return fs_read_custom(file, buffer, count);
+  }
+#endif /* LWIP_HTTPD_CUSTOM_FILES */
+
   if(file->index == file->len) {
     return FS_READ_EOF;
   }
@@ -84,7 +84,11 @@
 #include "lwip/stats.h"
 #include "httpd_structs.h"
 #include "lwip/tcp.h"
+#include "lwip/priv/tcpip_priv.h"
 #include "fs.h"
+#include "trace.h"
+#include "bench.h"
+#include "fuzz.h"
 #include "esp_log.h"
 
 #include <string.h>
@@ -268,7 +272,14 @@ static const char * g_tagWS = "WS";
 /** This was TI's check whether to let TCP copy data or not
 #define HTTP_IS_DATA_VOLATILE(hs) ((hs->file < (char *)0x20000000) ? 0 : TCP_WRITE_FLAG_COPY)*/
 #ifndef HTTP_IS_DATA_VOLATILE
-#if LWIP_HTTPD_SSI
+#if LWIP_HTTPD_SSI && LWIP_HTTPD_CUSTOM_FILES
+/* Copy for SSI files and custom files (they are rendered into the reused buffers),
+   no copy for the other files */
+#    define HTTP_IS_DATA_VOLATILE(hs)                                               \
+            (((hs)->ssi || (((hs)->handle != NULL) && (hs)->handle->is_custom_file)) ? \
+            TCP_WRITE_FLAG_COPY :                                                   \
+            0)
+#elif LWIP_HTTPD_SSI
 /* Copy for SSI files, no copy for non-SSI files */
 #    define HTTP_IS_DATA_VOLATILE(hs) ((hs)->ssi ? TCP_WRITE_FLAG_COPY : 0)
 #else /* LWIP_HTTPD_SSI */
@@ -298,6 +309,18 @@ static const char * g_tagWS = "WS";
 #define HTTP_DATA_TO_SEND_CONTINUE          1
 #define HTTP_NO_DATA_TO_SEND                0
 
+/* Methods found by http_scan_request() */
+#define HTTP_METHOD_NONE                    0 /* The request line is not received */
+#define HTTP_METHOD_GET                     1
+#define HTTP_METHOD_POST                    2
+#define HTTP_METHOD_OTHER                   3
+
+/* WebSocket upgrade found by http_scan_request() */
+#define WS_SCAN_NONE                        0
+#define WS_SCAN_NO_KEY                      1 /* The upgrade without the key header */
+#define WS_SCAN_KEY_PARTIAL                 2 /* The key header is not complete */
+#define WS_SCAN_KEY                         3
+
 #if HTTPD_USE_MEM_POOL
 #    define HTTP_ALLOC_SSI_STATE()  (struct http_ssi_state *)memp_malloc(MEMP_HTTPD_SSI_STATE)
 #    define HTTP_ALLOC_HTTP_STATE() (struct http_state *)memp_malloc(MEMP_HTTPD_STATE)
@@ -464,6 +487,44 @@ struct http_state
 #endif /* LWIP_HTTPD_SUPPORT_POST*/
 };
 
+/** The request line and the headers found by http_scan_request(),
+ * the offsets are from the start of the request.
+ */
+struct http_request_scan
+{
+    u16_t uri;        /* The URI offset */
+    u16_t uri_end;    /* The offset of the char after the URI, 0 - the URI is not complete */
+    u16_t ws_key;     /* The WebSocket key offset */
+    u16_t ws_key_len;
+    u8_t  method;     /* HTTP_METHOD_xxx */
+    u8_t  websocket;  /* WS_SCAN_xxx */
+    u8_t  is_09;
+    u8_t  complete;   /* The headers are received (CRLF CRLF) */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    u8_t keepalive;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+};
+
+/** The WebSocket frame header found by websocket_parse_header() */
+struct websocket_frame
+{
+    u8_t  fin;
+    u8_t  opcode;
+    u8_t  mask[4];
+    u16_t offset;     /* The payload offset */
+    u16_t len;        /* The payload length */
+};
+
+/** The frame of websocket_write_tcpip() passed to the TCP thread */
+struct websocket_write_msg
+{
+    struct tcpip_api_call_data call;
+    struct tcp_pcb *           pcb;
+    const uint8_t *            data;
+    uint16_t                   len;
+    uint8_t                    mode;
+};
+
 static err_t http_close_conn(struct tcp_pcb * pcb, struct http_state * hs);
 static err_t http_close_or_abort_conn(struct tcp_pcb * pcb, struct http_state * hs, u8_t abort_conn);
 static err_t http_find_file(struct http_state * hs, const char * uri, int is_09);
@@ -511,7 +572,7 @@ static char * strnstr(const char * buffer, const char * token, size_t n)
     {
         return (char *)buffer;
     }
-    for (p = buffer; *p && (p + tokenlen <= buffer + n); p++)
+    for (p = buffer; (p + tokenlen <= buffer + n) && *p; p++)
     {
         if ((*p == *token) && (strncmp(p, token, tokenlen) == 0))
         {
@@ -1245,6 +1306,8 @@ static u8_t http_check_eof(struct tcp_pcb * pcb, struct http_state * hs)
             return 0;
         }
     }
+    /* The block is not read over the end of the file */
+    count = LWIP_MIN(count, fs_bytes_left(hs->handle));
 
     /* Read a block of data from the file. */
     HTTPD_LOGI("Trying to read %d bytes", count);
@@ -1751,6 +1814,7 @@ static u8_t http_send(struct tcp_pcb * pcb, struct http_state * hs)
 {
     u8_t data_to_send = HTTP_NO_DATA_TO_SEND;
 
+    TRACE_SPAN(TRACE_HTTP_SEND);
     HTTPD_LOGI("Send: pcb=%p hs=%p left=%d", (void *)pcb, (void *)hs, hs != NULL ? (int)hs->left : 0);
 
 #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
@@ -2225,6 +2289,140 @@ static void http_continue(void * connection)
 }
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
 
+/**
+ * Find the request line, the WebSocket key and the end of the headers.
+ * Only the data_len bytes are read, the data is not changed and it may
+ * contain zeros, so any received bytes can be passed.
+ *
+ * @param data the received request
+ * @param data_len the length of the request
+ * @param scan the bounds of the request, the offsets are less than data_len
+ */
+static void http_scan_request(const char * data, u16_t data_len, struct http_request_scan * scan)
+{
+    const char * key_start;
+    const char * key_end;
+    const char * sp1;
+    const char * sp2;
+    u16_t        left_len;
+
+    memset(scan, 0, sizeof(struct http_request_scan));
+
+    /* WebSocket request */
+    if (strncasestr(data, WS_HEADER, data_len))
+    {
+        scan->websocket = WS_SCAN_NO_KEY;
+        key_start       = strncasestr(data, WS_KEY, data_len);
+        if (key_start)
+        {
+            scan->websocket = WS_SCAN_KEY_PARTIAL;
+            key_start += sizeof(WS_KEY) - 1;
+            /* the key ends in the rest of the data */
+            key_end = strnstr(key_start, CRLF, data_len - (key_start - data));
+            if (key_end)
+            {
+                scan->websocket  = WS_SCAN_KEY;
+                scan->ws_key     = key_start - data;
+                scan->ws_key_len = key_end - key_start;
+            }
+        }
+    }
+
+    /* received enough data for minimal request? wait for CRLF before parsing anything */
+    if ((data_len < MIN_REQ_LEN) || (strnstr(data, CRLF, data_len) == NULL))
+    {
+        return;
+    }
+
+    /* parse method */
+    if (!strncmp(data, "GET ", 4))
+    {
+        scan->method = HTTP_METHOD_GET;
+        sp1          = data + 3;
+    }
+#if LWIP_HTTPD_SUPPORT_POST
+    else if (!strncmp(data, "POST ", 5))
+    {
+        scan->method = HTTP_METHOD_POST;
+        sp1          = data + 4;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+    else
+    {
+        scan->method = HTTP_METHOD_OTHER;
+        return;
+    }
+
+    /* parse URI */
+    left_len = data_len - ((sp1 + 1) - data);
+    sp2      = strnstr(sp1 + 1, " ", left_len);
+#if LWIP_HTTPD_SUPPORT_V09
+    if (sp2 == NULL)
+    {
+        /* HTTP 0.9: respond with correct protocol version */
+        sp2         = strnstr(sp1 + 1, CRLF, left_len);
+        scan->is_09 = 1;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_V09 */
+    if (sp2 == NULL)
+    {
+        return;
+    }
+    scan->uri     = (sp1 + 1) - data;
+    scan->uri_end = sp2 - data;
+
+    /* wait for CRLFCRLF (indicating end of HTTP headers) */
+    if (strnstr(data, CRLF CRLF, data_len) != NULL)
+    {
+        scan->complete = 1;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+        if (!scan->is_09 && strnstr(data, HTTP11_CONNECTIONKEEPALIVE, data_len))
+        {
+            scan->keepalive = 1;
+        }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+    }
+}
+
+/**
+ * Build the response to the WebSocket opening handshake, the accept value
+ * is the base64 of the SHA1 of the key and the GUID (RFC 6455, 4.2.2).
+ *
+ * @param key the Sec-WebSocket-Key of the request, not terminated
+ * @param key_len the length of the key
+ * @param rsp the buffer for the terminated response, WS_RSP_LEN bytes at least
+ * @param rsp_size the size of the buffer
+ * @return the length of the response, 0 if the key is empty or too long
+ */
+static u16_t websocket_handshake(const char * key, u16_t key_len, char * rsp, u16_t rsp_size)
+{
+    char          accept[64];
+    unsigned char sha1sum[20];
+    size_t        olen    = 0;
+    char *        rsp_ptr = &rsp[sizeof(WS_RSP) - 1];
+
+    if ((0 == key_len) || ((key_len + sizeof(WS_GUID)) >= sizeof(accept)) || (rsp_size < WS_RSP_LEN))
+    {
+        return 0;
+    }
+
+    /* Concatenate key */
+    memcpy(accept, key, key_len);
+    memcpy(&accept[key_len], WS_GUID, sizeof(WS_GUID));
+    HTTPD_LOGI("Resulting key: %s", accept);
+
+    /* Get SHA1 and base64 encode it after the status and the headers */
+    mbedtls_sha1((unsigned char *)accept, (key_len + sizeof(WS_GUID) - 1), sha1sum);
+    memcpy(rsp, WS_RSP, sizeof(WS_RSP) - 1);
+    if (0 != mbedtls_base64_encode((unsigned char *)rsp_ptr, WS_BASE64_LEN, &olen, sha1sum, sizeof(sha1sum)))
+    {
+        return 0;
+    }
+    memcpy(&rsp_ptr[olen], CRLF CRLF, sizeof(CRLF CRLF));
+
+    return (u16_t)((rsp_ptr - rsp) + olen + sizeof(CRLF CRLF) - 1);
+}
+
 /**
  * When data has been received in the correct state, try to parse it
  * as a HTTP request.
@@ -2238,10 +2436,10 @@ static void http_continue(void * connection)
  */
 static err_t http_parse_request(struct pbuf ** inp, struct http_state * hs, struct tcp_pcb * pcb)
 {
-    char *        data;
-    char *        crlf;
-    u16_t         data_len;
-    struct pbuf * p = *inp;
+    char *                   data;
+    u16_t                    data_len;
+    struct http_request_scan scan;
+    struct pbuf *            p = *inp;
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
     u16_t clen;
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
@@ -2296,189 +2494,107 @@ static err_t http_parse_request(struct pbuf ** inp, struct http_state * hs, stru
         }
     }
 
+    http_scan_request(data, data_len, &scan);
+
     /* Parse WebSocket request */
     hs->is_websocket = 0;
-    if (strncasestr(data, WS_HEADER, data_len))
+    if (scan.websocket == WS_SCAN_NO_KEY)
+    {
+        HTTPD_LOGE("Error: malformed packet");
+        return ERR_ARG;
+    }
+    if (scan.websocket == WS_SCAN_KEY)
     {
+        char  rsp[WS_RSP_LEN];
+        u16_t rsp_len = websocket_handshake(data + scan.ws_key, scan.ws_key_len, rsp, sizeof(rsp));
+
         HTTPD_LOGI("WebSocket opening handshake");
-        char * key_start = strncasestr(data, WS_KEY, data_len);
-        if (key_start)
+        if (0 == rsp_len)
         {
-            key_start += sizeof(WS_KEY) - 1;
-            char * key_end = strnstr(key_start, CRLF, data_len);
-            if (key_end)
-            {
-                char key[64];
-                int  len = sizeof(char) * (key_end - key_start);
-                if ((len + sizeof(WS_GUID) < sizeof(key)) && (len > 0))
-                {
-                    /* Allocate response buffer */
-                    unsigned char * retval = mem_malloc(WS_RSP_LEN);
-                    if (retval == NULL)
-                    {
-                        HTTPD_LOGI("Out of memory");
-                        return ERR_MEM;
-                    }
-                    unsigned char * retval_ptr;
-                    retval_ptr = memcpy(retval, WS_RSP, sizeof(WS_RSP) - 1);
-                    retval_ptr += sizeof(WS_RSP) - 1;
-
-                    /* Concatenate key */
-                    memcpy(key, key_start, len);
-                    strlcpy(&key[len], WS_GUID, sizeof(key));
-                    HTTPD_LOGI("Resulting key: %s", key);
-
-                    /* Get SHA1 */
-                    int           key_len = sizeof(WS_GUID) - 1 + len;
-                    unsigned char sha1sum[20];
-                    mbedtls_sha1((unsigned char *)key, key_len, sha1sum);
-
-                    /* Base64 encode */
-                    unsigned int olen = WS_BASE64_LEN;
-                    int          ok   = mbedtls_base64_encode(retval_ptr, WS_BASE64_LEN, &olen, sha1sum, 20);
-
-                    if (ok == 0)
-                    {
-                        HTTPD_LOGI("Base64 encoded: %s", retval_ptr);
-
-                        /* Send response */
-                        memcpy(&retval_ptr[olen], CRLF CRLF, sizeof(CRLF CRLF));
-                        HTTPD_LOGI("Sending: %s", retval);
-                        tcp_write(pcb, retval, WS_RSP_LEN - 1, 0);
-                        hs->is_websocket = 1;
-                    }
-                    mem_free(retval);
-                }
-                else
-                {
-                    HTTPD_LOGI("Key overflow");
-                    return ERR_MEM;
-                }
-            }
+            HTTPD_LOGI("Key overflow");
+            return ERR_MEM;
         }
-        else
+
+        /* The response is on the stack, so the pcb keeps a copy of it until it is acknowledged */
+        HTTPD_LOGI("Sending: %s", rsp);
+        if (ERR_OK == tcp_write(pcb, rsp, rsp_len, TCP_WRITE_FLAG_COPY))
         {
-            HTTPD_LOGE("Error: malformed packet");
-            return ERR_ARG;
+            hs->is_websocket = 1;
         }
     }
 
-    /* received enough data for minimal request? */
-    if (data_len >= MIN_REQ_LEN)
+    if (scan.method == HTTP_METHOD_OTHER)
     {
-        /* wait for CRLF before parsing anything */
-        crlf = strnstr(data, CRLF, data_len);
-        if (crlf != NULL)
-        {
-#if LWIP_HTTPD_SUPPORT_POST
-            int is_post = 0;
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-            int   is_09 = 0;
-            char *sp1, *sp2;
-            u16_t left_len, uri_len;
-            HTTPD_LOGI("CRLF received, parsing request");
-            /* parse method */
-            if (!strncmp(data, "GET ", 4))
-            {
-                sp1 = data + 3;
-                /* received GET request */
-                HTTPD_LOGI("Received GET request");
-#if LWIP_HTTPD_SUPPORT_POST
-            }
-            else if (!strncmp(data, "POST ", 5))
-            {
-                /* store request type */
-                is_post = 1;
-                sp1     = data + 4;
-                /* received GET request */
-                HTTPD_LOGI("Received POST request");
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-            }
-            else
-            {
-                /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
-                data[4] = 0;
-                /* unsupported method! */
-                HTTPD_LOGI("Unsupported request method (not implemented): \"%s\"", data);
-                return http_find_error_file(hs, 501);
-            }
-            /* if we come here, method is OK, parse URI */
-            left_len = data_len - ((sp1 + 1) - data);
-            sp2      = strnstr(sp1 + 1, " ", left_len);
-#if LWIP_HTTPD_SUPPORT_V09
-            if (sp2 == NULL)
-            {
-                /* HTTP 0.9: respond with correct protocol version */
-                sp2   = strnstr(sp1 + 1, CRLF, left_len);
-                is_09 = 1;
+        /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
+        data[4] = 0;
+        /* unsupported method! */
+        HTTPD_LOGI("Unsupported request method (not implemented): \"%s\"", data);
+        return http_find_error_file(hs, 501);
+    }
+    if (scan.method != HTTP_METHOD_NONE)
+    {
+        HTTPD_LOGI("CRLF received, parsing request");
 #if LWIP_HTTPD_SUPPORT_POST
-                if (is_post)
-                {
-                    /* HTTP/0.9 does not support POST */
-                    goto badrequest;
-                }
+        if ((scan.method == HTTP_METHOD_POST) && scan.is_09)
+        {
+            /* HTTP/0.9 does not support POST */
+            goto badrequest;
+        }
 #endif /* LWIP_HTTPD_SUPPORT_POST */
-            }
-#endif /* LWIP_HTTPD_SUPPORT_V09 */
-            uri_len = sp2 - (sp1 + 1);
-            if ((sp2 != 0) && (sp2 > sp1))
+        if (scan.uri_end != 0)
+        {
+            if (scan.complete)
             {
-                /* wait for CRLFCRLF (indicating end of HTTP headers) before parsing anything */
-                if (strnstr(data, CRLF CRLF, data_len) != NULL)
-                {
-                    char * uri = sp1 + 1;
+                char * sp1 = data + scan.uri - 1;
+                char * sp2 = data + scan.uri_end;
+                char * uri = data + scan.uri;
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-                    if (!is_09 && strnstr(data, HTTP11_CONNECTIONKEEPALIVE, data_len))
-                    {
-                        hs->keepalive = 1;
-                    }
+                hs->keepalive = scan.keepalive;
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
-                    /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
-                    *sp1         = 0;
-                    uri[uri_len] = 0;
-                    HTTPD_LOGI("Received \"%s\" request for URI: \"%s\"", data, uri);
+                /* null-terminate the METHOD and the URI (pbuf is freed anyway wen returning) */
+                *sp1 = 0;
+                *sp2 = 0;
+                HTTPD_LOGI("Received \"%s\" request for URI: \"%s\"", data, uri);
 #if LWIP_HTTPD_SUPPORT_POST
-                    if (is_post)
-                    {
+                if (scan.method == HTTP_METHOD_POST)
+                {
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
-                        struct pbuf ** q = &hs->req;
+                    struct pbuf ** q = &hs->req;
 #else  /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-                        struct pbuf ** q = inp;
+                    struct pbuf ** q = inp;
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-                        err = http_post_request(q, hs, data, data_len, uri, sp2);
-                        if (err != ERR_OK)
-                        {
-                            /* restore header for next try */
-                            *sp1         = ' ';
-                            *sp2         = ' ';
-                            uri[uri_len] = ' ';
-                        }
-                        if (err == ERR_ARG)
-                        {
-                            goto badrequest;
-                        }
-                        return err;
+                    err = http_post_request(q, hs, data, data_len, uri, sp2);
+                    if (err != ERR_OK)
+                    {
+                        /* restore header for next try */
+                        *sp1 = ' ';
+                        *sp2 = ' ';
                     }
-                    else
+                    if (err == ERR_ARG)
+                    {
+                        goto badrequest;
+                    }
+                    return err;
+                }
+                else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
+                {
+                    if (hs->is_websocket)
                     {
-                        if (hs->is_websocket)
-                        {
-                            if (websocket_open_cb)
-                                websocket_open_cb(pcb, uri);
-                            return ERR_OK;  // We handled this
-                        }
-                        else
-                        {
-                            return http_find_file(hs, uri, is_09);
-                        }
+                        if (websocket_open_cb)
+                            websocket_open_cb(pcb, uri);
+                        return ERR_OK;  // We handled this
+                    }
+                    else
+                    {
+                        return http_find_file(hs, uri, scan.is_09);
                     }
                 }
             }
-            else
-            {
-                HTTPD_LOGI("Invalid URI");
-            }
+        }
+        else
+        {
+            HTTPD_LOGI("Invalid URI");
         }
     }
 
@@ -2658,7 +2774,17 @@ static err_t http_init_file(struct http_state * hs, struct fs_file * file, int i
         hs->handle = file;
         hs->file   = (char *)file->data;
         LWIP_ASSERT("File length must be positive!", (file->len >= 0));
-        hs->left    = file->len;
+#if LWIP_HTTPD_CUSTOM_FILES
+        if (file->is_custom_file && (file->data == NULL))
+        {
+            /* The custom file is read by parts (fs_read_custom), its len is the upper bound */
+            hs->left = 0;
+        }
+        else
+#endif /* LWIP_HTTPD_CUSTOM_FILES */
+        {
+            hs->left = file->len;
+        }
         hs->retries = 0;
 #if LWIP_HTTPD_TIMING
         hs->time_started = sys_now();
@@ -2667,7 +2793,7 @@ static err_t http_init_file(struct http_state * hs, struct fs_file * file, int i
         LWIP_ASSERT("HTTP headers not included in file system", hs->handle->http_header_included);
 #endif /* !LWIP_HTTPD_DYNAMIC_HEADERS */
 #if LWIP_HTTPD_SUPPORT_V09
-        if (hs->handle->http_header_included && is_09)
+        if (hs->handle->http_header_included && is_09 && (hs->file != NULL))
         {
             /* HTTP/0.9 responses are sent without HTTP header,
                search for the end of the header. */
@@ -2804,37 +2930,92 @@ void websocket_register_callbacks(tWsOpenHandler ws_open_cb, tWsHandler ws_cb)
     websocket_cb      = ws_cb;
 }
 
+/**
+ * Queue the frame header and the payload as two writes of one segment.
+ * The room for the frame is checked first, so the frame is not queued in part
+ * when the send buffer is full. A part of the frame would break the stream:
+ * if the payload write still fails, the connection is aborted (ERR_ABRT).
+ */
 err_t websocket_write(struct tcp_pcb * pcb, const uint8_t * data, uint16_t len, uint8_t mode)
 {
-    uint8_t * buf = mem_malloc(len + 4);
-    if (buf == NULL)
-    {
-        WS_LOGI("Out of memory");
-        return ERR_MEM;
-    }
+    u8_t  hdr[4];
+    u16_t hdr_len = 2;
+    u16_t mss     = LWIP_MAX(tcp_mss(pcb), 1);
+    u16_t queuelen;
+    err_t err;
 
-    int offset = 2;
-    buf[0]     = 0x80 | mode;
+    hdr[0] = 0x80 | mode;
     if (len > 125)
     {
-        offset = 4;
-        buf[1] = 126;
-        buf[2] = len >> 8;
-        buf[3] = len;
+        hdr_len = 4;
+        hdr[1]  = 126;
+        hdr[2]  = len >> 8;
+        hdr[3]  = len;
     }
     else
     {
-        buf[1] = len;
+        hdr[1] = len;
     }
 
-    memcpy(&buf[offset], data, len);
-    len += offset;
+    /* the pbuf of every segment and the one of the header if it is sent alone */
+    queuelen = 1 + ((hdr_len + len + mss - 1) / mss);
+    if ((tcp_sndbuf(pcb) < hdr_len + len) || (tcp_sndqueuelen(pcb) + queuelen > TCP_SND_QUEUELEN))
+    {
+        WS_LOGE("Send buffer is full");
+        return ERR_MEM;
+    }
 
     WS_LOGI("Sending packet");
-    err_t retval = http_write(pcb, buf, &len, TCP_WRITE_FLAG_COPY);
-    mem_free(buf);
+    err = tcp_write(pcb, hdr, hdr_len, TCP_WRITE_FLAG_COPY | ((len > 0) ? TCP_WRITE_FLAG_MORE : 0));
+    if ((err == ERR_OK) && (len > 0))
+    {
+        err = tcp_write(pcb, data, len, TCP_WRITE_FLAG_COPY);
+        if (err != ERR_OK)
+        {
+            /* The header is queued without its payload, the stream can not be resynced */
+            WS_LOGE("Error: the frame is broken, err %d, abort", err);
+            tcp_abort(pcb);
+            err = ERR_ABRT;
+        }
+    }
 
-    return retval;
+    return err;
+}
+
+/**
+ * The frame of websocket_write_tcpip(), it is written in the TCP thread:
+ * the pcb is not changed by the stack under the write and the abort.
+ * The connection which only sends gets no segment which would output
+ * the queue, so the frame is sent at once.
+ */
+static err_t websocket_write_call(struct tcpip_api_call_data * call)
+{
+    struct websocket_write_msg * msg = (struct websocket_write_msg *)call;
+    err_t                        err;
+
+    if (msg->pcb->state != ESTABLISHED)
+    {
+        return ERR_CONN;
+    }
+    err = websocket_write(msg->pcb, msg->data, msg->len, msg->mode);
+    if (err == ERR_OK)
+    {
+        tcp_output(msg->pcb);
+    }
+
+    return err;
+}
+
+err_t websocket_write_tcpip(struct tcp_pcb * pcb, const uint8_t * data, uint16_t len, uint8_t mode)
+{
+    struct websocket_write_msg msg;
+
+    msg.pcb  = pcb;
+    msg.data = data;
+    msg.len  = len;
+    msg.mode = mode;
+
+    return tcpip_api_call(websocket_write_call, &msg.call);
 }
 
 /**
@@ -2848,6 +3029,60 @@ static err_t websocket_send_close(struct tcp_pcb * pcb)
     return tcp_write(pcb, buf, len, TCP_WRITE_FLAG_COPY);
 }
 
+/**
+ * Parse websocket frame header, only the data_len bytes are read.
+ *
+ * @return ERR_OK: the header and the payload are within the data
+ *         ERR_VAL: the header is not complete, the payload is longer than the data
+ *                  or the frame is not masked
+ *         ERR_MEM: the payload length does not fit 16 bits
+ */
+static err_t websocket_parse_header(const u8_t * data, u16_t data_len, struct websocket_frame * frame)
+{
+    u16_t offset = 2;
+    u16_t len;
+
+    if (data_len < offset)
+    {
+        return ERR_VAL;
+    }
+    frame->fin    = (data[0] & 0x80) ? 1 : 0;
+    frame->opcode = data[0] & 0x0F;
+    len           = data[1] & 0x7F;
+
+    if (len == 127)
+    {
+        return ERR_MEM;
+    }
+    else if (len == 126)
+    {
+        /* extended length */
+        offset += 2;
+        if (data_len < offset)
+        {
+            return ERR_VAL;
+        }
+        len = (data[2] << 8) | data[3];
+    }
+
+    /* the client frames are masked */
+    if (((data[1] & 0x80) == 0) || (data_len < offset + 4))
+    {
+        return ERR_VAL;
+    }
+    memcpy(frame->mask, &data[offset], 4);
+    offset += 4;
+
+    if (len > data_len - offset)
+    {
+        return ERR_VAL;
+    }
+    frame->offset = offset;
+    frame->len    = len;
+
+    return ERR_OK;
+}
+
 /**
  * Parse websocket frame.
  *
@@ -2857,9 +3092,12 @@ static err_t websocket_send_close(struct tcp_pcb * pcb)
  */
 static err_t websocket_parse(struct tcp_pcb * pcb, struct pbuf * p)
 {
-    u8_t * data     = (u8_t *)p->payload;
-    u16_t  data_len = p->len;
+    u8_t *                 data     = (u8_t *)p->payload;
+    u16_t                  data_len = p->len;
+    struct websocket_frame frame;
+    err_t                  err;
 
+    TRACE_SPAN(TRACE_WEBSOCKET_PARSE);
     if (data != NULL && data_len > 1)
     {
         WS_LOGI("Frame received");
@@ -2876,45 +3114,34 @@ static err_t websocket_parse(struct tcp_pcb * pcb, struct pbuf * p)
                 WS_LOGI("Opcode: 0x%hX, frame length: %d", opcode, data_len);
                 if (data_len > 6 && websocket_cb != NULL)
                 {
-                    int    data_offset = 6;
-                    u8_t * dptr        = &data[6];
-                    u8_t * kptr        = &data[2];
-                    u16_t  len         = data[1] & 0x7F;
-
-                    if (len == 127)
+                    err = websocket_parse_header(data, data_len, &frame);
+                    if (err == ERR_MEM)
                     {
                         /* most likely won't happen inside non-fragmented frame */
                         WS_LOGE("Warning: frame is too long");
                         return ERR_OK;
                     }
-                    else if (len == 126)
-                    {
-                        /* extended length */
-                        dptr += 2;
-                        kptr += 2;
-                        data_offset += 2;
-                        len = (data[2] << 8) | data[3];
-                    }
-
-                    data_len -= data_offset;
-
-                    if (len > data_len)
+                    else if (err != ERR_OK)
                     {
                         WS_LOGE("Error: incorrect frame size");
                         return ERR_VAL;
                     }
 
-                    if (data_len != len)
+                    if (data_len - frame.offset != frame.len)
                     {
                         WS_LOGE("Warning: segmented frame received");
                     }
 
                     /* unmask */
-                    for (int i = 0; i < len; i++)
-                        *(dptr++) ^= kptr[i % 4];
+                    u8_t * dptr = &data[frame.offset];
+                    for (int i = 0; i < frame.len; i++)
+                        dptr[i] ^= frame.mask[i % 4];
 
-                    /* user callback */
-                    websocket_cb(pcb, &data[data_offset], len, opcode);
+                    /* user callback, ERR_ABRT if its write has aborted the connection */
+                    if (websocket_cb(pcb, dptr, frame.len, opcode) == ERR_ABRT)
+                    {
+                        return ERR_ABRT;
+                    }
                 }
                 break;
             case 0x08:  // close
@@ -2955,6 +3182,11 @@ static err_t http_recv(void * arg, struct tcp_pcb * pcb, struct pbuf * p, err_t
             WS_LOGI("Freeing buffer");
             pbuf_free(p);
         }
+        if (err == ERR_ABRT)
+        {
+            /* pcb and hs are freed */
+            return ERR_ABRT;
+        }
         if (err == ERR_CLSD)
         {
             http_close_conn(pcb, hs);
@@ -3179,4 +3411,337 @@ void http_set_cgi_handlers(const tCGI * cgis, int num_handlers)
 }
 #endif /* LWIP_HTTPD_CGI */
 
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    const u8_t * frame;
+    u16_t        frame_len;
+    u8_t         outside;
+    u32_t        payloads;
+    u32_t        requests;
+} httpd_test_t;
+
+static httpd_test_t gHttpdTest;
+
+static const char gcHttpdTestUpgrade[] =
+    "GET /stream HTTP/1.1" CRLF
+    "Host: home.local" CRLF
+    "Upgrade: websocket" CRLF
+    "Connection: Upgrade" CRLF
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==" CRLF
+    "Sec-WebSocket-Version: 13" CRLF CRLF;
+
+static const char gcHttpdTestCgi[] = "GET /gpio?led=1&r=255&g=128&b=0 HTTP/1.1" CRLF "Host: home.local" CRLF CRLF;
+static const char gcHttpdTestV09[] = "GET /index.html" CRLF;
+
+/* The masked "Hello" of RFC 6455 and the close request with the status 1000 */
+static const u8_t gcHttpdTestHello[] = {0x81, 0x85, 0x37, 0xFA, 0x21, 0x3D, 0x7F, 0x9F, 0x4D, 0x51, 0x58};
+static const u8_t gcHttpdTestClose[] = {0x88, 0x82, 0x11, 0x22, 0x33, 0x44, 0x12, 0xCA};
+
+//-------------------------------------------------------------------------------------------------
+
+static err_t httpd_TestWsCb(struct tcp_pcb * pcb, uint8_t * data, u16_t data_len, uint8_t mode)
+{
+    LWIP_UNUSED_ARG(pcb);
+    LWIP_UNUSED_ARG(mode);
+    if ((data < gHttpdTest.frame) || ((data + data_len) > (gHttpdTest.frame + gHttpdTest.frame_len)))
+    {
+        gHttpdTest.outside = 1;
+    }
+    gHttpdTest.payloads++;
+
+    return ERR_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The bounds are within the request, so it is terminated in place safely */
+static bool httpd_TestFuzzRequest(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    struct http_request_scan scan;
+    bool                     pass = true;
+
+    LWIP_UNUSED_ARG(p_ctx);
+    http_scan_request((const char *)p_data, size, &scan);
+    pass &= ((0 == scan.uri_end) || ((0 < scan.uri) && (scan.uri <= scan.uri_end) && (scan.uri_end < size)));
+    pass &= ((WS_SCAN_KEY != scan.websocket) || ((u32_t)(scan.ws_key + scan.ws_key_len) <= size));
+    pass &= ((0 == scan.complete) || (0 != scan.uri_end));
+    gHttpdTest.requests += scan.complete;
+
+    return pass;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The payload passed to the handler is within the frame */
+static bool httpd_TestFuzzFrame(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    struct pbuf p = {0};
+
+    LWIP_UNUSED_ARG(p_ctx);
+    p.payload             = p_data;
+    p.len                 = size;
+    p.tot_len             = size;
+    gHttpdTest.frame      = p_data;
+    gHttpdTest.frame_len  = size;
+    gHttpdTest.outside    = 0;
+    (void)websocket_parse(NULL, &p);
+
+    return (0 == gHttpdTest.outside);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The WebSocket handler is replaced while the frames are parsed, call it before httpd_init() */
+void HTTPD_Test(void)
+{
+    static u8_t              extended[4 + 4 + 130];
+    tWsHandler               ws_cb      = websocket_cb;
+    struct http_request_scan scan       = {0};
+    struct websocket_frame   frame      = {0};
+    char                     rsp[WS_RSP_LEN];
+    fuzz_seed_t              requests[] =
+    {
+        {(const uint8_t *)gcHttpdTestUpgrade, sizeof(gcHttpdTestUpgrade) - 1},
+        {(const uint8_t *)gcHttpdTestCgi, sizeof(gcHttpdTestCgi) - 1},
+        {(const uint8_t *)gcHttpdTestV09, sizeof(gcHttpdTestV09) - 1},
+    };
+    fuzz_seed_t              frames[]   =
+    {
+        {gcHttpdTestHello, sizeof(gcHttpdTestHello)},
+        {extended, sizeof(extended)},
+        {gcHttpdTestClose, sizeof(gcHttpdTestClose)},
+    };
+    u16_t                    idx        = 0;
+    bool                     pass       = true;
+
+    /* The binary frame of 130 bytes with the extended length */
+    extended[0] = (0x80 | WS_BIN_MODE);
+    extended[1] = (0x80 | 126);
+    extended[2] = 0x00;
+    extended[3] = 130;
+    for (idx = 4; idx < sizeof(extended); idx++)
+    {
+        extended[idx] = (u8_t)(idx * 37 + 11);
+    }
+
+    http_scan_request(gcHttpdTestUpgrade, sizeof(gcHttpdTestUpgrade) - 1, &scan);
+    pass &= ((HTTP_METHOD_GET == scan.method) && (1 == scan.complete) && (0 == scan.is_09));
+    pass &= (0 == strncmp(&gcHttpdTestUpgrade[scan.uri], "/stream ", (scan.uri_end - scan.uri) + 1));
+    pass &= ((WS_SCAN_KEY == scan.websocket) && (24 == scan.ws_key_len));
+    pass &= (0 == strncmp(&gcHttpdTestUpgrade[scan.ws_key], "dGhlIHNhbXBsZSBub25jZQ==", 24));
+
+    /* The accept value of the RFC 6455 sample key, the whole response is sent and the long key is refused */
+    pass &= ((WS_RSP_LEN - 1) == websocket_handshake(&gcHttpdTestUpgrade[scan.ws_key], scan.ws_key_len, rsp, sizeof(rsp)));
+    pass &= ((WS_RSP_LEN - 1) == strlen(rsp));
+    pass &= (NULL != strstr(rsp, CRLF "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=" CRLF CRLF));
+    pass &= (0 == websocket_handshake(gcHttpdTestUpgrade, 40, rsp, sizeof(rsp)));
+
+    /* The key is searched within the request only */
+    http_scan_request(gcHttpdTestUpgrade, (strstr(gcHttpdTestUpgrade, "Sec-WebSocket-Version") - gcHttpdTestUpgrade - 2), &scan);
+    pass &= ((WS_SCAN_KEY_PARTIAL == scan.websocket) && (0 == scan.complete));
+    http_scan_request(gcHttpdTestV09, sizeof(gcHttpdTestV09) - 1, &scan);
+    pass &= ((1 == scan.is_09) && (4 == scan.uri) && ((sizeof(gcHttpdTestV09) - 3) == scan.uri_end));
+
+    pass &= (ERR_OK == websocket_parse_header(gcHttpdTestHello, sizeof(gcHttpdTestHello), &frame));
+    pass &= ((WS_TEXT_MODE == frame.opcode) && (6 == frame.offset) && (5 == frame.len));
+    pass &= (ERR_OK == websocket_parse_header(extended, sizeof(extended), &frame));
+    pass &= ((8 == frame.offset) && (130 == frame.len));
+
+    /* The extended length without the mask, the short and the unmasked frames */
+    pass &= (ERR_VAL == websocket_parse_header(extended, 7, &frame));
+    pass &= (ERR_VAL == websocket_parse_header(extended, (sizeof(extended) - 1), &frame));
+    pass &= (ERR_VAL == websocket_parse_header((const u8_t *)"\x81\x05Hello", 7, &frame));
+
+    websocket_cb = httpd_TestWsCb;
+    pass &= (0 == Fuzz_Run("http", requests, 3, httpd_TestFuzzRequest, NULL, 20000));
+    pass &= (0 == Fuzz_Run("websocket", frames, 3, httpd_TestFuzzFrame, NULL, 20000));
+    pass &= ((0 < gHttpdTest.requests) && (0 < gHttpdTest.payloads));
+    websocket_cb = ws_cb;
+
+    HTTPD_LOGI("HTTPD - %s", (true == pass) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Benchmarks ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+#ifdef CONFIG_BENCH_ENABLE
+/* The WebSocket write benchmark drops the segments queued on its pcb */
+#    include "lwip/priv/tcp_priv.h"
+#endif /* CONFIG_BENCH_ENABLE */
+
+typedef struct
+{
+    struct http_state hs;
+    char              req[512];
+    u8_t              frame[80];
+    u16_t             frame_len;
+#ifdef CONFIG_BENCH_ENABLE
+    struct tcp_pcb *  pcb;
+    u8_t              payload[1024];
+    u16_t             payload_len;
+#endif /* CONFIG_BENCH_ENABLE */
+    volatile u32_t    sum;
+} httpd_bench_t;
+
+static httpd_bench_t gHttpdBench;
+
+/* The browser request of the LED CGI */
+static const char gcHttpdBenchReq[] =
+    "GET /gpio?led=1&r=255&g=128&b=0&duration=1000 HTTP/1.1" CRLF
+    "Host: home.local" CRLF
+    "Connection: keep-alive" CRLF
+    "User-Agent: Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) "
+    "Chrome/120.0.0.0 Safari/537.36" CRLF
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8" CRLF
+    "Referer: http://home.local/index.html" CRLF
+    "Accept-Encoding: gzip, deflate" CRLF
+    "Accept-Language: en-US,en;q=0.9" CRLF CRLF;
+
+//-------------------------------------------------------------------------------------------------
+
+static err_t httpd_BenchWsCb(struct tcp_pcb * pcb, uint8_t * data, u16_t data_len, uint8_t mode)
+{
+    LWIP_UNUSED_ARG(pcb);
+    LWIP_UNUSED_ARG(mode);
+    gHttpdBench.sum += (u32_t)(data[0] + data_len);
+
+    return ERR_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The scan of http_parse_request() and the CGI parameters, the request is parsed in place */
+static void httpd_BenchRequest(void * p_ctx, uint32_t count)
+{
+    httpd_bench_t *          p_bench = (httpd_bench_t *)p_ctx;
+    struct http_request_scan scan;
+    char *                   params  = NULL;
+    u16_t                    len     = (u16_t)(sizeof(gcHttpdBenchReq) - 1);
+    uint32_t                 idx     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        memcpy(p_bench->req, gcHttpdBenchReq, sizeof(gcHttpdBenchReq));
+        http_scan_request(p_bench->req, len, &scan);
+        p_bench->sum += scan.uri_end;
+        p_bench->req[scan.uri_end] = '\0';
+        params = strnstr(&p_bench->req[scan.uri], "?", (scan.uri_end - scan.uri));
+#if LWIP_HTTPD_CGI
+        if (NULL != params)
+        {
+            *params++ = '\0';
+            p_bench->sum += (u32_t)extract_uri_parameters(&p_bench->hs, params);
+        }
+#endif /* LWIP_HTTPD_CGI */
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The masked frame of the 64 bytes command, it is unmasked in place (toggled every time) */
+static void httpd_BenchWsParse(void * p_ctx, uint32_t count)
+{
+    httpd_bench_t * p_bench = (httpd_bench_t *)p_ctx;
+    struct pbuf     p       = {0};
+    uint32_t        idx     = 0;
+
+    p.payload = p_bench->frame;
+    p.len     = p_bench->frame_len;
+    p.tot_len = p_bench->frame_len;
+    for (idx = 0; idx < count; idx++)
+    {
+        p_bench->sum += (u32_t)websocket_parse(NULL, &p);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+#ifdef CONFIG_BENCH_ENABLE
+
+/* The queued segments are dropped, the pcb is ready for the next frame */
+static void httpd_BenchWsDrop(struct tcp_pcb * pcb)
+{
+    tcp_segs_free(pcb->unsent);
+    pcb->unsent       = NULL;
+    pcb->snd_queuelen = 0;
+    pcb->snd_buf      = TCP_SND_BUF;
+#if TCP_OVERSIZE
+    pcb->unsent_oversize = 0;
+#endif /* TCP_OVERSIZE */
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The frames are queued on the pcb which is not connected, nothing is sent */
+static void httpd_BenchWsWrite(void * p_ctx, uint32_t count)
+{
+    httpd_bench_t * p_bench = (httpd_bench_t *)p_ctx;
+    uint32_t        idx     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        p_bench->sum += (u32_t)websocket_write(p_bench->pcb, p_bench->payload, p_bench->payload_len, WS_BIN_MODE);
+        httpd_BenchWsDrop(p_bench->pcb);
+    }
+}
+
+#endif /* CONFIG_BENCH_ENABLE */
+
+//-------------------------------------------------------------------------------------------------
+
+/* The WebSocket handler is replaced while the frame is parsed, call it before httpd_init() */
+/* The frames per second are 1e9 / ns_per_op, the heap churn is allocs_per_op, bytes_per_op */
+/* The frames are written on the detached pcb only when CONFIG_BENCH_ENABLE is set          */
+void HTTPD_Bench(void)
+{
+    tWsHandler ws_cb = websocket_cb;
+    u16_t      idx   = 0;
+
+    memset(&gHttpdBench, 0, sizeof(gHttpdBench));
+    gHttpdBench.frame[0] = (0x80 | WS_BIN_MODE);
+    gHttpdBench.frame[1] = (0x80 | 64);
+    for (idx = 0; idx < (4 + 64); idx++)
+    {
+        gHttpdBench.frame[2 + idx] = (u8_t)(idx * 37 + 11);
+    }
+    gHttpdBench.frame_len = (2 + 4 + 64);
+
+    Bench_Run("httpd", "http_parse_request", httpd_BenchRequest, &gHttpdBench, NULL);
+    websocket_cb = httpd_BenchWsCb;
+    Bench_Run("httpd", "websocket_parse", httpd_BenchWsParse, &gHttpdBench, NULL);
+    websocket_cb = ws_cb;
+
+#ifdef CONFIG_BENCH_ENABLE
+    /* The pcb is not in the lists of the stack, so it is not touched by the TCP thread */
+    gHttpdBench.pcb = tcp_new();
+    if (NULL == gHttpdBench.pcb)
+    {
+        HTTPD_LOGE("Out of memory");
+        return;
+    }
+    gHttpdBench.pcb->state = ESTABLISHED;
+    for (idx = 0; idx < sizeof(gHttpdBench.payload); idx++)
+    {
+        gHttpdBench.payload[idx] = (u8_t)(idx * 37 + 11);
+    }
+
+    /* The command response and the climate series chunk */
+    gHttpdBench.payload_len = 64;
+    Bench_Run("httpd", "websocket_write_64", httpd_BenchWsWrite, &gHttpdBench, NULL);
+    gHttpdBench.payload_len = sizeof(gHttpdBench.payload);
+    Bench_Run("httpd", "websocket_write_1024", httpd_BenchWsWrite, &gHttpdBench, NULL);
+
+    gHttpdBench.pcb->state = CLOSED;
+    tcp_close(gHttpdBench.pcb);
+    gHttpdBench.pcb = NULL;
+#endif /* CONFIG_BENCH_ENABLE */
+}
+
+//-------------------------------------------------------------------------------------------------
+
 #endif /* LWIP_TCP */
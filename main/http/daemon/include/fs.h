@@ -41,6 +41,11 @@
  *    that are not included in fsdata(_custom).c
  * - "void fs_close_custom(struct fs_file *file)"
  *    Called to free resources allocated by fs_open_custom().
+ * - "int fs_read_custom(struct fs_file *file, char *buffer, int count)"
+ *    Called by fs_read() for the custom files with pextension set
+ *    (LWIP_HTTPD_DYNAMIC_FILE_READ), returns FS_READ_EOF at the end.
+ *    The file has no data then, its len is the upper bound of the size
+ *    and its index is advanced by the read parts.
  */
 #ifndef LWIP_HTTPD_CUSTOM_FILES
 #define LWIP_HTTPD_CUSTOM_FILES       0
@@ -237,28 +237,48 @@ enum
   WS_BIN_MODE  = 0x02,
 };
 
-typedef void (*tWsHandler)(struct tcp_pcb *pcb, uint8_t *data, u16_t data_len, uint8_t mode);
+typedef err_t (*tWsHandler)(struct tcp_pcb *pcb, uint8_t *data, u16_t data_len, uint8_t mode);
 typedef void (*tWsOpenHandler)(struct tcp_pcb *pcb, const char *uri);
 
 /**
- * Write data into a websocket.
+ * Write data into a websocket, it is called in the TCP thread (the websocket callback).
+ * The data is copied into the TCP segments. The header and the payload are
+ * queued by two writes: the frame is not queued when the send buffer or the
+ * segment queue has no room for it, but the payload write may still fail
+ * (no pbuf) after the header is queued, then the connection is aborted.
  *
  * @param pcb tcp_pcb to send.
  * @param data data to send.
  * @param len data length.
  * @param mode WS_TEXT_MODE or WS_BIN_MODE.
- * @return ERR_OK if write succeeded.
+ * @return ERR_OK if write succeeded, nothing is queued on ERR_MEM (no room for the frame)
+ *         and the other errors of the header write, ERR_ABRT if the frame is broken:
+ *         the pcb is aborted and freed, it must not be used any more. The websocket
+ *         callback returns ERR_ABRT to the daemon then.
  */
 err_t websocket_write(struct tcp_pcb *pcb, const uint8_t *data, uint16_t len, uint8_t mode);
 
+/**
+ * Write data into a websocket from a task, the frame is written and sent
+ * by the TCP thread, the task waits for it.
+ *
+ * @return the same as websocket_write(), ERR_CONN if the connection is not established.
+ */
+err_t websocket_write_tcpip(struct tcp_pcb *pcb, const uint8_t *data, uint16_t len, uint8_t mode);
+
 /**
  * Register websocket callback functions. Use NULL if callback is not needed.
  *
  * @param ws_open_cb called when new websocket is opened.
- * @param ws_cb called when data is received from client.
+ * @param ws_cb called when data is received from client, it returns ERR_ABRT
+ *              if it has aborted the connection, the other errors are ignored.
  */
 void websocket_register_callbacks(tWsOpenHandler ws_open_cb, tWsHandler ws_cb);
 
 void httpd_init(bool config);
 
+/* The request and WebSocket frame parsing fuzz tests and benchmarks */
+void HTTPD_Test(void);
+void HTTPD_Bench(void);
+
 #endif /* __HTTPD_H__ */
@@ -11,12 +11,15 @@
         this.onConnectionParametersReceived = NaN;
         this.onStatusReceived = NaN;
         this.onDayMeasurementsReceived = NaN;
+        this.onEventsReceived = NaN;
+        this.onSeriesReceived = NaN;
         this.onDisconnected = NaN;
 
         this.onWsOpen = this.onWsOpen.bind(this);
         this.onWsError = this.onWsError.bind(this);
         this.onWsMessage = this.onWsMessage.bind(this);
         this.onWsClose = this.onWsClose.bind(this);
+        this.series = {to: 0, level: 0, fields: 0};
 
         this._setMode = function(mode)
         {
@@ -60,6 +63,10 @@
         setFAN: 0x09,
         setHumidifier: 0x0A,
         getDayMeasurements: 0x0B,
+        getEvents: 0x0C,
+        getSeries: 0x0D,
+        seriesFields: 5,
+        seriesRetryMs: 100,
         success: 0x00,
         on: 0x01,
         off: 0x00,
@@ -129,6 +136,115 @@
         this.send(buffer);
     }
 
+    Controller.prototype.getEvents = function(since)
+    {
+        console.log("WS: Get Events after " + since);
+        let buffer = new ArrayBuffer(3);
+        let view = new DataView(buffer);
+        view.setUint8(0, Controller.Protocol.getEvents);
+        view.setUint16(1, since, true);
+        this.send(buffer);
+    }
+
+    // The range [from, to) of the history level (0 - 10 s, 1 - 1 minute, 2 - 20 minutes),
+    // the fields mask: 1 - temperature, 2 - humidity, 4 - pressure, 8 - CO2, 16 - light.
+    // The chunks are requested one by one, so the slow link gets them as fast as it can.
+    Controller.prototype.getSeries = function(from, to, level, fields)
+    {
+        console.log("WS: Get Series " + from + " - " + to);
+        this.series = {to: to, level: level, fields: fields};
+        let buffer = new ArrayBuffer(11);
+        let view = new DataView(buffer);
+        view.setUint8(0, Controller.Protocol.getSeries);
+        view.setUint32(1, from, true);
+        view.setUint32(5, to, true);
+        view.setUint8(9, level);
+        view.setUint8(10, fields);
+        this.send(buffer);
+    }
+
+    // The chunk: the first sample is 32 bits per the time and every value, the next ones
+    // are the delta-of-delta of the time and the deltas of the values in the buckets:
+    // '0' - zero, '10', '110', '1110' + the short signed value, '1111' + 32 bits.
+    Controller.decodeSeries = function(view, offset, count, fields)
+    {
+        let bit = offset * 8;
+        let read = function(bits)
+        {
+            let value = 0;
+            for (let i = 0; i < bits; i++, bit++)
+            {
+                value = (value * 2) + ((view.getUint8(bit >> 3) >> (7 - (bit & 7))) & 1);
+            }
+            return value;
+        };
+        let bucket = function(sizes)
+        {
+            let prefix = 0;
+            while ((prefix < sizes.length) && (1 == read(1)))
+            {
+                prefix++;
+            }
+            if (0 == prefix)
+            {
+                return 0;
+            }
+            let bits = sizes[prefix - 1];
+            let value = read(bits);
+            return (value >= Math.pow(2, bits - 1)) ? (value - Math.pow(2, bits)) : value;
+        };
+        let samples = [];
+        let time = 0;
+        let delta = 0;
+        let values = [0, 0, 0, 0, 0];
+
+        for (let n = 0; n < count; n++)
+        {
+            if (0 == n)
+            {
+                time = read(32);
+            }
+            else
+            {
+                delta += bucket([7, 9, 12, 32]);
+                time += delta;
+            }
+            for (let f = 0; f < Controller.Protocol.seriesFields; f++)
+            {
+                if (0 != (fields & (1 << f)))
+                {
+                    values[f] = (0 == n) ? (read(32) | 0) : ((values[f] + bucket([4, 7, 12, 32])) | 0);
+                }
+            }
+            samples.push({time: time, values: values.slice()});
+        }
+
+        return samples;
+    }
+
+    Controller.prototype.onMessageGetSeries = function(view)
+    {
+        let next = view.getUint32(2, true);
+        let count = view.getUint16(6, true);
+        let level = view.getUint8(8);
+        let fields = view.getUint8(9);
+        let samples = Controller.decodeSeries(view, 10, count, fields);
+        let done = (next >= this.series.to);
+
+        console.log("WS: Series received: " + count + " samples in " + (view.byteLength - 10) + " bytes");
+
+        if (NaN != this.onSeriesReceived)
+        {
+            this.onSeriesReceived(samples, done);
+        }
+        if (false == done)
+        {
+            // The empty chunk is the full TCP buffer of the device, repeat a bit later
+            let delay = (0 < count) ? 0 : Controller.Protocol.seriesRetryMs;
+            setTimeout(() => this.getSeries(next, this.series.to, level, fields), delay);
+        }
+    }
+
     Controller.prototype.onMessageGetConnectionParameters = function (view)
     {
         console.log("WS: Configuration received!");
@@ -163,7 +279,12 @@
         let p      = view.getUint32(12, true);
         let t      = view.getInt16(16, true);
         let h      = view.getUint16(18, true);
-        let dts    = Controller.getStrFromBuffer(view, 20);
+        let co2    = view.getUint16(20, true);
+        let lux    = view.getUint32(22, true);
+        let rpm    = view.getUint16(26, true);
+        let fa     = view.getUint8(28);
+        let ev     = view.getUint16(29, true);
+        let dts    = Controller.getStrFromBuffer(view, 31);
         let sun    = true;
 
         console.log("WS: Color = " + color.r + ":" + color.g + ":" + color.b + " - " + dts.value);
@@ -174,7 +295,7 @@
         }
         if (NaN != this.onStatusReceived)
         {
-            this.onStatusReceived(sun, dts.value, color, uv, w, fito, fan, hf, p, t, h, r);
+            this.onStatusReceived(sun, dts.value, color, uv, w, fito, fan, hf, p, t, h, co2, lux, rpm, fa, ev, r);
         }
     }
 
@@ -216,6 +337,32 @@
         }
     }
 
+    Controller.prototype.onMessageGetEvents = function(view)
+    {
+        let count = view.getUint8(2);
+        let offs = 3;
+        let events = [];
+        let i = 0;
+
+        console.log("WS: Events received: " + count);
+
+        // time, value, sequence, type, metric
+        for (i = 0; i < count; i++)
+        {
+            events[i] = {time: view.getUint32(offs, true),
+                         value: view.getInt32(offs + 4, true),
+                         sequence: view.getUint16(offs + 8, true),
+                         type: view.getUint8(offs + 10),
+                         metric: view.getUint8(offs + 11)};
+            offs += 12;
+        }
+
+        if (NaN != this.onEventsReceived)
+        {
+            this.onEventsReceived(events);
+        }
+    }
+
     Controller.prototype.onWsOpen = function(event)
     {
         this.retries = 0;
@@ -297,6 +444,14 @@
             {
                 this.onMessageGetDayMeasurements(view);
             }
+            else if (Controller.Protocol.getEvents == command)
+            {
+                this.onMessageGetEvents(view);
+            }
+            else if (Controller.Protocol.getSeries == command)
+            {
+                this.onMessageGetSeries(view);
+            }
         }
     }
 
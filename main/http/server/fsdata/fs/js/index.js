@@ -1,6 +1,7 @@
 var rgbPicker = new iro.ColorPicker('#rgb_picker', { wheelLightness: false });
 var intervalId = 0;
 var mode = {last: false, initiatedByUser: false, needUiUpdate: false, width: 0};
+var events = {sequence: 0, lines: []};
 var chart_t = undefined;
 var chart_h = undefined;
 var chart_p = undefined;
@@ -79,6 +80,7 @@ function onWindowLoad()
     controller.onConnectionParametersReceived = onConnectionParametersReceived;
     controller.onStatusReceived = onStatusReceived;
     controller.onDayMeasurementsReceived = onDayMeasurementsReceived;
+    controller.onEventsReceived = onEventsReceived;
     controller.onDisconnected = onDisconnected;
     controller.connect();
 
@@ -142,7 +144,7 @@ function onConnectionParametersReceived(ssid, pwd, site)
     //document.getElementById('site').innerText = site.value;
 }
 
-function onStatusReceived(sun, dts, color, uv, w, fito, fan, hf, p, t, h, r)
+function onStatusReceived(sun, dts, color, uv, w, fito, fan, hf, p, t, h, co2, lux, rpm, fa, ev, r)
 {
     updateStatusBox("success", dts);
 
@@ -152,6 +154,19 @@ function onStatusReceived(sun, dts, color, uv, w, fito, fan, hf, p, t, h, r)
     document.getElementById("lh").innerText = hum.toFixed(2).toString() + " %";
     let press = (p * 0.001);
     document.getElementById("lp").innerText = press.toFixed(1).toString() + " kP";
+    // 0 - the CO2 sensor is missing
+    document.getElementById("lc").innerText = ((0 < co2) ? co2.toString() : "-") + " ppm";
+    document.getElementById("ll").innerText = lux.toString() + " lx";
+    // 0 - the FAN is stopped or has no tachometer, the alarms: 1 - stalled, 2 - the bearing is worn
+    let lf = document.getElementById("lf");
+    lf.innerText = (((0 < rpm) || (0 != fa)) ? rpm.toString() : "-") + " rpm" + ((0 != (fa & 1)) ? " stall" : ((0 != (fa & 2)) ? " wear" : ""));
+    lf.style.color = (0 != fa) ? "#d0021b" : "#4a90b8";
+    // The anomaly events are fetched when the last event sequence changes
+    if (ev != events.sequence)
+    {
+        controller.getEvents(events.sequence);
+        events.sequence = ev;
+    }
 
     sun_switch = document.getElementById("sun_switch");
 
@@ -217,6 +232,43 @@ function onDayMeasurementsReceived(ts, hs, ps)
     }
 }
 
+function onEventsReceived(list)
+{
+    // 1 - the spike, 2 - the drift, 3 - the humidity does not rise while misting
+    let units = [{name: "Temperature", unit: " \xB0"}, {name: "Humidity", unit: " %"}];
+    let i = 0;
+
+    for (i = 0; i < list.length; i++)
+    {
+        let e = list[i];
+        let m = units[e.metric];
+        let v = (e.value * 0.01);
+        let text = new Date(e.time * 1000).toLocaleTimeString() + " - ";
+
+        if (1 == e.type)
+        {
+            text += m.name + " spike " + v.toFixed(2).toString() + m.unit + "/min";
+        }
+        else if (2 == e.type)
+        {
+            text += m.name + " drift " + v.toFixed(2).toString() + m.unit;
+        }
+        else
+        {
+            text += "No humidity rise while misting";
+        }
+        events.lines.push(text);
+        events.sequence = e.sequence;
+    }
+    events.lines = events.lines.slice(-3);
+
+    if (0 < events.lines.length)
+    {
+        document.getElementById("events").innerText = events.lines.join("\n");
+        document.getElementById("events_box").style.display = "block";
+    }
+}
+
 function onSunSwitchClick()
 {
     controller.setSunImitationMode(this.checked);
@@ -662,15 +662,15 @@ static const unsigned char data_index_html[] = {
     0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
     0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
 
-    /* "Content-Length: 4186" (22 chars) */
+    /* "Content-Length: 4999" (22 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
-    0x34,0x31,0x38,0x36,0x0D,0x0A,
+    0x34,0x39,0x39,0x39,0x0D,0x0A,
 
     /* "Content-Type: text/html" (27 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
 
-    /* raw file data (4186 bytes) */
+    /* raw file data (4999 bytes) */
     0x3C,0x21,0x44,0x4F,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6D,0x6C,0x3E,0x0A,
     0x3C,0x68,0x74,0x6D,0x6C,0x3E,0x0A,0x09,0x3C,0x68,0x65,0x61,0x64,0x3E,0x0A,0x09,
     0x09,0x3C,0x6D,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3D,0x22,
@@ -718,70 +718,121 @@ static const unsigned char data_index_html[] = {
     0x2D,0x66,0x75,0x6C,0x6C,0x20,0x68,0x61,0x73,0x2D,0x74,0x65,0x78,0x74,0x2D,0x63,
     0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x53,0x74,0x61,0x72,0x74,0x69,0x6E,0x67,0x2E,
     0x2E,0x2E,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,
-    0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x21,0x2D,0x2D,0x2D,0x20,
-    0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x09,
-    0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,
-    0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x20,0x68,
-    0x61,0x73,0x2D,0x70,0x74,0x2D,0x34,0x20,0x68,0x61,0x73,0x2D,0x70,0x62,0x2D,0x34,
-    0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x70,0x72,
-    0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,
-    0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,
-    0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x74,0x65,0x78,0x74,0x2D,
-    0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,
-    0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3C,0x64,
-    0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,
-    0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,
-    0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x69,0x6E,0x70,0x75,
-    0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x63,0x68,0x65,0x63,0x6B,0x62,0x6F,0x78,
-    0x22,0x20,0x69,0x64,0x3D,0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,
-    0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x73,0x77,0x69,0x74,0x63,0x68,0x22,
-    0x2F,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,
+    0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x69,
+    0x64,0x3D,0x22,0x65,0x76,0x65,0x6E,0x74,0x73,0x5F,0x62,0x6F,0x78,0x22,0x20,0x63,
+    0x6C,0x61,0x73,0x73,0x3D,0x22,0x61,0x6C,0x65,0x72,0x74,0x20,0x69,0x73,0x2D,0x77,
+    0x61,0x72,0x6E,0x69,0x6E,0x67,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x64,
+    0x69,0x73,0x70,0x6C,0x61,0x79,0x3A,0x6E,0x6F,0x6E,0x65,0x22,0x3E,0x0A,0x09,0x09,
+    0x09,0x09,0x09,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,0x65,0x76,
+    0x65,0x6E,0x74,0x73,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,
+    0x2D,0x77,0x2D,0x66,0x75,0x6C,0x6C,0x20,0x68,0x61,0x73,0x2D,0x74,0x65,0x78,0x74,
+    0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,
+    0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,
+    0x09,0x3C,0x21,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,
+    0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,
+    0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,
+    0x64,0x6F,0x77,0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x74,0x2D,0x34,0x20,0x68,
+    0x61,0x73,0x2D,0x70,0x62,0x2D,0x34,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,0x30,
+    0x20,0x68,0x61,0x73,0x2D,0x70,0x72,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,
+    0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,
+    0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,
+    0x73,0x2D,0x74,0x65,0x78,0x74,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,
+    0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,
+    0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,
+    0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,
+    0x09,0x09,0x3C,0x69,0x6E,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x63,
+    0x68,0x65,0x63,0x6B,0x62,0x6F,0x78,0x22,0x20,0x69,0x64,0x3D,0x22,0x73,0x75,0x6E,
+    0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x2F,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,
+    0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,
+    0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,
+    0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,
+    0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,
+    0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,
+    0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,
+    0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,
+    0x20,0x66,0x6F,0x72,0x3D,0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,
+    0x22,0x3E,0x54,0x68,0x65,0x20,0x53,0x75,0x6E,0x20,0x69,0x6D,0x69,0x74,0x61,0x74,
+    0x69,0x6F,0x6E,0x20,0x6D,0x6F,0x64,0x65,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,
+    0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,
+    0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x21,0x2D,0x2D,
+    0x2D,0x20,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x3E,0x0A,
     0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
-    0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,
-    0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,
-    0x09,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,
-    0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,
-    0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,
-    0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x20,0x66,0x6F,0x72,0x3D,0x22,0x73,
-    0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x3E,0x54,0x68,0x65,0x20,0x53,
-    0x75,0x6E,0x20,0x69,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x20,0x6D,0x6F,0x64,
-    0x65,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,
-    0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,
-    0x0A,0x09,0x09,0x09,0x09,0x3C,0x21,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x2D,0x2D,0x2D,
-    0x2D,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,
-    0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,
-    0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,
-    0x34,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x22,0x3E,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,
-    0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,
-    0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,
-    0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,
-    0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,
-    0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,
-    0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,
-    0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,
-    0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,
-    0x6C,0x74,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,0x72,
-    0x3A,0x23,0x63,0x63,0x38,0x62,0x30,0x30,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,
-    0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x30,0x20,0x68,
-    0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,
-    0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x32,0x34,0x2E,0x34,0x3C,
-    0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,
-    0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,
-    0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,
-    0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x20,0x68,0x61,
-    0x73,0x2D,0x70,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x68,
-    0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,
-    0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x63,0x65,0x6E,0x74,
-    0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,
-    0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,0x6C,0x68,0x22,0x20,
-    0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,0x72,0x3A,0x23,0x37,0x35,
-    0x34,0x32,0x66,0x66,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,
-    0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x73,
-    0x69,0x7A,0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,
-    0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x34,0x37,0x2E,0x34,0x20,0x25,0x3C,0x2F,0x6C,
+    0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,
+    0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x34,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,
+    0x34,0x22,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,
+    0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,
+    0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,
+    0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,
+    0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,
+    0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,
+    0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,
+    0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,0x6C,0x74,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,
+    0x3D,0x22,0x63,0x6F,0x6C,0x6F,0x72,0x3A,0x23,0x63,0x63,0x38,0x62,0x30,0x30,0x22,
+    0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,
+    0x73,0x2D,0x70,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x32,
+    0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,
+    0x22,0x3E,0x32,0x34,0x2E,0x34,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,
+    0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,
+    0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,
+    0x6F,0x77,0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x32,0x20,0x68,0x61,0x73,
+    0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,
+    0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,
+    0x66,0x79,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,
+    0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,
+    0x64,0x3D,0x22,0x6C,0x68,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,
+    0x6C,0x6F,0x72,0x3A,0x23,0x37,0x35,0x34,0x32,0x66,0x66,0x22,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,
+    0x30,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,
+    0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x34,0x37,
+    0x2E,0x34,0x20,0x25,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,
+    0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,
+    0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,
+    0x6C,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,
+    0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,
+    0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,
+    0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,
+    0x22,0x6C,0x70,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,
+    0x72,0x3A,0x23,0x30,0x31,0x61,0x32,0x30,0x31,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x30,0x20,
+    0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,
+    0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x31,0x30,0x32,0x2E,
+    0x37,0x20,0x6B,0x50,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,
+    0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,
+    0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,
+    0x6C,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,
+    0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,
+    0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,
+    0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,
+    0x22,0x6C,0x63,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,
+    0x72,0x3A,0x23,0x35,0x61,0x36,0x62,0x37,0x63,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x30,0x20,
+    0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,
+    0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x2D,0x20,0x70,0x70,
+    0x6D,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,
+    0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,
+    0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x20,
+    0x68,0x61,0x73,0x2D,0x70,0x2D,0x32,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,
+    0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,0x6C,0x65,
+    0x78,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x63,0x65,
+    0x6E,0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,
+    0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,0x6C,0x6C,
+    0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,0x72,0x3A,0x23,
+    0x64,0x34,0x61,0x30,0x31,0x37,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,
+    0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x30,0x20,0x68,0x61,0x73,
+    0x2D,0x73,0x69,0x7A,0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,
+    0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x2D,0x20,0x6C,0x78,0x3C,0x2F,0x6C,
     0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,
     0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,
     0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,
@@ -790,110 +841,93 @@ static const unsigned char data_index_html[] = {
     0x2D,0x6D,0x62,0x2D,0x34,0x20,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,
     0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,
     0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,
-    0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,0x6C,0x70,0x22,0x20,0x73,0x74,
-    0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,0x72,0x3A,0x23,0x30,0x31,0x61,0x32,
-    0x30,0x31,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,
+    0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x64,0x3D,0x22,0x6C,0x66,0x22,0x20,0x73,0x74,
+    0x79,0x6C,0x65,0x3D,0x22,0x63,0x6F,0x6C,0x6F,0x72,0x3A,0x23,0x34,0x61,0x39,0x30,
+    0x62,0x38,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,
     0x20,0x68,0x61,0x73,0x2D,0x70,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,
     0x65,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,
-    0x62,0x6C,0x65,0x22,0x3E,0x31,0x30,0x32,0x2E,0x37,0x20,0x6B,0x50,0x3C,0x2F,0x6C,
-    0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,
-    0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x20,0x20,0x20,
-    0x20,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x63,0x61,
-    0x6E,0x76,0x61,0x73,0x20,0x69,0x64,0x3D,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,
-    0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x77,0x69,0x64,0x74,0x68,0x3A,0x31,
-    0x30,0x30,0x25,0x3B,0x68,0x65,0x69,0x67,0x68,0x74,0x3A,0x31,0x30,0x30,0x70,0x78,
-    0x22,0x3E,0x3C,0x2F,0x63,0x61,0x6E,0x76,0x61,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,
-    0x09,0x3C,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x69,0x64,0x3D,0x22,0x63,0x68,0x61,
-    0x72,0x74,0x2D,0x68,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x77,0x69,0x64,
-    0x74,0x68,0x3A,0x31,0x30,0x30,0x25,0x3B,0x68,0x65,0x69,0x67,0x68,0x74,0x3A,0x31,
-    0x30,0x30,0x70,0x78,0x22,0x3E,0x3C,0x2F,0x63,0x61,0x6E,0x76,0x61,0x73,0x3E,0x0A,
-    0x09,0x09,0x09,0x09,0x09,0x3C,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x69,0x64,0x3D,
-    0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x70,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,
-    0x22,0x77,0x69,0x64,0x74,0x68,0x3A,0x31,0x30,0x30,0x25,0x3B,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3A,0x31,0x30,0x30,0x70,0x78,0x22,0x3E,0x3C,0x2F,0x63,0x61,0x6E,0x76,
-    0x61,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,
-    0x09,0x09,0x09,0x3C,0x21,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,
-    0x2D,0x2D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,
-    0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,
-    0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x74,0x2D,0x34,
-    0x20,0x68,0x61,0x73,0x2D,0x70,0x62,0x2D,0x34,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,
-    0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x70,0x72,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,
-    0x6D,0x62,0x2D,0x34,0x22,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x22,0x63,0x65,0x6E,
-    0x74,0x65,0x72,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,
-    0x69,0x64,0x3D,0x22,0x72,0x67,0x62,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,
-    0x61,0x6C,0x69,0x67,0x6E,0x3D,0x22,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x20,0x63,
-    0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,0x70,0x74,0x2D,0x36,0x20,0x68,
-    0x61,0x73,0x2D,0x70,0x62,0x2D,0x36,0x22,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
+    0x62,0x6C,0x65,0x22,0x3E,0x2D,0x20,0x72,0x70,0x6D,0x3C,0x2F,0x6C,0x61,0x62,0x65,
+    0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,
+    0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x3C,0x2F,
+    0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x63,0x61,0x6E,0x76,0x61,
+    0x73,0x20,0x69,0x64,0x3D,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,0x22,0x20,0x73,
+    0x74,0x79,0x6C,0x65,0x3D,0x22,0x77,0x69,0x64,0x74,0x68,0x3A,0x31,0x30,0x30,0x25,
+    0x3B,0x68,0x65,0x69,0x67,0x68,0x74,0x3A,0x31,0x30,0x30,0x70,0x78,0x22,0x3E,0x3C,
+    0x2F,0x63,0x61,0x6E,0x76,0x61,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x63,
+    0x61,0x6E,0x76,0x61,0x73,0x20,0x69,0x64,0x3D,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,
+    0x68,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x77,0x69,0x64,0x74,0x68,0x3A,
+    0x31,0x30,0x30,0x25,0x3B,0x68,0x65,0x69,0x67,0x68,0x74,0x3A,0x31,0x30,0x30,0x70,
+    0x78,0x22,0x3E,0x3C,0x2F,0x63,0x61,0x6E,0x76,0x61,0x73,0x3E,0x0A,0x09,0x09,0x09,
+    0x09,0x09,0x3C,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x69,0x64,0x3D,0x22,0x63,0x68,
+    0x61,0x72,0x74,0x2D,0x70,0x22,0x20,0x73,0x74,0x79,0x6C,0x65,0x3D,0x22,0x77,0x69,
+    0x64,0x74,0x68,0x3A,0x31,0x30,0x30,0x25,0x3B,0x68,0x65,0x69,0x67,0x68,0x74,0x3A,
+    0x31,0x30,0x30,0x70,0x78,0x22,0x3E,0x3C,0x2F,0x63,0x61,0x6E,0x76,0x61,0x73,0x3E,
+    0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,
+    0x3C,0x21,0x2D,0x2D,0x2D,0x20,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x20,
+    0x2D,0x2D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x63,0x61,0x72,0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,
+    0x6F,0x77,0x65,0x64,0x20,0x68,0x61,0x73,0x2D,0x70,0x74,0x2D,0x34,0x20,0x68,0x61,
+    0x73,0x2D,0x70,0x62,0x2D,0x34,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,0x30,0x20,
+    0x68,0x61,0x73,0x2D,0x70,0x72,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,
+    0x34,0x22,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x22,0x63,0x65,0x6E,0x74,0x65,0x72,
+    0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x69,0x64,0x3D,
+    0x22,0x72,0x67,0x62,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x61,0x6C,0x69,
+    0x67,0x6E,0x3D,0x22,0x63,0x65,0x6E,0x74,0x65,0x72,0x22,0x20,0x63,0x6C,0x61,0x73,
+    0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,0x70,0x74,0x2D,0x36,0x20,0x68,0x61,0x73,0x2D,
+    0x70,0x62,0x2D,0x36,0x22,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
-    0x68,0x61,0x73,0x2D,0x77,0x2D,0x38,0x30,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,
-    0x32,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,
-    0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,
-    0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,
-    0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,
-    0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,
-    0x69,0x6E,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,
-    0x65,0x22,0x20,0x69,0x64,0x3D,0x22,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,
-    0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,
-    0x68,0x61,0x73,0x2D,0x77,0x2D,0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,
-    0x22,0x20,0x6D,0x61,0x78,0x3D,0x22,0x32,0x35,0x35,0x22,0x20,0x76,0x61,0x6C,0x75,
-    0x65,0x3D,0x22,0x30,0x22,0x2F,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,
-    0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,
-    0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,
-    0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,
-    0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,
-    0x61,0x62,0x6C,0x65,0x22,0x3E,0x55,0x56,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,
-    0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,
-    0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,
-    0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,
-    0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,
-    0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,
-    0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,
-    0x69,0x6E,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,
-    0x65,0x22,0x20,0x69,0x64,0x3D,0x22,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,
-    0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,
-    0x61,0x73,0x2D,0x77,0x2D,0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,
-    0x20,0x6D,0x61,0x78,0x3D,0x22,0x32,0x35,0x35,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,
-    0x3D,0x22,0x30,0x22,0x2F,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,
-    0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,
-    0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,
-    0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,
-    0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,
-    0x22,0x3E,0x57,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,
-    0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,
-    0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,
-    0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,
-    0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,
-    0x73,0x74,0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,0x09,0x09,
-    0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,0x75,0x74,
-    0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,0x69,0x64,
-    0x3D,0x22,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,
+    0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,
+    0x2D,0x77,0x2D,0x38,0x30,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,0x32,0x22,0x3E,
+    0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,
+    0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,
+    0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,
+    0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,
+    0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,
+    0x69,0x64,0x3D,0x22,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,
     0x6C,0x61,0x73,0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,
     0x2D,0x77,0x2D,0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,
     0x61,0x78,0x3D,0x22,0x32,0x35,0x35,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,
     0x30,0x22,0x2F,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,
-    0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,
-    0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,
-    0x69,0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,
-    0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,
-    0x46,0x69,0x74,0x6F,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,
-    0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
-    0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,
-    0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,
-    0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x6A,
-    0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,0x09,
-    0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,0x75,
-    0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,0x69,
-    0x64,0x3D,0x22,0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,
-    0x6C,0x61,0x73,0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,
-    0x2D,0x77,0x2D,0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,
-    0x61,0x78,0x3D,0x22,0x34,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,0x30,0x22,
-    0x2F,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,
-    0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,
-    0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,
-    0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,
-    0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x46,0x41,
-    0x4E,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
+    0x09,0x20,0x20,0x20,0x20,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,
+    0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,
+    0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,
+    0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,
+    0x65,0x22,0x3E,0x55,0x56,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,
+    0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,
+    0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,
+    0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,
+    0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,
+    0x6A,0x75,0x73,0x74,0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,
+    0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,
+    0x69,0x64,0x3D,0x22,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,0x6C,
+    0x61,0x73,0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,
+    0x77,0x2D,0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,0x61,
+    0x78,0x3D,0x22,0x32,0x35,0x35,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,0x30,
+    0x22,0x2F,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,
+    0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,
+    0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,
+    0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x57,
+    0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,
+    0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,
+    0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,
+    0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,
+    0x63,0x65,0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,
+    0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,
+    0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,0x75,0x74,0x20,0x74,0x79,
+    0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,0x69,0x64,0x3D,0x22,0x66,
+    0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,0x6C,0x61,0x73,
+    0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x77,0x2D,
+    0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,0x61,0x78,0x3D,
+    0x22,0x32,0x35,0x35,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,0x30,0x22,0x2F,
+    0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,
+    0x64,0x69,0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,
+    0x2D,0x31,0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,
+    0x6E,0x73,0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x46,0x69,0x74,
+    0x6F,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,
     0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,
     0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,
     0x73,0x2D,0x66,0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,
@@ -901,38 +935,55 @@ static const unsigned char data_index_html[] = {
     0x69,0x66,0x79,0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,
     0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,0x75,0x74,0x20,0x74,
     0x79,0x70,0x65,0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,0x69,0x64,0x3D,0x22,
-    0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,
-    0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x77,0x2D,0x36,
-    0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,0x61,0x78,0x3D,0x22,
-    0x31,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,0x30,0x22,0x2F,0x3E,0x3C,0x2F,
-    0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,
-    0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,
-    0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,
-    0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,
-    0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x48,0x46,0x3C,0x2F,0x6C,0x61,
-    0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,
-    0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,
-    0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x3C,0x2F,0x64,0x69,0x76,
-    0x3E,0x0A,0x0A,0x09,0x3C,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,
-    0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,
-    0x74,0x22,0x20,0x73,0x72,0x63,0x3D,0x22,0x6A,0x73,0x2F,0x69,0x72,0x6F,0x2E,0x6A,
-    0x73,0x22,0x3E,0x3C,0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x73,
-    0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,
-    0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,0x73,0x72,0x63,
-    0x3D,0x22,0x6A,0x73,0x2F,0x73,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x2E,0x6A,0x73,
-    0x22,0x3E,0x3C,0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x73,0x63,
-    0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,
-    0x6A,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,0x73,0x72,0x63,0x3D,
-    0x22,0x6A,0x73,0x2F,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6A,
-    0x73,0x22,0x3E,0x3C,0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x73,
-    0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,
-    0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,0x73,0x72,0x63,
-    0x3D,0x22,0x6A,0x73,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x6A,0x73,0x22,0x3E,0x3C,
-    0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x2F,0x62,0x6F,0x64,0x79,
-    0x3E,0x0A,0x3C,0x2F,0x68,0x74,0x6D,0x6C,0x3E,0x0A,
+    0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,0x6C,0x61,0x73,
+    0x73,0x3D,0x22,0x73,0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x77,0x2D,
+    0x36,0x34,0x22,0x20,0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,0x61,0x78,0x3D,
+    0x22,0x34,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,0x30,0x22,0x2F,0x3E,0x3C,
+    0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,
+    0x76,0x3E,0x3C,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x6C,0x61,0x62,0x65,0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,
+    0x20,0x68,0x61,0x73,0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,
+    0x65,0x6C,0x65,0x63,0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x46,0x41,0x4E,0x3C,0x2F,
+    0x6C,0x61,0x62,0x65,0x6C,0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,
+    0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,
+    0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x69,0x73,0x2D,0x66,
+    0x6C,0x65,0x78,0x20,0x68,0x61,0x73,0x2D,0x69,0x74,0x65,0x6D,0x73,0x2D,0x63,0x65,
+    0x6E,0x74,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x6A,0x75,0x73,0x74,0x69,0x66,0x79,
+    0x2D,0x73,0x74,0x61,0x72,0x74,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,
+    0x3C,0x64,0x69,0x76,0x3E,0x3C,0x69,0x6E,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
+    0x3D,0x22,0x72,0x61,0x6E,0x67,0x65,0x22,0x20,0x69,0x64,0x3D,0x22,0x68,0x66,0x5F,
+    0x70,0x69,0x63,0x6B,0x65,0x72,0x22,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x73,
+    0x6C,0x69,0x64,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x77,0x2D,0x36,0x34,0x22,0x20,
+    0x6D,0x69,0x6E,0x3D,0x22,0x30,0x22,0x20,0x6D,0x61,0x78,0x3D,0x22,0x31,0x22,0x20,
+    0x76,0x61,0x6C,0x75,0x65,0x3D,0x22,0x30,0x22,0x2F,0x3E,0x3C,0x2F,0x64,0x69,0x76,
+    0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3C,0x64,0x69,0x76,0x3E,0x3C,0x6C,
+    0x61,0x62,0x65,0x6C,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x6C,0x61,0x62,0x65,
+    0x6C,0x20,0x68,0x61,0x73,0x2D,0x73,0x69,0x7A,0x65,0x2D,0x31,0x20,0x68,0x61,0x73,
+    0x2D,0x6D,0x6C,0x2D,0x32,0x20,0x69,0x73,0x2D,0x75,0x6E,0x73,0x65,0x6C,0x65,0x63,
+    0x74,0x61,0x62,0x6C,0x65,0x22,0x3E,0x48,0x46,0x3C,0x2F,0x6C,0x61,0x62,0x65,0x6C,
+    0x3E,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,
+    0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x64,0x69,0x76,
+    0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3C,0x2F,
+    0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3C,0x2F,0x64,
+    0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x0A,
+    0x09,0x3C,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,
+    0x65,0x78,0x74,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,
+    0x73,0x72,0x63,0x3D,0x22,0x6A,0x73,0x2F,0x69,0x72,0x6F,0x2E,0x6A,0x73,0x22,0x3E,
+    0x3C,0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x73,0x63,0x72,0x69,
+    0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,0x6A,0x61,
+    0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,0x73,0x72,0x63,0x3D,0x22,0x6A,
+    0x73,0x2F,0x73,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x2E,0x6A,0x73,0x22,0x3E,0x3C,
+    0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x73,0x63,0x72,0x69,0x70,
+    0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,0x6A,0x61,0x76,
+    0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,0x73,0x72,0x63,0x3D,0x22,0x6A,0x73,
+    0x2F,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6A,0x73,0x22,0x3E,
+    0x3C,0x2F,0x73,0x63,0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x73,0x63,0x72,0x69,
+    0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,0x6A,0x61,
+    0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x20,0x73,0x72,0x63,0x3D,0x22,0x6A,
+    0x73,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x6A,0x73,0x22,0x3E,0x3C,0x2F,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x3E,0x0A,0x09,0x3C,0x2F,0x62,0x6F,0x64,0x79,0x3E,0x0A,0x3C,
+    0x2F,0x68,0x74,0x6D,0x6C,0x3E,0x0A,
 };
 
 static const unsigned char data_css_common_css[] = {
@@ -12115,16 +12166,16 @@ static const unsigned char data_js_controller_js[] = {
     0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
     0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
 
-    /* "Content-Length: 12904" (23 chars) */
+    /* "Content-Length: 18437" (23 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
-    0x31,0x32,0x39,0x30,0x34,0x0D,0x0A,
+    0x31,0x38,0x34,0x33,0x37,0x0D,0x0A,
 
     /* "Content-Type: application/javascript" (40 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
     0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
     0x72,0x69,0x70,0x74,0x0D,0x0A,0x0D,0x0A,
 
-    /* raw file data (12904 bytes) */
+    /* raw file data (18437 bytes) */
     0x28,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x78,0x70,0x6F,0x72,0x74,
     0x73,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x75,0x6E,0x63,0x74,
     0x69,0x6F,0x6E,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x28,0x6F,
@@ -12149,789 +12200,1135 @@ static const unsigned char data_js_controller_js[] = {
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x61,
     0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,
     0x65,0x69,0x76,0x65,0x64,0x20,0x3D,0x20,0x4E,0x61,0x4E,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x69,0x73,
-    0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x20,0x3D,0x20,0x4E,0x61,0x4E,0x3B,
-    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x6F,0x6E,0x57,0x73,0x4F,0x70,0x65,0x6E,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x6F,0x6E,0x57,0x73,0x4F,0x70,0x65,0x6E,0x2E,0x62,0x69,0x6E,0x64,0x28,0x74,
-    0x68,0x69,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
-    0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x20,0x3D,0x20,
-    0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x2E,0x62,
-    0x69,0x6E,0x64,0x28,0x74,0x68,0x69,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,0x4D,0x65,0x73,
-    0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,
-    0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x2E,0x62,0x69,0x6E,0x64,0x28,0x74,0x68,0x69,
-    0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x6F,0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x20,0x3D,0x20,0x74,0x68,
-    0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x2E,0x62,0x69,0x6E,
-    0x64,0x28,0x74,0x68,0x69,0x73,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x4D,0x6F,0x64,
-    0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x6D,0x6F,0x64,
-    0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,
-    0x75,0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,
-    0x79,0x42,0x75,0x66,0x66,0x65,0x72,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x69,0x65,
-    0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,0x6E,0x74,0x38,0x41,0x72,0x72,
-    0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,0x6E,
-    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,
-    0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,
-    0x4D,0x6F,0x64,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x6D,0x6F,0x64,0x65,0x53,
-    0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x20,0x3D,0x3D,0x20,0x6D,
-    0x6F,0x64,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,0x20,0x3D,0x20,0x43,
-    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,
-    0x6F,0x6C,0x2E,0x6F,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,0x20,
-    0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,
-    0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x6F,0x66,0x66,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,0x61,
-    0x6C,0x75,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x6F,
-    0x70,0x74,0x69,0x6F,0x6E,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,
-    0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,
-    0x65,0x72,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,
-    0x65,0x77,0x20,0x55,0x69,0x6E,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,0x75,
-    0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,0x20,0x6F,0x70,
-    0x74,0x69,0x6F,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,0x20,0x3D,0x20,0x76,0x61,0x6C,
-    0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,
-    0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,
-    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,
-    0x20,0x3D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x67,0x65,0x74,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,
-    0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x3A,0x20,0x30,0x78,0x30,0x31,
-    0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x43,0x6F,
-    0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,
-    0x72,0x73,0x3A,0x20,0x30,0x78,0x30,0x32,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x3A,0x20,0x30,0x78,0x30,
-    0x33,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x53,
-    0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x3A,
-    0x20,0x30,0x78,0x30,0x34,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x30,0x78,0x30,0x35,0x2C,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x55,0x6C,0x74,
-    0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x3A,0x20,0x30,0x78,0x30,0x36,0x2C,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x57,0x68,0x69,0x74,
-    0x65,0x3A,0x20,0x30,0x78,0x30,0x37,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x3A,0x20,0x30,0x78,0x30,0x38,0x2C,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x46,0x41,0x4E,
-    0x3A,0x20,0x30,0x78,0x30,0x39,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x73,0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x3A,0x20,
-    0x30,0x78,0x30,0x41,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
-    0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,
-    0x73,0x3A,0x20,0x30,0x78,0x30,0x42,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x3A,0x20,0x30,0x78,0x30,0x30,0x2C,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x6E,0x3A,0x20,0x30,0x78,
-    0x30,0x31,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,
-    0x3A,0x20,0x30,0x78,0x30,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x3A,0x20,0x35,0x2C,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x53,0x75,0x6E,0x49,0x6D,0x69,
-    0x74,0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x43,0x6F,0x6C,0x6F,0x72,0x3A,0x20,0x31,
-    0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x55,
-    0x6E,0x6B,0x6E,0x6F,0x77,0x6E,0x3A,0x20,0x32,0x35,0x35,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x7D,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x75,0x74,0x53,0x74,0x72,0x49,0x6E,0x42,0x75,
-    0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,
-    0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x2C,0x20,0x73,0x74,
-    0x72,0x69,0x6E,0x67,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x65,0x6E,0x20,0x3D,0x20,
-    0x73,0x74,0x72,0x69,0x6E,0x67,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,0x66,0x66,0x73,
-    0x20,0x3D,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,
-    0x28,0x6F,0x66,0x66,0x73,0x2B,0x2B,0x2C,0x20,0x6C,0x65,0x6E,0x29,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x6C,0x65,0x74,
-    0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x6C,0x65,0x6E,0x3B,
-    0x20,0x69,0x2B,0x2B,0x2C,0x20,0x6F,0x66,0x66,0x73,0x2B,0x2B,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,
-    0x6E,0x74,0x38,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,
-    0x2E,0x63,0x68,0x61,0x72,0x43,0x6F,0x64,0x65,0x41,0x74,0x28,0x69,0x29,0x29,0x3B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,
-    0x6C,0x6C,0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,
-    0x75,0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
-    0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x6F,0x66,0x66,0x73,0x20,0x3D,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,
-    0x65,0x6E,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,
-    0x6E,0x74,0x38,0x28,0x6F,0x66,0x66,0x73,0x2B,0x2B,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x74,0x72,0x20,0x20,0x3D,
-    0x20,0x27,0x27,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6F,0x72,0x20,0x28,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,
-    0x69,0x20,0x3C,0x20,0x6C,0x65,0x6E,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x20,0x2B,0x3D,0x20,0x53,0x74,0x72,
-    0x69,0x6E,0x67,0x2E,0x66,0x72,0x6F,0x6D,0x43,0x68,0x61,0x72,0x43,0x6F,0x64,0x65,
-    0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x6F,
-    0x66,0x66,0x73,0x2B,0x2B,0x29,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
-    0x65,0x74,0x75,0x72,0x6E,0x20,0x7B,0x76,0x61,0x6C,0x75,0x65,0x3A,0x20,0x73,0x74,
-    0x72,0x2C,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,0x28,0x6C,0x65,0x6E,0x20,
-    0x2B,0x20,0x31,0x29,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x6E,0x64,0x20,0x3D,
-    0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x64,0x61,0x74,0x61,0x29,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x28,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x2E,0x43,
-    0x4C,0x4F,0x53,0x45,0x44,0x20,0x3D,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,
-    0x2E,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x29,0x20,0x7C,0x7C,0x20,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x28,0x43,
-    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,
-    0x6F,0x6C,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x20,0x3C,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x2B,0x2B,0x29,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x63,0x6F,0x6E,0x6E,0x65,
-    0x63,0x74,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,
-    0x66,0x20,0x28,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x2E,0x4F,0x50,0x45,
-    0x4E,0x20,0x3D,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x72,0x65,0x61,
-    0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x64,0x61,
-    0x74,0x61,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,
-    0x20,0x28,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x2E,0x43,0x4F,0x4E,0x4E,
-    0x45,0x43,0x54,0x49,0x4E,0x47,0x20,0x3D,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,
-    0x73,0x2E,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,0x69,
-    0x65,0x73,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,
-    0x6F,0x74,0x79,0x70,0x65,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x20,
-    0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x29,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
-    0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x47,0x65,
-    0x74,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
-    0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,0x65,
-    0x72,0x28,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,
-    0x6E,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,
-    0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,
-    0x75,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x45,0x76,0x65,
+    0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x20,0x3D,0x20,0x4E,0x61,
+    0x4E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
+    0x2E,0x6F,0x6E,0x53,0x65,0x72,0x69,0x65,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,
+    0x64,0x20,0x3D,0x20,0x4E,0x61,0x4E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x69,0x73,0x63,0x6F,0x6E,0x6E,
+    0x65,0x63,0x74,0x65,0x64,0x20,0x3D,0x20,0x4E,0x61,0x4E,0x3B,0x0D,0x0A,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,
+    0x73,0x4F,0x70,0x65,0x6E,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,
+    0x73,0x4F,0x70,0x65,0x6E,0x2E,0x62,0x69,0x6E,0x64,0x28,0x74,0x68,0x69,0x73,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,
+    0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,
+    0x2E,0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x2E,0x62,0x69,0x6E,0x64,0x28,
+    0x74,0x68,0x69,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,
+    0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,0x73,0x4D,0x65,0x73,0x73,
+    0x61,0x67,0x65,0x2E,0x62,0x69,0x6E,0x64,0x28,0x74,0x68,0x69,0x73,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,
+    0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,
+    0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x2E,0x62,0x69,0x6E,0x64,0x28,0x74,0x68,
+    0x69,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,
+    0x69,0x73,0x2E,0x73,0x65,0x72,0x69,0x65,0x73,0x20,0x3D,0x20,0x7B,0x74,0x6F,0x3A,
+    0x20,0x30,0x2C,0x20,0x6C,0x65,0x76,0x65,0x6C,0x3A,0x20,0x30,0x2C,0x20,0x66,0x69,
+    0x65,0x6C,0x64,0x73,0x3A,0x20,0x30,0x7D,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x4D,0x6F,
+    0x64,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x6D,0x6F,
+    0x64,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,
+    0x61,0x79,0x42,0x75,0x66,0x66,0x65,0x72,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x69,
+    0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,0x6E,0x74,0x38,0x41,0x72,
+    0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,
+    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,
+    0x6C,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,
+    0x6E,0x4D,0x6F,0x64,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x6D,0x6F,0x64,0x65,
+    0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x20,0x3D,0x3D,0x20,
+    0x6D,0x6F,0x64,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,0x20,0x3D,0x20,
+    0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,
+    0x63,0x6F,0x6C,0x2E,0x6F,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,
+    0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,
+    0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x6F,0x66,0x66,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,
+    0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,
+    0x69,0x73,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,
+    0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,
+    0x6F,0x70,0x74,0x69,0x6F,0x6E,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,
+    0x66,0x65,0x72,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,
+    0x6E,0x65,0x77,0x20,0x55,0x69,0x6E,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,0x20,0x6F,
+    0x70,0x74,0x69,0x6F,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,0x20,0x3D,0x20,0x76,0x61,
+    0x6C,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
     0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,
-    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,
-    0x70,0x65,0x2E,0x67,0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,
-    0x6D,0x65,0x6E,0x74,0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
-    0x28,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,
-    0x57,0x53,0x3A,0x20,0x47,0x65,0x74,0x20,0x44,0x61,0x79,0x20,0x4D,0x65,0x61,0x73,
-    0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
-    0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,0x65,
-    0x72,0x28,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,
-    0x6E,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,
-    0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x44,0x61,0x79,0x4D,
-    0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,
-    0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,
+    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,
+    0x6C,0x20,0x3D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x65,0x74,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,
+    0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x3A,0x20,0x30,0x78,0x30,
+    0x31,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x43,
+    0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,
+    0x65,0x72,0x73,0x3A,0x20,0x30,0x78,0x30,0x32,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x3A,0x20,0x30,0x78,
+    0x30,0x33,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,
+    0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,
+    0x3A,0x20,0x30,0x78,0x30,0x34,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x30,0x78,0x30,0x35,
+    0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x55,0x6C,
+    0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x3A,0x20,0x30,0x78,0x30,0x36,0x2C,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x57,0x68,0x69,
+    0x74,0x65,0x3A,0x20,0x30,0x78,0x30,0x37,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x3A,0x20,0x30,0x78,0x30,0x38,
+    0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x46,0x41,
+    0x4E,0x3A,0x20,0x30,0x78,0x30,0x39,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x3A,
+    0x20,0x30,0x78,0x30,0x41,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x67,0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,
+    0x74,0x73,0x3A,0x20,0x30,0x78,0x30,0x42,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x67,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,0x73,0x3A,0x20,0x30,0x78,
+    0x30,0x43,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x65,0x74,
+    0x53,0x65,0x72,0x69,0x65,0x73,0x3A,0x20,0x30,0x78,0x30,0x44,0x2C,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x46,0x69,0x65,
+    0x6C,0x64,0x73,0x3A,0x20,0x35,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x52,0x65,0x74,0x72,0x79,0x4D,0x73,0x3A,0x20,
+    0x31,0x30,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,
+    0x63,0x63,0x65,0x73,0x73,0x3A,0x20,0x30,0x78,0x30,0x30,0x2C,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x6E,0x3A,0x20,0x30,0x78,0x30,0x31,0x2C,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,0x3A,0x20,0x30,0x78,
+    0x30,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x72,0x69,0x65,0x73,0x3A,0x20,0x35,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6D,0x6F,0x64,0x65,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,
+    0x6F,0x6E,0x3A,0x20,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6D,0x6F,0x64,0x65,0x43,0x6F,0x6C,0x6F,0x72,0x3A,0x20,0x31,0x2C,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x55,0x6E,0x6B,0x6E,0x6F,
+    0x77,0x6E,0x3A,0x20,0x32,0x35,0x35,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x3B,0x0D,
     0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x4D,0x65,
-    0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,
-    0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x20,0x3D,0x20,0x66,
-    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
-    0x43,0x6F,0x6E,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x72,0x65,
-    0x63,0x65,0x69,0x76,0x65,0x64,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,
-    0x20,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x73,0x73,0x69,0x64,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,
-    0x6C,0x6C,0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,
-    0x75,0x66,0x66,0x65,0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,
-    0x65,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,
-    0x66,0x73,0x65,0x74,0x20,0x2B,0x3D,0x20,0x73,0x73,0x69,0x64,0x2E,0x6C,0x65,0x6E,
-    0x67,0x74,0x68,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
-    0x74,0x20,0x70,0x77,0x64,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
-    0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,0x75,0x66,
-    0x66,0x65,0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,0x73,
-    0x65,0x74,0x20,0x2B,0x3D,0x20,0x70,0x77,0x64,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,
-    0x69,0x74,0x65,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
+    0x72,0x2E,0x70,0x75,0x74,0x53,0x74,0x72,0x49,0x6E,0x42,0x75,0x66,0x66,0x65,0x72,
+    0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,
+    0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x2C,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,
+    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x65,0x6E,0x20,0x3D,0x20,0x73,0x74,0x72,0x69,
+    0x6E,0x67,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,0x66,0x66,0x73,0x20,0x3D,0x20,0x6F,
+    0x66,0x66,0x73,0x65,0x74,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
+    0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x6F,0x66,0x66,
+    0x73,0x2B,0x2B,0x2C,0x20,0x6C,0x65,0x6E,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,
+    0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x6C,0x65,0x6E,0x3B,0x20,0x69,0x2B,0x2B,
+    0x2C,0x20,0x6F,0x66,0x66,0x73,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,
+    0x6F,0x66,0x66,0x73,0x2C,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x2E,0x63,0x68,0x61,
+    0x72,0x43,0x6F,0x64,0x65,0x41,0x74,0x28,0x69,0x29,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
     0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,0x75,0x66,0x66,0x65,
-    0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x29,0x3B,
-    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,
-    0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x50,0x61,0x72,
-    0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x3A,0x20,0x22,0x20,0x2B,0x20,0x73,0x73,0x69,
-    0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x2B,0x20,0x22,0x20,0x22,0x20,0x2B,0x20,
-    0x70,0x77,0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x2B,0x20,0x22,0x20,0x22,0x20,
-    0x2B,0x20,0x73,0x69,0x74,0x65,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,
-    0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,
-    0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,
-    0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,
+    0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,
+    0x66,0x66,0x73,0x20,0x3D,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x65,0x6E,0x20,0x20,
+    0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,
+    0x6F,0x66,0x66,0x73,0x2B,0x2B,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x74,0x72,0x20,0x20,0x3D,0x20,0x27,0x27,0x3B,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,
+    0x28,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,
+    0x6C,0x65,0x6E,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,
-    0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x52,0x65,0x63,
-    0x65,0x69,0x76,0x65,0x64,0x28,0x73,0x73,0x69,0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,
-    0x2C,0x20,0x70,0x77,0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,0x2C,0x20,0x73,0x69,0x74,
-    0x65,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,
-    0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,
-    0x65,0x47,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,
-    0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,
-    0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x74,0x61,
-    0x74,0x75,0x73,0x20,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x21,0x22,0x29,0x3B,
-    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
-    0x6D,0x6F,0x64,0x65,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,
-    0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x20,0x20,0x3D,
-    0x20,0x7B,0x72,0x3A,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,
-    0x74,0x38,0x28,0x33,0x29,0x2C,0x20,0x67,0x3A,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
-    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x34,0x29,0x2C,0x20,0x62,0x3A,0x20,0x76,
-    0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x35,0x29,0x7D,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x75,
-    0x76,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,
-    0x55,0x69,0x6E,0x74,0x38,0x28,0x36,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x77,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,
-    0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x37,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x66,
-    0x69,0x74,0x6F,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,
-    0x55,0x69,0x6E,0x74,0x38,0x28,0x38,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x66,0x61,0x6E,0x20,0x20,0x20,0x20,0x3D,0x20,
-    0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x39,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,
-    0x66,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,
-    0x55,0x69,0x6E,0x74,0x38,0x28,0x31,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x72,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,
-    0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x31,
-    0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
-    0x20,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
-    0x65,0x74,0x55,0x69,0x6E,0x74,0x33,0x32,0x28,0x31,0x32,0x2C,0x20,0x74,0x72,0x75,
-    0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
-    0x20,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
-    0x65,0x74,0x49,0x6E,0x74,0x31,0x36,0x28,0x31,0x36,0x2C,0x20,0x74,0x72,0x75,0x65,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
-    0x68,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,
-    0x74,0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x31,0x38,0x2C,0x20,0x74,0x72,0x75,0x65,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
-    0x64,0x74,0x73,0x20,0x20,0x20,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,
-    0x6C,0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,0x75,
-    0x66,0x66,0x65,0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x32,0x30,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x75,0x6E,
-    0x20,0x20,0x20,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,
-    0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x43,0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x20,
-    0x22,0x20,0x2B,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x72,0x20,0x2B,0x20,0x22,0x3A,
-    0x22,0x20,0x2B,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x67,0x20,0x2B,0x20,0x22,0x3A,
-    0x22,0x20,0x2B,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x62,0x20,0x2B,0x20,0x22,0x20,
-    0x2D,0x20,0x22,0x20,0x2B,0x20,0x64,0x74,0x73,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,
-    0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-    0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
-    0x6F,0x63,0x6F,0x6C,0x2E,0x6D,0x6F,0x64,0x65,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,
-    0x61,0x74,0x69,0x6F,0x6E,0x20,0x21,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x20,0x3D,0x20,0x66,0x61,0x6C,
-    0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,
-    0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,
-    0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x72,0x20,0x2B,0x3D,0x20,0x53,0x74,0x72,0x69,0x6E,0x67,0x2E,
+    0x66,0x72,0x6F,0x6D,0x43,0x68,0x61,0x72,0x43,0x6F,0x64,0x65,0x28,0x76,0x69,0x65,
+    0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x6F,0x66,0x66,0x73,0x2B,
+    0x2B,0x29,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
+    0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6E,0x20,0x7B,0x76,0x61,0x6C,0x75,0x65,0x3A,0x20,0x73,0x74,0x72,0x2C,0x20,0x6C,
+    0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,0x28,0x6C,0x65,0x6E,0x20,0x2B,0x20,0x31,0x29,
+    0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,
+    0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x6E,0x64,0x20,0x3D,0x20,0x66,0x75,0x6E,
+    0x63,0x74,0x69,0x6F,0x6E,0x28,0x64,0x61,0x74,0x61,0x29,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x28,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x2E,0x43,0x4C,0x4F,0x53,0x45,
+    0x44,0x20,0x3D,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x72,0x65,0x61,
+    0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x29,0x20,0x7C,0x7C,0x20,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,
+    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x72,
+    0x65,0x74,0x72,0x69,0x65,0x73,0x20,0x3C,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,
+    0x74,0x72,0x69,0x65,0x73,0x2B,0x2B,0x29,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,
-    0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x73,0x75,0x6E,0x2C,0x20,0x64,0x74,0x73,
-    0x2E,0x76,0x61,0x6C,0x75,0x65,0x2C,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2C,0x20,0x75,
-    0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,0x69,0x74,0x6F,0x2C,0x20,0x66,0x61,0x6E,0x2C,
-    0x20,0x68,0x66,0x2C,0x20,0x70,0x2C,0x20,0x74,0x2C,0x20,0x68,0x2C,0x20,0x72,0x29,
+    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x28,0x29,
     0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,
-    0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x44,0x61,0x79,0x4D,
-    0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x20,0x3D,0x20,0x66,0x75,
-    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
-    0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x44,0x61,
-    0x79,0x20,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x20,0x72,
-    0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,0x20,0x3D,0x20,0x30,
-    0x2E,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
-    0x20,0x74,0x73,0x20,0x3D,0x20,0x5B,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,0x20,0x3D,0x20,0x30,0x2E,0x30,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,0x73,0x20,
-    0x3D,0x20,0x5B,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x70,0x20,0x3D,0x20,0x30,0x2E,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x70,0x73,0x20,0x3D,0x20,0x5B,0x5D,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,
-    0x66,0x66,0x73,0x20,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x6E,0x74,0x20,0x3D,0x20,
-    0x37,0x33,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x63,
-    0x6E,0x74,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x70,0x20,0x3D,0x20,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,
-    0x6E,0x74,0x33,0x32,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,
-    0x20,0x2A,0x20,0x30,0x2E,0x30,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x73,0x5B,0x69,0x5D,0x20,0x3D,0x20,
-    0x70,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x31,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,0x73,0x20,
-    0x2B,0x3D,0x20,0x34,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x69,
-    0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x63,0x6E,0x74,0x3B,0x20,0x69,
-    0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x73,0x5B,0x69,
-    0x5D,0x20,0x3D,0x20,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x49,0x6E,0x74,
-    0x31,0x36,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,0x20,0x2A,
-    0x20,0x30,0x2E,0x30,0x31,0x29,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x6F,0x66,0x66,0x73,0x20,0x2B,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x63,
-    0x6E,0x74,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x68,0x20,0x3D,0x20,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,
-    0x6E,0x74,0x31,0x36,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,
-    0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x73,0x5B,0x69,0x5D,0x20,0x3D,0x20,0x68,
-    0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,0x73,0x20,0x2B,
-    0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
-    0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,
-    0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x61,0x79,
-    0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,
-    0x69,0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,
-    0x69,0x73,0x2E,0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,
-    0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x74,0x73,0x2C,
-    0x20,0x68,0x73,0x2C,0x20,0x70,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,
-    0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x57,0x73,0x4F,0x70,0x65,0x6E,
-    0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,
-    0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x20,
-    0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,
-    0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,
-    0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
-    0x54,0x72,0x79,0x20,0x74,0x6F,0x20,0x67,0x65,0x74,0x20,0x74,0x68,0x65,0x20,0x63,
-    0x6F,0x6E,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x2E,0x2E,0x22,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,
-    0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,
-    0x65,0x72,0x28,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x6C,0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,
-    0x69,0x6E,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,
-    0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,
-    0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
-    0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x43,
-    0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,
-    0x65,0x72,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,
-    0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,
-    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x67,0x65,0x74,0x44,
-    0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x28,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,
-    0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x20,0x3D,
-    0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x57,
+    0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x2E,0x4F,0x50,0x45,0x4E,0x20,0x3D,0x3D,
+    0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x72,0x65,0x61,0x64,0x79,0x53,0x74,
+    0x61,0x74,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+    0x73,0x2E,0x77,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x64,0x61,0x74,0x61,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x57,0x65,
+    0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x2E,0x43,0x4F,0x4E,0x4E,0x45,0x43,0x54,0x49,
+    0x4E,0x47,0x20,0x3D,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x72,0x65,
+    0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x28,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,
-    0x6F,0x6E,0x57,0x73,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x66,0x75,
-    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
-    0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x44,0x61,0x74,
-    0x61,0x56,0x69,0x65,0x77,0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x64,0x61,0x74,0x61,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
-    0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
-    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x20,
-    0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,
-    0x31,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x20,0x3D,
+    0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,
+    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,
+    0x65,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x3D,0x20,0x66,0x75,
+    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,
+    0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x47,0x65,0x74,0x20,0x53,0x74,
+    0x61,0x74,0x75,0x73,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x6E,0x65,
+    0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,
+    0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,0x6E,0x74,0x38,0x41,
+    0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,
+    0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
+    0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,
+    0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x67,
+    0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,
+    0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
     0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
-    0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x66,0x72,0x6F,0x6D,0x20,0x73,0x65,0x72,
-    0x76,0x65,0x72,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x20,
-    0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,
-    0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x20,
-    0x3D,0x3D,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x43,0x6F,
-    0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,
-    0x72,0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
-    0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,
-    0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,
-    0x74,0x65,0x72,0x73,0x28,0x76,0x69,0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,
-    0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
-    0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x3D,
-    0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,
-    0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x43,0x6F,0x6C,0x6F,0x72,
-    0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x47,0x65,0x74,0x20,0x44,0x61,0x79,0x20,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,
+    0x65,0x6E,0x74,0x73,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x6E,0x65,
+    0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,
+    0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,0x6E,0x74,0x38,0x41,
+    0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,
+    0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
+    0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,
+    0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,
+    0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x67,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,
+    0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x73,0x69,0x6E,
+    0x63,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,
+    0x22,0x57,0x53,0x3A,0x20,0x47,0x65,0x74,0x20,0x45,0x76,0x65,0x6E,0x74,0x73,0x20,
+    0x61,0x66,0x74,0x65,0x72,0x20,0x22,0x20,0x2B,0x20,0x73,0x69,0x6E,0x63,0x65,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,
+    0x79,0x42,0x75,0x66,0x66,0x65,0x72,0x28,0x33,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,
+    0x6E,0x65,0x77,0x20,0x44,0x61,0x74,0x61,0x56,0x69,0x65,0x77,0x28,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
+    0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x30,0x2C,0x20,
+    0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,
+    0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,0x73,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,
+    0x74,0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x31,0x2C,0x20,0x73,0x69,0x6E,0x63,0x65,
+    0x2C,0x20,0x74,0x72,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x2F,0x2F,0x20,0x54,0x68,0x65,0x20,0x72,0x61,0x6E,0x67,0x65,0x20,
+    0x5B,0x66,0x72,0x6F,0x6D,0x2C,0x20,0x74,0x6F,0x29,0x20,0x6F,0x66,0x20,0x74,0x68,
+    0x65,0x20,0x68,0x69,0x73,0x74,0x6F,0x72,0x79,0x20,0x6C,0x65,0x76,0x65,0x6C,0x20,
+    0x28,0x30,0x20,0x2D,0x20,0x31,0x30,0x20,0x73,0x2C,0x20,0x31,0x20,0x2D,0x20,0x31,
+    0x20,0x6D,0x69,0x6E,0x75,0x74,0x65,0x2C,0x20,0x32,0x20,0x2D,0x20,0x32,0x30,0x20,
+    0x6D,0x69,0x6E,0x75,0x74,0x65,0x73,0x29,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,
+    0x2F,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x65,0x6C,0x64,0x73,0x20,0x6D,0x61,0x73,
+    0x6B,0x3A,0x20,0x31,0x20,0x2D,0x20,0x74,0x65,0x6D,0x70,0x65,0x72,0x61,0x74,0x75,
+    0x72,0x65,0x2C,0x20,0x32,0x20,0x2D,0x20,0x68,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,
+    0x2C,0x20,0x34,0x20,0x2D,0x20,0x70,0x72,0x65,0x73,0x73,0x75,0x72,0x65,0x2C,0x20,
+    0x38,0x20,0x2D,0x20,0x43,0x4F,0x32,0x2C,0x20,0x31,0x36,0x20,0x2D,0x20,0x6C,0x69,
+    0x67,0x68,0x74,0x2E,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x54,0x68,0x65,
+    0x20,0x63,0x68,0x75,0x6E,0x6B,0x73,0x20,0x61,0x72,0x65,0x20,0x72,0x65,0x71,0x75,
+    0x65,0x73,0x74,0x65,0x64,0x20,0x6F,0x6E,0x65,0x20,0x62,0x79,0x20,0x6F,0x6E,0x65,
+    0x2C,0x20,0x73,0x6F,0x20,0x74,0x68,0x65,0x20,0x73,0x6C,0x6F,0x77,0x20,0x6C,0x69,
+    0x6E,0x6B,0x20,0x67,0x65,0x74,0x73,0x20,0x74,0x68,0x65,0x6D,0x20,0x61,0x73,0x20,
+    0x66,0x61,0x73,0x74,0x20,0x61,0x73,0x20,0x69,0x74,0x20,0x63,0x61,0x6E,0x2E,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
+    0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x67,0x65,0x74,0x53,0x65,0x72,
+    0x69,0x65,0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x66,
+    0x72,0x6F,0x6D,0x2C,0x20,0x74,0x6F,0x2C,0x20,0x6C,0x65,0x76,0x65,0x6C,0x2C,0x20,
+    0x66,0x69,0x65,0x6C,0x64,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,
+    0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x47,0x65,0x74,0x20,0x53,0x65,0x72,
+    0x69,0x65,0x73,0x20,0x22,0x20,0x2B,0x20,0x66,0x72,0x6F,0x6D,0x20,0x2B,0x20,0x22,
+    0x20,0x2D,0x20,0x22,0x20,0x2B,0x20,0x74,0x6F,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x72,0x69,0x65,0x73,
+    0x20,0x3D,0x20,0x7B,0x74,0x6F,0x3A,0x20,0x74,0x6F,0x2C,0x20,0x6C,0x65,0x76,0x65,
+    0x6C,0x3A,0x20,0x6C,0x65,0x76,0x65,0x6C,0x2C,0x20,0x66,0x69,0x65,0x6C,0x64,0x73,
+    0x3A,0x20,0x66,0x69,0x65,0x6C,0x64,0x73,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3D,
+    0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,0x65,0x72,
+    0x28,0x31,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x44,0x61,
+    0x74,0x61,0x56,0x69,0x65,0x77,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,
+    0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x30,0x2C,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,
+    0x74,0x53,0x65,0x72,0x69,0x65,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x33,
+    0x32,0x28,0x31,0x2C,0x20,0x66,0x72,0x6F,0x6D,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x33,0x32,0x28,0x35,0x2C,0x20,0x74,0x6F,0x2C,
+    0x20,0x74,0x72,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x39,
+    0x2C,0x20,0x6C,0x65,0x76,0x65,0x6C,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x2E,0x73,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,
+    0x28,0x31,0x30,0x2C,0x20,0x66,0x69,0x65,0x6C,0x64,0x73,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,
+    0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x54,0x68,0x65,0x20,0x63,
+    0x68,0x75,0x6E,0x6B,0x3A,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x72,0x73,0x74,0x20,
+    0x73,0x61,0x6D,0x70,0x6C,0x65,0x20,0x69,0x73,0x20,0x33,0x32,0x20,0x62,0x69,0x74,
+    0x73,0x20,0x70,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x74,0x69,0x6D,0x65,0x20,0x61,
+    0x6E,0x64,0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x76,0x61,0x6C,0x75,0x65,0x2C,0x20,
+    0x74,0x68,0x65,0x20,0x6E,0x65,0x78,0x74,0x20,0x6F,0x6E,0x65,0x73,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x2F,0x2F,0x20,0x61,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x64,0x65,
+    0x6C,0x74,0x61,0x2D,0x6F,0x66,0x2D,0x64,0x65,0x6C,0x74,0x61,0x20,0x6F,0x66,0x20,
+    0x74,0x68,0x65,0x20,0x74,0x69,0x6D,0x65,0x20,0x61,0x6E,0x64,0x20,0x74,0x68,0x65,
+    0x20,0x64,0x65,0x6C,0x74,0x61,0x73,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x76,
+    0x61,0x6C,0x75,0x65,0x73,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x62,0x75,0x63,
+    0x6B,0x65,0x74,0x73,0x3A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x27,0x30,
+    0x27,0x20,0x2D,0x20,0x7A,0x65,0x72,0x6F,0x2C,0x20,0x27,0x31,0x30,0x27,0x2C,0x20,
+    0x27,0x31,0x31,0x30,0x27,0x2C,0x20,0x27,0x31,0x31,0x31,0x30,0x27,0x20,0x2B,0x20,
+    0x74,0x68,0x65,0x20,0x73,0x68,0x6F,0x72,0x74,0x20,0x73,0x69,0x67,0x6E,0x65,0x64,
+    0x20,0x76,0x61,0x6C,0x75,0x65,0x2C,0x20,0x27,0x31,0x31,0x31,0x31,0x27,0x20,0x2B,
+    0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x73,0x2E,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,
+    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x64,0x65,0x63,0x6F,0x64,0x65,
+    0x53,0x65,0x72,0x69,0x65,0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,
+    0x6E,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x2C,0x20,
+    0x63,0x6F,0x75,0x6E,0x74,0x2C,0x20,0x66,0x69,0x65,0x6C,0x64,0x73,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x62,0x69,0x74,0x20,0x3D,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2A,0x20,0x38,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x72,0x65,0x61,0x64,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,
+    0x6E,0x28,0x62,0x69,0x74,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6C,0x65,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,
+    0x28,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,
+    0x62,0x69,0x74,0x73,0x3B,0x20,0x69,0x2B,0x2B,0x2C,0x20,0x62,0x69,0x74,0x2B,0x2B,
+    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x28,0x76,0x61,0x6C,0x75,0x65,
+    0x20,0x2A,0x20,0x32,0x29,0x20,0x2B,0x20,0x28,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,
+    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x62,0x69,0x74,0x20,0x3E,0x3E,0x20,0x33,
+    0x29,0x20,0x3E,0x3E,0x20,0x28,0x37,0x20,0x2D,0x20,0x28,0x62,0x69,0x74,0x20,0x26,
+    0x20,0x37,0x29,0x29,0x29,0x20,0x26,0x20,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,
-    0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
-    0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,
-    0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,
-    0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,
-    0x28,0x22,0x57,0x53,0x3A,0x20,0x54,0x68,0x65,0x20,0x53,0x75,0x6E,0x20,0x69,0x6D,
-    0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x20,0x6D,0x6F,0x64,0x65,0x20,0x69,0x73,0x20,
-    0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,
-    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,
-    0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,
-    0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,
-    0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x76,
-    0x69,0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,
-    0x65,0x74,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x20,0x3D,0x3D,
-    0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,
-    0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x55,0x6C,0x74,0x72,0x61,
-    0x56,0x69,0x6F,0x6C,0x65,0x74,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,
-    0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x57,0x68,
-    0x69,0x74,0x65,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
-    0x20,0x57,0x68,0x69,0x74,0x65,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,
-    0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,0x69,
-    0x74,0x6F,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x20,0x76,
+    0x61,0x6C,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,
+    0x75,0x63,0x6B,0x65,0x74,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
+    0x28,0x73,0x69,0x7A,0x65,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6C,0x65,0x74,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x20,0x3D,0x20,0x30,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6C,0x65,0x20,0x28,0x28,0x70,0x72,0x65,0x66,0x69,0x78,0x20,0x3C,0x20,0x73,0x69,
+    0x7A,0x65,0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x29,0x20,0x26,0x26,0x20,0x28,
+    0x31,0x20,0x3D,0x3D,0x20,0x72,0x65,0x61,0x64,0x28,0x31,0x29,0x29,0x29,0x0D,0x0A,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
-    0x46,0x69,0x74,0x6F,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,
+    0x72,0x65,0x66,0x69,0x78,0x2B,0x2B,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x30,0x20,0x3D,0x3D,0x20,0x70,0x72,
+    0x65,0x66,0x69,0x78,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x20,0x30,0x3B,0x0D,
     0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,
-    0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,0x41,0x4E,0x20,
-    0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,
-    0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x46,0x41,0x4E,
-    0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,
-    0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
-    0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,
-    0x65,0x72,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
-    0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x20,0x69,0x73,0x20,0x73,0x65,
-    0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,
-    0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,
-    0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,
-    0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x44,
-    0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x28,0x76,
-    0x69,0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,
-    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,
-    0x70,0x65,0x2E,0x6F,0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x20,0x3D,0x20,0x66,
-    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
-    0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,
-    0x6E,0x44,0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x29,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x69,
-    0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,
-    0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x63,0x6F,0x6E,0x6E,
-    0x65,0x63,0x74,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x29,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x28,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x20,0x3D,0x3D,
-    0x3D,0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,0x29,0x20,0x7C,0x7C,0x20,
-    0x28,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x20,0x3D,0x3D,0x20,0x4E,0x61,0x4E,0x29,
-    0x20,0x7C,0x7C,0x20,0x28,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x72,0x65,0x61,
-    0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x20,0x21,0x3D,0x20,0x57,0x65,0x62,0x53,0x6F,
-    0x63,0x6B,0x65,0x74,0x2E,0x43,0x4F,0x4E,0x4E,0x45,0x43,0x54,0x49,0x4E,0x47,0x29,
-    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,
-    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,
-    0x6C,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x20,0x3C,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,
-    0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x54,0x69,0x6D,0x65,
-    0x6F,0x75,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
+    0x62,0x69,0x74,0x73,0x20,0x3D,0x20,0x73,0x69,0x7A,0x65,0x73,0x5B,0x70,0x72,0x65,
+    0x66,0x69,0x78,0x20,0x2D,0x20,0x31,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,
+    0x20,0x3D,0x20,0x72,0x65,0x61,0x64,0x28,0x62,0x69,0x74,0x73,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6E,0x20,0x28,0x76,0x61,0x6C,0x75,0x65,0x20,0x3E,0x3D,0x20,0x4D,0x61,0x74,
+    0x68,0x2E,0x70,0x6F,0x77,0x28,0x32,0x2C,0x20,0x62,0x69,0x74,0x73,0x20,0x2D,0x20,
+    0x31,0x29,0x29,0x20,0x3F,0x20,0x28,0x76,0x61,0x6C,0x75,0x65,0x20,0x2D,0x20,0x4D,
+    0x61,0x74,0x68,0x2E,0x70,0x6F,0x77,0x28,0x32,0x2C,0x20,0x62,0x69,0x74,0x73,0x29,
+    0x29,0x20,0x3A,0x20,0x76,0x61,0x6C,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6C,0x65,0x74,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,0x73,0x20,0x3D,0x20,0x5B,0x5D,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,
+    0x69,0x6D,0x65,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6C,0x65,0x74,0x20,0x64,0x65,0x6C,0x74,0x61,0x20,0x3D,0x20,0x30,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x61,
+    0x6C,0x75,0x65,0x73,0x20,0x3D,0x20,0x5B,0x30,0x2C,0x20,0x30,0x2C,0x20,0x30,0x2C,
+    0x20,0x30,0x2C,0x20,0x30,0x5D,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x6C,0x65,0x74,0x20,0x6E,0x20,0x3D,0x20,
+    0x30,0x3B,0x20,0x6E,0x20,0x3C,0x20,0x63,0x6F,0x75,0x6E,0x74,0x3B,0x20,0x6E,0x2B,
+    0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x30,
+    0x20,0x3D,0x3D,0x20,0x6E,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x69,0x6D,0x65,0x20,0x3D,0x20,0x72,0x65,
+    0x61,0x64,0x28,0x33,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x6F,0x6E,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,0x28,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x65,0x6C,0x74,0x61,0x20,0x2B,
+    0x3D,0x20,0x62,0x75,0x63,0x6B,0x65,0x74,0x28,0x5B,0x37,0x2C,0x20,0x39,0x2C,0x20,
+    0x31,0x32,0x2C,0x20,0x33,0x32,0x5D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x69,0x6D,0x65,0x20,
+    0x2B,0x3D,0x20,0x64,0x65,0x6C,0x74,0x61,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x6C,0x65,0x74,0x20,0x66,
+    0x20,0x3D,0x20,0x30,0x3B,0x20,0x66,0x20,0x3C,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,
+    0x72,0x69,0x65,0x73,0x46,0x69,0x65,0x6C,0x64,0x73,0x3B,0x20,0x66,0x2B,0x2B,0x29,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x30,0x20,0x21,0x3D,0x20,0x28,0x66,0x69,0x65,0x6C,0x64,
+    0x73,0x20,0x26,0x20,0x28,0x31,0x20,0x3C,0x3C,0x20,0x66,0x29,0x29,0x29,0x0D,0x0A,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,
-    0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,
-    0x69,0x73,0x2E,0x6F,0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,
-    0x63,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x6F,0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,
-    0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x5B,0x66,0x5D,
+    0x20,0x3D,0x20,0x28,0x30,0x20,0x3D,0x3D,0x20,0x6E,0x29,0x20,0x3F,0x20,0x28,0x72,
+    0x65,0x61,0x64,0x28,0x33,0x32,0x29,0x20,0x7C,0x20,0x30,0x29,0x20,0x3A,0x20,0x28,
+    0x28,0x76,0x61,0x6C,0x75,0x65,0x73,0x5B,0x66,0x5D,0x20,0x2B,0x20,0x62,0x75,0x63,
+    0x6B,0x65,0x74,0x28,0x5B,0x34,0x2C,0x20,0x37,0x2C,0x20,0x31,0x32,0x2C,0x20,0x33,
+    0x32,0x5D,0x29,0x29,0x20,0x7C,0x20,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,
+    0x73,0x2E,0x70,0x75,0x73,0x68,0x28,0x7B,0x74,0x69,0x6D,0x65,0x3A,0x20,0x74,0x69,
+    0x6D,0x65,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x3A,0x20,0x76,0x61,0x6C,0x75,
+    0x65,0x73,0x2E,0x73,0x6C,0x69,0x63,0x65,0x28,0x29,0x7D,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x20,0x73,0x61,0x6D,0x70,0x6C,
+    0x65,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,
+    0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,
+    0x47,0x65,0x74,0x53,0x65,0x72,0x69,0x65,0x73,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,
+    0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6E,
+    0x65,0x78,0x74,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,
+    0x6E,0x74,0x33,0x32,0x28,0x32,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x6F,0x75,0x6E,
+    0x74,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,
+    0x31,0x36,0x28,0x36,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x65,0x76,0x65,0x6C,0x20,
+    0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,
+    0x38,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x66,0x69,0x65,0x6C,0x64,0x73,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
+    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x39,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,0x73,
+    0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x64,0x65,
+    0x63,0x6F,0x64,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x76,0x69,0x65,0x77,0x2C,
+    0x20,0x31,0x30,0x2C,0x20,0x63,0x6F,0x75,0x6E,0x74,0x2C,0x20,0x66,0x69,0x65,0x6C,
+    0x64,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x64,0x6F,0x6E,0x65,0x20,0x3D,0x20,0x28,0x6E,0x65,0x78,0x74,0x20,0x3E,
+    0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x72,0x69,0x65,0x73,0x2E,0x74,0x6F,
+    0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,
+    0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,
+    0x65,0x72,0x69,0x65,0x73,0x20,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x3A,0x20,
+    0x22,0x20,0x2B,0x20,0x63,0x6F,0x75,0x6E,0x74,0x20,0x2B,0x20,0x22,0x20,0x73,0x61,
+    0x6D,0x70,0x6C,0x65,0x73,0x20,0x69,0x6E,0x20,0x22,0x20,0x2B,0x20,0x28,0x76,0x69,
+    0x65,0x77,0x2E,0x62,0x79,0x74,0x65,0x4C,0x65,0x6E,0x67,0x74,0x68,0x20,0x2D,0x20,
+    0x31,0x30,0x29,0x20,0x2B,0x20,0x22,0x20,0x62,0x79,0x74,0x65,0x73,0x22,0x29,0x3B,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x53,0x65,
+    0x72,0x69,0x65,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x53,0x65,0x72,
+    0x69,0x65,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x73,0x61,0x6D,0x70,
+    0x6C,0x65,0x73,0x2C,0x20,0x64,0x6F,0x6E,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,
-    0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x20,0x3D,0x20,
-    0x22,0x20,0x2B,0x20,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,
-    0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x28,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,
-    0x6F,0x73,0x74,0x6E,0x61,0x6D,0x65,0x20,0x3D,0x3D,0x3D,0x20,0x22,0x6C,0x6F,0x63,
-    0x61,0x6C,0x68,0x6F,0x73,0x74,0x22,0x29,0x20,0x7C,0x7C,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x28,0x6C,0x6F,
-    0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x6E,0x61,0x6D,0x65,0x20,
-    0x3D,0x3D,0x3D,0x20,0x22,0x31,0x32,0x37,0x2E,0x30,0x2E,0x30,0x2E,0x31,0x22,0x29,
-    0x20,0x7C,0x7C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x28,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,
-    0x6F,0x73,0x74,0x6E,0x61,0x6D,0x65,0x20,0x3D,0x3D,0x3D,0x20,0x22,0x66,0x73,0x22,
-    0x29,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,
-    0x57,0x53,0x3A,0x20,0x55,0x73,0x65,0x20,0x6C,0x6F,0x63,0x61,0x6C,0x20,0x68,0x6F,
-    0x73,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x20,0x3D,
-    0x20,0x6E,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x28,0x22,
-    0x77,0x73,0x3A,0x2F,0x2F,0x6C,0x6F,0x63,0x61,0x6C,0x68,0x6F,0x73,0x74,0x3A,0x38,
-    0x30,0x38,0x30,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x66,0x61,0x6C,0x73,0x65,0x20,0x3D,0x3D,0x20,0x64,0x6F,0x6E,
+    0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x54,0x68,
+    0x65,0x20,0x65,0x6D,0x70,0x74,0x79,0x20,0x63,0x68,0x75,0x6E,0x6B,0x20,0x69,0x73,
+    0x20,0x74,0x68,0x65,0x20,0x66,0x75,0x6C,0x6C,0x20,0x54,0x43,0x50,0x20,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x2C,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x20,0x61,0x20,0x62,0x69,0x74,
+    0x20,0x6C,0x61,0x74,0x65,0x72,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x64,0x65,0x6C,0x61,0x79,0x20,0x3D,0x20,
+    0x28,0x30,0x20,0x3C,0x20,0x63,0x6F,0x75,0x6E,0x74,0x29,0x20,0x3F,0x20,0x30,0x20,
+    0x3A,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,
+    0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x72,0x69,0x65,0x73,0x52,0x65,0x74,0x72,
+    0x79,0x4D,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x65,0x74,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,0x28,0x28,0x29,0x20,
+    0x3D,0x3E,0x20,0x74,0x68,0x69,0x73,0x2E,0x67,0x65,0x74,0x53,0x65,0x72,0x69,0x65,
+    0x73,0x28,0x6E,0x65,0x78,0x74,0x2C,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,0x65,0x72,
+    0x69,0x65,0x73,0x2E,0x74,0x6F,0x2C,0x20,0x6C,0x65,0x76,0x65,0x6C,0x2C,0x20,0x66,
+    0x69,0x65,0x6C,0x64,0x73,0x29,0x2C,0x20,0x64,0x65,0x6C,0x61,0x79,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,
+    0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,
+    0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x43,0x6F,0x6E,0x6E,0x65,0x63,
+    0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x20,0x3D,
+    0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x28,0x76,0x69,0x65,0x77,0x29,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,
+    0x3A,0x20,0x43,0x6F,0x6E,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,
+    0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,0x66,0x66,0x73,
+    0x65,0x74,0x20,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6C,0x65,0x74,0x20,0x73,0x73,0x69,0x64,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,
+    0x6D,0x42,0x75,0x66,0x66,0x65,0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,
+    0x66,0x73,0x65,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6F,0x66,0x66,0x73,0x65,0x74,0x20,0x2B,0x3D,0x20,0x73,0x73,0x69,0x64,0x2E,0x6C,
+    0x65,0x6E,0x67,0x74,0x68,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6C,0x65,0x74,0x20,0x70,0x77,0x64,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2B,0x3D,0x20,0x70,0x77,0x64,0x2E,0x6C,0x65,0x6E,0x67,
+    0x74,0x68,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x73,0x69,0x74,0x65,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,0x75,0x66,
+    0x66,0x65,0x72,0x28,0x76,0x69,0x65,0x77,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,
+    0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,
+    0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x50,
+    0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x3A,0x20,0x22,0x20,0x2B,0x20,0x73,
+    0x73,0x69,0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x2B,0x20,0x22,0x20,0x22,0x20,
+    0x2B,0x20,0x70,0x77,0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x2B,0x20,0x22,0x20,
+    0x22,0x20,0x2B,0x20,0x73,0x69,0x74,0x65,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x43,0x6F,
+    0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,
+    0x72,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,
-    0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x55,0x73,0x65,0x20,0x72,0x65,0x6D,
-    0x6F,0x74,0x65,0x20,0x68,0x6F,0x73,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x77,0x73,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6F,
-    0x63,0x6B,0x65,0x74,0x28,0x22,0x77,0x73,0x3A,0x2F,0x2F,0x22,0x20,0x2B,0x20,0x6C,
-    0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x29,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,
-    0x77,0x73,0x2E,0x62,0x69,0x6E,0x61,0x72,0x79,0x54,0x79,0x70,0x65,0x20,0x3D,0x20,
-    0x27,0x61,0x72,0x72,0x61,0x79,0x62,0x75,0x66,0x66,0x65,0x72,0x27,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x77,0x73,0x2E,0x6F,0x6E,0x6F,0x70,0x65,0x6E,0x20,0x3D,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x6F,0x6E,0x57,0x73,0x4F,0x70,0x65,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,
-    0x2E,0x6F,0x6E,0x65,0x72,0x72,0x6F,0x72,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,
-    0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,
-    0x6F,0x6E,0x6D,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x6F,0x6E,0x57,0x73,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,
-    0x77,0x73,0x2E,0x6F,0x6E,0x63,0x6C,0x6F,0x73,0x65,0x20,0x3D,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x6F,0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,
-    0x65,0x74,0x72,0x69,0x65,0x73,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,
+    0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x52,
+    0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x73,0x73,0x69,0x64,0x2E,0x76,0x61,0x6C,
+    0x75,0x65,0x2C,0x20,0x70,0x77,0x64,0x2E,0x76,0x61,0x6C,0x75,0x65,0x2C,0x20,0x73,
+    0x69,0x74,0x65,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,
     0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,
-    0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x20,0x3D,0x20,
-    0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x6E,0x61,0x62,0x6C,0x65,0x64,
-    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,
+    0x61,0x67,0x65,0x47,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x3D,0x20,0x66,
+    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,
+    0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,
+    0x74,0x61,0x74,0x75,0x73,0x20,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x21,0x22,
+    0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x6D,0x6F,0x64,0x65,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x20,
+    0x20,0x3D,0x20,0x7B,0x72,0x3A,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,
+    0x69,0x6E,0x74,0x38,0x28,0x33,0x29,0x2C,0x20,0x67,0x3A,0x20,0x76,0x69,0x65,0x77,
+    0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x34,0x29,0x2C,0x20,0x62,0x3A,
+    0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x35,
+    0x29,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x75,0x76,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
+    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x36,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x77,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,
+    0x37,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x66,0x69,0x74,0x6F,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
+    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x38,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x66,0x61,0x6E,0x20,0x20,0x20,0x20,
+    0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,
+    0x39,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x68,0x66,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
+    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x31,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x72,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,
+    0x28,0x31,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,
+    0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x33,0x32,0x28,0x31,0x32,0x2C,0x20,0x74,
+    0x72,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,
+    0x2E,0x67,0x65,0x74,0x49,0x6E,0x74,0x31,0x36,0x28,0x31,0x36,0x2C,0x20,0x74,0x72,
+    0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x68,0x20,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x31,0x38,0x2C,0x20,0x74,0x72,
+    0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x63,0x6F,0x32,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x32,0x30,0x2C,0x20,0x74,0x72,
+    0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x6C,0x75,0x78,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x33,0x32,0x28,0x32,0x32,0x2C,0x20,0x74,0x72,
+    0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x72,0x70,0x6D,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x32,0x36,0x2C,0x20,0x74,0x72,
+    0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x66,0x61,0x20,0x20,0x20,0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x32,0x38,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x65,0x76,0x20,0x20,0x20,
+    0x20,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,
+    0x31,0x36,0x28,0x32,0x39,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x64,0x74,0x73,0x20,0x20,
+    0x20,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x67,
+    0x65,0x74,0x53,0x74,0x72,0x46,0x72,0x6F,0x6D,0x42,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x76,0x69,0x65,0x77,0x2C,0x20,0x33,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x75,0x6E,0x20,0x20,0x20,0x20,0x3D,
+    0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,
-    0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x53,0x75,0x6E,0x20,0x49,0x6D,0x69,0x74,0x61,
-    0x74,0x69,0x6F,0x6E,0x20,0x4D,0x6F,0x64,0x65,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,
-    0x65,0x6E,0x61,0x62,0x6C,0x65,0x64,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,0x65,
-    0x6E,0x61,0x62,0x6C,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x53,0x3A,0x20,0x43,0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x63,
+    0x6F,0x6C,0x6F,0x72,0x2E,0x72,0x20,0x2B,0x20,0x22,0x3A,0x22,0x20,0x2B,0x20,0x63,
+    0x6F,0x6C,0x6F,0x72,0x2E,0x67,0x20,0x2B,0x20,0x22,0x3A,0x22,0x20,0x2B,0x20,0x63,
+    0x6F,0x6C,0x6F,0x72,0x2E,0x62,0x20,0x2B,0x20,0x22,0x20,0x2D,0x20,0x22,0x20,0x2B,
+    0x20,0x64,0x74,0x73,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,
+    0x6D,0x6F,0x64,0x65,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,
+    0x20,0x21,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x75,0x6E,0x20,0x3D,0x20,0x66,0x61,0x6C,0x73,0x65,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,
+    0x69,0x73,0x2E,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,
+    0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+    0x73,0x2E,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,0x76,
+    0x65,0x64,0x28,0x73,0x75,0x6E,0x2C,0x20,0x64,0x74,0x73,0x2E,0x76,0x61,0x6C,0x75,
+    0x65,0x2C,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,
+    0x20,0x66,0x69,0x74,0x6F,0x2C,0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x2C,0x20,
+    0x70,0x2C,0x20,0x74,0x2C,0x20,0x68,0x2C,0x20,0x63,0x6F,0x32,0x2C,0x20,0x6C,0x75,
+    0x78,0x2C,0x20,0x72,0x70,0x6D,0x2C,0x20,0x66,0x61,0x2C,0x20,0x65,0x76,0x2C,0x20,
+    0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,
+    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,
+    0x65,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x44,0x61,
+    0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x20,0x3D,0x20,
+    0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
+    0x44,0x61,0x79,0x20,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,
+    0x20,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,0x20,0x3D,
+    0x20,0x30,0x2E,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x74,0x73,0x20,0x3D,0x20,0x5B,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,0x20,0x3D,0x20,0x30,0x2E,0x30,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,
+    0x73,0x20,0x3D,0x20,0x5B,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6C,0x65,0x74,0x20,0x70,0x20,0x3D,0x20,0x30,0x2E,0x30,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x70,0x73,0x20,0x3D,0x20,
+    0x5B,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x6F,0x66,0x66,0x73,0x20,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x6E,0x74,0x20,
+    0x3D,0x20,0x37,0x33,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,
+    0x20,0x63,0x6E,0x74,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x70,0x20,0x3D,0x20,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,
+    0x55,0x69,0x6E,0x74,0x33,0x32,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x74,0x72,0x75,
+    0x65,0x29,0x20,0x2A,0x20,0x30,0x2E,0x30,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x73,0x5B,0x69,0x5D,0x20,
+    0x3D,0x20,0x70,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x31,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,
+    0x73,0x20,0x2B,0x3D,0x20,0x34,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,
+    0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x63,0x6E,0x74,0x3B,
+    0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x73,
+    0x5B,0x69,0x5D,0x20,0x3D,0x20,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x49,
+    0x6E,0x74,0x31,0x36,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,
+    0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,
+    0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6F,0x66,0x66,0x73,0x20,0x2B,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,
+    0x20,0x63,0x6E,0x74,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x68,0x20,0x3D,0x20,0x28,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,
+    0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x6F,0x66,0x66,0x73,0x2C,0x20,0x74,0x72,0x75,
+    0x65,0x29,0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x73,0x5B,0x69,0x5D,0x20,0x3D,
+    0x20,0x68,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6F,0x66,0x66,0x73,
+    0x20,0x2B,0x3D,0x20,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,
+    0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,
+    0x63,0x65,0x69,0x76,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x4D,0x6F,0x64,0x65,0x28,0x43,0x6F,
-    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,
-    0x6C,0x2E,0x6D,0x6F,0x64,0x65,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,
-    0x6F,0x6E,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,
+    0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,
+    0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x74,
+    0x73,0x2C,0x20,0x68,0x73,0x2C,0x20,0x70,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
+    0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,
+    0x61,0x67,0x65,0x47,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,0x73,0x20,0x3D,0x20,0x66,
+    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x69,0x65,0x77,0x29,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x63,0x6F,0x75,0x6E,0x74,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,
+    0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x32,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6F,0x66,0x66,0x73,0x20,0x3D,0x20,
+    0x33,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
+    0x65,0x76,0x65,0x6E,0x74,0x73,0x20,0x3D,0x20,0x5B,0x5D,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,
+    0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x45,0x76,0x65,
+    0x6E,0x74,0x73,0x20,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x3A,0x20,0x22,0x20,
+    0x2B,0x20,0x63,0x6F,0x75,0x6E,0x74,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x74,0x69,0x6D,0x65,0x2C,0x20,0x76,0x61,
+    0x6C,0x75,0x65,0x2C,0x20,0x73,0x65,0x71,0x75,0x65,0x6E,0x63,0x65,0x2C,0x20,0x74,
+    0x79,0x70,0x65,0x2C,0x20,0x6D,0x65,0x74,0x72,0x69,0x63,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,
+    0x20,0x69,0x20,0x3C,0x20,0x63,0x6F,0x75,0x6E,0x74,0x3B,0x20,0x69,0x2B,0x2B,0x29,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x5B,
+    0x69,0x5D,0x20,0x3D,0x20,0x7B,0x74,0x69,0x6D,0x65,0x3A,0x20,0x76,0x69,0x65,0x77,
+    0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x33,0x32,0x28,0x6F,0x66,0x66,0x73,0x2C,
+    0x20,0x74,0x72,0x75,0x65,0x29,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x61,0x6C,0x75,0x65,0x3A,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,
+    0x74,0x49,0x6E,0x74,0x33,0x32,0x28,0x6F,0x66,0x66,0x73,0x20,0x2B,0x20,0x34,0x2C,
+    0x20,0x74,0x72,0x75,0x65,0x29,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x65,0x71,0x75,0x65,0x6E,0x63,0x65,0x3A,0x20,0x76,0x69,0x65,0x77,
+    0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x31,0x36,0x28,0x6F,0x66,0x66,0x73,0x20,
+    0x2B,0x20,0x38,0x2C,0x20,0x74,0x72,0x75,0x65,0x29,0x2C,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x3A,0x20,0x76,0x69,0x65,0x77,
+    0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x6F,0x66,0x66,0x73,0x20,0x2B,
+    0x20,0x31,0x30,0x29,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6D,0x65,0x74,0x72,0x69,0x63,0x3A,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,
+    0x55,0x69,0x6E,0x74,0x38,0x28,0x6F,0x66,0x66,0x73,0x20,0x2B,0x20,0x31,0x31,0x29,
+    0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6F,0x66,0x66,0x73,0x20,0x2B,0x3D,0x20,0x31,0x32,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,
+    0x73,0x2E,0x6F,0x6E,0x45,0x76,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,
+    0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
+    0x2E,0x6F,0x6E,0x45,0x76,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,
+    0x64,0x28,0x65,0x76,0x65,0x6E,0x74,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,
+    0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x57,0x73,0x4F,0x70,0x65,
+    0x6E,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,
+    0x6E,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,
+    0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,
+    0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x29,0x0D,0x0A,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x4D,
-    0x6F,0x64,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,
-    0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x6D,0x6F,0x64,0x65,0x43,0x6F,0x6C,0x6F,
-    0x72,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,
-    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,
-    0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x20,0x66,
-    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x72,0x65,0x64,0x2C,0x20,0x67,0x72,0x65,
-    0x65,0x6E,0x2C,0x20,0x62,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,
-    0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x63,
-    0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x72,0x65,0x64,0x20,0x2B,
-    0x20,0x22,0x3A,0x22,0x20,0x2B,0x20,0x67,0x72,0x65,0x65,0x6E,0x20,0x2B,0x20,0x22,
-    0x3A,0x22,0x20,0x2B,0x20,0x62,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,
+    0x6E,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
+    0x20,0x54,0x72,0x79,0x20,0x74,0x6F,0x20,0x67,0x65,0x74,0x20,0x74,0x68,0x65,0x20,
+    0x63,0x6F,0x6E,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x2E,0x2E,
+    0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,
     0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,
-    0x66,0x65,0x72,0x28,0x34,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x65,0x72,0x28,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x6C,0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,
     0x55,0x69,0x6E,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,
     0x72,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
     0x69,0x65,0x77,0x5B,0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,
-    0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,
-    0x43,0x6F,0x6C,0x6F,0x72,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x76,0x69,0x65,0x77,0x5B,0x31,0x5D,0x20,0x3D,0x20,0x72,0x65,0x64,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x32,0x5D,0x20,
-    0x3D,0x20,0x67,0x72,0x65,0x65,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x33,0x5D,0x20,0x3D,0x20,0x62,0x6C,0x75,0x65,
+    0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,
+    0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,
+    0x74,0x65,0x72,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x68,0x69,0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
     0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
-    0x73,0x2E,0x73,0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,
-    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,
-    0x70,0x65,0x2E,0x73,0x65,0x74,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,
-    0x74,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x61,0x6C,
-    0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,
-    0x22,0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,
-    0x6F,0x6C,0x65,0x74,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
-    0x2E,0x5F,0x73,0x65,0x74,0x56,0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,
-    0x65,0x74,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x2C,0x20,0x76,
-    0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,
-    0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,
-    0x74,0x57,0x68,0x69,0x74,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,
-    0x6E,0x28,0x76,0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,
-    0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x57,0x68,
-    0x69,0x74,0x65,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,
-    0x5F,0x73,0x65,0x74,0x56,0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,
-    0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,
-    0x74,0x57,0x68,0x69,0x74,0x65,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,
+    0x73,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x67,0x65,0x74,
+    0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x28,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,
+    0x6F,0x74,0x79,0x70,0x65,0x2E,0x6F,0x6E,0x57,0x73,0x45,0x72,0x72,0x6F,0x72,0x20,
+    0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,
+    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,
+    0x73,0x2E,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x28,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,
+    0x2E,0x6F,0x6E,0x57,0x73,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x66,
+    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x44,0x61,
+    0x74,0x61,0x56,0x69,0x65,0x77,0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x64,0x61,0x74,
+    0x61,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,
+    0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,0x28,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x73,0x74,0x61,0x74,0x75,0x73,
+    0x20,0x3D,0x20,0x76,0x69,0x65,0x77,0x2E,0x67,0x65,0x74,0x55,0x69,0x6E,0x74,0x38,
+    0x28,0x31,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
+    0x20,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x66,0x72,0x6F,0x6D,0x20,0x73,0x65,
+    0x72,0x76,0x65,0x72,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,0x69,0x65,0x73,
+    0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
+    0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x75,0x63,0x63,0x65,0x73,0x73,
+    0x20,0x3D,0x3D,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,0x74,0x43,
+    0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,
+    0x65,0x72,0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,
+    0x74,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,
+    0x65,0x74,0x65,0x72,0x73,0x28,0x76,0x69,0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,
+    0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,
+    0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x20,0x3D,
+    0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,
+    0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x43,0x6F,0x6C,0x6F,
+    0x72,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,
+    0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,
+    0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,
+    0x61,0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,
+    0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,
+    0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x54,0x68,0x65,0x20,0x53,0x75,0x6E,0x20,0x69,
+    0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x20,0x6D,0x6F,0x64,0x65,0x20,0x69,0x73,
+    0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,
+    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,
+    0x6C,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x3D,0x3D,0x20,0x63,
+    0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,
+    0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,
+    0x76,0x69,0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,
+    0x73,0x65,0x74,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x20,0x3D,
+    0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,
+    0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x55,0x6C,0x74,0x72,
+    0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
+    0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x57,
+    0x68,0x69,0x74,0x65,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,
+    0x3A,0x20,0x57,0x68,0x69,0x74,0x65,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
+    0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,
+    0x69,0x74,0x6F,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
+    0x20,0x46,0x69,0x74,0x6F,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,
+    0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
+    0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,0x41,0x4E,
+    0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
+    0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x46,0x41,
+    0x4E,0x20,0x69,0x73,0x20,0x73,0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,
+    0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,
+    0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,
+    0x69,0x65,0x72,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
+    0x20,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x20,0x69,0x73,0x20,0x73,
+    0x65,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,
+    0x67,0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,
+    0x74,0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x47,0x65,0x74,
+    0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x28,
+    0x76,0x69,0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,
+    0x67,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,
+    0x6D,0x61,0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,0x73,
+    0x73,0x61,0x67,0x65,0x47,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,0x73,0x28,0x76,0x69,
+    0x65,0x77,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x67,0x65,
+    0x74,0x53,0x65,0x72,0x69,0x65,0x73,0x20,0x3D,0x3D,0x20,0x63,0x6F,0x6D,0x6D,0x61,
+    0x6E,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x4D,0x65,0x73,0x73,0x61,
+    0x67,0x65,0x47,0x65,0x74,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x76,0x69,0x65,0x77,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,
+    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,
+    0x6F,0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,
+    0x74,0x69,0x6F,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x69,
+    0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x44,0x69,0x73,0x63,0x6F,
+    0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,
+    0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,
+    0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x29,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x20,0x3D,0x3D,0x3D,0x20,0x75,
+    0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,0x29,0x20,0x7C,0x7C,0x20,0x28,0x74,0x68,
+    0x69,0x73,0x2E,0x77,0x73,0x20,0x3D,0x3D,0x20,0x4E,0x61,0x4E,0x29,0x20,0x7C,0x7C,
+    0x20,0x28,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x72,0x65,0x61,0x64,0x79,0x53,
+    0x74,0x61,0x74,0x65,0x20,0x21,0x3D,0x20,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,
+    0x74,0x2E,0x43,0x4F,0x4E,0x4E,0x45,0x43,0x54,0x49,0x4E,0x47,0x29,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x43,0x6F,0x6E,0x74,0x72,
+    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x72,
+    0x65,0x74,0x72,0x69,0x65,0x73,0x20,0x3C,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,
+    0x74,0x72,0x69,0x65,0x73,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,
+    0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,
+    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,
+    0x6E,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x4E,0x61,0x4E,0x20,0x21,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,
+    0x6F,0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x29,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,
+    0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x28,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x6C,0x6F,0x63,
+    0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x20,0x3D,0x20,0x22,0x20,0x2B,
+    0x20,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,
+    0x6E,0x61,0x6D,0x65,0x20,0x3D,0x3D,0x3D,0x20,0x22,0x6C,0x6F,0x63,0x61,0x6C,0x68,
+    0x6F,0x73,0x74,0x22,0x29,0x20,0x7C,0x7C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x28,0x6C,0x6F,0x63,0x61,0x74,
+    0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x6E,0x61,0x6D,0x65,0x20,0x3D,0x3D,0x3D,
+    0x20,0x22,0x31,0x32,0x37,0x2E,0x30,0x2E,0x30,0x2E,0x31,0x22,0x29,0x20,0x7C,0x7C,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x28,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,
+    0x6E,0x61,0x6D,0x65,0x20,0x3D,0x3D,0x3D,0x20,0x22,0x66,0x73,0x22,0x29,0x29,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
+    0x20,0x55,0x73,0x65,0x20,0x6C,0x6F,0x63,0x61,0x6C,0x20,0x68,0x6F,0x73,0x74,0x22,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x20,0x3D,0x20,0x6E,0x65,
+    0x77,0x20,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x28,0x22,0x77,0x73,0x3A,
+    0x2F,0x2F,0x6C,0x6F,0x63,0x61,0x6C,0x68,0x6F,0x73,0x74,0x3A,0x38,0x30,0x38,0x30,
+    0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,
+    0x28,0x22,0x57,0x53,0x3A,0x20,0x55,0x73,0x65,0x20,0x72,0x65,0x6D,0x6F,0x74,0x65,
+    0x20,0x68,0x6F,0x73,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,
+    0x73,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,
+    0x74,0x28,0x22,0x77,0x73,0x3A,0x2F,0x2F,0x22,0x20,0x2B,0x20,0x6C,0x6F,0x63,0x61,
+    0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,
+    0x62,0x69,0x6E,0x61,0x72,0x79,0x54,0x79,0x70,0x65,0x20,0x3D,0x20,0x27,0x61,0x72,
+    0x72,0x61,0x79,0x62,0x75,0x66,0x66,0x65,0x72,0x27,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,
+    0x2E,0x6F,0x6E,0x6F,0x70,0x65,0x6E,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,
+    0x6E,0x57,0x73,0x4F,0x70,0x65,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x6F,0x6E,
+    0x65,0x72,0x72,0x6F,0x72,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,0x57,
+    0x73,0x45,0x72,0x72,0x6F,0x72,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,0x6F,0x6E,0x6D,
+    0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,0x6E,
+    0x57,0x73,0x4D,0x65,0x73,0x73,0x61,0x67,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x77,0x73,0x2E,
+    0x6F,0x6E,0x63,0x6C,0x6F,0x73,0x65,0x20,0x3D,0x20,0x74,0x68,0x69,0x73,0x2E,0x6F,
+    0x6E,0x57,0x73,0x43,0x6C,0x6F,0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x72,0x65,0x74,0x72,
+    0x69,0x65,0x73,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
     0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,
-    0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x20,0x3D,
+    0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,0x49,0x6D,0x69,
+    0x74,0x61,0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,
+    0x63,0x74,0x69,0x6F,0x6E,0x28,0x65,0x6E,0x61,0x62,0x6C,0x65,0x64,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,
+    0x53,0x65,0x74,0x20,0x53,0x75,0x6E,0x20,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,
+    0x6E,0x20,0x4D,0x6F,0x64,0x65,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x65,0x6E,0x61,
+    0x62,0x6C,0x65,0x64,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,0x65,0x6E,0x61,0x62,
+    0x6C,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+    0x73,0x2E,0x5F,0x73,0x65,0x74,0x4D,0x6F,0x64,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,
+    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x6D,
+    0x6F,0x64,0x65,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x4D,0x6F,0x64,0x65,
+    0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
+    0x6F,0x63,0x6F,0x6C,0x2E,0x6D,0x6F,0x64,0x65,0x43,0x6F,0x6C,0x6F,0x72,0x29,0x3B,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,
+    0x2E,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,
+    0x74,0x69,0x6F,0x6E,0x28,0x72,0x65,0x64,0x2C,0x20,0x67,0x72,0x65,0x65,0x6E,0x2C,
+    0x20,0x62,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,
+    0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x63,0x6F,0x6C,0x6F,
+    0x72,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x72,0x65,0x64,0x20,0x2B,0x20,0x22,0x3A,
+    0x22,0x20,0x2B,0x20,0x67,0x72,0x65,0x65,0x6E,0x20,0x2B,0x20,0x22,0x3A,0x22,0x20,
+    0x2B,0x20,0x62,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3D,
+    0x20,0x6E,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x42,0x75,0x66,0x66,0x65,0x72,
+    0x28,0x34,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,
+    0x74,0x20,0x76,0x69,0x65,0x77,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x55,0x69,0x6E,
+    0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,
+    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,
+    0x5B,0x30,0x5D,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
+    0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x43,0x6F,0x6C,
+    0x6F,0x72,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,
+    0x77,0x5B,0x31,0x5D,0x20,0x3D,0x20,0x72,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x76,0x69,0x65,0x77,0x5B,0x32,0x5D,0x20,0x3D,0x20,0x67,
+    0x72,0x65,0x65,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
+    0x69,0x65,0x77,0x5B,0x33,0x5D,0x20,0x3D,0x20,0x62,0x6C,0x75,0x65,0x3B,0x0D,0x0A,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x73,
+    0x65,0x6E,0x64,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,
+    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,
+    0x73,0x65,0x74,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x20,0x3D,
     0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x61,0x6C,0x75,0x65,0x29,
     0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,
-    0x3A,0x20,0x53,0x65,0x74,0x20,0x46,0x69,0x74,0x6F,0x20,0x3D,0x20,0x22,0x20,0x2B,
-    0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,0x61,0x6C,0x75,0x65,
-    0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,
-    0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x2C,0x20,0x76,0x61,
+    0x3A,0x20,0x53,0x65,0x74,0x20,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,
+    0x74,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,
+    0x65,0x74,0x56,0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x55,
+    0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x2C,0x20,0x76,0x61,0x6C,0x75,
+    0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
+    0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x57,0x68,
+    0x69,0x74,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,
+    0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,
+    0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x57,0x68,0x69,0x74,0x65,
+    0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,
+    0x74,0x56,0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
+    0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x57,0x68,
+    0x69,0x74,0x65,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,
+    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,
+    0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x20,0x3D,0x20,0x66,0x75,
+    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,
+    0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,
+    0x65,0x74,0x20,0x46,0x69,0x74,0x6F,0x20,0x3D,0x20,0x22,0x20,0x2B,0x20,0x76,0x61,
+    0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,
+    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,
+    0x6C,0x2E,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
+    0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x74,0x46,0x61,0x6E,
+    0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x61,0x6C,0x75,
+    0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,
+    0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x46,0x41,0x4E,0x20,0x3D,0x20,0x22,0x20,
+    0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,0x61,0x6C,0x75,
+    0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,0x6F,
+    0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,0x41,0x4E,0x2C,0x20,0x76,0x61,
     0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,
     0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
     0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,0x73,0x65,0x74,
-    0x46,0x61,0x6E,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,
-    0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,
-    0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x65,0x74,0x20,0x46,0x41,0x4E,0x20,0x3D,
-    0x20,0x22,0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,
-    0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x46,0x41,0x4E,0x2C,
-    0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x43,0x6F,0x6E,0x74,0x72,
-    0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x70,0x72,0x6F,0x74,0x6F,0x74,0x79,0x70,0x65,0x2E,
-    0x73,0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x20,0x3D,0x20,
-    0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x61,0x6C,0x75,0x65,0x29,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,
-    0x20,0x53,0x65,0x74,0x20,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x20,
-    0x3D,0x20,0x22,0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,
-    0x56,0x61,0x6C,0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
-    0x2E,0x50,0x72,0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x48,0x75,0x6D,
-    0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,
-    0x2F,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x77,0x73,0x4F,0x70,0x65,0x6E,
-    0x53,0x74,0x72,0x65,0x61,0x6D,0x28,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,
-    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x76,0x61,0x72,0x20,0x75,
-    0x72,0x69,0x20,0x3D,0x20,0x22,0x2F,0x73,0x74,0x72,0x65,0x61,0x6D,0x22,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x76,0x61,0x72,0x20,0x77,0x73,0x20,0x3D,
-    0x20,0x6E,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x28,0x22,
-    0x77,0x73,0x3A,0x2F,0x2F,0x6C,0x6F,0x63,0x61,0x6C,0x68,0x6F,0x73,0x74,0x3A,0x38,
-    0x30,0x38,0x30,0x22,0x29,0x3B,0x20,0x2F,0x2F,0x20,0x2B,0x20,0x6C,0x6F,0x63,0x61,
-    0x74,0x69,0x6F,0x6E,0x2E,0x68,0x6F,0x73,0x74,0x20,0x2B,0x20,0x75,0x72,0x69,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x77,0x73,0x2E,0x6F,0x6E,
-    0x6D,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,
-    0x6F,0x6E,0x28,0x65,0x76,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,
-    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x65,0x76,0x74,0x2E,
-    0x64,0x61,0x74,0x61,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x74,0x61,0x74,0x73,0x20,0x3D,0x20,
-    0x4A,0x53,0x4F,0x4E,0x2E,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x76,0x74,0x2E,0x64,
-    0x61,0x74,0x61,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x73,
-    0x74,0x61,0x74,0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,
-    0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x70,0x74,
-    0x69,0x6D,0x65,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x48,0x54,0x4D,0x4C,0x20,
-    0x3D,0x20,0x73,0x74,0x61,0x74,0x73,0x2E,0x75,0x70,0x74,0x69,0x6D,0x65,0x20,0x2B,
-    0x20,0x27,0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x27,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,
-    0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,
-    0x64,0x28,0x27,0x68,0x65,0x61,0x70,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x48,
-    0x54,0x4D,0x4C,0x20,0x3D,0x20,0x73,0x74,0x61,0x74,0x73,0x2E,0x68,0x65,0x61,0x70,
-    0x20,0x2B,0x20,0x27,0x20,0x62,0x79,0x74,0x65,0x73,0x27,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,
-    0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,
-    0x64,0x28,0x27,0x6C,0x65,0x64,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x48,0x54,
-    0x4D,0x4C,0x20,0x3D,0x20,0x28,0x73,0x74,0x61,0x74,0x73,0x2E,0x6C,0x65,0x64,0x20,
-    0x3D,0x3D,0x20,0x31,0x29,0x20,0x3F,0x20,0x27,0x4F,0x6E,0x27,0x20,0x3A,0x20,0x27,
-    0x4F,0x66,0x66,0x27,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x7D,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x65,0x78,0x70,0x6F,0x72,0x74,0x73,0x2E,0x43,0x6F,0x6E,0x74,0x72,0x6F,
-    0x6C,0x6C,0x65,0x72,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x3B,0x0D,0x0A,0x7D,0x29,0x28,0x74,0x79,0x70,0x65,0x6F,0x66,0x20,0x65,0x78,
-    0x70,0x6F,0x72,0x74,0x73,0x20,0x3D,0x3D,0x3D,0x20,0x27,0x75,0x6E,0x64,0x65,0x66,
-    0x69,0x6E,0x65,0x64,0x27,0x20,0x3F,0x20,0x74,0x68,0x69,0x73,0x20,0x3A,0x20,0x65,
-    0x78,0x70,0x6F,0x72,0x74,0x73,0x29,0x3B,
+    0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x20,0x3D,0x20,0x66,0x75,0x6E,
+    0x63,0x74,0x69,0x6F,0x6E,0x28,0x76,0x61,0x6C,0x75,0x65,0x29,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
+    0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x53,0x3A,0x20,0x53,0x65,
+    0x74,0x20,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x20,0x3D,0x20,0x22,
+    0x20,0x2B,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x2E,0x5F,0x73,0x65,0x74,0x56,0x61,0x6C,
+    0x75,0x65,0x28,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x50,0x72,
+    0x6F,0x74,0x6F,0x63,0x6F,0x6C,0x2E,0x73,0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,
+    0x66,0x69,0x65,0x72,0x2C,0x20,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x66,0x75,
+    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x77,0x73,0x4F,0x70,0x65,0x6E,0x53,0x74,0x72,
+    0x65,0x61,0x6D,0x28,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x7B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x76,0x61,0x72,0x20,0x75,0x72,0x69,0x20,
+    0x3D,0x20,0x22,0x2F,0x73,0x74,0x72,0x65,0x61,0x6D,0x22,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x2F,0x2F,0x20,0x20,0x76,0x61,0x72,0x20,0x77,0x73,0x20,0x3D,0x20,0x6E,0x65,
+    0x77,0x20,0x57,0x65,0x62,0x53,0x6F,0x63,0x6B,0x65,0x74,0x28,0x22,0x77,0x73,0x3A,
+    0x2F,0x2F,0x6C,0x6F,0x63,0x61,0x6C,0x68,0x6F,0x73,0x74,0x3A,0x38,0x30,0x38,0x30,
+    0x22,0x29,0x3B,0x20,0x2F,0x2F,0x20,0x2B,0x20,0x6C,0x6F,0x63,0x61,0x74,0x69,0x6F,
+    0x6E,0x2E,0x68,0x6F,0x73,0x74,0x20,0x2B,0x20,0x75,0x72,0x69,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x77,0x73,0x2E,0x6F,0x6E,0x6D,0x65,0x73,
+    0x73,0x61,0x67,0x65,0x20,0x3D,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x28,
+    0x65,0x76,0x74,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
+    0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x65,0x76,0x74,0x2E,0x64,0x61,0x74,
+    0x61,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x73,0x74,0x61,0x74,0x73,0x20,0x3D,0x20,0x4A,0x53,0x4F,
+    0x4E,0x2E,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x76,0x74,0x2E,0x64,0x61,0x74,0x61,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x73,0x74,0x61,0x74,
+    0x73,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,
+    0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x70,0x74,0x69,0x6D,0x65,
+    0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x48,0x54,0x4D,0x4C,0x20,0x3D,0x20,0x73,
+    0x74,0x61,0x74,0x73,0x2E,0x75,0x70,0x74,0x69,0x6D,0x65,0x20,0x2B,0x20,0x27,0x20,
+    0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x27,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,
+    0x2F,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,
+    0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
+    0x68,0x65,0x61,0x70,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x48,0x54,0x4D,0x4C,
+    0x20,0x3D,0x20,0x73,0x74,0x61,0x74,0x73,0x2E,0x68,0x65,0x61,0x70,0x20,0x2B,0x20,
+    0x27,0x20,0x62,0x79,0x74,0x65,0x73,0x27,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,
+    0x2F,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,
+    0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
+    0x6C,0x65,0x64,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x48,0x54,0x4D,0x4C,0x20,
+    0x3D,0x20,0x28,0x73,0x74,0x61,0x74,0x73,0x2E,0x6C,0x65,0x64,0x20,0x3D,0x3D,0x20,
+    0x31,0x29,0x20,0x3F,0x20,0x27,0x4F,0x6E,0x27,0x20,0x3A,0x20,0x27,0x4F,0x66,0x66,
+    0x27,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x20,0x7D,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x2F,0x2F,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x65,
+    0x78,0x70,0x6F,0x72,0x74,0x73,0x2E,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
+    0x72,0x20,0x3D,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x3B,0x0D,
+    0x0A,0x7D,0x29,0x28,0x74,0x79,0x70,0x65,0x6F,0x66,0x20,0x65,0x78,0x70,0x6F,0x72,
+    0x74,0x73,0x20,0x3D,0x3D,0x3D,0x20,0x27,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,
+    0x64,0x27,0x20,0x3F,0x20,0x74,0x68,0x69,0x73,0x20,0x3A,0x20,0x65,0x78,0x70,0x6F,
+    0x72,0x74,0x73,0x29,0x3B,
 };
 
 static const unsigned char data_js_index_js[] = {
@@ -12949,16 +13346,16 @@ static const unsigned char data_js_index_js[] = {
     0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
     0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
 
-    /* "Content-Length: 8374" (22 chars) */
+    /* "Content-Length: 10369" (23 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
-    0x38,0x33,0x37,0x34,0x0D,0x0A,
+    0x31,0x30,0x33,0x36,0x39,0x0D,0x0A,
 
     /* "Content-Type: application/javascript" (40 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
     0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
     0x72,0x69,0x70,0x74,0x0D,0x0A,0x0D,0x0A,
 
-    /* raw file data (8374 bytes) */
+    /* raw file data (10369 bytes) */
     0x76,0x61,0x72,0x20,0x72,0x67,0x62,0x50,0x69,0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,
     0x6E,0x65,0x77,0x20,0x69,0x72,0x6F,0x2E,0x43,0x6F,0x6C,0x6F,0x72,0x50,0x69,0x63,
     0x6B,0x65,0x72,0x28,0x27,0x23,0x72,0x67,0x62,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,
@@ -12970,519 +13367,644 @@ static const unsigned char data_js_index_js[] = {
     0x69,0x74,0x69,0x61,0x74,0x65,0x64,0x42,0x79,0x55,0x73,0x65,0x72,0x3A,0x20,0x66,
     0x61,0x6C,0x73,0x65,0x2C,0x20,0x6E,0x65,0x65,0x64,0x55,0x69,0x55,0x70,0x64,0x61,
     0x74,0x65,0x3A,0x20,0x66,0x61,0x6C,0x73,0x65,0x2C,0x20,0x77,0x69,0x64,0x74,0x68,
-    0x3A,0x20,0x30,0x7D,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x63,0x68,0x61,0x72,0x74,
-    0x5F,0x74,0x20,0x3D,0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,0x3B,0x0D,
-    0x0A,0x76,0x61,0x72,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x68,0x20,0x3D,0x20,0x75,
-    0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x63,
-    0x68,0x61,0x72,0x74,0x5F,0x70,0x20,0x3D,0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,
-    0x65,0x64,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,
-    0x74,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,
-    0x65,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x73,0x65,0x72,0x69,0x65,
-    0x73,0x5F,0x68,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x54,0x69,0x6D,0x65,0x53,0x65,
-    0x72,0x69,0x65,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x73,0x65,0x72,
-    0x69,0x65,0x73,0x5F,0x70,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x54,0x69,0x6D,0x65,
-    0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x63,
-    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,
-    0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x28,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0D,0x0A,0x77,0x69,0x6E,0x64,0x6F,0x77,0x2E,
-    0x6F,0x6E,0x6C,0x6F,0x61,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x57,0x69,0x6E,0x64,0x6F,
-    0x77,0x4C,0x6F,0x61,0x64,0x3B,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,
-    0x6F,0x6E,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x43,0x68,0x61,0x72,0x74,0x73,0x28,
-    0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x67,0x72,
-    0x69,0x64,0x20,0x3D,0x20,0x7B,0x66,0x69,0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,
-    0x20,0x27,0x23,0x66,0x66,0x66,0x66,0x66,0x66,0x27,0x2C,0x20,0x73,0x74,0x72,0x6F,
-    0x6B,0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x64,0x34,0x64,0x34,0x64,
-    0x34,0x27,0x2C,0x20,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6C,0x53,0x65,0x63,0x74,
-    0x69,0x6F,0x6E,0x73,0x3A,0x20,0x34,0x2C,0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,
-    0x65,0x72,0x4C,0x69,0x6E,0x65,0x3A,0x20,0x31,0x30,0x30,0x30,0x2C,0x20,0x6C,0x69,
-    0x6E,0x65,0x57,0x69,0x64,0x74,0x68,0x3A,0x20,0x31,0x7D,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x20,0x3D,0x20,0x7B,
-    0x66,0x69,0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x30,0x30,0x30,
-    0x30,0x30,0x30,0x27,0x2C,0x20,0x66,0x6F,0x6E,0x74,0x53,0x69,0x7A,0x65,0x3A,0x20,
-    0x31,0x31,0x2C,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3A,0x20,0x30,
-    0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,0x6F,0x6F,0x6C,
-    0x74,0x69,0x70,0x20,0x3D,0x20,0x7B,0x73,0x74,0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,
-    0x6C,0x65,0x3A,0x20,0x27,0x23,0x62,0x62,0x62,0x62,0x62,0x62,0x27,0x7D,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,
-    0x6C,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,
-    0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,
-    0x65,0x64,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,
-    0x5F,0x74,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,
-    0x65,0x43,0x68,0x61,0x72,0x74,0x28,0x7B,0x67,0x72,0x69,0x64,0x3A,0x20,0x67,0x72,
-    0x69,0x64,0x2C,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x3A,0x20,0x6C,0x61,0x62,0x65,
-    0x6C,0x73,0x2C,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x4C,0x69,0x6E,0x65,0x3A,
-    0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x3A,0x20,0x30,0x7D,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x65,0x76,0x65,0x6E,0x74,
+    0x73,0x20,0x3D,0x20,0x7B,0x73,0x65,0x71,0x75,0x65,0x6E,0x63,0x65,0x3A,0x20,0x30,
+    0x2C,0x20,0x6C,0x69,0x6E,0x65,0x73,0x3A,0x20,0x5B,0x5D,0x7D,0x3B,0x0D,0x0A,0x76,
+    0x61,0x72,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x74,0x20,0x3D,0x20,0x75,0x6E,0x64,
+    0x65,0x66,0x69,0x6E,0x65,0x64,0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x63,0x68,0x61,
+    0x72,0x74,0x5F,0x68,0x20,0x3D,0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,
+    0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x70,0x20,0x3D,
+    0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,0x3B,0x0D,0x0A,0x76,0x61,0x72,
+    0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x74,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,
+    0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x76,
+    0x61,0x72,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x68,0x20,0x3D,0x20,0x6E,0x65,
+    0x77,0x20,0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x29,0x3B,0x0D,
+    0x0A,0x76,0x61,0x72,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x70,0x20,0x3D,0x20,
+    0x6E,0x65,0x77,0x20,0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x29,
+    0x3B,0x0D,0x0A,0x76,0x61,0x72,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
+    0x72,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
+    0x65,0x72,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0D,
+    0x0A,0x77,0x69,0x6E,0x64,0x6F,0x77,0x2E,0x6F,0x6E,0x6C,0x6F,0x61,0x64,0x20,0x3D,
+    0x20,0x6F,0x6E,0x57,0x69,0x6E,0x64,0x6F,0x77,0x4C,0x6F,0x61,0x64,0x3B,0x0D,0x0A,
+    0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x63,0x72,0x65,0x61,0x74,
+    0x65,0x43,0x68,0x61,0x72,0x74,0x73,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x6C,0x65,0x74,0x20,0x67,0x72,0x69,0x64,0x20,0x3D,0x20,0x7B,0x66,0x69,
+    0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x66,0x66,0x66,0x66,0x66,
+    0x66,0x27,0x2C,0x20,0x73,0x74,0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,
+    0x20,0x27,0x23,0x64,0x34,0x64,0x34,0x64,0x34,0x27,0x2C,0x20,0x76,0x65,0x72,0x74,
+    0x69,0x63,0x61,0x6C,0x53,0x65,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3A,0x20,0x34,0x2C,
+    0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x4C,0x69,0x6E,0x65,0x3A,0x20,
+    0x31,0x30,0x30,0x30,0x2C,0x20,0x6C,0x69,0x6E,0x65,0x57,0x69,0x64,0x74,0x68,0x3A,
+    0x20,0x31,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x61,
+    0x62,0x65,0x6C,0x73,0x20,0x3D,0x20,0x7B,0x66,0x69,0x6C,0x6C,0x53,0x74,0x79,0x6C,
+    0x65,0x3A,0x20,0x27,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x27,0x2C,0x20,0x66,0x6F,
+    0x6E,0x74,0x53,0x69,0x7A,0x65,0x3A,0x20,0x31,0x31,0x2C,0x20,0x70,0x72,0x65,0x63,
+    0x69,0x73,0x69,0x6F,0x6E,0x3A,0x20,0x30,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x6C,0x65,0x74,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x20,0x3D,0x20,0x7B,0x73,
+    0x74,0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x62,0x62,
+    0x62,0x62,0x62,0x62,0x27,0x7D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,
+    0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,
+    0x20,0x75,0x6E,0x64,0x65,0x66,0x69,0x6E,0x65,0x64,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x74,0x20,0x3D,0x20,0x6E,0x65,0x77,
+    0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x43,0x68,0x61,0x72,0x74,0x28,0x7B,
+    0x67,0x72,0x69,0x64,0x3A,0x20,0x67,0x72,0x69,0x64,0x2C,0x20,0x6C,0x61,0x62,0x65,
+    0x6C,0x73,0x3A,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x2C,0x20,0x74,0x6F,0x6F,0x6C,
+    0x74,0x69,0x70,0x4C,0x69,0x6E,0x65,0x3A,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,
+    0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x61,0x78,0x56,
-    0x61,0x6C,0x75,0x65,0x3A,0x20,0x34,0x30,0x2C,0x20,0x6D,0x69,0x6E,0x56,0x61,0x6C,
-    0x75,0x65,0x3A,0x20,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6D,0x61,0x78,0x56,0x61,0x6C,0x75,0x65,0x3A,0x20,0x34,0x30,
+    0x2C,0x20,0x6D,0x69,0x6E,0x56,0x61,0x6C,0x75,0x65,0x3A,0x20,0x30,0x2C,0x0D,0x0A,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6E,0x6F,0x6E,0x52,0x65,0x61,0x6C,
-    0x74,0x69,0x6D,0x65,0x44,0x61,0x74,0x61,0x3A,0x20,0x74,0x72,0x75,0x65,0x2C,0x20,
-    0x69,0x6E,0x74,0x65,0x72,0x70,0x6F,0x6C,0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x27,
-    0x62,0x65,0x7A,0x69,0x65,0x72,0x27,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x69,0x6C,0x6C,0x69,
-    0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x3A,0x20,0x35,0x36,0x2C,0x0D,0x0A,
+    0x20,0x6E,0x6F,0x6E,0x52,0x65,0x61,0x6C,0x74,0x69,0x6D,0x65,0x44,0x61,0x74,0x61,
+    0x3A,0x20,0x74,0x72,0x75,0x65,0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x70,0x6F,0x6C,
+    0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x27,0x62,0x65,0x7A,0x69,0x65,0x72,0x27,0x2C,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,
+    0x6C,0x3A,0x20,0x35,0x36,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x72,0x65,0x73,0x70,0x6F,0x6E,0x73,0x69,0x76,0x65,0x3A,0x20,0x74,0x72,0x75,
-    0x65,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,
-    0x68,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,
-    0x43,0x68,0x61,0x72,0x74,0x28,0x7B,0x67,0x72,0x69,0x64,0x3A,0x20,0x67,0x72,0x69,
-    0x64,0x2C,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x3A,0x20,0x6C,0x61,0x62,0x65,0x6C,
-    0x73,0x2C,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x4C,0x69,0x6E,0x65,0x3A,0x20,
-    0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x70,0x6F,0x6E,0x73,
+    0x69,0x76,0x65,0x3A,0x20,0x74,0x72,0x75,0x65,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x68,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,
+    0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x43,0x68,0x61,0x72,0x74,0x28,0x7B,0x67,
+    0x72,0x69,0x64,0x3A,0x20,0x67,0x72,0x69,0x64,0x2C,0x20,0x6C,0x61,0x62,0x65,0x6C,
+    0x73,0x3A,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x2C,0x20,0x74,0x6F,0x6F,0x6C,0x74,
+    0x69,0x70,0x4C,0x69,0x6E,0x65,0x3A,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x2C,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x61,0x78,0x56,0x61,
-    0x6C,0x75,0x65,0x3A,0x20,0x31,0x30,0x30,0x2C,0x20,0x6D,0x69,0x6E,0x56,0x61,0x6C,
-    0x75,0x65,0x3A,0x20,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6D,0x61,0x78,0x56,0x61,0x6C,0x75,0x65,0x3A,0x20,0x31,0x30,0x30,
+    0x2C,0x20,0x6D,0x69,0x6E,0x56,0x61,0x6C,0x75,0x65,0x3A,0x20,0x30,0x2C,0x0D,0x0A,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6E,0x6F,0x6E,0x52,0x65,0x61,0x6C,
-    0x74,0x69,0x6D,0x65,0x44,0x61,0x74,0x61,0x3A,0x20,0x74,0x72,0x75,0x65,0x2C,0x20,
-    0x69,0x6E,0x74,0x65,0x72,0x70,0x6F,0x6C,0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x27,
-    0x62,0x65,0x7A,0x69,0x65,0x72,0x27,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x69,0x6C,0x6C,0x69,
-    0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x3A,0x20,0x35,0x36,0x2C,0x0D,0x0A,
+    0x20,0x6E,0x6F,0x6E,0x52,0x65,0x61,0x6C,0x74,0x69,0x6D,0x65,0x44,0x61,0x74,0x61,
+    0x3A,0x20,0x74,0x72,0x75,0x65,0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x70,0x6F,0x6C,
+    0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x27,0x62,0x65,0x7A,0x69,0x65,0x72,0x27,0x2C,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,
+    0x6C,0x3A,0x20,0x35,0x36,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x72,0x65,0x73,0x70,0x6F,0x6E,0x73,0x69,0x76,0x65,0x3A,0x20,0x74,0x72,0x75,
-    0x65,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,
-    0x70,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,
-    0x43,0x68,0x61,0x72,0x74,0x28,0x7B,0x67,0x72,0x69,0x64,0x3A,0x20,0x67,0x72,0x69,
-    0x64,0x2C,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x3A,0x20,0x6C,0x61,0x62,0x65,0x6C,
-    0x73,0x2C,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x4C,0x69,0x6E,0x65,0x3A,0x20,
-    0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x70,0x6F,0x6E,0x73,
+    0x69,0x76,0x65,0x3A,0x20,0x74,0x72,0x75,0x65,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x70,0x20,0x3D,0x20,0x6E,0x65,0x77,0x20,
+    0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x43,0x68,0x61,0x72,0x74,0x28,0x7B,0x67,
+    0x72,0x69,0x64,0x3A,0x20,0x67,0x72,0x69,0x64,0x2C,0x20,0x6C,0x61,0x62,0x65,0x6C,
+    0x73,0x3A,0x20,0x6C,0x61,0x62,0x65,0x6C,0x73,0x2C,0x20,0x74,0x6F,0x6F,0x6C,0x74,
+    0x69,0x70,0x4C,0x69,0x6E,0x65,0x3A,0x20,0x74,0x6F,0x6F,0x6C,0x74,0x69,0x70,0x2C,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x61,0x78,0x56,0x61,
-    0x6C,0x75,0x65,0x3A,0x20,0x31,0x31,0x30,0x2C,0x20,0x6D,0x69,0x6E,0x56,0x61,0x6C,
-    0x75,0x65,0x3A,0x20,0x39,0x30,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6D,0x61,0x78,0x56,0x61,0x6C,0x75,0x65,0x3A,0x20,0x31,0x31,0x30,
+    0x2C,0x20,0x6D,0x69,0x6E,0x56,0x61,0x6C,0x75,0x65,0x3A,0x20,0x39,0x30,0x2C,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6E,0x6F,0x6E,0x52,0x65,0x61,
-    0x6C,0x74,0x69,0x6D,0x65,0x44,0x61,0x74,0x61,0x3A,0x20,0x74,0x72,0x75,0x65,0x2C,
-    0x20,0x69,0x6E,0x74,0x65,0x72,0x70,0x6F,0x6C,0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,
-    0x27,0x62,0x65,0x7A,0x69,0x65,0x72,0x27,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6E,0x6F,0x6E,0x52,0x65,0x61,0x6C,0x74,0x69,0x6D,0x65,0x44,0x61,0x74,
+    0x61,0x3A,0x20,0x74,0x72,0x75,0x65,0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x70,0x6F,
+    0x6C,0x61,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x27,0x62,0x65,0x7A,0x69,0x65,0x72,0x27,
+    0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x69,0x6C,0x6C,
-    0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x3A,0x20,0x35,0x36,0x2C,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,
+    0x65,0x6C,0x3A,0x20,0x35,0x36,0x2C,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x72,0x65,0x73,0x70,0x6F,0x6E,0x73,0x69,0x76,0x65,0x3A,0x20,0x74,0x72,
-    0x75,0x65,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,
-    0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,
-    0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x74,0x2E,0x61,0x64,0x64,0x54,0x69,
-    0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,
-    0x74,0x2C,0x20,0x7B,0x6C,0x69,0x6E,0x65,0x57,0x69,0x64,0x74,0x68,0x3A,0x20,0x32,
-    0x2C,0x20,0x73,0x74,0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,
-    0x23,0x63,0x63,0x38,0x62,0x30,0x30,0x27,0x2C,0x20,0x66,0x69,0x6C,0x6C,0x53,0x74,
-    0x79,0x6C,0x65,0x3A,0x20,0x27,0x72,0x67,0x62,0x61,0x28,0x32,0x30,0x34,0x2C,0x31,
-    0x33,0x39,0x2C,0x30,0x2C,0x30,0x2E,0x31,0x38,0x29,0x27,0x7D,0x29,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x74,0x2E,0x73,0x74,0x72,0x65,
-    0x61,0x6D,0x54,0x6F,0x28,0x63,0x61,0x6E,0x76,0x61,0x73,0x2C,0x20,0x69,0x6E,0x74,
-    0x65,0x72,0x76,0x61,0x6C,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x61,0x6E,
-    0x76,0x61,0x73,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
-    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,
-    0x68,0x61,0x72,0x74,0x2D,0x68,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
-    0x68,0x61,0x72,0x74,0x5F,0x68,0x2E,0x61,0x64,0x64,0x54,0x69,0x6D,0x65,0x53,0x65,
-    0x72,0x69,0x65,0x73,0x28,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x68,0x2C,0x20,0x7B,
-    0x6C,0x69,0x6E,0x65,0x57,0x69,0x64,0x74,0x68,0x3A,0x20,0x32,0x2C,0x20,0x73,0x74,
-    0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x37,0x35,0x34,
-    0x32,0x66,0x66,0x27,0x2C,0x20,0x66,0x69,0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,
-    0x20,0x27,0x72,0x67,0x62,0x61,0x28,0x31,0x31,0x37,0x2C,0x36,0x36,0x2C,0x32,0x35,
-    0x35,0x2C,0x30,0x2E,0x31,0x38,0x29,0x27,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x68,0x2E,0x73,0x74,0x72,0x65,0x61,0x6D,0x54,
-    0x6F,0x28,0x63,0x61,0x6E,0x76,0x61,0x73,0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,
-    0x61,0x6C,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,
-    0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,
-    0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,
-    0x74,0x2D,0x70,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,
-    0x74,0x5F,0x70,0x2E,0x61,0x64,0x64,0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,
-    0x73,0x28,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x70,0x2C,0x20,0x7B,0x6C,0x69,0x6E,
-    0x65,0x57,0x69,0x64,0x74,0x68,0x3A,0x20,0x32,0x2C,0x20,0x73,0x74,0x72,0x6F,0x6B,
-    0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x30,0x31,0x61,0x32,0x30,0x31,
-    0x27,0x2C,0x20,0x66,0x69,0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x72,
-    0x67,0x62,0x61,0x28,0x30,0x2C,0x31,0x36,0x33,0x2C,0x30,0x2C,0x30,0x2E,0x31,0x38,
-    0x29,0x27,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,
-    0x5F,0x70,0x2E,0x73,0x74,0x72,0x65,0x61,0x6D,0x54,0x6F,0x28,0x63,0x61,0x6E,0x76,
-    0x61,0x73,0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x29,0x3B,0x0D,0x0A,
-    0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,
-    0x57,0x69,0x6E,0x64,0x6F,0x77,0x4C,0x6F,0x61,0x64,0x28,0x29,0x0D,0x0A,0x7B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,
-    0x28,0x22,0x57,0x69,0x6E,0x64,0x6F,0x77,0x20,0x6C,0x6F,0x61,0x64,0x65,0x64,0x22,
-    0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x72,0x67,0x62,0x50,0x69,0x63,
-    0x6B,0x65,0x72,0x2E,0x6F,0x6E,0x28,0x27,0x69,0x6E,0x70,0x75,0x74,0x3A,0x73,0x74,
-    0x61,0x72,0x74,0x27,0x2C,0x20,0x6F,0x6E,0x53,0x74,0x61,0x72,0x74,0x43,0x6F,0x6C,
-    0x6F,0x72,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x72,0x67,0x62,0x50,0x69,0x63,0x6B,0x65,0x72,0x2E,0x6F,0x6E,0x28,0x27,0x69,0x6E,
-    0x70,0x75,0x74,0x3A,0x65,0x6E,0x64,0x27,0x2C,0x20,0x6F,0x6E,0x45,0x6E,0x64,0x43,
-    0x6F,0x6C,0x6F,0x72,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,
-    0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,
-    0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,
-    0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,
-    0x6E,0x65,0x72,0x28,0x22,0x63,0x68,0x61,0x6E,0x67,0x65,0x22,0x2C,0x20,0x6F,0x6E,
-    0x55,0x76,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,
-    0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x69,0x6E,0x70,0x75,
-    0x74,0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x70,0x6F,0x6E,
+    0x73,0x69,0x76,0x65,0x3A,0x20,0x74,0x72,0x75,0x65,0x7D,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,
+    0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,
+    0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,
+    0x2D,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,
+    0x5F,0x74,0x2E,0x61,0x64,0x64,0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,
+    0x28,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x74,0x2C,0x20,0x7B,0x6C,0x69,0x6E,0x65,
+    0x57,0x69,0x64,0x74,0x68,0x3A,0x20,0x32,0x2C,0x20,0x73,0x74,0x72,0x6F,0x6B,0x65,
+    0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x23,0x63,0x63,0x38,0x62,0x30,0x30,0x27,
+    0x2C,0x20,0x66,0x69,0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x72,0x67,
+    0x62,0x61,0x28,0x32,0x30,0x34,0x2C,0x31,0x33,0x39,0x2C,0x30,0x2C,0x30,0x2E,0x31,
+    0x38,0x29,0x27,0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,
+    0x74,0x5F,0x74,0x2E,0x73,0x74,0x72,0x65,0x61,0x6D,0x54,0x6F,0x28,0x63,0x61,0x6E,
+    0x76,0x61,0x73,0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,0x20,0x64,0x6F,
     0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,
-    0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,
-    0x72,0x28,0x22,0x63,0x68,0x61,0x6E,0x67,0x65,0x22,0x2C,0x20,0x6F,0x6E,0x57,0x43,
-    0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x77,0x5F,0x70,
-    0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,
-    0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,0x20,
-    0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,
-    0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,
-    0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,
-    0x42,0x79,0x49,0x64,0x28,0x27,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,
-    0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x69,0x74,0x6F,0x5F,0x70,
+    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x68,0x22,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x68,0x2E,0x61,
+    0x64,0x64,0x54,0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x73,0x65,0x72,
+    0x69,0x65,0x73,0x5F,0x68,0x2C,0x20,0x7B,0x6C,0x69,0x6E,0x65,0x57,0x69,0x64,0x74,
+    0x68,0x3A,0x20,0x32,0x2C,0x20,0x73,0x74,0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,0x6C,
+    0x65,0x3A,0x20,0x27,0x23,0x37,0x35,0x34,0x32,0x66,0x66,0x27,0x2C,0x20,0x66,0x69,
+    0x6C,0x6C,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x72,0x67,0x62,0x61,0x28,0x31,
+    0x31,0x37,0x2C,0x36,0x36,0x2C,0x32,0x35,0x35,0x2C,0x30,0x2E,0x31,0x38,0x29,0x27,
+    0x7D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x68,
+    0x2E,0x73,0x74,0x72,0x65,0x61,0x6D,0x54,0x6F,0x28,0x63,0x61,0x6E,0x76,0x61,0x73,
+    0x2C,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,
+    0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,
+    0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x70,0x22,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x70,0x2E,0x61,0x64,0x64,0x54,
+    0x69,0x6D,0x65,0x53,0x65,0x72,0x69,0x65,0x73,0x28,0x73,0x65,0x72,0x69,0x65,0x73,
+    0x5F,0x70,0x2C,0x20,0x7B,0x6C,0x69,0x6E,0x65,0x57,0x69,0x64,0x74,0x68,0x3A,0x20,
+    0x32,0x2C,0x20,0x73,0x74,0x72,0x6F,0x6B,0x65,0x53,0x74,0x79,0x6C,0x65,0x3A,0x20,
+    0x27,0x23,0x30,0x31,0x61,0x32,0x30,0x31,0x27,0x2C,0x20,0x66,0x69,0x6C,0x6C,0x53,
+    0x74,0x79,0x6C,0x65,0x3A,0x20,0x27,0x72,0x67,0x62,0x61,0x28,0x30,0x2C,0x31,0x36,
+    0x33,0x2C,0x30,0x2C,0x30,0x2E,0x31,0x38,0x29,0x27,0x7D,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x70,0x2E,0x73,0x74,0x72,0x65,0x61,
+    0x6D,0x54,0x6F,0x28,0x63,0x61,0x6E,0x76,0x61,0x73,0x2C,0x20,0x69,0x6E,0x74,0x65,
+    0x72,0x76,0x61,0x6C,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,
+    0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x57,0x69,0x6E,0x64,0x6F,0x77,0x4C,0x6F,
+    0x61,0x64,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
+    0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x57,0x69,0x6E,0x64,0x6F,0x77,
+    0x20,0x6C,0x6F,0x61,0x64,0x65,0x64,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x72,0x67,0x62,0x50,0x69,0x63,0x6B,0x65,0x72,0x2E,0x6F,0x6E,0x28,0x27,
+    0x69,0x6E,0x70,0x75,0x74,0x3A,0x73,0x74,0x61,0x72,0x74,0x27,0x2C,0x20,0x6F,0x6E,
+    0x53,0x74,0x61,0x72,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x43,0x68,0x61,0x6E,0x67,0x65,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x72,0x67,0x62,0x50,0x69,0x63,0x6B,0x65,
+    0x72,0x2E,0x6F,0x6E,0x28,0x27,0x69,0x6E,0x70,0x75,0x74,0x3A,0x65,0x6E,0x64,0x27,
+    0x2C,0x20,0x6F,0x6E,0x45,0x6E,0x64,0x43,0x6F,0x6C,0x6F,0x72,0x43,0x68,0x61,0x6E,
+    0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x76,0x5F,0x70,0x69,0x63,
+    0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,
+    0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,
+    0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x63,0x68,0x61,
+    0x6E,0x67,0x65,0x22,0x2C,0x20,0x6F,0x6E,0x55,0x76,0x43,0x68,0x61,0x6E,0x67,0x65,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,
+    0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,
+    0x65,0x72,0x28,0x22,0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,
+    0x70,0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x77,0x5F,0x70,0x69,0x63,
+    0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x77,
+    0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,
+    0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x63,0x68,0x61,0x6E,0x67,
+    0x65,0x22,0x2C,0x20,0x6F,0x6E,0x57,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,
+    0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,
+    0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,
+    0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,
+    0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x66,0x69,
+    0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,
+    0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,
+    0x63,0x68,0x61,0x6E,0x67,0x65,0x22,0x2C,0x20,0x6F,0x6E,0x46,0x69,0x74,0x6F,0x43,
+    0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x69,0x74,
+    0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,
+    0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x69,0x6E,0x70,0x75,0x74,
+    0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,
+    0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,
+    0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,
+    0x65,0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x61,0x6E,0x5F,0x70,
     0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,
     0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x63,0x68,0x61,0x6E,0x67,0x65,0x22,0x2C,
-    0x20,0x6F,0x6E,0x46,0x69,0x74,0x6F,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,
-    0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,
-    0x72,0x28,0x22,0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,
-    0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x61,0x6E,0x5F,0x70,0x69,
-    0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,
-    0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
-    0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,
-    0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,
-    0x63,0x68,0x61,0x6E,0x67,0x65,0x22,0x2C,0x20,0x6F,0x6E,0x46,0x61,0x6E,0x43,0x68,
-    0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x61,0x6E,0x5F,
-    0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,
-    0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,
-    0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,
-    0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x27,0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,
-    0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,
-    0x72,0x28,0x22,0x63,0x68,0x61,0x6E,0x67,0x65,0x22,0x2C,0x20,0x6F,0x6E,0x48,0x66,
-    0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x68,0x66,
-    0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,
-    0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x69,0x6E,0x70,0x75,0x74,0x22,
-    0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x3D,0x20,0x64,0x6F,
-    0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,
-    0x68,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,
-    0x69,0x74,0x63,0x68,0x2E,0x6F,0x6E,0x63,0x6C,0x69,0x63,0x6B,0x20,0x3D,0x20,0x6F,
-    0x6E,0x53,0x75,0x6E,0x53,0x77,0x69,0x74,0x63,0x68,0x43,0x6C,0x69,0x63,0x6B,0x3B,
-    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x43,0x68,
-    0x61,0x72,0x74,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x42,0x65,0x66,0x6F,
-    0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x20,0x3D,0x20,0x6F,0x6E,0x42,0x65,
-    0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x43,
-    0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x43,0x6F,0x6E,
-    0x6E,0x65,0x63,0x74,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
-    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x54,0x69,0x6D,0x65,0x6F,0x75,
-    0x74,0x20,0x3D,0x20,0x6F,0x6E,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,
-    0x6E,0x45,0x72,0x72,0x6F,0x72,0x20,0x3D,0x20,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,
-    0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,
-    0x20,0x3D,0x20,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,
-    0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,
-    0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
-    0x65,0x72,0x2E,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,
-    0x76,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,
-    0x63,0x65,0x69,0x76,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
-    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,
-    0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,
-    0x64,0x20,0x3D,0x20,0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,
-    0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,
-    0x6E,0x44,0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x20,0x3D,0x20,
-    0x6F,0x6E,0x44,0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x3B,0x0D,
+    0x20,0x6F,0x6E,0x46,0x61,0x6E,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,
+    0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,
+    0x22,0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,
+    0x72,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,
+    0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x68,0x66,0x5F,
+    0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x68,
+    0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,0x61,0x64,0x64,0x45,0x76,0x65,0x6E,
+    0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,0x28,0x22,0x63,0x68,0x61,0x6E,0x67,
+    0x65,0x22,0x2C,0x20,0x6F,0x6E,0x48,0x66,0x43,0x68,0x61,0x6E,0x67,0x65,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x2E,
+    0x61,0x64,0x64,0x45,0x76,0x65,0x6E,0x74,0x4C,0x69,0x73,0x74,0x65,0x6E,0x65,0x72,
+    0x28,0x22,0x69,0x6E,0x70,0x75,0x74,0x22,0x2C,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,
+    0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,
+    0x74,0x63,0x68,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,
+    0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x2E,0x6F,0x6E,0x63,
+    0x6C,0x69,0x63,0x6B,0x20,0x3D,0x20,0x6F,0x6E,0x53,0x75,0x6E,0x53,0x77,0x69,0x74,
+    0x63,0x68,0x43,0x6C,0x69,0x63,0x6B,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x63,0x72,0x65,0x61,0x74,0x65,0x43,0x68,0x61,0x72,0x74,0x73,0x28,0x29,0x3B,0x0D,
+    0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
+    0x72,0x2E,0x6F,0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,
+    0x74,0x20,0x3D,0x20,0x6F,0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,
+    0x65,0x63,0x74,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,
+    0x20,0x3D,0x20,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x3B,0x0D,
     0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
-    0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x28,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x49,0x64,0x20,0x3D,0x20,0x73,
-    0x65,0x74,0x49,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x28,0x67,0x65,0x74,0x53,0x74,
-    0x61,0x74,0x75,0x73,0x2C,0x20,0x31,0x30,0x30,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x6C,0x74,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,
-    0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
-    0x6C,0x74,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x74,0x2E,0x69,0x6E,
-    0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x22,0x32,0x34,0x2E,0x34,0x20,
-    0x5C,0x78,0x42,0x30,0x22,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6D,0x6F,
-    0x64,0x65,0x2E,0x77,0x69,0x64,0x74,0x68,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,
-    0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,0x22,0x29,0x2E,0x77,0x69,
-    0x64,0x74,0x68,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,
-    0x69,0x6F,0x6E,0x20,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x0D,
-    0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,
-    0x65,0x72,0x2E,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3B,0x0D,
-    0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x75,
-    0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x63,
-    0x6C,0x73,0x2C,0x20,0x74,0x65,0x78,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x73,0x62,0x6F,0x78,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,
+    0x6F,0x6E,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,0x20,0x3D,0x20,0x6F,0x6E,0x54,0x69,
+    0x6D,0x65,0x6F,0x75,0x74,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x20,0x3D,
+    0x20,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
+    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,
+    0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,
+    0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x43,0x6F,0x6E,
+    0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,
+    0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x53,0x74,0x61,
+    0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,
+    0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
+    0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,
+    0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x44,0x61,
+    0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,
+    0x65,0x69,0x76,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,
+    0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x45,0x76,0x65,0x6E,0x74,0x73,0x52,
+    0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x45,0x76,0x65,0x6E,
+    0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x6F,0x6E,0x44,0x69,
+    0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x20,0x3D,0x20,0x6F,0x6E,0x44,
+    0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x63,0x6F,0x6E,
+    0x6E,0x65,0x63,0x74,0x28,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,
+    0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x49,0x64,0x20,0x3D,0x20,0x73,0x65,0x74,0x49,
+    0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x28,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,
+    0x73,0x2C,0x20,0x31,0x30,0x30,0x30,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,
+    0x74,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,
+    0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x6C,0x74,0x27,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x74,0x2E,0x69,0x6E,0x6E,0x65,0x72,
+    0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x22,0x32,0x34,0x2E,0x34,0x20,0x5C,0x78,0x42,
+    0x30,0x22,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,
+    0x77,0x69,0x64,0x74,0x68,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,
+    0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,
+    0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,0x22,0x29,0x2E,0x77,0x69,0x64,0x74,0x68,
+    0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
+    0x20,0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x0D,0x0A,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,
+    0x67,0x65,0x74,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,
+    0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x75,0x70,0x64,0x61,
+    0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x63,0x6C,0x73,0x2C,
+    0x20,0x74,0x65,0x78,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,
+    0x62,0x6F,0x78,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,
+    0x74,0x61,0x74,0x75,0x73,0x5F,0x62,0x6F,0x78,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x73,0x62,0x6F,0x78,0x2E,0x63,0x6C,0x61,0x73,0x73,0x4E,0x61,0x6D,0x65,
+    0x20,0x3D,0x20,0x22,0x61,0x6C,0x65,0x72,0x74,0x20,0x69,0x73,0x2D,0x22,0x20,0x2B,
+    0x20,0x63,0x6C,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x6C,0x61,0x62,0x65,
+    0x6C,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,
+    0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x74,0x61,
+    0x74,0x75,0x73,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x6C,0x61,0x62,
+    0x65,0x6C,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x74,
+    0x65,0x78,0x74,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,
+    0x69,0x6F,0x6E,0x20,0x75,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x63,0x6F,0x6C,
+    0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,0x69,0x74,0x6F,0x2C,
+    0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x72,0x67,0x62,0x50,0x69,0x63,0x6B,0x65,0x72,0x2E,0x63,0x6F,0x6C,0x6F,
+    0x72,0x2E,0x73,0x65,0x74,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,
+    0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x76,0x5F,0x70,
+    0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,
+    0x75,0x76,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,
     0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,
-    0x28,0x27,0x73,0x74,0x61,0x74,0x75,0x73,0x5F,0x62,0x6F,0x78,0x27,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x73,0x62,0x6F,0x78,0x2E,0x63,0x6C,0x61,0x73,0x73,0x4E,
-    0x61,0x6D,0x65,0x20,0x3D,0x20,0x22,0x61,0x6C,0x65,0x72,0x74,0x20,0x69,0x73,0x2D,
-    0x22,0x20,0x2B,0x20,0x63,0x6C,0x73,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x6C,
-    0x61,0x62,0x65,0x6C,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,
+    0x28,0x27,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,
+    0x75,0x65,0x20,0x3D,0x20,0x77,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,
+    0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,
+    0x42,0x79,0x49,0x64,0x28,0x27,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,0x63,0x6B,0x65,
+    0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x66,0x69,0x74,0x6F,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,
     0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
-    0x73,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,
-    0x6C,0x61,0x62,0x65,0x6C,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-    0x3D,0x20,0x74,0x65,0x78,0x74,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,
-    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x75,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x28,
-    0x63,0x6F,0x6C,0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,0x69,
-    0x74,0x6F,0x2C,0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x29,0x0D,0x0A,0x7B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x72,0x67,0x62,0x50,0x69,0x63,0x6B,0x65,0x72,0x2E,0x63,
-    0x6F,0x6C,0x6F,0x72,0x2E,0x73,0x65,0x74,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x29,0x3B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
-    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,
-    0x76,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,0x75,0x65,
-    0x20,0x3D,0x20,0x75,0x76,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,
-    0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x27,0x77,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,
-    0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x77,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,
-    0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x66,0x69,0x74,0x6F,0x5F,0x70,0x69,
-    0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x66,
-    0x69,0x74,0x6F,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,
-    0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,
-    0x64,0x28,0x27,0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,
-    0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x66,0x61,0x6E,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,
-    0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x68,0x66,0x5F,0x70,0x69,
-    0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x68,
-    0x66,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,
-    0x6E,0x20,0x6F,0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,
-    0x74,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,
-    0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x73,0x65,0x63,
-    0x6F,0x6E,0x64,0x61,0x72,0x79,0x22,0x2C,0x20,0x22,0x43,0x6F,0x6E,0x6E,0x65,0x63,
-    0x74,0x69,0x6E,0x67,0x2E,0x2E,0x2E,0x22,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,
-    0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,
-    0x65,0x63,0x74,0x65,0x64,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,
-    0x73,0x42,0x6F,0x78,0x28,0x22,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x22,0x2C,0x20,
-    0x22,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x3B,0x0D,0x0A,0x7D,
-    0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x54,
-    0x69,0x6D,0x65,0x6F,0x75,0x74,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,
-    0x28,0x22,0x64,0x61,0x6E,0x67,0x65,0x72,0x22,0x2C,0x20,0x22,0x54,0x69,0x6D,0x65,
-    0x6F,0x75,0x74,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,
-    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x28,0x29,
+    0x66,0x61,0x6E,0x5F,0x70,0x69,0x63,0x6B,0x65,0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,
+    0x75,0x65,0x20,0x3D,0x20,0x66,0x61,0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,
+    0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,
+    0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x68,0x66,0x5F,0x70,0x69,0x63,0x6B,0x65,
+    0x72,0x27,0x29,0x2E,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x68,0x66,0x3B,0x0D,
+    0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,
+    0x6E,0x42,0x65,0x66,0x6F,0x72,0x65,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x28,0x29,
     0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,
-    0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x64,0x61,0x6E,0x67,0x65,0x72,
-    0x22,0x2C,0x20,0x22,0x45,0x72,0x72,0x6F,0x72,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x7D,
-    0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x44,
-    0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x0D,0x0A,0x7B,
+    0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x73,0x65,0x63,0x6F,0x6E,0x64,
+    0x61,0x72,0x79,0x22,0x2C,0x20,0x22,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6E,
+    0x67,0x2E,0x2E,0x2E,0x22,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,
+    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,
+    0x65,0x64,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,
+    0x78,0x28,0x22,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x22,0x2C,0x20,0x22,0x43,0x6F,
+    0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,
+    0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x54,0x69,0x6D,0x65,
+    0x6F,0x75,0x74,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x70,
+    0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x64,
+    0x61,0x6E,0x67,0x65,0x72,0x22,0x2C,0x20,0x22,0x54,0x69,0x6D,0x65,0x6F,0x75,0x74,
+    0x21,0x22,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,
+    0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x45,0x72,0x72,0x6F,0x72,0x28,0x29,0x0D,0x0A,0x7B,
     0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,
-    0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x77,0x61,0x72,0x6E,0x69,0x6E,0x67,0x22,0x2C,
-    0x20,0x22,0x44,0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x22,0x29,
-    0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
-    0x20,0x6F,0x6E,0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,
-    0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,
-    0x73,0x73,0x69,0x64,0x2C,0x20,0x70,0x77,0x64,0x2C,0x20,0x73,0x69,0x74,0x65,0x29,
-    0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x64,0x6F,0x63,0x75,0x6D,
+    0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x64,0x61,0x6E,0x67,0x65,0x72,0x22,0x2C,0x20,
+    0x22,0x45,0x72,0x72,0x6F,0x72,0x21,0x22,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,
+    0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x44,0x69,0x73,0x63,
+    0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,
+    0x6F,0x78,0x28,0x22,0x77,0x61,0x72,0x6E,0x69,0x6E,0x67,0x22,0x2C,0x20,0x22,0x44,
+    0x69,0x73,0x63,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x3B,0x0D,0x0A,
+    0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,
+    0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x50,0x61,0x72,0x61,0x6D,0x65,
+    0x74,0x65,0x72,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x73,0x73,0x69,
+    0x64,0x2C,0x20,0x70,0x77,0x64,0x2C,0x20,0x73,0x69,0x74,0x65,0x29,0x0D,0x0A,0x7B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,
+    0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,
+    0x27,0x73,0x69,0x74,0x65,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,
+    0x74,0x20,0x3D,0x20,0x73,0x69,0x74,0x65,0x2E,0x76,0x61,0x6C,0x75,0x65,0x3B,0x0D,
+    0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,
+    0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,
+    0x73,0x75,0x6E,0x2C,0x20,0x64,0x74,0x73,0x2C,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2C,
+    0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,0x69,0x74,0x6F,0x2C,0x20,0x66,0x61,
+    0x6E,0x2C,0x20,0x68,0x66,0x2C,0x20,0x70,0x2C,0x20,0x74,0x2C,0x20,0x68,0x2C,0x20,
+    0x63,0x6F,0x32,0x2C,0x20,0x6C,0x75,0x78,0x2C,0x20,0x72,0x70,0x6D,0x2C,0x20,0x66,
+    0x61,0x2C,0x20,0x65,0x76,0x2C,0x20,0x72,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,
+    0x78,0x28,0x22,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x22,0x2C,0x20,0x64,0x74,0x73,
+    0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,0x65,
+    0x6D,0x70,0x20,0x3D,0x20,0x28,0x74,0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,
+    0x74,0x22,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,
+    0x74,0x65,0x6D,0x70,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x2E,
+    0x74,0x6F,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x5C,
+    0x78,0x42,0x30,0x22,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,
+    0x75,0x6D,0x20,0x3D,0x20,0x28,0x68,0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,
+    0x68,0x22,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,
+    0x68,0x75,0x6D,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x2E,0x74,
+    0x6F,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x25,0x22,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x70,0x72,0x65,0x73,0x73,
+    0x20,0x3D,0x20,0x28,0x70,0x20,0x2A,0x20,0x30,0x2E,0x30,0x30,0x31,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,
+    0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,0x70,
+    0x22,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x70,
+    0x72,0x65,0x73,0x73,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x31,0x29,0x2E,
+    0x74,0x6F,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x6B,
+    0x50,0x22,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x30,0x20,0x2D,0x20,
+    0x74,0x68,0x65,0x20,0x43,0x4F,0x32,0x20,0x73,0x65,0x6E,0x73,0x6F,0x72,0x20,0x69,
+    0x73,0x20,0x6D,0x69,0x73,0x73,0x69,0x6E,0x67,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,
+    0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,
+    0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,0x63,0x22,0x29,0x2E,0x69,0x6E,0x6E,
+    0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x28,0x28,0x30,0x20,0x3C,0x20,0x63,
+    0x6F,0x32,0x29,0x20,0x3F,0x20,0x63,0x6F,0x32,0x2E,0x74,0x6F,0x53,0x74,0x72,0x69,
+    0x6E,0x67,0x28,0x29,0x20,0x3A,0x20,0x22,0x2D,0x22,0x29,0x20,0x2B,0x20,0x22,0x20,
+    0x70,0x70,0x6D,0x22,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,
     0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,
-    0x49,0x64,0x28,0x27,0x73,0x69,0x74,0x65,0x27,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,
-    0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x73,0x69,0x74,0x65,0x2E,0x76,0x61,0x6C,0x75,
-    0x65,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,
-    0x6E,0x20,0x6F,0x6E,0x53,0x74,0x61,0x74,0x75,0x73,0x52,0x65,0x63,0x65,0x69,0x76,
-    0x65,0x64,0x28,0x73,0x75,0x6E,0x2C,0x20,0x64,0x74,0x73,0x2C,0x20,0x63,0x6F,0x6C,
-    0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,0x69,0x74,0x6F,0x2C,
-    0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x2C,0x20,0x70,0x2C,0x20,0x74,0x2C,0x20,
-    0x68,0x2C,0x20,0x72,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x75,0x70,
-    0x64,0x61,0x74,0x65,0x53,0x74,0x61,0x74,0x75,0x73,0x42,0x6F,0x78,0x28,0x22,0x73,
-    0x75,0x63,0x63,0x65,0x73,0x73,0x22,0x2C,0x20,0x64,0x74,0x73,0x29,0x3B,0x0D,0x0A,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,0x65,0x6D,0x70,0x20,0x3D,
-    0x20,0x28,0x74,0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,
-    0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,0x74,0x22,0x29,0x2E,
-    0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x74,0x65,0x6D,0x70,
-    0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x2E,0x74,0x6F,0x53,0x74,
-    0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x5C,0x78,0x42,0x30,0x22,
-    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x68,0x75,0x6D,0x20,0x3D,
-    0x20,0x28,0x68,0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,
-    0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,0x68,0x22,0x29,0x2E,
-    0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x68,0x75,0x6D,0x2E,
-    0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x2E,0x74,0x6F,0x53,0x74,0x72,
-    0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x25,0x22,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x70,0x72,0x65,0x73,0x73,0x20,0x3D,0x20,0x28,
-    0x70,0x20,0x2A,0x20,0x30,0x2E,0x30,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x49,0x64,0x28,0x22,0x6C,0x6C,0x22,0x29,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,
+    0x78,0x74,0x20,0x3D,0x20,0x6C,0x75,0x78,0x2E,0x74,0x6F,0x53,0x74,0x72,0x69,0x6E,
+    0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x6C,0x78,0x22,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x2F,0x2F,0x20,0x30,0x20,0x2D,0x20,0x74,0x68,0x65,0x20,0x46,0x41,0x4E,
+    0x20,0x69,0x73,0x20,0x73,0x74,0x6F,0x70,0x70,0x65,0x64,0x20,0x6F,0x72,0x20,0x68,
+    0x61,0x73,0x20,0x6E,0x6F,0x20,0x74,0x61,0x63,0x68,0x6F,0x6D,0x65,0x74,0x65,0x72,
+    0x2C,0x20,0x74,0x68,0x65,0x20,0x61,0x6C,0x61,0x72,0x6D,0x73,0x3A,0x20,0x31,0x20,
+    0x2D,0x20,0x73,0x74,0x61,0x6C,0x6C,0x65,0x64,0x2C,0x20,0x32,0x20,0x2D,0x20,0x74,
+    0x68,0x65,0x20,0x62,0x65,0x61,0x72,0x69,0x6E,0x67,0x20,0x69,0x73,0x20,0x77,0x6F,
+    0x72,0x6E,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6C,0x66,0x20,0x3D,
     0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,
-    0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,0x70,0x22,0x29,0x2E,0x69,
-    0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x70,0x72,0x65,0x73,0x73,
-    0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x31,0x29,0x2E,0x74,0x6F,0x53,0x74,
-    0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x22,0x20,0x6B,0x50,0x22,0x3B,0x0D,
-    0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,
-    0x68,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,
-    0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x75,0x6E,
-    0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,0x73,
-    0x75,0x6E,0x29,0x20,0x26,0x26,0x20,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,
+    0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6C,0x66,0x22,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x6C,0x66,0x2E,0x69,0x6E,0x6E,0x65,0x72,0x54,0x65,0x78,
+    0x74,0x20,0x3D,0x20,0x28,0x28,0x28,0x30,0x20,0x3C,0x20,0x72,0x70,0x6D,0x29,0x20,
+    0x7C,0x7C,0x20,0x28,0x30,0x20,0x21,0x3D,0x20,0x66,0x61,0x29,0x29,0x20,0x3F,0x20,
+    0x72,0x70,0x6D,0x2E,0x74,0x6F,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x3A,
+    0x20,0x22,0x2D,0x22,0x29,0x20,0x2B,0x20,0x22,0x20,0x72,0x70,0x6D,0x22,0x20,0x2B,
+    0x20,0x28,0x28,0x30,0x20,0x21,0x3D,0x20,0x28,0x66,0x61,0x20,0x26,0x20,0x31,0x29,
+    0x29,0x20,0x3F,0x20,0x22,0x20,0x73,0x74,0x61,0x6C,0x6C,0x22,0x20,0x3A,0x20,0x28,
+    0x28,0x30,0x20,0x21,0x3D,0x20,0x28,0x66,0x61,0x20,0x26,0x20,0x32,0x29,0x29,0x20,
+    0x3F,0x20,0x22,0x20,0x77,0x65,0x61,0x72,0x22,0x20,0x3A,0x20,0x22,0x22,0x29,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x66,0x2E,0x73,0x74,0x79,0x6C,0x65,0x2E,
+    0x63,0x6F,0x6C,0x6F,0x72,0x20,0x3D,0x20,0x28,0x30,0x20,0x21,0x3D,0x20,0x66,0x61,
+    0x29,0x20,0x3F,0x20,0x22,0x23,0x64,0x30,0x30,0x32,0x31,0x62,0x22,0x20,0x3A,0x20,
+    0x22,0x23,0x34,0x61,0x39,0x30,0x62,0x38,0x22,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x2F,0x2F,0x20,0x54,0x68,0x65,0x20,0x61,0x6E,0x6F,0x6D,0x61,0x6C,0x79,0x20,0x65,
+    0x76,0x65,0x6E,0x74,0x73,0x20,0x61,0x72,0x65,0x20,0x66,0x65,0x74,0x63,0x68,0x65,
+    0x64,0x20,0x77,0x68,0x65,0x6E,0x20,0x74,0x68,0x65,0x20,0x6C,0x61,0x73,0x74,0x20,
+    0x65,0x76,0x65,0x6E,0x74,0x20,0x73,0x65,0x71,0x75,0x65,0x6E,0x63,0x65,0x20,0x63,
+    0x68,0x61,0x6E,0x67,0x65,0x73,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x65,0x76,0x20,0x21,0x3D,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x2E,0x73,0x65,0x71,
+    0x75,0x65,0x6E,0x63,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
+    0x72,0x2E,0x67,0x65,0x74,0x45,0x76,0x65,0x6E,0x74,0x73,0x28,0x65,0x76,0x65,0x6E,
+    0x74,0x73,0x2E,0x73,0x65,0x71,0x75,0x65,0x6E,0x63,0x65,0x29,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x2E,0x73,0x65,
+    0x71,0x75,0x65,0x6E,0x63,0x65,0x20,0x3D,0x20,0x65,0x76,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x7D,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,
+    0x77,0x69,0x74,0x63,0x68,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,
+    0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,
+    0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x29,0x3B,0x0D,0x0A,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x74,0x72,0x75,0x65,0x20,
+    0x3D,0x3D,0x20,0x73,0x75,0x6E,0x29,0x20,0x26,0x26,0x20,0x28,0x74,0x72,0x75,0x65,
+    0x20,0x3D,0x3D,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x2E,0x63,
+    0x68,0x65,0x63,0x6B,0x65,0x64,0x29,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x55,0x70,0x64,0x61,0x74,
+    0x65,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,
+    0x66,0x69,0x74,0x6F,0x2C,0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x29,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x73,0x75,0x6E,0x20,0x21,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6C,0x61,0x73,0x74,
+    0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6C,0x61,0x73,0x74,0x20,0x3D,0x20,0x73,0x75,
+    0x6E,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x66,0x61,0x6C,0x73,0x65,0x20,0x3D,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x69,0x6E,
+    0x69,0x74,0x69,0x61,0x74,0x65,0x64,0x42,0x79,0x55,0x73,0x65,0x72,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6E,0x65,0x65,0x64,
+    0x55,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,
+    0x20,0x3D,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6E,0x65,0x65,0x64,0x55,0x69,0x55,
+    0x70,0x64,0x61,0x74,0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,0x20,
+    0x3D,0x3D,0x20,0x73,0x75,0x6E,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x2E,0x63,0x68,0x65,0x63,0x6B,
-    0x65,0x64,0x29,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x63,0x6F,
-    0x6C,0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,0x69,0x74,0x6F,
-    0x2C,0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
-    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x75,0x6E,0x20,
-    0x21,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6C,0x61,0x73,0x74,0x29,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,
-    0x64,0x65,0x2E,0x6C,0x61,0x73,0x74,0x20,0x3D,0x20,0x73,0x75,0x6E,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x66,0x61,0x6C,0x73,
-    0x65,0x20,0x3D,0x3D,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x69,0x6E,0x69,0x74,0x69,0x61,
-    0x74,0x65,0x64,0x42,0x79,0x55,0x73,0x65,0x72,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6E,0x65,0x65,0x64,0x55,0x69,0x55,0x70,
-    0x64,0x61,0x74,0x65,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,
-    0x6D,0x6F,0x64,0x65,0x2E,0x6E,0x65,0x65,0x64,0x55,0x69,0x55,0x70,0x64,0x61,0x74,
-    0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,0x73,
-    0x75,0x6E,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
+    0x65,0x64,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
+    0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,
     0x73,0x77,0x69,0x74,0x63,0x68,0x2E,0x63,0x68,0x65,0x63,0x6B,0x65,0x64,0x20,0x3D,
-    0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x61,0x6C,0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x55,0x70,
+    0x64,0x61,0x74,0x65,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,
+    0x77,0x2C,0x20,0x66,0x69,0x74,0x6F,0x2C,0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,
+    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,
+    0x2E,0x6E,0x65,0x65,0x64,0x55,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x3D,0x20,
+    0x66,0x61,0x6C,0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,0x20,
+    0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,
+    0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,
+    0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x6D,0x6F,
+    0x64,0x65,0x2E,0x77,0x69,0x64,0x74,0x68,0x20,0x21,0x3D,0x20,0x63,0x61,0x6E,0x76,
+    0x61,0x73,0x2E,0x77,0x69,0x64,0x74,0x68,0x29,0x20,0x7C,0x7C,0x20,0x28,0x74,0x72,
+    0x75,0x65,0x20,0x3D,0x3D,0x20,0x72,0x29,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x67,0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,
+    0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x77,0x69,0x64,0x74,0x68,0x20,0x3D,
+    0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x2E,0x77,0x69,0x64,0x74,0x68,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,
+    0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,
+    0x65,0x6D,0x65,0x6E,0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x74,
+    0x73,0x2C,0x20,0x68,0x73,0x2C,0x20,0x70,0x73,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x63,0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,
+    0x44,0x61,0x79,0x20,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,
+    0x3A,0x20,0x22,0x20,0x2B,0x20,0x74,0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x29,
+    0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x61,0x6E,
+    0x76,0x61,0x73,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,
+    0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,
+    0x68,0x61,0x72,0x74,0x2D,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,
+    0x65,0x74,0x20,0x6D,0x69,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,
+    0x20,0x3D,0x20,0x28,0x32,0x34,0x30,0x30,0x30,0x20,0x2A,0x20,0x77,0x69,0x6E,0x64,
+    0x6F,0x77,0x2E,0x64,0x65,0x76,0x69,0x63,0x65,0x50,0x69,0x78,0x65,0x6C,0x52,0x61,
+    0x74,0x69,0x6F,0x20,0x2F,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x2E,0x77,0x69,0x64,
+    0x74,0x68,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,
+    0x74,0x5F,0x74,0x2E,0x6F,0x70,0x74,0x69,0x6F,0x6E,0x73,0x2E,0x6D,0x69,0x6C,0x6C,
+    0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x20,0x3D,0x20,0x6D,0x69,0x6C,
+    0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x68,0x2E,0x6F,0x70,0x74,0x69,0x6F,0x6E,0x73,
+    0x2E,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x20,
+    0x3D,0x20,0x6D,0x69,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x70,0x2E,0x6F,0x70,
+    0x74,0x69,0x6F,0x6E,0x73,0x2E,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,
+    0x69,0x78,0x65,0x6C,0x20,0x3D,0x20,0x6D,0x69,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,
+    0x69,0x78,0x65,0x6C,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x65,0x72,
+    0x69,0x65,0x73,0x5F,0x74,0x2E,0x63,0x6C,0x65,0x61,0x72,0x28,0x29,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,
+    0x69,0x20,0x3C,0x20,0x74,0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3B,0x20,0x69,
+    0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x74,0x2E,0x61,0x70,0x70,
+    0x65,0x6E,0x64,0x28,0x69,0x20,0x2A,0x20,0x31,0x30,0x30,0x30,0x2E,0x30,0x20,0x2F,
+    0x20,0x33,0x2C,0x20,0x74,0x73,0x5B,0x69,0x5D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x68,
+    0x2E,0x63,0x6C,0x65,0x61,0x72,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,
+    0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x68,
+    0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
+    0x65,0x72,0x69,0x65,0x73,0x5F,0x68,0x2E,0x61,0x70,0x70,0x65,0x6E,0x64,0x28,0x69,
+    0x20,0x2A,0x20,0x31,0x30,0x30,0x30,0x2E,0x30,0x20,0x2F,0x20,0x33,0x2C,0x20,0x68,
+    0x73,0x5B,0x69,0x5D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x70,0x2E,0x63,0x6C,0x65,0x61,
+    0x72,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x69,
+    0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x70,0x73,0x2E,0x6C,0x65,0x6E,
+    0x67,0x74,0x68,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,
+    0x5F,0x70,0x2E,0x61,0x70,0x70,0x65,0x6E,0x64,0x28,0x69,0x20,0x2A,0x20,0x31,0x30,
+    0x30,0x30,0x2E,0x30,0x20,0x2F,0x20,0x33,0x2C,0x20,0x70,0x73,0x5B,0x69,0x5D,0x29,
+    0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,
+    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x45,0x76,0x65,0x6E,0x74,0x73,
+    0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x6C,0x69,0x73,0x74,0x29,0x0D,0x0A,
+    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x2F,0x2F,0x20,0x31,0x20,0x2D,0x20,0x74,0x68,
+    0x65,0x20,0x73,0x70,0x69,0x6B,0x65,0x2C,0x20,0x32,0x20,0x2D,0x20,0x74,0x68,0x65,
+    0x20,0x64,0x72,0x69,0x66,0x74,0x2C,0x20,0x33,0x20,0x2D,0x20,0x74,0x68,0x65,0x20,
+    0x68,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,0x20,0x64,0x6F,0x65,0x73,0x20,0x6E,0x6F,
+    0x74,0x20,0x72,0x69,0x73,0x65,0x20,0x77,0x68,0x69,0x6C,0x65,0x20,0x6D,0x69,0x73,
+    0x74,0x69,0x6E,0x67,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x75,0x6E,
+    0x69,0x74,0x73,0x20,0x3D,0x20,0x5B,0x7B,0x6E,0x61,0x6D,0x65,0x3A,0x20,0x22,0x54,
+    0x65,0x6D,0x70,0x65,0x72,0x61,0x74,0x75,0x72,0x65,0x22,0x2C,0x20,0x75,0x6E,0x69,
+    0x74,0x3A,0x20,0x22,0x20,0x5C,0x78,0x42,0x30,0x22,0x7D,0x2C,0x20,0x7B,0x6E,0x61,
+    0x6D,0x65,0x3A,0x20,0x22,0x48,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,0x22,0x2C,0x20,
+    0x75,0x6E,0x69,0x74,0x3A,0x20,0x22,0x20,0x25,0x22,0x7D,0x5D,0x3B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,
+    0x20,0x69,0x20,0x3C,0x20,0x6C,0x69,0x73,0x74,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,
+    0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x65,0x20,0x3D,0x20,0x6C,
+    0x69,0x73,0x74,0x5B,0x69,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6C,0x65,0x74,0x20,0x6D,0x20,0x3D,0x20,0x75,0x6E,0x69,0x74,0x73,0x5B,0x65,
+    0x2E,0x6D,0x65,0x74,0x72,0x69,0x63,0x5D,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x76,0x20,0x3D,0x20,0x28,0x65,0x2E,0x76,0x61,
+    0x6C,0x75,0x65,0x20,0x2A,0x20,0x30,0x2E,0x30,0x31,0x29,0x3B,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x74,0x65,0x78,0x74,0x20,0x3D,
+    0x20,0x6E,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x28,0x65,0x2E,0x74,0x69,0x6D,0x65,
+    0x20,0x2A,0x20,0x31,0x30,0x30,0x30,0x29,0x2E,0x74,0x6F,0x4C,0x6F,0x63,0x61,0x6C,
+    0x65,0x54,0x69,0x6D,0x65,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,
+    0x22,0x20,0x2D,0x20,0x22,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x31,0x20,0x3D,0x3D,0x20,0x65,0x2E,0x74,0x79,0x70,
+    0x65,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x20,
+    0x2B,0x3D,0x20,0x6D,0x2E,0x6E,0x61,0x6D,0x65,0x20,0x2B,0x20,0x22,0x20,0x73,0x70,
+    0x69,0x6B,0x65,0x20,0x22,0x20,0x2B,0x20,0x76,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,
+    0x64,0x28,0x32,0x29,0x2E,0x74,0x6F,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,
+    0x2B,0x20,0x6D,0x2E,0x75,0x6E,0x69,0x74,0x20,0x2B,0x20,0x22,0x2F,0x6D,0x69,0x6E,
+    0x22,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
+    0x32,0x20,0x3D,0x3D,0x20,0x65,0x2E,0x74,0x79,0x70,0x65,0x29,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x20,0x2B,0x3D,0x20,0x6D,0x2E,0x6E,
+    0x61,0x6D,0x65,0x20,0x2B,0x20,0x22,0x20,0x64,0x72,0x69,0x66,0x74,0x20,0x22,0x20,
+    0x2B,0x20,0x76,0x2E,0x74,0x6F,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x2E,0x74,
+    0x6F,0x53,0x74,0x72,0x69,0x6E,0x67,0x28,0x29,0x20,0x2B,0x20,0x6D,0x2E,0x75,0x6E,
+    0x69,0x74,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6C,0x73,0x65,0x0D,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x20,0x2B,0x3D,0x20,0x22,0x4E,0x6F,
+    0x20,0x68,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,0x20,0x72,0x69,0x73,0x65,0x20,0x77,
+    0x68,0x69,0x6C,0x65,0x20,0x6D,0x69,0x73,0x74,0x69,0x6E,0x67,0x22,0x3B,0x0D,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x2E,0x6C,0x69,0x6E,0x65,0x73,0x2E,
+    0x70,0x75,0x73,0x68,0x28,0x74,0x65,0x78,0x74,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x2E,0x73,0x65,0x71,0x75,
+    0x65,0x6E,0x63,0x65,0x20,0x3D,0x20,0x65,0x2E,0x73,0x65,0x71,0x75,0x65,0x6E,0x63,
+    0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x65,
+    0x76,0x65,0x6E,0x74,0x73,0x2E,0x6C,0x69,0x6E,0x65,0x73,0x20,0x3D,0x20,0x65,0x76,
+    0x65,0x6E,0x74,0x73,0x2E,0x6C,0x69,0x6E,0x65,0x73,0x2E,0x73,0x6C,0x69,0x63,0x65,
+    0x28,0x2D,0x33,0x29,0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x30,0x20,0x3C,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x2E,0x6C,0x69,0x6E,0x65,
+    0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,
+    0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,
+    0x64,0x28,0x22,0x65,0x76,0x65,0x6E,0x74,0x73,0x22,0x29,0x2E,0x69,0x6E,0x6E,0x65,
+    0x72,0x54,0x65,0x78,0x74,0x20,0x3D,0x20,0x65,0x76,0x65,0x6E,0x74,0x73,0x2E,0x6C,
+    0x69,0x6E,0x65,0x73,0x2E,0x6A,0x6F,0x69,0x6E,0x28,0x22,0x5C,0x6E,0x22,0x29,0x3B,
+    0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,
+    0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,
+    0x64,0x28,0x22,0x65,0x76,0x65,0x6E,0x74,0x73,0x5F,0x62,0x6F,0x78,0x22,0x29,0x2E,
+    0x73,0x74,0x79,0x6C,0x65,0x2E,0x64,0x69,0x73,0x70,0x6C,0x61,0x79,0x20,0x3D,0x20,
+    0x22,0x62,0x6C,0x6F,0x63,0x6B,0x22,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,
+    0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,
+    0x6E,0x53,0x75,0x6E,0x53,0x77,0x69,0x74,0x63,0x68,0x43,0x6C,0x69,0x63,0x6B,0x28,
+    0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,
+    0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,0x49,0x6D,0x69,0x74,0x61,
+    0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x28,0x74,0x68,0x69,0x73,0x2E,0x63,0x68,
+    0x65,0x63,0x6B,0x65,0x64,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,
+    0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x53,0x74,0x61,0x72,0x74,0x43,0x6F,
+    0x6C,0x6F,0x72,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x29,
+    0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,
+    0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,
+    0x28,0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x29,0x2E,0x63,
+    0x68,0x65,0x63,0x6B,0x65,0x64,0x20,0x3D,0x20,0x66,0x61,0x6C,0x73,0x65,0x3B,0x0D,
+    0x0A,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x69,0x6E,0x69,0x74,0x69,0x61,
+    0x74,0x65,0x64,0x42,0x79,0x55,0x73,0x65,0x72,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,
+    0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
+    0x20,0x6F,0x6E,0x45,0x6E,0x64,0x43,0x6F,0x6C,0x6F,0x72,0x43,0x68,0x61,0x6E,0x67,
+    0x65,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,
+    0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x43,
+    0x6F,0x6C,0x6F,0x72,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x72,0x65,0x64,0x2C,0x20,
+    0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x67,0x72,0x65,0x65,0x6E,0x2C,0x20,0x63,0x6F,0x6C,
+    0x6F,0x72,0x2E,0x62,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,
+    0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x49,0x6E,0x70,0x75,0x74,
+    0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,
+    0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x3D,0x20,0x64,0x6F,0x63,
+    0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,
+    0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,
+    0x22,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x72,0x75,0x65,
+    0x20,0x3D,0x3D,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x2E,0x63,
+    0x68,0x65,0x63,0x6B,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,
     0x63,0x68,0x2E,0x63,0x68,0x65,0x63,0x6B,0x65,0x64,0x20,0x3D,0x20,0x66,0x61,0x6C,
-    0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x55,0x70,0x64,0x61,0x74,0x65,
-    0x28,0x63,0x6F,0x6C,0x6F,0x72,0x2C,0x20,0x75,0x76,0x2C,0x20,0x77,0x2C,0x20,0x66,
-    0x69,0x74,0x6F,0x2C,0x20,0x66,0x61,0x6E,0x2C,0x20,0x68,0x66,0x29,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x6E,0x65,0x65,
-    0x64,0x55,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x3D,0x20,0x66,0x61,0x6C,0x73,
-    0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,0x3D,0x20,0x64,0x6F,0x63,0x75,
-    0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x42,
-    0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,0x2D,0x74,0x22,0x29,0x3B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x6D,0x6F,0x64,0x65,0x2E,0x77,
-    0x69,0x64,0x74,0x68,0x20,0x21,0x3D,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x2E,0x77,
-    0x69,0x64,0x74,0x68,0x29,0x20,0x7C,0x7C,0x20,0x28,0x74,0x72,0x75,0x65,0x20,0x3D,
-    0x3D,0x20,0x72,0x29,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
-    0x2E,0x67,0x65,0x74,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,
-    0x6E,0x74,0x73,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x6D,0x6F,0x64,0x65,0x2E,0x77,0x69,0x64,0x74,0x68,0x20,0x3D,0x20,0x63,0x61,0x6E,
-    0x76,0x61,0x73,0x2E,0x77,0x69,0x64,0x74,0x68,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x7D,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
-    0x20,0x6F,0x6E,0x44,0x61,0x79,0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,
-    0x74,0x73,0x52,0x65,0x63,0x65,0x69,0x76,0x65,0x64,0x28,0x74,0x73,0x2C,0x20,0x68,
-    0x73,0x2C,0x20,0x70,0x73,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,
-    0x65,0x74,0x20,0x69,0x20,0x3D,0x20,0x30,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x73,0x6F,0x6C,0x65,0x2E,0x6C,0x6F,0x67,0x28,0x22,0x44,0x61,0x79,0x20,
-    0x4D,0x65,0x61,0x73,0x75,0x72,0x65,0x6D,0x65,0x6E,0x74,0x73,0x3A,0x20,0x22,0x20,
-    0x2B,0x20,0x74,0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x29,0x3B,0x0D,0x0A,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x20,
-    0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,
-    0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x72,0x74,
-    0x2D,0x74,0x22,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6C,0x65,0x74,0x20,0x6D,
-    0x69,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x20,0x3D,0x20,0x28,
-    0x32,0x34,0x30,0x30,0x30,0x20,0x2A,0x20,0x77,0x69,0x6E,0x64,0x6F,0x77,0x2E,0x64,
-    0x65,0x76,0x69,0x63,0x65,0x50,0x69,0x78,0x65,0x6C,0x52,0x61,0x74,0x69,0x6F,0x20,
-    0x2F,0x20,0x63,0x61,0x6E,0x76,0x61,0x73,0x2E,0x77,0x69,0x64,0x74,0x68,0x29,0x3B,
-    0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x74,0x2E,
-    0x6F,0x70,0x74,0x69,0x6F,0x6E,0x73,0x2E,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,
-    0x72,0x50,0x69,0x78,0x65,0x6C,0x20,0x3D,0x20,0x6D,0x69,0x6C,0x69,0x73,0x50,0x65,
-    0x72,0x50,0x69,0x78,0x65,0x6C,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x68,0x61,
-    0x72,0x74,0x5F,0x68,0x2E,0x6F,0x70,0x74,0x69,0x6F,0x6E,0x73,0x2E,0x6D,0x69,0x6C,
-    0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x20,0x3D,0x20,0x6D,0x69,
-    0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,0x3B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x63,0x68,0x61,0x72,0x74,0x5F,0x70,0x2E,0x6F,0x70,0x74,0x69,0x6F,0x6E,
-    0x73,0x2E,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,
-    0x20,0x3D,0x20,0x6D,0x69,0x6C,0x69,0x73,0x50,0x65,0x72,0x50,0x69,0x78,0x65,0x6C,
-    0x3B,0x0D,0x0A,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,
-    0x74,0x2E,0x63,0x6C,0x65,0x61,0x72,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,
-    0x74,0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x74,0x2E,0x61,0x70,0x70,0x65,0x6E,0x64,0x28,
-    0x69,0x20,0x2A,0x20,0x31,0x30,0x30,0x30,0x2E,0x30,0x20,0x2F,0x20,0x33,0x2C,0x20,
-    0x74,0x73,0x5B,0x69,0x5D,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x68,0x2E,0x63,0x6C,0x65,
-    0x61,0x72,0x28,0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,
-    0x69,0x20,0x3D,0x20,0x30,0x3B,0x20,0x69,0x20,0x3C,0x20,0x68,0x73,0x2E,0x6C,0x65,
-    0x6E,0x67,0x74,0x68,0x3B,0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,
-    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,
-    0x73,0x5F,0x68,0x2E,0x61,0x70,0x70,0x65,0x6E,0x64,0x28,0x69,0x20,0x2A,0x20,0x31,
-    0x30,0x30,0x30,0x2E,0x30,0x20,0x2F,0x20,0x33,0x2C,0x20,0x68,0x73,0x5B,0x69,0x5D,
-    0x29,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x73,
-    0x65,0x72,0x69,0x65,0x73,0x5F,0x70,0x2E,0x63,0x6C,0x65,0x61,0x72,0x28,0x29,0x3B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x66,0x6F,0x72,0x20,0x28,0x69,0x20,0x3D,0x20,0x30,
-    0x3B,0x20,0x69,0x20,0x3C,0x20,0x70,0x73,0x2E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x3B,
-    0x20,0x69,0x2B,0x2B,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x5F,0x70,0x2E,0x61,
-    0x70,0x70,0x65,0x6E,0x64,0x28,0x69,0x20,0x2A,0x20,0x31,0x30,0x30,0x30,0x2E,0x30,
-    0x20,0x2F,0x20,0x33,0x2C,0x20,0x70,0x73,0x5B,0x69,0x5D,0x29,0x3B,0x0D,0x0A,0x20,
-    0x20,0x20,0x20,0x7D,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,
-    0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x53,0x75,0x6E,0x53,0x77,0x69,0x74,0x63,0x68,0x43,
-    0x6C,0x69,0x63,0x6B,0x28,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
-    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x53,0x75,0x6E,
-    0x49,0x6D,0x69,0x74,0x61,0x74,0x69,0x6F,0x6E,0x4D,0x6F,0x64,0x65,0x28,0x74,0x68,
-    0x69,0x73,0x2E,0x63,0x68,0x65,0x63,0x6B,0x65,0x64,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,
-    0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x53,0x74,
-    0x61,0x72,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x63,
-    0x6F,0x6C,0x6F,0x72,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x64,0x6F,
-    0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,0x65,0x6D,0x65,0x6E,
-    0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,
-    0x68,0x22,0x29,0x2E,0x63,0x68,0x65,0x63,0x6B,0x65,0x64,0x20,0x3D,0x20,0x66,0x61,
-    0x6C,0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x69,
-    0x6E,0x69,0x74,0x69,0x61,0x74,0x65,0x64,0x42,0x79,0x55,0x73,0x65,0x72,0x20,0x3D,
-    0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,
-    0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x45,0x6E,0x64,0x43,0x6F,0x6C,0x6F,0x72,
-    0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x29,0x0D,0x0A,0x7B,
-    0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,
-    0x2E,0x73,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x72,0x28,0x63,0x6F,0x6C,0x6F,0x72,0x2E,
-    0x72,0x65,0x64,0x2C,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x67,0x72,0x65,0x65,0x6E,
-    0x2C,0x20,0x63,0x6F,0x6C,0x6F,0x72,0x2E,0x62,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,
-    0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,
-    0x49,0x6E,0x70,0x75,0x74,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,
-    0x0A,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x20,
-    0x3D,0x20,0x64,0x6F,0x63,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x67,0x65,0x74,0x45,0x6C,
-    0x65,0x6D,0x65,0x6E,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x75,0x6E,0x5F,0x73,
-    0x77,0x69,0x74,0x63,0x68,0x22,0x29,0x0D,0x0A,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-    0x28,0x74,0x72,0x75,0x65,0x20,0x3D,0x3D,0x20,0x73,0x75,0x6E,0x5F,0x73,0x77,0x69,
-    0x74,0x63,0x68,0x2E,0x63,0x68,0x65,0x63,0x6B,0x65,0x64,0x29,0x0D,0x0A,0x20,0x20,
-    0x20,0x20,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6E,
-    0x5F,0x73,0x77,0x69,0x74,0x63,0x68,0x2E,0x63,0x68,0x65,0x63,0x6B,0x65,0x64,0x20,
-    0x3D,0x20,0x66,0x61,0x6C,0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x69,0x6E,0x69,0x74,0x69,0x61,0x74,0x65,0x64,
-    0x42,0x79,0x55,0x73,0x65,0x72,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x7D,0x0D,0x0A,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x55,
-    0x76,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,
-    0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,
-    0x72,0x2E,0x73,0x65,0x74,0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,
-    0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,0x65,0x74,0x2E,0x76,0x61,
-    0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,
-    0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x57,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x65,
-    0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,
-    0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x57,0x68,0x69,0x74,
-    0x65,0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,0x65,0x74,0x2E,0x76,
-    0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,
-    0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x46,0x69,0x74,0x6F,0x43,0x68,0x61,0x6E,
+    0x73,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6D,0x6F,0x64,
+    0x65,0x2E,0x69,0x6E,0x69,0x74,0x69,0x61,0x74,0x65,0x64,0x42,0x79,0x55,0x73,0x65,
+    0x72,0x20,0x3D,0x20,0x74,0x72,0x75,0x65,0x3B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x7D,
+    0x0D,0x0A,0x7D,0x0D,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0D,0x0A,0x66,
+    0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x55,0x76,0x43,0x68,0x61,0x6E,
     0x67,0x65,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,
     0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,
-    0x46,0x69,0x74,0x6F,0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,0x65,
-    0x74,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,
-    0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x46,0x61,0x6E,0x43,0x68,
-    0x61,0x6E,0x67,0x65,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,
-    0x65,0x74,0x46,0x61,0x6E,0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,
-    0x65,0x74,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,
-    0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x48,0x66,0x43,0x68,
-    0x61,0x6E,0x67,0x65,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,
-    0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,
-    0x65,0x74,0x48,0x75,0x6D,0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x28,0x65,0x76,0x65,
+    0x55,0x6C,0x74,0x72,0x61,0x56,0x69,0x6F,0x6C,0x65,0x74,0x28,0x65,0x76,0x65,0x6E,
+    0x74,0x2E,0x74,0x61,0x72,0x67,0x65,0x74,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,
+    0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,
+    0x6F,0x6E,0x57,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x65,0x76,0x65,0x6E,0x74,0x29,
+    0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,
+    0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x57,0x68,0x69,0x74,0x65,0x28,0x65,0x76,0x65,
     0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,0x65,0x74,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,
-    0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,
+    0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,
+    0x20,0x6F,0x6E,0x46,0x69,0x74,0x6F,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,0x65,0x76,
+    0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,0x6F,0x6E,
+    0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x46,0x69,0x74,0x6F,0x28,
+    0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,0x65,0x74,0x2E,0x76,0x61,0x6C,
+    0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,0x74,
+    0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x46,0x61,0x6E,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,
+    0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
+    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x46,0x61,0x6E,
+    0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,0x72,0x67,0x65,0x74,0x2E,0x76,0x61,
+    0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,0x0A,0x0D,0x0A,0x66,0x75,0x6E,0x63,
+    0x74,0x69,0x6F,0x6E,0x20,0x6F,0x6E,0x48,0x66,0x43,0x68,0x61,0x6E,0x67,0x65,0x28,
+    0x65,0x76,0x65,0x6E,0x74,0x29,0x0D,0x0A,0x7B,0x0D,0x0A,0x20,0x20,0x20,0x20,0x63,
+    0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x65,0x72,0x2E,0x73,0x65,0x74,0x48,0x75,0x6D,
+    0x69,0x64,0x69,0x66,0x69,0x65,0x72,0x28,0x65,0x76,0x65,0x6E,0x74,0x2E,0x74,0x61,
+    0x72,0x67,0x65,0x74,0x2E,0x76,0x61,0x6C,0x75,0x65,0x29,0x3B,0x0D,0x0A,0x7D,0x0D,
+    0x0A,
 };
 
 static const unsigned char data_js_iro_js[] = {
@@ -0,0 +1,710 @@
+/* Prometheus Metrics */
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "types.h"
+#include "fs.h"
+#include "led_task.h"
+#include "led_dli.h"
+#include "climate_task.h"
+#include "humidifier.h"
+#include "scd4x.h"
+#include "bh1750.h"
+#include "http_metrics.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define HTTP_METRICS_LOG  0
+
+#if (1 == HTTP_METRICS_LOG)
+static const char * gTAG = "METRICS";
+#    define METRICS_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define METRICS_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define METRICS_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define METRICS_LOGI(...)
+#    define METRICS_LOGE(...)
+#    define METRICS_LOGV(...)
+#endif
+
+#define METRICS_URI     "/metrics"
+/* The same agent as in the file system headers (makefsdata.py) */
+#define METRICS_SERVER  "lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)"
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    /* The HTTP header is put right before the rendered page */
+    METRICS_HEADER_MAX = 192,
+    METRICS_PAGE_MAX   = 4096,
+    METRICS_BUF_SIZE   = (METRICS_HEADER_MAX + METRICS_PAGE_MAX),
+};
+
+/* The value is printed as is or as the fixed point number of 0.01 units */
+typedef enum
+{
+    METRICS_UNITS = 0,
+    METRICS_HUNDREDTHS,
+} metrics_format_t;
+
+typedef enum
+{
+    METRICS_LED_R = 0,
+    METRICS_LED_G,
+    METRICS_LED_B,
+    METRICS_LED_U,
+    METRICS_LED_W,
+    METRICS_LED_F,
+    METRICS_LEDS,
+} metrics_led_t;
+
+typedef enum
+{
+    METRICS_SENSOR_BME280 = 0,
+    METRICS_SENSOR_SCD4X,
+    METRICS_SENSOR_BH1750,
+    METRICS_SENSORS,
+} metrics_sensor_t;
+
+enum
+{
+    METRICS_TASKS = 11,
+};
+
+/* The task is not running */
+#define METRICS_STACK_NONE  UINT32_MAX
+
+typedef struct
+{
+    /* s */
+    uint32_t uptime;
+    uint32_t heap_free;
+    uint32_t heap_min;
+    /* 0.01 C */
+    int32_t  temperature;
+    /* 0.01 % */
+    int32_t  humidity;
+    /* 0.01 Pa */
+    int32_t  pressure;
+    /* ppm, 0 - not measured */
+    uint32_t co2;
+    /* lx */
+    uint32_t light;
+    uint8_t  leds[METRICS_LEDS];
+    /* mmol/m2 */
+    uint32_t dli;
+    uint32_t fan_rpm;
+    /* 0.01 % */
+    uint32_t fan_duty;
+    uint8_t  fan_alarms;
+    bool     humidifier;
+    uint16_t events;
+    /* The stack high water marks (bytes) */
+    uint32_t stacks[METRICS_TASKS];
+    uint32_t errors[METRICS_SENSORS];
+    uint32_t scrapes;
+    uint32_t busy;
+} metrics_snapshot_t, * metrics_snapshot_p;
+
+typedef struct
+{
+    char   * p_buf;
+    size_t   size;
+    size_t   len;
+    /* The page does not fit the buffer */
+    bool     overflow;
+} metrics_writer_t, * metrics_writer_p;
+
+typedef struct
+{
+    metrics_snapshot_t snapshot;
+    /* The buffer is used by the scrape till the file is closed */
+    bool               busy;
+    uint32_t           scrapes;
+    uint32_t           busy_scrapes;
+    char               buf[METRICS_BUF_SIZE];
+} metrics_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static const char * gcMetricsLeds[METRICS_LEDS] =
+{
+    [METRICS_LED_R] = "red",
+    [METRICS_LED_G] = "green",
+    [METRICS_LED_B] = "blue",
+    [METRICS_LED_U] = "ultraviolet",
+    [METRICS_LED_W] = "white",
+    [METRICS_LED_F] = "fito",
+};
+
+static const char * gcMetricsSensors[METRICS_SENSORS] =
+{
+    [METRICS_SENSOR_BME280] = "bme280",
+    [METRICS_SENSOR_SCD4X]  = "scd4x",
+    [METRICS_SENSOR_BH1750] = "bh1750",
+};
+
+/* The names of the tasks are given by their xTaskCreate calls */
+static const char * gcMetricsTasks[METRICS_TASKS] =
+{
+    "LED RGB",
+    "LED UWF",
+    "WiFi",
+    "TIME",
+    "Climate",
+    "HTTP Server",
+    "WebSocket",
+    "DNS",
+    "SNTP",
+    "LINK",
+    "tiT",
+};
+
+/* The HTTP server calls the file system from the TCP/IP task only */
+static metrics_t gMetrics = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static void metrics_Printf(metrics_writer_p p_wr, const char * p_fmt, ...)
+{
+    va_list args;
+    int     len = 0;
+
+    if (false == p_wr->overflow)
+    {
+        va_start(args, p_fmt);
+        len = vsnprintf(&p_wr->p_buf[p_wr->len], (p_wr->size - p_wr->len), p_fmt, args);
+        va_end(args);
+
+        if ((0 > len) || ((p_wr->size - p_wr->len) <= (size_t)len))
+        {
+            p_wr->overflow = true;
+        }
+        else
+        {
+            p_wr->len += (size_t)len;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void metrics_Family(metrics_writer_p p_wr, const char * p_name, const char * p_type, const char * p_help)
+{
+    metrics_Printf(p_wr, "# HELP %s %s\n# TYPE %s %s\n", p_name, p_help, p_name, p_type);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The label is NULL for the sample without the labels */
+static void metrics_Sample
+(
+    metrics_writer_p p_wr,
+    const char     * p_name,
+    const char     * p_label,
+    const char     * p_label_value,
+    int64_t          value,
+    metrics_format_t format
+)
+{
+    uint64_t abs_value = (uint64_t)((0 > value) ? -value : value);
+
+    if (NULL == p_label)
+    {
+        metrics_Printf(p_wr, "%s ", p_name);
+    }
+    else
+    {
+        metrics_Printf(p_wr, "%s{%s=\"%s\"} ", p_name, p_label, p_label_value);
+    }
+
+    if (METRICS_HUNDREDTHS == format)
+    {
+        metrics_Printf
+        (
+            p_wr,
+            "%s%llu.%02llu\n",
+            (0 > value) ? "-" : "",
+            (unsigned long long)(abs_value / 100),
+            (unsigned long long)(abs_value % 100)
+        );
+    }
+    else
+    {
+        metrics_Printf(p_wr, "%lld\n", (long long)value);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the page length, 0 - the page does not fit the buffer */
+static size_t metrics_Render(const metrics_snapshot_t * p_snap, char * p_buf, size_t size)
+{
+    metrics_writer_t wr = {.p_buf = p_buf, .size = size, .len = 0, .overflow = false};
+    uint32_t         i  = 0;
+
+    metrics_Family(&wr, "orchidarium_uptime_seconds", "gauge", "Time since the boot.");
+    metrics_Sample(&wr, "orchidarium_uptime_seconds", NULL, NULL, p_snap->uptime, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_heap_free_bytes", "gauge", "Free heap.");
+    metrics_Sample(&wr, "orchidarium_heap_free_bytes", NULL, NULL, p_snap->heap_free, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_heap_min_free_bytes", "gauge", "Minimum free heap since the boot.");
+    metrics_Sample(&wr, "orchidarium_heap_min_free_bytes", NULL, NULL, p_snap->heap_min, METRICS_UNITS);
+
+    metrics_Family(&wr, "orchidarium_task_stack_free_bytes", "gauge", "Stack high water mark of the task.");
+    for (i = 0; i < METRICS_TASKS; i++)
+    {
+        if (METRICS_STACK_NONE != p_snap->stacks[i])
+        {
+            metrics_Sample(&wr, "orchidarium_task_stack_free_bytes", "task", gcMetricsTasks[i], p_snap->stacks[i], METRICS_UNITS);
+        }
+    }
+
+    metrics_Family(&wr, "orchidarium_temperature_celsius", "gauge", "Enclosure temperature, the last minute mean.");
+    metrics_Sample(&wr, "orchidarium_temperature_celsius", NULL, NULL, p_snap->temperature, METRICS_HUNDREDTHS);
+    metrics_Family(&wr, "orchidarium_humidity_percent", "gauge", "Enclosure relative humidity, the last minute mean.");
+    metrics_Sample(&wr, "orchidarium_humidity_percent", NULL, NULL, p_snap->humidity, METRICS_HUNDREDTHS);
+    metrics_Family(&wr, "orchidarium_pressure_pascals", "gauge", "Atmospheric pressure, the last minute mean.");
+    metrics_Sample(&wr, "orchidarium_pressure_pascals", NULL, NULL, p_snap->pressure, METRICS_HUNDREDTHS);
+    metrics_Family(&wr, "orchidarium_co2_ppm", "gauge", "CO2 concentration, 0 - not measured.");
+    metrics_Sample(&wr, "orchidarium_co2_ppm", NULL, NULL, p_snap->co2, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_light_lux", "gauge", "Illuminance.");
+    metrics_Sample(&wr, "orchidarium_light_lux", NULL, NULL, p_snap->light, METRICS_UNITS);
+
+    metrics_Family(&wr, "orchidarium_led_level", "gauge", "Current level of the LED channel (0-255).");
+    for (i = 0; i < METRICS_LEDS; i++)
+    {
+        metrics_Sample(&wr, "orchidarium_led_level", "channel", gcMetricsLeds[i], p_snap->leds[i], METRICS_UNITS);
+    }
+    metrics_Family(&wr, "orchidarium_dli_mmol_per_m2", "gauge", "Light integral of the LEDs since the day start.");
+    metrics_Sample(&wr, "orchidarium_dli_mmol_per_m2", NULL, NULL, p_snap->dli, METRICS_UNITS);
+
+    metrics_Family(&wr, "orchidarium_fan_rpm", "gauge", "FAN speed by the tachometer.");
+    metrics_Sample(&wr, "orchidarium_fan_rpm", NULL, NULL, p_snap->fan_rpm, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_fan_duty_percent", "gauge", "FAN PWM duty.");
+    metrics_Sample(&wr, "orchidarium_fan_duty_percent", NULL, NULL, p_snap->fan_duty, METRICS_HUNDREDTHS);
+    metrics_Family(&wr, "orchidarium_fan_alarms", "gauge", "FAN alarms: 1 - stall, 2 - wear.");
+    metrics_Sample(&wr, "orchidarium_fan_alarms", NULL, NULL, p_snap->fan_alarms, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_humidifier_on", "gauge", "Humidifier is misting.");
+    metrics_Sample(&wr, "orchidarium_humidifier_on", NULL, NULL, p_snap->humidifier, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_climate_events_sequence", "gauge", "Sequence of the last climate anomaly event, it wraps.");
+    metrics_Sample(&wr, "orchidarium_climate_events_sequence", NULL, NULL, p_snap->events, METRICS_UNITS);
+
+    metrics_Family(&wr, "orchidarium_sensor_errors_total", "counter", "Failed acquisitions of the sensor.");
+    for (i = 0; i < METRICS_SENSORS; i++)
+    {
+        metrics_Sample(&wr, "orchidarium_sensor_errors_total", "sensor", gcMetricsSensors[i], p_snap->errors[i], METRICS_UNITS);
+    }
+    metrics_Family(&wr, "orchidarium_http_scrapes_total", "counter", "Served metrics scrapes.");
+    metrics_Sample(&wr, "orchidarium_http_scrapes_total", NULL, NULL, p_snap->scrapes, METRICS_UNITS);
+    metrics_Family(&wr, "orchidarium_http_scrapes_busy_total", "counter", "Scrapes refused while the previous one was served.");
+    metrics_Sample(&wr, "orchidarium_http_scrapes_busy_total", NULL, NULL, p_snap->busy, METRICS_UNITS);
+
+    return ((true == wr.overflow) ? 0 : wr.len);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The climate task measures the pressure in Pa, the page shows it in 0.01 Pa as the others */
+static void metrics_CollectClimate(metrics_snapshot_p p_snap, const climate_measurements_t * p_meas)
+{
+    p_snap->temperature = (int16_t)p_meas->temperature;
+    p_snap->humidity    = p_meas->humidity;
+    p_snap->pressure    = (int32_t)(p_meas->pressure * 100);
+    p_snap->co2         = p_meas->co2;
+    p_snap->light       = p_meas->light;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void metrics_Collect(metrics_snapshot_p p_snap)
+{
+    climate_measurements_t meas   = {0};
+    led_color_t            color  = {0};
+    TaskHandle_t           handle = NULL;
+    uint32_t               i      = 0;
+
+    p_snap->uptime    = (uint32_t)(esp_timer_get_time() / 1000000);
+    p_snap->heap_free = esp_get_free_heap_size();
+    p_snap->heap_min  = esp_get_minimum_free_heap_size();
+
+    /* The stack high water marks are in bytes on ESP32 */
+    for (i = 0; i < METRICS_TASKS; i++)
+    {
+        handle            = xTaskGetHandle(gcMetricsTasks[i]);
+        p_snap->stacks[i] = (NULL == handle) ? METRICS_STACK_NONE : uxTaskGetStackHighWaterMark(handle);
+    }
+
+    Climate_Task_GetMeasurements(&meas);
+    metrics_CollectClimate(p_snap, &meas);
+
+    LED_Task_GetCurrentColor(&color);
+    p_snap->leds[METRICS_LED_R] = color.r;
+    p_snap->leds[METRICS_LED_G] = color.g;
+    p_snap->leds[METRICS_LED_B] = color.b;
+    p_snap->leds[METRICS_LED_U] = LED_Task_GetCurrentUltraViolet();
+    p_snap->leds[METRICS_LED_W] = LED_Task_GetCurrentWhite();
+    p_snap->leds[METRICS_LED_F] = LED_Task_GetCurrentFito();
+    p_snap->dli                 = LED_DLI_Get();
+
+    p_snap->fan_rpm    = Climate_Task_GetFanRpm();
+    p_snap->fan_duty   = (Climate_Task_GetFanDuty() * 10000 / FAN_MCPWM_PERIOD);
+    p_snap->fan_alarms = Climate_Task_GetFanAlarms();
+    p_snap->humidifier = Climate_Task_IsHumidifierOn();
+    p_snap->events     = Climate_Task_GetEventsSequence();
+
+    p_snap->errors[METRICS_SENSOR_BME280] = Humidifier_GetSensorsErrors();
+    p_snap->errors[METRICS_SENSOR_SCD4X]  = SCD4x_GetErrors();
+    p_snap->errors[METRICS_SENSOR_BH1750] = BH1750_GetErrors();
+
+    p_snap->scrapes = gMetrics.scrapes;
+    p_snap->busy    = gMetrics.busy_scrapes;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Renders the header and the page into the buffer, returns the start of the response */
+static char * metrics_Respond(const metrics_snapshot_t * p_snap, char * p_buf, size_t * p_len)
+{
+    char   header[METRICS_HEADER_MAX] = {0};
+    size_t page                       = 0;
+    int    len                        = 0;
+
+    page = metrics_Render(p_snap, &p_buf[METRICS_HEADER_MAX], METRICS_PAGE_MAX);
+    if (0 < page)
+    {
+        len = snprintf
+        (
+            header,
+            sizeof(header),
+            "HTTP/1.0 200 OK\r\n"
+            "Server: " METRICS_SERVER "\r\n"
+            "Content-Length: %u\r\n"
+            "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n\r\n",
+            (unsigned int)page
+        );
+        if ((0 < len) && ((size_t)len < sizeof(header)))
+        {
+            /* The header is not terminated in the buffer, the page follows it */
+            memcpy(&p_buf[METRICS_HEADER_MAX - len], header, (size_t)len);
+            *p_len = ((size_t)len + page);
+            return &p_buf[METRICS_HEADER_MAX - len];
+        }
+    }
+
+    METRICS_LOGE("The page does not fit the buffer");
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int HTTP_Metrics_Open(struct fs_file * file, const char * name)
+{
+    char   * p_data = NULL;
+    size_t   len    = 0;
+
+    if (0 != strcmp(name, METRICS_URI))
+    {
+        return 0;
+    }
+
+    /* The buffer is not released till the previous scrape is sent */
+    if (true == gMetrics.busy)
+    {
+        gMetrics.busy_scrapes++;
+        return 0;
+    }
+
+    gMetrics.scrapes++;
+    metrics_Collect(&gMetrics.snapshot);
+    p_data = metrics_Respond(&gMetrics.snapshot, gMetrics.buf, &len);
+    if (NULL == p_data)
+    {
+        return 0;
+    }
+
+    gMetrics.busy              = true;
+    file->data                 = p_data;
+    file->len                  = (int)len;
+    file->index                = (int)len;
+    file->pextension           = NULL;
+    file->http_header_included = 1;
+    METRICS_LOGI("Scrape %lu: %u bytes", gMetrics.scrapes, (unsigned int)len);
+
+    return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void HTTP_Metrics_Close(struct fs_file * file)
+{
+    /* The data is copied by TCP, so the buffer is free once the file is closed */
+    if ((file->data >= gMetrics.buf) && (file->data < &gMetrics.buf[METRICS_BUF_SIZE]))
+    {
+        gMetrics.busy = false;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static bool metrics_IsNameChar(char c, bool first)
+{
+    return ((('a' <= c) && ('z' >= c)) || (('A' <= c) && ('Z' >= c)) || ('_' == c) || (':' == c) ||
+            ((false == first) && ('0' <= c) && ('9' >= c)));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Parses the name, returns its length, 0 - not the name */
+static size_t metrics_ParseName(const char * p_text)
+{
+    size_t len = 0;
+
+    while (true == metrics_IsNameChar(p_text[len], (0 == len)))
+    {
+        len++;
+    }
+
+    return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Parses the decimal value, returns its end, NULL - not the value */
+static const char * metrics_ParseValue(const char * p_text)
+{
+    const char * p_digits = NULL;
+
+    if ('-' == *p_text)
+    {
+        p_text++;
+    }
+    for (p_digits = p_text; ('0' <= *p_text) && ('9' >= *p_text); p_text++);
+    if (p_digits == p_text)
+    {
+        return NULL;
+    }
+
+    if ('.' == *p_text)
+    {
+        p_text++;
+        for (p_digits = p_text; ('0' <= *p_text) && ('9' >= *p_text); p_text++);
+        if (p_digits == p_text)
+        {
+            return NULL;
+        }
+    }
+
+    return p_text;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Validates the page by the text format, returns the count of the samples, -1 - invalid */
+static int32_t metrics_Parse(const char * p_page, size_t len)
+{
+    const char * p_line   = p_page;
+    const char * p_end    = &p_page[len];
+    const char * p_eol    = NULL;
+    const char * p_family = NULL;
+    size_t       family   = 0;
+    size_t       name     = 0;
+    int32_t      samples  = 0;
+
+    while (p_line < p_end)
+    {
+        p_eol = memchr(p_line, '\n', (size_t)(p_end - p_line));
+        if ((NULL == p_eol) || (p_eol == p_line))
+        {
+            return -1;
+        }
+
+        if (0 == strncmp(p_line, "# HELP ", 7))
+        {
+            /* The HELP starts the family */
+            p_family = &p_line[7];
+            family   = metrics_ParseName(p_family);
+            if ((0 == family) || (' ' != p_family[family]))
+            {
+                return -1;
+            }
+        }
+        else if (0 == strncmp(p_line, "# TYPE ", 7))
+        {
+            /* The TYPE is of the same family and it is before the samples */
+            if ((NULL == p_family) || (0 != strncmp(&p_line[7], p_family, family)) || (' ' != p_line[7 + family]))
+            {
+                return -1;
+            }
+            if ((0 != strncmp(&p_line[8 + family], "gauge\n", 6)) && (0 != strncmp(&p_line[8 + family], "counter\n", 8)))
+            {
+                return -1;
+            }
+        }
+        else
+        {
+            /* The sample is of the current family */
+            name = metrics_ParseName(p_line);
+            if ((NULL == p_family) || (name != family) || (0 != strncmp(p_line, p_family, family)))
+            {
+                return -1;
+            }
+            p_line += name;
+
+            /* The label value is quoted and it has no escapes here */
+            if ('{' == *p_line)
+            {
+                p_line++;
+                name = metrics_ParseName(p_line);
+                if ((0 == name) || (0 != strncmp(&p_line[name], "=\"", 2)))
+                {
+                    return -1;
+                }
+                p_line = memchr(&p_line[name + 2], '"', (size_t)(p_eol - &p_line[name + 2]));
+                if ((NULL == p_line) || ('}' != p_line[1]))
+                {
+                    return -1;
+                }
+                p_line += 2;
+            }
+
+            /* The value is the whole rest of the line */
+            if ((' ' != *p_line) || (p_eol != metrics_ParseValue(&p_line[1])))
+            {
+                return -1;
+            }
+            samples++;
+        }
+
+        p_line = (p_eol + 1);
+    }
+
+    return samples;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void HTTP_Metrics_Test(void)
+{
+    static const struct
+    {
+        const char * p_page;
+        int32_t      samples;
+    } gcTestPages[] =
+    {
+        {"orchidarium_fan_rpm 1\n", -1},
+        {"# HELP a A\n# TYPE a gauge\nb 1\n", -1},
+        {"# HELP a A\n# TYPE a gauge\na 1x\n", -1},
+        {"# HELP a A\n# TYPE a gauge\na 1.\n", -1},
+        {"# HELP a A\n# TYPE a gauge\na{l=\"v} 1\n", -1},
+        {"# HELP a A\n# TYPE a gauge\na 1\n\n", -1},
+        {"# HELP a A\n# TYPE a histogram\na 1\n", -1},
+        {"# HELP a A\n# TYPE a gauge\na{l=\"v\"} -0.5\na 2\n", 2},
+    };
+    climate_measurements_t meas   = {0};
+    metrics_snapshot_t     snap   = {0};
+    char                 * p_rsp  = NULL;
+    char                 * p_page = NULL;
+    size_t                 len    = 0;
+    uint32_t               i      = 0;
+    bool                   result = true;
+
+    /* This call is not thread safe but this is acceptable */
+    if (true == gMetrics.busy)
+    {
+        METRICS_LOGI("Metrics Page - the scrape is in progress - FAIL");
+        return;
+    }
+
+    snap.uptime      = 86461;
+    snap.heap_free   = 123456;
+    snap.heap_min    = 98765;
+    snap.dli         = 4321;
+    snap.fan_rpm     = 1450;
+    snap.fan_duty    = 5000;
+    snap.fan_alarms  = FAN_ALARM_WEAR;
+    snap.humidifier  = true;
+    snap.events      = 65535;
+    snap.scrapes     = UINT32_MAX;
+
+    /* The measurements are in the units of the climate task: 0.01 C, 0.01 %, Pa */
+    meas.temperature = (uint16_t)-105;
+    meas.humidity    = 7503;
+    meas.pressure    = 101325;
+    meas.co2         = 612;
+    meas.light       = 15000;
+    metrics_CollectClimate(&snap, &meas);
+    result &= (-105 == snap.temperature);
+    result &= (7503 == snap.humidity);
+    result &= (10132500 == snap.pressure);
+    result &= ((612 == snap.co2) && (15000 == snap.light));
+
+    for (i = 0; i < METRICS_LEDS; i++)
+    {
+        snap.leds[i] = (uint8_t)(i * 51);
+    }
+    for (i = 0; i < METRICS_TASKS; i++)
+    {
+        snap.stacks[i] = ((0 == (i % 2)) ? (1000 + i) : METRICS_STACK_NONE);
+    }
+    for (i = 0; i < METRICS_SENSORS; i++)
+    {
+        snap.errors[i] = i;
+    }
+
+    /* The response is the header and the page of the text format */
+    p_rsp   = metrics_Respond(&snap, gMetrics.buf, &len);
+    result &= (NULL != p_rsp);
+    if (true == result)
+    {
+        p_page     = strstr(p_rsp, "\r\n\r\n");
+        result    &= (0 == strncmp(p_rsp, "HTTP/1.0 200 OK\r\n", 17));
+        result    &= (NULL != strstr(p_rsp, "Content-Type: text/plain; version=0.0.4"));
+        result    &= (NULL != p_page);
+    }
+    if (true == result)
+    {
+        p_page += 4;
+        len    -= (size_t)(p_page - p_rsp);
+        result &= (NULL != strstr(p_rsp, "Content-Length: "));
+        result &= (len == strtoul((strstr(p_rsp, "Content-Length: ") + 16), NULL, 10));
+
+        /* Every metric is the sample, the tasks and the LEDs and the sensors are labeled */
+        result &= (31 == metrics_Parse(p_page, len));
+        result &= (NULL != strstr(p_page, "\norchidarium_temperature_celsius -1.05\n"));
+        result &= (NULL != strstr(p_page, "\norchidarium_humidity_percent 75.03\n"));
+        result &= (NULL != strstr(p_page, "\norchidarium_pressure_pascals 101325.00\n"));
+        result &= (NULL != strstr(p_page, "\norchidarium_led_level{channel=\"fito\"} 255\n"));
+        result &= (NULL != strstr(p_page, "\norchidarium_task_stack_free_bytes{task=\"Climate\"} 1004\n"));
+        result &= (NULL == strstr(p_page, "task=\"TIME\""));
+        result &= (NULL != strstr(p_page, "\norchidarium_sensor_errors_total{sensor=\"bh1750\"} 2\n"));
+        result &= (NULL != strstr(p_page, "\norchidarium_http_scrapes_total 4294967295\n"));
+        METRICS_LOGI("%s", p_page);
+    }
+
+    /* The parser rejects the broken pages */
+    for (i = 0; i < (sizeof(gcTestPages) / sizeof(gcTestPages[0])); i++)
+    {
+        result &= (gcTestPages[i].samples == metrics_Parse(gcTestPages[i].p_page, strlen(gcTestPages[i].p_page)));
+    }
+
+    /* The page over the buffer is not served */
+    result &= (0 == metrics_Render(&snap, gMetrics.buf, 256));
+
+    METRICS_LOGI("Metrics Page - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdio.h>
+#include <sys/param.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -16,6 +17,10 @@
 #include "led_task.h"
 #include "time_task.h"
 #include "climate_task.h"
+#include "climate_series.h"
+#include "profiler.h"
+#include "http_metrics.h"
+#include "http_trace.h"
 
 //-------------------------------------------------------------------------------------------------
 
@@ -57,6 +62,8 @@ enum
     CMD_SET_FAN                   = 0x09,
     CMD_SET_HUMIDIFIER            = 0x0A,
     CMD_GET_DAY_MEASUREMENTS      = 0x0B,
+    CMD_GET_EVENTS                = 0x0C,
+    CMD_GET_SERIES                = 0x0D,
     SUCCESS                       = 0x00,
     ERROR                         = 0xFF,
     ON                            = 0x01,
@@ -65,6 +72,14 @@ enum
     MODE_COLOR                    = 1,
 };
 
+enum
+{
+    /* The series chunk is limited by the TCP send buffer as well */
+    CTRL_SERIES_CHUNK_MAX         = 512,
+    /* The WebSocket header of the binary frame over 125 bytes */
+    CTRL_WS_HEADER_LEN            = 4,
+};
+
 #pragma pack(push, 1)
 
 typedef struct
@@ -92,11 +107,40 @@ typedef struct
     uint32_t      pressure;
     uint16_t      temperature;
     uint16_t      humidity;
+    uint16_t      co2;
+    uint32_t      light;
+    uint16_t      fan_rpm;
+    uint8_t       fan_alarms;
+    uint16_t      events;
     wifi_string_t datetime;
 } ctrl_status_t;
 
 typedef climate_day_measurements_t ctrl_day_measmts_t;
 
+typedef struct
+{
+    uint8_t                 count;
+    climate_anomaly_event_t events[CLIMATE_ANOMALY_EVENTS];
+} ctrl_events_t;
+
+typedef struct
+{
+    uint32_t from;
+    uint32_t to;
+    uint8_t  level;
+    uint8_t  fields;
+} ctrl_series_req_t;
+
+typedef struct
+{
+    /* The next chunk starts here, 'to' - the range is over */
+    uint32_t next;
+    uint16_t count;
+    uint8_t  level;
+    uint8_t  fields;
+    uint8_t  data[CTRL_SERIES_CHUNK_MAX];
+} ctrl_series_t;
+
 typedef struct
 {
     uint8_t command;
@@ -105,6 +149,8 @@ typedef struct
         ctrl_conn_params_t conn;
         ctrl_color_t       color;
         uint8_t            value;
+        uint16_t           sequence;
+        ctrl_series_req_t  series;
     };
 } ctrl_req_t, * ctrl_req_p;
 
@@ -117,6 +163,8 @@ typedef struct
         ctrl_conn_params_t conn;
         ctrl_status_t      status;
         ctrl_day_measmts_t day_measmts;
+        ctrl_events_t      events;
+        ctrl_series_t      series;
     };
 } ctrl_rsp_t, * ctrl_rsp_p;
 
@@ -196,7 +244,11 @@ static char * websocket_cgi_handler(int iIndex, int iNumParams, char * pcParam[]
 
 static void vWebSocket_Task(void * pvParameter)
 {
-    struct tcp_pcb * pcb = (struct tcp_pcb *) pvParameter;
+    struct tcp_pcb * pcb      = (struct tcp_pcb *) pvParameter;
+    uint32_t         sequence = 0;
+    size_t           len      = 0;
+    err_t            err      = ERR_OK;
+    char             record[PROFILER_RECORD_MAX];
 
     for (;;)
     {
@@ -206,22 +258,19 @@ static void vWebSocket_Task(void * pvParameter)
             break;
         }
 
-        int uptime = xTaskGetTickCount() * portTICK_PERIOD_MS / 1000;
-        int heap = 35000; //(int) xPortGetFreeHeapSize();
-        int led = 0; //!gpio_read(LED_PIN);
-
-        /* Generate response in JSON format */
-        char response[64];
-        int len = snprintf(response, sizeof (response),
-                "{\"uptime\" : \"%d\","
-                " \"heap\" : \"%d\","
-                " \"led\" : \"%d\"}", uptime, heap, led);
-        if (len < sizeof (response))
+        /* The profiler record is streamed once it is made, the TCP thread writes the frame */
+        len = Profiler_GetRecord(&sequence, record, sizeof(record));
+        if (0 < len)
         {
-            websocket_write(pcb, (unsigned char *) response, len, WS_TEXT_MODE);
+            err = websocket_write_tcpip(pcb, (unsigned char *) record, len, WS_TEXT_MODE);
+            if ((ERR_ABRT == err) || (ERR_CONN == err))
+            {
+                HTTPS_LOGI("Connection closed, deleting task");
+                break;
+            }
         }
 
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
+        vTaskDelay(1000 / portTICK_PERIOD_MS);
     }
 
     vTaskDelete(NULL);
@@ -397,10 +446,15 @@ static void ctrl_GetStatus(ctrl_req_p p_req, ctrl_rsp_p p_rsp, uint16_t * p_rsp_
     p_rsp->status.fan         = Climate_Task_GetFanSpeed();
     p_rsp->status.humidifier  = Climate_Task_IsHumidifierOn();
     p_rsp->status.refresh     = Climate_Task_IsNewDayMeasurementsAvailable();
+    p_rsp->status.fan_rpm     = (uint16_t)Climate_Task_GetFanRpm();
+    p_rsp->status.fan_alarms  = Climate_Task_GetFanAlarms();
+    p_rsp->status.events      = Climate_Task_GetEventsSequence();
     Climate_Task_GetMeasurements(&meas);
     p_rsp->status.pressure        = meas.pressure;
     p_rsp->status.temperature     = meas.temperature;
     p_rsp->status.humidity        = meas.humidity;
+    p_rsp->status.co2             = meas.co2;
+    p_rsp->status.light           = meas.light;
     p_rsp->status.datetime.length = strftime
                                     (
                                         p_rsp->status.datetime.data,
@@ -547,14 +601,75 @@ static void ctrl_GetDayMeasurements(ctrl_req_p p_req, ctrl_rsp_p p_rsp, uint16_t
     *p_rsp_len += sizeof(ctrl_day_measmts_t);
 }
 
+//-------------------------------------------------------------------------------------------------
+
+static void ctrl_GetEvents(ctrl_req_p p_req, ctrl_rsp_p p_rsp, uint16_t * p_rsp_len)
+{
+    p_rsp->command      = CMD_GET_EVENTS;
+    p_rsp->result       = SUCCESS;
+    /* The events after the sequence the client has seen */
+    p_rsp->events.count = Climate_Task_GetEvents
+                          (
+                              p_req->sequence,
+                              p_rsp->events.events,
+                              CLIMATE_ANOMALY_EVENTS
+                          );
+
+    *p_rsp_len  = OFFSET_OF(ctrl_rsp_p, events.events);
+    *p_rsp_len += (p_rsp->events.count * sizeof(climate_anomaly_event_t));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void ctrl_GetSeries(struct tcp_pcb * pcb, ctrl_req_p p_req, ctrl_rsp_p p_rsp, uint16_t * p_rsp_len)
+{
+    uint32_t count = 0;
+    time_t   next  = p_req->series.from;
+    size_t   size  = 0;
+    size_t   room  = tcp_sndbuf(pcb);
+
+    if (CLIMATE_HISTORY_LEVELS <= p_req->series.level)
+    {
+        return;
+    }
+    p_rsp->command       = CMD_GET_SERIES;
+    p_rsp->result        = SUCCESS;
+    p_rsp->series.level  = p_req->series.level;
+    p_rsp->series.fields = p_req->series.fields;
+
+    /* The client asks for the next chunk when it gets this one, the chunk is not larger than */
+    /* the TCP send buffer can take, so the slow client only gets the smaller chunks. The full */
+    /* buffer gives no samples, the client repeats the request later.                        */
+    room = (room > (CTRL_WS_HEADER_LEN + OFFSET_OF(ctrl_rsp_p, series.data))) ?
+           (room - CTRL_WS_HEADER_LEN - OFFSET_OF(ctrl_rsp_p, series.data)) : 0;
+    room = MIN(room, sizeof(p_rsp->series.data));
+    size = Climate_Series_Export
+           (
+               p_req->series.level,
+               p_req->series.from,
+               p_req->series.to,
+               p_req->series.fields,
+               p_rsp->series.data,
+               room,
+               &count,
+               &next
+           );
+    p_rsp->series.next  = (uint32_t)next;
+    p_rsp->series.count = (uint16_t)count;
+    HTTPS_LOGI("Series chunk: %lu samples in %u bytes", count, size);
+
+    *p_rsp_len  = OFFSET_OF(ctrl_rsp_p, series.data);
+    *p_rsp_len += size;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * This function is called when websocket frame is received.
  *
  * Note: this function is executed on TCP thread and should return as soon
- * as possible.
+ * as possible. It returns ERR_ABRT if the response write has aborted the connection.
  */
-static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len, uint8_t mode)
+static err_t websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len, uint8_t mode)
 {
     ctrl_req_p p_req   = (ctrl_req_p)data;
     uint16_t   rsp_len = 2;
@@ -599,6 +714,12 @@ static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len
         case CMD_GET_DAY_MEASUREMENTS:
             ctrl_GetDayMeasurements(p_req, &rsp, &rsp_len);
             break;
+        case CMD_GET_EVENTS:
+            ctrl_GetEvents(p_req, &rsp, &rsp_len);
+            break;
+        case CMD_GET_SERIES:
+            ctrl_GetSeries(pcb, p_req, &rsp, &rsp_len);
+            break;
         case 'A': // ADC
             /* This should be done on a separate thread in 'real' applications */
             //rnd = esp_random();
@@ -618,7 +739,7 @@ static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len
             break;
     }
 
-    websocket_write(pcb, (uint8_t *)&rsp, rsp_len, WS_BIN_MODE);
+    return websocket_write(pcb, (uint8_t *)&rsp, rsp_len, WS_BIN_MODE);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -645,6 +766,31 @@ static void websocket_open_cb(struct tcp_pcb * pcb, const char * uri)
     }
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * The custom file hooks of the HTTP server file system,
+ * the files which are not in fsdata are rendered on request.
+ */
+int fs_open_custom(struct fs_file * file, const char * name)
+{
+    return (HTTP_Metrics_Open(file, name) || HTTP_Trace_Open(file, name));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void fs_close_custom(struct fs_file * file)
+{
+    HTTP_Metrics_Close(file);
+    HTTP_Trace_Close(file);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int fs_read_custom(struct fs_file * file, char * buffer, int count)
+{
+    return HTTP_Trace_Read(file, buffer, count);
+}
+
 //-------------------------------------------------------------------------------------------------
 
 static void vHTTP_Server_Task(void * pvParameters)
@@ -0,0 +1,137 @@
+/* Chrome Trace Dump */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "fs.h"
+#include "trace.h"
+#include "http_trace.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define HTTP_TRACE_LOG  0
+
+#if (1 == HTTP_TRACE_LOG)
+static const char * gTAG = "TRACE";
+#    define HTTP_TRACE_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define HTTP_TRACE_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define HTTP_TRACE_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define HTTP_TRACE_LOGI(...)
+#    define HTTP_TRACE_LOGE(...)
+#    define HTTP_TRACE_LOGV(...)
+#endif
+
+#define HTTP_TRACE_URI  "/trace.json"
+
+//-------------------------------------------------------------------------------------------------
+
+#ifdef CONFIG_TRACE_ENABLE
+
+typedef struct
+{
+    trace_dump_t dump;
+    bool         busy;
+    uint32_t     dumps;
+} http_trace_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static http_trace_t gHttpTrace = {0};
+
+/* The same agent as in the file system headers (makefsdata.py) */
+static const char gcHttpTraceHeader[] =
+    "HTTP/1.0 200 OK\r\n"
+    "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)\r\n"
+    "Content-Type: application/json\r\n"
+    "Cache-Control: no-cache\r\n\r\n";
+
+#define HTTP_TRACE_HEADER_LEN  (sizeof(gcHttpTraceHeader) - 1)
+
+#endif /* CONFIG_TRACE_ENABLE */
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+int HTTP_Trace_Open(struct fs_file * file, const char * name)
+{
+#ifdef CONFIG_TRACE_ENABLE
+    if (0 != strcmp(name, HTTP_TRACE_URI))
+    {
+        return 0;
+    }
+
+    /* The dump state is not released till the previous dump is sent */
+    if (true == gHttpTrace.busy)
+    {
+        HTTP_TRACE_LOGE("The dump is in progress");
+        return 0;
+    }
+
+    gHttpTrace.busy = true;
+    gHttpTrace.dumps++;
+    Trace_DumpInit(&gHttpTrace.dump);
+
+    /* The header and the JSON are read by the parts of the send buffer, the size is bounded */
+    file->data                 = NULL;
+    file->len                  = (int)(HTTP_TRACE_HEADER_LEN + TRACE_DUMP_MAX);
+    file->index                = 0;
+    file->pextension           = &gHttpTrace.dump;
+    file->http_header_included = 1;
+    HTTP_TRACE_LOGI("Dump %lu", (unsigned long)gHttpTrace.dumps);
+
+    return 1;
+#else
+    (void)file;
+    (void)name;
+    return 0;
+#endif /* CONFIG_TRACE_ENABLE */
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void HTTP_Trace_Close(struct fs_file * file)
+{
+#ifdef CONFIG_TRACE_ENABLE
+    if (&gHttpTrace.dump == file->pextension)
+    {
+        gHttpTrace.busy = false;
+    }
+#else
+    (void)file;
+#endif /* CONFIG_TRACE_ENABLE */
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int HTTP_Trace_Read(struct fs_file * file, char * buffer, int count)
+{
+    size_t len = 0;
+
+#ifdef CONFIG_TRACE_ENABLE
+    if ((&gHttpTrace.dump == file->pextension) && (0 < count))
+    {
+        /* The header is read first, the JSON follows it in the same part */
+        if (HTTP_TRACE_HEADER_LEN > (size_t)file->index)
+        {
+            len = MIN((HTTP_TRACE_HEADER_LEN - (size_t)file->index), (size_t)count);
+            memcpy(buffer, &gcHttpTraceHeader[file->index], len);
+        }
+        len         += Trace_DumpRead(&gHttpTrace.dump, &buffer[len], ((size_t)count - len));
+        file->index += (int)len;
+    }
+#else
+    (void)file;
+    (void)buffer;
+    (void)count;
+#endif /* CONFIG_TRACE_ENABLE */
+
+    return (0 < len) ? (int)len : FS_READ_EOF;
+}
+
+//-------------------------------------------------------------------------------------------------
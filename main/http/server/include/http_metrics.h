@@ -0,0 +1,16 @@
+#ifndef __HTTP_METRICS_H__
+#define __HTTP_METRICS_H__
+
+#include "fs.h"
+
+/* This interface serves the Prometheus text format (version 0.0.4) scrape at "/metrics":   */
+/*  - the readings are collected and rendered when the file is opened by the HTTP server;   */
+/*  - the page is rendered into the static buffer, so the scrape does not use the heap;     */
+/*  - one scrape is served at a time, the concurrent scrape gets "404 Not Found".           */
+
+/* The custom file hooks of the HTTP server file system, 1 - the file is opened */
+int  HTTP_Metrics_Open(struct fs_file * file, const char * name);
+void HTTP_Metrics_Close(struct fs_file * file);
+void HTTP_Metrics_Test(void);
+
+#endif /* __HTTP_METRICS_H__ */
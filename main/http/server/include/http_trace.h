@@ -0,0 +1,18 @@
+#ifndef __HTTP_TRACE_H__
+#define __HTTP_TRACE_H__
+
+#include "fs.h"
+
+/* This interface serves the trace rings as the Chrome trace JSON at "/trace.json":        */
+/*  - the JSON is rendered by the parts while it is sent, so the dump does not use the heap; */
+/*  - the file size is the upper bound, the end of the JSON is the end of the connection;   */
+/*  - one dump is served at a time, the concurrent dump gets "404 Not Found".               */
+/* The file is not found till CONFIG_TRACE_ENABLE is set.                                    */
+
+/* The custom file hooks of the HTTP server file system, 1 - the file is opened */
+int  HTTP_Trace_Open(struct fs_file * file, const char * name);
+void HTTP_Trace_Close(struct fs_file * file);
+/* Returns the length of the read part, FS_READ_EOF - the end */
+int  HTTP_Trace_Read(struct fs_file * file, char * buffer, int count);
+
+#endif /* __HTTP_TRACE_H__ */
@@ -0,0 +1,32 @@
+#ifndef __LED_DLI_H__
+#define __LED_DLI_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "led_strip_rgb.h"
+
+/* This interface integrates the light the plants get from the LEDs (the daily light integral): */
+/*  - the PPFD is estimated from the LEDs output weighted by the channels efficacy;             */
+/*  - every LED task integrates its own LEDs on every frame, so no locking is needed;           */
+/*  - the integral of the current day survives the reboot.                                      */
+
+typedef enum
+{
+    LED_DLI_SOURCE_RGB = 0,
+    LED_DLI_SOURCE_UWF,
+    LED_DLI_SOURCES,
+} led_dli_source_t;
+
+void     LED_DLI_Init(void);
+/* 0.01 umol/m2/s */
+uint32_t LED_DLI_GetPpfd(led_color_p p_rgb, uint8_t u, uint8_t w, uint8_t f);
+/* The previous PPFD is held till now (us) */
+void     LED_DLI_Integrate(led_dli_source_t source, uint32_t ppfd, int64_t now);
+/* Starts the new day integral, the same day start keeps the integral */
+void     LED_DLI_StartDay(time_t day);
+/* mmol/m2 since the day start */
+uint32_t LED_DLI_Get(void);
+void     LED_DLI_Test(void);
+
+#endif /* __LED_DLI_H__ */
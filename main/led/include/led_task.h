@@ -2,6 +2,7 @@
 #define __LED_TASK_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "led_strip_rgb.h"
 
 typedef enum
@@ -21,6 +22,8 @@ typedef enum
     LED_CMD_W_INDICATE_SINE,
     LED_CMD_F_INDICATE_BRIGHTNESS,
     LED_CMD_F_INDICATE_SINE,
+    LED_CMD_RGB_INDICATE_SCHEDULE,
+    LED_CMD_UW_INDICATE_SCHEDULE,
 } led_command_t;
 
 typedef struct
@@ -46,13 +49,25 @@ typedef struct
     uint32_t      duration;
 } led_message_t, * led_message_p;
 
+typedef struct
+{
+    led_color_t rgb;
+    uint8_t     u;
+    uint8_t     w;
+} led_state_t, * led_state_p;
+
+/* Returns the LEDs state for the current moment, false - if the state is not available */
+typedef bool (* led_schedule_fp_t)(led_state_p p_state);
+
 void    LED_Task_Init(void);
 void    LED_Task_SendMsg(led_message_p p_msg);
 void    LED_Task_DetermineColor(led_message_p p_msg, led_color_p p_color);
+void    LED_Task_SetSchedule(led_schedule_fp_t fp_schedule);
 void    LED_Task_GetCurrentColor(led_color_p p_color);
 uint8_t LED_Task_GetCurrentUltraViolet(void);
 uint8_t LED_Task_GetCurrentWhite(void);
 uint8_t LED_Task_GetCurrentFito(void);
 void    LED_Task_Test(void);
+void    LED_Task_Bench(void);
 
 #endif /* __LED_TASK_H__ */
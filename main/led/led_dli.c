@@ -0,0 +1,262 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_system.h"
+#include "esp_log.h"
+
+#include "types.h"
+#include "led_dli.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define LED_DLI_LOG  0
+
+#if (1 == LED_DLI_LOG)
+static const char * gTAG = "DLI";
+#    define DLI_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define DLI_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define DLI_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define DLI_LOGI(...)
+#    define DLI_LOGE(...)
+#    define DLI_LOGV(...)
+#endif
+
+#define LED_DLI_KEY  (0xD1D1CAFE)
+
+//-------------------------------------------------------------------------------------------------
+
+/* The PPFD of the channel is proportional to its level (the PWM duty). The efficacy is the  */
+/* PPFD at the plants level with the channel at the full level, the RGB strip is decorative. */
+enum
+{
+    DLI_CHANNEL_R = 0,
+    DLI_CHANNEL_G,
+    DLI_CHANNEL_B,
+    DLI_CHANNEL_U,
+    DLI_CHANNEL_W,
+    DLI_CHANNEL_F,
+    DLI_CHANNELS,
+};
+
+enum
+{
+    DLI_LEVEL_MAX  = 255,
+    /* The PPFD is in 0.01 umol/m2/s */
+    DLI_PPFD_SCALE = 100,
+    /* The integrator rest is in 0.01 umol/m2/s * us */
+    DLI_UMOL_UNITS = (DLI_PPFD_SCALE * 1000000),
+    /* The stalled frame is not integrated longer than this (us) */
+    DLI_DT_MAX_US  = 1000000,
+    DLI_UMOL_MMOL  = 1000,
+};
+
+typedef struct
+{
+    /* umol/m2, it wraps */
+    uint32_t total;
+    /* The total at the day start */
+    uint32_t mark;
+} dli_source_t, * dli_source_p;
+
+typedef struct
+{
+    dli_source_t sources[LED_DLI_SOURCES];
+    /* The start of the day */
+    time_t       day;
+    uint32_t     key;
+} dli_state_t, * dli_state_p;
+
+typedef struct
+{
+    /* The part below 1 umol/m2 */
+    uint64_t rest;
+    /* The time of the previous frame (us), 0 - none */
+    int64_t  last;
+    /* The PPFD of the previous frame */
+    uint32_t ppfd;
+} dli_integrator_t, * dli_integrator_p;
+
+//-------------------------------------------------------------------------------------------------
+
+/* umol/m2/s */
+static const uint16_t gcDliEfficacy[DLI_CHANNELS] =
+{
+    [DLI_CHANNEL_R] = 12,
+    [DLI_CHANNEL_G] = 8,
+    [DLI_CHANNEL_B] = 10,
+    /* The UV-A is mostly out of the PAR range */
+    [DLI_CHANNEL_U] = 10,
+    [DLI_CHANNEL_W] = 300,
+    [DLI_CHANNEL_F] = 150,
+};
+
+/* The integral of the day is kept over the reboot */
+static dli_state_t RTC_NOINIT_ATTR gDli;
+/* Every integrator is used by its LED task only */
+static dli_integrator_t gDliIntegrators[LED_DLI_SOURCES] = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static void dli_Integrate(dli_source_p p_source, dli_integrator_p p_integrator, uint32_t ppfd, int64_t now)
+{
+    int64_t dt = 0;
+
+    /* The output of the previous frame was held till now */
+    if (0 < p_integrator->last)
+    {
+        dt = MIN(MAX((now - p_integrator->last), 0), DLI_DT_MAX_US);
+    }
+    p_integrator->rest += ((uint64_t)p_integrator->ppfd * (uint64_t)dt);
+    p_source->total    += (uint32_t)(p_integrator->rest / DLI_UMOL_UNITS);
+    p_integrator->rest %= DLI_UMOL_UNITS;
+    p_integrator->ppfd  = ppfd;
+    p_integrator->last  = now;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void dli_StartDay(dli_state_p p_state, time_t day)
+{
+    uint32_t source = 0;
+
+    if (day != p_state->day)
+    {
+        for (source = 0; source < LED_DLI_SOURCES; source++)
+        {
+            p_state->sources[source].mark = p_state->sources[source].total;
+        }
+        p_state->day = day;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t dli_Get(dli_state_p p_state)
+{
+    uint32_t result = 0;
+    uint32_t source = 0;
+
+    /* The totals wrap, their differences do not */
+    for (source = 0; source < LED_DLI_SOURCES; source++)
+    {
+        result += (p_state->sources[source].total - p_state->sources[source].mark);
+    }
+
+    return (result / DLI_UMOL_MMOL);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_DLI_Init(void)
+{
+    if (LED_DLI_KEY != gDli.key)
+    {
+        /* The power on */
+        memset(&gDli, 0, sizeof(gDli));
+        gDli.key = LED_DLI_KEY;
+    }
+    memset(gDliIntegrators, 0, sizeof(gDliIntegrators));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t LED_DLI_GetPpfd(led_color_p p_rgb, uint8_t u, uint8_t w, uint8_t f)
+{
+    uint32_t result = 0;
+
+    result += (gcDliEfficacy[DLI_CHANNEL_R] * p_rgb->r);
+    result += (gcDliEfficacy[DLI_CHANNEL_G] * p_rgb->g);
+    result += (gcDliEfficacy[DLI_CHANNEL_B] * p_rgb->b);
+    result += (gcDliEfficacy[DLI_CHANNEL_U] * u);
+    result += (gcDliEfficacy[DLI_CHANNEL_W] * w);
+    result += (gcDliEfficacy[DLI_CHANNEL_F] * f);
+
+    return (result * DLI_PPFD_SCALE / DLI_LEVEL_MAX);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_DLI_Integrate(led_dli_source_t source, uint32_t ppfd, int64_t now)
+{
+    dli_Integrate(&gDli.sources[source], &gDliIntegrators[source], ppfd, now);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_DLI_StartDay(time_t day)
+{
+    /* This call is not thread safe but this is acceptable */
+    if (day != gDli.day)
+    {
+        DLI_LOGI("DLI of the previous day: %lu mmol/m2", dli_Get(&gDli));
+    }
+    dli_StartDay(&gDli, day);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t LED_DLI_Get(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return dli_Get(&gDli);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void LED_DLI_Test(void)
+{
+    enum
+    {
+        FRAME_US    = 10000,
+        HOUR_FRAMES = (3600000000LL / FRAME_US),
+    };
+    dli_state_t      state      = {0};
+    dli_integrator_t integrator = {0};
+    led_color_t      color      = {0};
+    int64_t          now        = 0;
+    uint32_t         frame      = 0;
+    bool             result     = true;
+
+    /* The full white and the full red */
+    result &= ((300 * DLI_PPFD_SCALE) == LED_DLI_GetPpfd(&color, 0, DLI_LEVEL_MAX, 0));
+    color.r = DLI_LEVEL_MAX;
+    result &= ((12 * DLI_PPFD_SCALE) == LED_DLI_GetPpfd(&color, 0, 0, 0));
+    color.r = 0;
+    result &= (0 == LED_DLI_GetPpfd(&color, 0, 0, 0));
+
+    /* 100 umol/m2/s for 1 hour with the jittered frames - 360 mmol/m2 */
+    now = 1;
+    for (frame = 0; frame < HOUR_FRAMES; frame++)
+    {
+        dli_Integrate(&state.sources[LED_DLI_SOURCE_UWF], &integrator, (100 * DLI_PPFD_SCALE), now);
+        now += ((0 == (frame % 2)) ? (FRAME_US - 3000) : (FRAME_US + 3000));
+    }
+    dli_Integrate(&state.sources[LED_DLI_SOURCE_UWF], &integrator, 0, now);
+    result &= (360 == dli_Get(&state));
+    DLI_LOGI("DLI Constant: %lu mmol/m2", dli_Get(&state));
+
+    /* The new PPFD counts from the next frame, the stalled frame is limited */
+    dli_Integrate(&state.sources[LED_DLI_SOURCE_RGB], &integrator, (1000 * DLI_PPFD_SCALE), (now + 5000000));
+    dli_Integrate(&state.sources[LED_DLI_SOURCE_RGB], &integrator, 0, (now + 7000000));
+    result &= (361 == dli_Get(&state));
+
+    /* The same day keeps the integral, the next day restarts it */
+    dli_StartDay(&state, 86400);
+    result &= (0 == dli_Get(&state));
+    state.sources[LED_DLI_SOURCE_RGB].total += 5000;
+    dli_StartDay(&state, 86400);
+    result &= (5 == dli_Get(&state));
+
+    /* The total wraps */
+    state.sources[LED_DLI_SOURCE_UWF].total = (UINT32_MAX - 1000);
+    dli_StartDay(&state, (2 * 86400));
+    state.sources[LED_DLI_SOURCE_UWF].total += 3000;
+    result &= (3 == dli_Get(&state));
+
+    DLI_LOGI("DLI Integrator - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -11,6 +11,10 @@
 #include "led_task.h"
 #include "led_strip_rgb.h"
 #include "led_strip_uwf.h"
+#include "led_dli.h"
+#include "profiler.h"
+#include "trace.h"
+#include "bench.h"
 
 #include "esp_timer.h"
 #include "esp_log.h"
@@ -88,9 +92,13 @@ typedef struct
 
 typedef struct
 {
-    leds_t u;
-    leds_t w;
-    leds_t f;
+    leds_t      u;
+    leds_t      w;
+    leds_t      f;
+    /* The schedule is sampled once per frame for all the channels */
+    led_state_t schedule;
+    bool        sampled;
+    bool        scheduled;
 } leds_uwf_t;
 
 //-------------------------------------------------------------------------------------------------
@@ -102,6 +110,8 @@ static leds_rgb_t    gLedsRgb      = {0};
 static QueueHandle_t gLedsUwfQueue = {0};
 static leds_uwf_t    gLedsUwf      = {0};
 
+static led_schedule_fp_t gSchedule = NULL;
+
 //-------------------------------------------------------------------------------------------------
 
 static void rgb_RGBtoHSV(led_color_p p_color, hsv_p p_hsv)
@@ -686,6 +696,62 @@ static void rgb_SetIndication_Sine(led_message_p p_msg)
     gLedsRgb.fp_iterate();
 }
 
+//-------------------------------------------------------------------------------------------------
+//--- Schedule Color Indication -------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static void rgb_IterateIndication_Schedule(void)
+{
+    led_state_t state   = {0};
+    led_color_t result  = {0};
+    double      percent = 1.0;
+
+    /* Keep the last color while the schedule is not available */
+    if ((NULL == gSchedule) || (false == gSchedule(&state)))
+    {
+        return;
+    }
+
+    result.dword = state.rgb.dword;
+    /* Smooth transition from the color the schedule was started with */
+    if (gLedsRgb.time.duration < gLedsRgb.time.interval)
+    {
+        percent = (1.0 * gLedsRgb.time.duration / gLedsRgb.time.interval);
+        rgb_SmoothColorTransition(&gLedsRgb.src_color, &state.rgb, percent, &result);
+        gLedsRgb.time.duration += gLedsRgb.time.delta;
+    }
+    LED_Strip_RGB_SetColor(&result);
+    LED_Strip_RGB_Update();
+
+    LED_LOGI("C(%d.%d.%d)-P:%d", result.r, result.g, result.b, (int)(100 * percent));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void rgb_SetIndication_Schedule(led_message_p p_msg)
+{
+    enum
+    {
+        TRANSITION_TIME_MS = 1200,
+    };
+
+    /* Set the default tick interval to 30 ms */
+    gLedsRgb.tick.interval = 3;
+    gLedsRgb.tick.counter  = gLedsRgb.tick.interval;
+    gLedsRgb.time.delta    = (gLedsRgb.tick.interval * LED_TASK_TICK_MS);
+
+    /* The repeated request does not restart the indication */
+    if (rgb_IterateIndication_Schedule != gLedsRgb.fp_iterate)
+    {
+        gLedsRgb.src_color.dword = 0;
+        LED_Strip_RGB_GetAverageColor(&gLedsRgb.src_color);
+        gLedsRgb.time.interval   = TRANSITION_TIME_MS;
+        gLedsRgb.time.duration   = 0;
+    }
+    gLedsRgb.fp_iterate = rgb_IterateIndication_Schedule;
+    gLedsRgb.fp_iterate();
+}
+
 //-------------------------------------------------------------------------------------------------
 
 static void rgb_ProcessMsg(led_message_p p_msg)
@@ -714,6 +780,9 @@ static void rgb_ProcessMsg(led_message_p p_msg)
         case LED_CMD_RGB_INDICATE_SINE:
             rgb_SetIndication_Sine(p_msg);
             break;
+        case LED_CMD_RGB_INDICATE_SCHEDULE:
+            rgb_SetIndication_Schedule(p_msg);
+            break;
         default:
             gLedsRgb.command       = LED_CMD_EMPTY;
             gLedsRgb.fp_iterate    = NULL;
@@ -727,6 +796,8 @@ static void rgb_ProcessMsg(led_message_p p_msg)
 
 static void rgb_Process(void)
 {
+    TRACE_SPAN(TRACE_RGB_PROCESS);
+
     if (LED_CMD_EMPTY == gLedsRgb.command) return;
 
     gLedsRgb.tick.counter--;
@@ -750,6 +821,7 @@ static void vRGB_Task(void * pvParameters)
     };
     BaseType_t    status = pdFAIL;
     led_message_t msg    = {0};
+    led_color_t   color  = {0};
 
     LED_LOGI("LED RGB Task started...");
 
@@ -775,6 +847,10 @@ static void vRGB_Task(void * pvParameters)
         {
             rgb_Process();
         }
+
+        /* The light of the frame is integrated */
+        LED_Strip_RGB_GetAverageColor(&color);
+        LED_DLI_Integrate(LED_DLI_SOURCE_RGB, LED_DLI_GetPpfd(&color, 0, 0, 0), esp_timer_get_time());
     }
 }
 
@@ -964,10 +1040,94 @@ static void fito_IterateIndication_Sine(void)
     uwf_IterateIndication_Sine(&gLedsUwf.f);
 }
 
+//-------------------------------------------------------------------------------------------------
+//--- Schedule Brightness Indication --------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static void uwf_IterateIndication_Schedule(leds_p p_leds, uint8_t value)
+{
+    double percent = 1.0;
+
+    /* Smooth transition from the brightness the schedule was started with */
+    if (p_leds->time.duration < p_leds->time.interval)
+    {
+        percent = (1.0 * p_leds->time.duration / p_leds->time.interval);
+        value   = uwf_SmoothBrightnessTransition(p_leds->src, value, percent);
+        p_leds->time.duration += p_leds->time.delta;
+    }
+    p_leds->fp_set(value);
+
+    LED_LOGI("Sc:V(%d)-P:%d", value, (int)(100 * percent));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void uwf_SetIndication_Schedule(leds_p p_leds, iterate_fp_t fp_iterate, led_message_p p_msg)
+{
+    enum
+    {
+        TRANSITION_TIME_MS = 1200,
+    };
+
+    p_leds->command = p_msg->command;
+
+    /* Set the default tick interval to 30 ms */
+    p_leds->tick.interval = 3;
+    p_leds->tick.counter  = p_leds->tick.interval;
+    p_leds->time.delta    = (p_leds->tick.interval * LED_TASK_TICK_MS);
+
+    /* The repeated request does not restart the indication */
+    if (fp_iterate != p_leds->fp_iterate)
+    {
+        p_leds->src           = p_leds->fp_get();
+        p_leds->time.interval = TRANSITION_TIME_MS;
+        p_leds->time.duration = 0;
+    }
+    p_leds->fp_iterate = fp_iterate;
+    p_leds->fp_iterate();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the schedule state of the frame, false - if the state is not available */
+static bool uwf_SampleSchedule(void)
+{
+    if (false == gLedsUwf.sampled)
+    {
+        gLedsUwf.sampled   = true;
+        gLedsUwf.scheduled = ((NULL != gSchedule) && (true == gSchedule(&gLedsUwf.schedule)));
+    }
+
+    return gLedsUwf.scheduled;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void ultraviolet_IterateIndication_Schedule(void)
+{
+    /* Keep the last brightness while the schedule is not available */
+    if (true == uwf_SampleSchedule())
+    {
+        uwf_IterateIndication_Schedule(&gLedsUwf.u, gLedsUwf.schedule.u);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void white_IterateIndication_Schedule(void)
+{
+    /* Keep the last brightness while the schedule is not available */
+    if (true == uwf_SampleSchedule())
+    {
+        uwf_IterateIndication_Schedule(&gLedsUwf.w, gLedsUwf.schedule.w);
+    }
+}
+
 //-------------------------------------------------------------------------------------------------
 
 static void uwf_ProcessMsg(led_message_p p_msg)
 {
+    gLedsUwf.sampled = false;
     switch (p_msg->command)
     {
         case LED_CMD_UV_INDICATE_BRIGHTNESS:
@@ -994,6 +1154,10 @@ static void uwf_ProcessMsg(led_message_p p_msg)
             gLedsUwf.f.fp_iterate = fito_IterateIndication_Sine;
             uwf_SetIndication_Sine(&gLedsUwf.f, p_msg);
             break;
+        case LED_CMD_UW_INDICATE_SCHEDULE:
+            uwf_SetIndication_Schedule(&gLedsUwf.u, ultraviolet_IterateIndication_Schedule, p_msg);
+            uwf_SetIndication_Schedule(&gLedsUwf.w, white_IterateIndication_Schedule, p_msg);
+            break;
         default:
             break;
     }
@@ -1021,6 +1185,7 @@ static void uwf_ProcessLeds(leds_p p_leds)
 
 static void uwf_Process(void)
 {
+    gLedsUwf.sampled = false;
     uwf_ProcessLeds(&gLedsUwf.u);
     uwf_ProcessLeds(&gLedsUwf.w);
     uwf_ProcessLeds(&gLedsUwf.f);
@@ -1036,6 +1201,7 @@ static void vUWF_Task(void * pvParameters)
     };
     BaseType_t    status = pdFAIL;
     led_message_t msg    = {0};
+    led_color_t   black  = {0};
 
     LED_LOGI("LED UWF Task started...");
 
@@ -1061,6 +1227,14 @@ static void vUWF_Task(void * pvParameters)
         {
             uwf_Process();
         }
+
+        /* The light of the frame is integrated */
+        LED_DLI_Integrate
+        (
+            LED_DLI_SOURCE_UWF,
+            LED_DLI_GetPpfd(&black, gLedsUwf.u.fp_get(), gLedsUwf.w.fp_get(), gLedsUwf.f.fp_get()),
+            esp_timer_get_time()
+        );
     }
 }
 
@@ -1068,8 +1242,13 @@ static void vUWF_Task(void * pvParameters)
 
 void LED_Task_Init(void)
 {
+    /* The light integral of the day is restored after the reboot */
+    LED_DLI_Init();
+
     gLedsRgbQueue = xQueueCreate(20, sizeof(led_message_t));
     gLedsUwfQueue = xQueueCreate(20, sizeof(led_message_t));
+    Profiler_AddQueue("LED RGB", gLedsRgbQueue);
+    Profiler_AddQueue("LED UWF", gLedsUwfQueue);
 
     (void)xTaskCreatePinnedToCore(vRGB_Task, "LED RGB", 4096, NULL, 10, NULL, CORE1);
     (void)xTaskCreatePinnedToCore(vUWF_Task, "LED UWF", 4096, NULL, 10, NULL, CORE1);
@@ -1088,8 +1267,9 @@ void LED_Task_SendMsg(led_message_p p_msg)
         (int)p_msg->interval
     );
 
-    if ((LED_CMD_RGB_INDICATE_COLOR <= p_msg->command) && 
-        (LED_CMD_RGB_SWITCH_OFF >= p_msg->command))
+    if (((LED_CMD_RGB_INDICATE_COLOR <= p_msg->command) &&
+         (LED_CMD_RGB_SWITCH_OFF >= p_msg->command)) ||
+        (LED_CMD_RGB_INDICATE_SCHEDULE == p_msg->command))
     {
         (void)xQueueSendToBack(gLedsRgbQueue, (void *)p_msg, (TickType_t)0);
     }
@@ -1144,6 +1324,14 @@ void LED_Task_DetermineColor(led_message_p p_msg, led_color_p p_color)
 
 //-------------------------------------------------------------------------------------------------
 
+void LED_Task_SetSchedule(led_schedule_fp_t fp_schedule)
+{
+    /* The schedule is called from the LED tasks context on every frame */
+    gSchedule = fp_schedule;
+}
+
+//-------------------------------------------------------------------------------------------------
+
 void LED_Task_GetCurrentColor(led_color_p p_color)
 {
     /* This call is not thread safe but this is acceptable */
@@ -1683,3 +1871,49 @@ void LED_Task_Test(void)
 }
 
 //-------------------------------------------------------------------------------------------------
+//--- Benchmarks ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The input depends on the iteration and the output is summed, so nothing is hoisted */
+static void rgb_BenchHSV(void * p_ctx, uint32_t count)
+{
+    volatile uint32_t * p_sum = (volatile uint32_t *)p_ctx;
+    led_color_t         color = {0};
+    hsv_t               hsv   = {0};
+    uint32_t            idx   = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        color.r = (uint8_t)idx;
+        color.g = (uint8_t)((idx >> 8) ^ 0x5A);
+        color.b = (uint8_t)(255 - idx);
+        rgb_RGBtoHSV(&color, &hsv);
+        rgb_HSVtoRGB(&hsv, &color);
+        *p_sum += color.dword;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void uwf_BenchTransition(void * p_ctx, uint32_t count)
+{
+    volatile uint32_t * p_sum = (volatile uint32_t *)p_ctx;
+    uint32_t            idx   = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        *p_sum += uwf_SmoothBrightnessTransition((uint8_t)idx, (uint8_t)~idx, ((idx & 0xFF) / 255.0));
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Task_Bench(void)
+{
+    volatile uint32_t sum = 0;
+
+    Bench_Run("led", "rgb_RGBtoHSV+rgb_HSVtoRGB", rgb_BenchHSV, (void *)&sum, NULL);
+    Bench_Run("led", "uwf_SmoothBrightnessTransition", uwf_BenchTransition, (void *)&sum, NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
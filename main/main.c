@@ -2,11 +2,13 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "nvs_flash.h"
 
 #include "led_task.h"
 #include "wifi_task.h"
 #include "time_task.h"
 #include "climate_task.h"
+#include "profiler.h"
 
 //-------------------------------------------------------------------------------------------------
 
@@ -30,6 +32,11 @@ void app_main(void)
     MAIN_LOGI("*");
     MAIN_LOGI("--- Application Started ----------------------------------------");
 
+    /* The NVS is shared by the WiFi and the Time tasks, so it is initialized once before them */
+    ESP_ERROR_CHECK(nvs_flash_init());
+
+    /* The profiler measures the interrupt latency on the core 0 */
+    Profiler_Init();
     LED_Task_Init();
     WiFi_Task_Init();
     Time_Task_Init();
@@ -37,15 +44,44 @@ void app_main(void)
 
 //---    LED_Task_Test();
 //---    LED_Strip_UWF_Test();
+//---    LED_DLI_Test();
 //---    FAN_Test();
 //---    Humidifier_Test();
+//---    SCD4x_Test();
+//---    BH1750_Test();
 //---    I2C_Test();
+//---    I2C_Scheduler_Test();
 //---    Climate_Task_Test();
+//---    Climate_History_Test();
+//---    Climate_Archive_Test();
+//---    Climate_Fusion_Test();
+//---    Climate_Anomaly_Test();
+//---    Climate_Series_Test();
 //---    Time_Task_Test();
+//---    Weather_Test();
+//---    Time_Sync_Test();
+//---    UDP_SNTP_Test();
+//---    UDP_Link_Test();
+//---    HTTP_Metrics_Test();
+//---    Profiler_Test();
+//---    Trace_Test();
+//---    Bench_Test();
+//---    Fuzz_Test();
+//---    UDP_DNS_Test();
+//---    HTTPD_Test();
+
+    /* The benchmarks log the JSON lines "BENCH: {...}" (BENCH_LOG), run them one by one */
+//---    LED_Task_Bench();
+//---    Time_Task_Bench();
+//---    UDP_DNS_Bench();
+//---    Humidifier_Bench();
+//---    Climate_History_Bench();
+//---    HTTPD_Bench();
 
     while (1)
     {
         vTaskDelay(pdMS_TO_TICKS(1000));
+        Profiler_Process();
     };
 }
 
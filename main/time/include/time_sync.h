@@ -0,0 +1,21 @@
+#ifndef __TIME_SYNC_H__
+#define __TIME_SYNC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "types.h"
+
+/* This interface keeps the system time running between the SNTP synchronizations: */
+/*  - the last known time is restored from NVS after the power loss;               */
+/*  - the SNTP corrections are slewed with the bounded rate instead of the steps;  */
+/*  - the measured RTC drift is compensated while the SNTP server is unreachable.  */
+
+void       Time_Sync_Init(void);
+FW_BOOLEAN Time_Sync_Process(void);
+bool       Time_Sync_IsSynced(void);
+time_t     Time_Sync_GetLastSync(void);
+void       Time_Sync_Test(void);
+
+#endif /* __TIME_SYNC_H__ */
@@ -19,5 +19,6 @@ void       Time_Task_Init(void);
 void       Time_Task_SendMsg(time_message_t * p_msg);
 FW_BOOLEAN Time_Task_IsInSunImitationMode(void);
 void       Time_Task_Test(void);
+void       Time_Task_Bench(void);
 
 #endif /* __TIME_TASK_H__ */
@@ -0,0 +1,27 @@
+#ifndef __WEATHER_H__
+#define __WEATHER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "types.h"
+
+/* This interface replays the weather trace stored in the "weather" flash partition */
+
+typedef struct
+{
+    /* Cloud cover (percents) */
+    uint8_t  cloud;
+    /* Temperature target (0.01 C) - the same units as the climate measurements */
+    int16_t  temperature;
+    /* Humidity target (0.01 %) - the same units as the climate measurements */
+    uint16_t humidity;
+} weather_t, * weather_p;
+
+FW_RESULT Weather_Init(void);
+bool      Weather_IsAvailable(void);
+FW_RESULT Weather_Get(time_t t, weather_p p_weather);
+void      Weather_Test(void);
+
+#endif /* __WEATHER_H__ */
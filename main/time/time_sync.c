@@ -0,0 +1,532 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_sntp.h"
+#include "nvs_flash.h"
+
+#include "types.h"
+#include "time_sync.h"
+
+//-------------------------------------------------------------------------------------------------
+
+/* The SNTP response is not applied to the system time directly (sntp_sync_time() is         */
+/* overridden). The offset is passed to the Time task which:                                */
+/*  - steps the time if the offset is too large to be slewed (the first sync after the power */
+/*    loss, when the time is estimated from the last saved one);                             */
+/*  - otherwise slews the time with the bounded rate, so the LED transitions do not jump,    */
+/*    the sub-second remainder is slewed by the system clock (adjtime);                      */
+/*  - estimates the RTC drift from the offsets of the uncorrected clock between the syncs    */
+/*    and compensates it while the SNTP server is unreachable.                               */
+
+#define SYNC_LOG  1
+
+#if (1 == SYNC_LOG)
+static const char * gTAG = "SYNC";
+#    define SYNC_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SYNC_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define SYNC_LOGW(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define SYNC_LOGI(...)
+#    define SYNC_LOGE(...)
+#    define SYNC_LOGW(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    /* The offsets above are stepped, the rest are slewed (microseconds) */
+    SYNC_STEP_MIN_US       = (60 * 1000000),
+    /* The offsets below are slewed by the system clock (microseconds) */
+    SYNC_ADJUST_MAX_US     = 1000000,
+    /* The slew rate - 50 ms per second (ppm) */
+    SYNC_SLEW_RATE_PPM     = 50000,
+    /* The drift is measured over the intervals not shorter than (microseconds) */
+    SYNC_DRIFT_INTERVAL_US = (10 * 60 * 1000000),
+    /* The measurements above are considered as the time changes, not the drift (ppb) */
+    SYNC_DRIFT_MAX_PPB     = 500000,
+    /* The drift estimation is smoothed as 1/(2^SHIFT) */
+    SYNC_DRIFT_EWMA_SHIFT  = 2,
+    /* The last known time is saved periodically to be restored after the power loss */
+    SYNC_SAVE_PERIOD_S     = (60 * 60),
+    /* The time before this year is not valid */
+    SYNC_YEAR_MIN          = 2024,
+};
+
+typedef struct
+{
+    int64_t true_us;
+    int64_t offset_us;
+} sync_sample_t;
+
+typedef struct
+{
+    /* The reference point - the true time and the offset of the uncorrected clock */
+    int64_t  time_us;
+    int64_t  raw_us;
+    bool     reference;
+    /* The estimated drift - positive if the clock is slow (ppb) */
+    int32_t  ppb;
+    uint32_t samples;
+} sync_drift_t, * sync_drift_p;
+
+typedef struct
+{
+    sync_drift_t drift;
+    /* All the corrections applied to the clock since the boot */
+    int64_t      corrected_us;
+    /* The correction which is not applied yet */
+    int64_t      pending_us;
+    /* The drift compensation remainder */
+    int64_t      compensation_ns;
+    int64_t      tick_us;
+    int64_t      save_us;
+    time_t       sync_s;
+    bool         valid;
+    bool         synced;
+} sync_clock_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static QueueHandle_t gSyncQueue = NULL;
+static sync_clock_t  gClock     = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static int64_t sync_ToUs(const struct timeval * p_tv)
+{
+    return ((int64_t)p_tv->tv_sec * 1000000 + p_tv->tv_usec);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Updates the drift estimation with the offset of the uncorrected clock at the true time */
+static FW_BOOLEAN sync_DriftUpdate(sync_drift_p p_drift, int64_t true_us, int64_t raw_us)
+{
+    int64_t interval = 0;
+    int64_t change   = 0;
+    int32_t measured = 0;
+
+    if (false == p_drift->reference)
+    {
+        p_drift->time_us   = true_us;
+        p_drift->raw_us    = raw_us;
+        p_drift->reference = true;
+        return FW_FALSE;
+    }
+
+    /* The offset change over the short interval is mostly the SNTP jitter */
+    interval = (true_us - p_drift->time_us);
+    if (SYNC_DRIFT_INTERVAL_US > interval)
+    {
+        return FW_FALSE;
+    }
+
+    /* The time is changed by someone else - start from the new reference */
+    change              = (raw_us - p_drift->raw_us);
+    p_drift->time_us    = true_us;
+    p_drift->raw_us     = raw_us;
+    if (llabs(change) > (interval / 1000000 * SYNC_DRIFT_MAX_PPB / 1000))
+    {
+        return FW_FALSE;
+    }
+
+    measured = (int32_t)(change * 1000000 / (interval / 1000));
+    if (0 == p_drift->samples)
+    {
+        p_drift->ppb = measured;
+    }
+    else
+    {
+        p_drift->ppb += ((measured - p_drift->ppb) / (1 << SYNC_DRIFT_EWMA_SHIFT));
+    }
+    if (UINT32_MAX > p_drift->samples)
+    {
+        p_drift->samples++;
+    }
+
+    return FW_TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the part of the correction which can be applied during the elapsed time */
+static int64_t sync_SlewStep(int64_t pending_us, int64_t elapsed_us)
+{
+    int64_t limit = (elapsed_us * SYNC_SLEW_RATE_PPM / 1000000);
+
+    if (pending_us > limit)
+    {
+        return limit;
+    }
+    if (pending_us < -limit)
+    {
+        return -limit;
+    }
+    return pending_us;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void sync_Shift(int64_t delta_us)
+{
+    struct timeval tv = {0};
+    int64_t        us = 0;
+
+    gettimeofday(&tv, NULL);
+    us         = (sync_ToUs(&tv) + delta_us);
+    tv.tv_sec  = (time_t)(us / 1000000);
+    tv.tv_usec = (suseconds_t)(us % 1000000);
+    settimeofday(&tv, NULL);
+
+    gClock.corrected_us += delta_us;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Adds the correction to the one slewed by the system clock */
+static void sync_Adjust(int64_t delta_us)
+{
+    struct timeval tv  = {0};
+    struct timeval old = {0};
+    int64_t        us  = 0;
+
+    (void)adjtime(NULL, &old);
+    us         = (sync_ToUs(&old) + delta_us);
+    tv.tv_sec  = (time_t)(us / 1000000);
+    tv.tv_usec = (suseconds_t)(us % 1000000);
+    (void)adjtime(&tv, NULL);
+
+    gClock.corrected_us += delta_us;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Stops the system clock slewing, the correction which is not applied is not counted */
+static void sync_AdjustStop(void)
+{
+    struct timeval zero = {0};
+    struct timeval old  = {0};
+
+    (void)adjtime(&zero, &old);
+
+    gClock.corrected_us -= sync_ToUs(&old);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT sync_Load(int64_t * p_time, int32_t * p_ppb)
+{
+    nvs_handle h_nvs  = 0;
+    esp_err_t  status = ESP_OK;
+
+    /* The NVS is initialized by app_main() before the tasks are started */
+    status = nvs_open("time", NVS_READONLY, &h_nvs);
+    if (ESP_OK != status)
+    {
+        return FW_ERROR;
+    }
+    status = nvs_get_i64(h_nvs, "last", p_time);
+    if (ESP_OK == status)
+    {
+        status = nvs_get_i32(h_nvs, "drift", p_ppb);
+    }
+    nvs_close(h_nvs);
+
+    return (ESP_OK == status) ? FW_SUCCESS : FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void sync_Save(void)
+{
+    nvs_handle h_nvs  = 0;
+    esp_err_t  status = ESP_OK;
+    time_t     now    = 0;
+
+    status = nvs_open("time", NVS_READWRITE, &h_nvs);
+    if (ESP_OK == status)
+    {
+        time(&now);
+        status = nvs_set_i64(h_nvs, "last", (int64_t)now);
+        if (ESP_OK == status)
+        {
+            status = nvs_set_i32(h_nvs, "drift", gClock.drift.ppb);
+        }
+        if (ESP_OK == status)
+        {
+            status = nvs_commit(h_nvs);
+        }
+        nvs_close(h_nvs);
+    }
+    if (ESP_OK != status)
+    {
+        SYNC_LOGE("Save error: %d", status);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool sync_IsTimeValid(void)
+{
+    struct tm dt  = {0};
+    time_t    now = 0;
+
+    time(&now);
+    localtime_r(&now, &dt);
+
+    return ((SYNC_YEAR_MIN - 1900) <= dt.tm_year);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Overrides the default SNTP handler, it is called in the LwIP context */
+void sntp_sync_time(struct timeval * p_tv)
+{
+    struct timeval now    = {0};
+    sync_sample_t  sample = {0};
+
+    gettimeofday(&now, NULL);
+    sample.true_us   = sync_ToUs(p_tv);
+    sample.offset_us = (sample.true_us - sync_ToUs(&now));
+    (void)xQueueOverwrite(gSyncQueue, (void *)&sample);
+
+    sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Time_Sync_Init(void)
+{
+    struct timeval tv   = {0};
+    int64_t        last = 0;
+    int32_t        ppb  = 0;
+
+    gSyncQueue     = xQueueCreate(1, sizeof(sync_sample_t));
+    gClock.tick_us = esp_timer_get_time();
+    gClock.save_us = gClock.tick_us;
+
+    if (FW_SUCCESS == sync_Load(&last, &ppb))
+    {
+        gClock.drift.ppb     = ppb;
+        gClock.drift.samples = 1;
+        SYNC_LOGI("Restored drift: %ld ppb", ppb);
+    }
+
+    /* The RTC keeps running during the software reset, so the time is still valid */
+    gClock.valid = sync_IsTimeValid();
+    if ((false == gClock.valid) && (0 < last))
+    {
+        /* The power was lost - continue from the last known time till the SNTP sync */
+        tv.tv_sec = (time_t)last;
+        settimeofday(&tv, NULL);
+        gClock.valid = sync_IsTimeValid();
+        SYNC_LOGI("Restored time: %lld (estimated)", last);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Called by the Time task periodically, returns FW_TRUE if the time is stepped */
+FW_BOOLEAN Time_Sync_Process(void)
+{
+    sync_sample_t sample  = {0};
+    int64_t       now_us  = esp_timer_get_time();
+    int64_t       elapsed = (now_us - gClock.tick_us);
+    int64_t       delta   = 0;
+    FW_BOOLEAN    stepped = FW_FALSE;
+
+    gClock.tick_us = now_us;
+
+    /* Compensate the estimated drift */
+    if (0 < gClock.drift.samples)
+    {
+        gClock.compensation_ns += (elapsed * gClock.drift.ppb / 1000000);
+        gClock.pending_us      += (gClock.compensation_ns / 1000);
+        gClock.compensation_ns %= 1000;
+    }
+
+    if ((NULL != gSyncQueue) && (pdTRUE == xQueueReceive(gSyncQueue, (void *)&sample, 0)))
+    {
+        /* The fresh offset already includes the correction which is not applied yet */
+        sync_AdjustStop();
+        (void)sync_DriftUpdate
+        (
+            &gClock.drift,
+            sample.true_us,
+            (sample.offset_us + gClock.corrected_us)
+        );
+        gClock.pending_us      = sample.offset_us;
+        gClock.compensation_ns = 0;
+
+        if (SYNC_STEP_MIN_US < llabs(gClock.pending_us))
+        {
+            sync_Shift(gClock.pending_us);
+            gClock.pending_us = 0;
+            stepped           = FW_TRUE;
+        }
+        SYNC_LOGI
+        (
+            "Offset: %lld us - %s - Drift: %ld ppb",
+            sample.offset_us,
+            (FW_TRUE == stepped) ? "Step" : "Slew",
+            gClock.drift.ppb
+        );
+
+        gClock.sync_s  = (time_t)(sample.true_us / 1000000);
+        gClock.synced  = true;
+        gClock.valid   = true;
+        gClock.save_us = now_us;
+        sync_Save();
+    }
+
+    /* Slew the time with the bounded rate, the system clock slews the small remainder */
+    /* smoothly instead of the steps of the tick                                       */
+    if (SYNC_ADJUST_MAX_US > llabs(gClock.pending_us))
+    {
+        delta = gClock.pending_us;
+        if (0 != delta)
+        {
+            sync_Adjust(delta);
+        }
+    }
+    else
+    {
+        delta = sync_SlewStep(gClock.pending_us, elapsed);
+        sync_Shift(delta);
+    }
+    gClock.pending_us -= delta;
+
+    /* Save the last known time periodically */
+    if ((true == gClock.valid) && (SYNC_SAVE_PERIOD_S <= ((now_us - gClock.save_us) / 1000000)))
+    {
+        gClock.save_us = now_us;
+        sync_Save();
+    }
+
+    return stepped;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Time_Sync_IsSynced(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return gClock.synced;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+time_t Time_Sync_GetLastSync(void)
+{
+    /* This call is not thread safe but this is acceptable */
+    return gClock.sync_s;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* Simulates the clock with the drift (ppb) synchronized every period, returns the estimation */
+static int32_t sync_Test_Simulate(int32_t ppb, int64_t period_us, uint32_t count, int64_t jitter_us)
+{
+    sync_drift_t drift    = {0};
+    int64_t      true_us  = 1700000000LL * 1000000;
+    int64_t      local_us = true_us;
+    int64_t      offset   = 0;
+    uint32_t     idx      = 0;
+    uint32_t     seed     = 1;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        /* The pseudo-random SNTP jitter */
+        seed   = (seed * 1103515245 + 12345);
+        offset = (true_us - local_us) + ((int64_t)(seed >> 16) % (2 * jitter_us + 1)) - jitter_us;
+        (void)sync_DriftUpdate(&drift, true_us, offset);
+        true_us  += period_us;
+        local_us += (period_us - period_us / 1000 * ppb / 1000000);
+    }
+
+    return drift.ppb;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool sync_Test_IsNear(int32_t value, int32_t expected, int32_t tolerance)
+{
+    bool result = (abs(value - expected) <= tolerance);
+
+    SYNC_LOGI
+    (
+        "Drift: %8ld ppb, expected: %8ld ppb - %s",
+        value,
+        expected,
+        (true == result) ? "PASS" : "FAIL"
+    );
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void sync_Test_DriftEstimator(void)
+{
+    const int64_t hour_us = (60 * 60 * 1000000LL);
+    sync_drift_t  drift   = {0};
+    int64_t       t       = 0;
+    bool          result  = true;
+
+    /* The slow and the fast clocks synchronized every hour with 5 ms jitter */
+    result &= sync_Test_IsNear(sync_Test_Simulate( 35000, hour_us, 48, 5000),  35000, 2000);
+    result &= sync_Test_IsNear(sync_Test_Simulate(-20000, hour_us, 48, 5000), -20000, 2000);
+    result &= sync_Test_IsNear(sync_Test_Simulate(     0, hour_us, 48, 5000),      0, 2000);
+
+    /* The syncs more often than the measurement interval are accumulated */
+    result &= sync_Test_IsNear(sync_Test_Simulate( 10000, hour_us / 60, 600, 2000), 10000, 2000);
+
+    /* The time change is not a drift */
+    t = 1700000000LL * 1000000;
+    (void)sync_DriftUpdate(&drift, t, 0);
+    (void)sync_DriftUpdate(&drift, (t + hour_us), 36000);
+    result &= (FW_FALSE == sync_DriftUpdate(&drift, (t + 2 * hour_us), (36000 + 3600000000LL)));
+    result &= sync_Test_IsNear(drift.ppb, 10000, 0);
+    result &= (FW_TRUE == sync_DriftUpdate(&drift, (t + 3 * hour_us), (72000 + 3600000000LL)));
+    result &= sync_Test_IsNear(drift.ppb, 10000, 0);
+
+    SYNC_LOGI("Drift Estimator - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void sync_Test_Slew(void)
+{
+    bool result = true;
+
+    /* 50 ms per second at most */
+    result &= (50000 == sync_SlewStep(2000000, 1000000));
+    result &= (-50000 == sync_SlewStep(-2000000, 1000000));
+    result &= (1500 == sync_SlewStep(1500, 1000000));
+    result &= (1500 == sync_SlewStep(2000000, 30000));
+    result &= (0 == sync_SlewStep(0, 1000000));
+
+    SYNC_LOGI("Slew Rate - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Time_Sync_Test(void)
+{
+    sync_Test_DriftEstimator();
+    sync_Test_Slew();
+}
+
+//-------------------------------------------------------------------------------------------------
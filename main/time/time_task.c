@@ -2,10 +2,13 @@
 #include <string.h>
 #include <math.h>
 #include <time.h>
+#include <sys/time.h>
+#include <sys/param.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 
 #include "esp_system.h"
 #include "esp_log.h"
@@ -13,7 +16,13 @@
 
 #include "time_task.h"
 #include "led_task.h"
+#include "led_dli.h"
 #include "climate_task.h"
+#include "weather.h"
+#include "time_sync.h"
+#include "udp_schedule_link.h"
+#include "profiler.h"
+#include "bench.h"
 
 //-------------------------------------------------------------------------------------------------
 
@@ -45,20 +54,27 @@ enum
     /* Calculated for Jun 21 2024 14:00:00 (seconds) */
     TIME_LONGEST_DAY_DURATION_S    = 52666,
     TIME_STR_MAX_LEN               = 28,
-    /* Whole 24 hours day duration (seconds) */
-    TIME_FULL_DAY_DURATION_S       = (24 * 60 * 60),
     TIME_UV_BRIGHTNESS_MIN         = 25,
     TIME_UV_BRIGHTNESS_MAX         = 150,
     TIME_W_BRIGHTNESS_MIN          = 170,
     TIME_W_BRIGHTNESS_MAX          = 230,
-    TIME_FAN_MORNING_PERCENT       = 4,
-    TIME_FAN_EVENING_PERCENT       = 5,
-    TIME_FAN_DAY_PERCENT_MIN       = 15,
-    TIME_FAN_DAY_PERCENT_MAX       = 26,
-    TIME_FAN_SLOT_DURATION_S       = (35 * 60),
-    TIME_FAN_MARGIN_DURATION_S     = (5 * 60),
-    TIME_HUMIDIFIER_MIN_DURATION_S = 23,
-    TIME_HUMIDIFIER_MAX_DURATION_S = 60,
+    /* The temperature the FAN cools the enclosure to without the weather (0.01 C) */
+    TIME_TEMPERATURE_TARGET        = 2600,
+    /* The humidity setpoints limits (0.01 %) */
+    TIME_HUMIDITY_MIN              = 5000,
+    TIME_HUMIDITY_MAX              = 9000,
+    /* The light loss under the full overcast (percents) */
+    TIME_WEATHER_CLOUD_ATTENUATION = 70,
+    /* The weather humidity the humidity setpoints are defined for (0.01 %) */
+    TIME_WEATHER_HUMIDITY_NOMINAL  = 7000,
+    /* The light the plants get from the LEDs per day (mmol/m2), 0 - the natural day */
+    TIME_DLI_TARGET                = CONFIG_TIME_DLI_TARGET,
+    /* The white/UV day phase is stretched not longer than this... */
+    TIME_DLI_STRETCH_MAX_S         = (3 * 3600),
+    /* ...and ends this time before the midnight at latest */
+    TIME_DLI_NIGHT_RESERVE_S       = (2 * 3600),
+    /* The phase in progress is changed by this step at most (percents) */
+    TIME_DLI_REPLAN_STEP           = 10,
 };
 
 enum
@@ -107,35 +123,15 @@ typedef struct
 {
     uw_tx_p  transition;
     uint32_t interval;
+    /* The transition starts this time after the time point (the DLI plan) */
+    int32_t  shift;
 } uw_point_t;
 
 typedef struct
 {
-    climate_command_t cmd;
-    fan_speed_t       speed;
-    bool              repeat;
-    uint8_t           percent;
-} fan_tx_t, * fan_tx_p;
-
-typedef struct
-{
-    fan_tx_p transition;
-    uint32_t interval;
-} fan_point_t;
-
-typedef struct
-{
-    climate_command_t cmd;
-    bool              on;
-    bool              repeat;
-    uint8_t           duration;
-} humidifier_tx_t, * humidifier_tx_p;
-
-typedef struct
-{
-    humidifier_tx_p transition;
-    uint32_t        interval;
-} humidifier_point_t;
+    led_state_t        leds;
+    climate_setpoint_t climate;
+} time_state_t, * time_state_p;
 
 //-------------------------------------------------------------------------------------------------
 
@@ -149,9 +145,15 @@ static const double gPi  = 3.14159265;
 static const double gLat = 49.839684;
 static const double gLon = 24.029716;
 
-static QueueHandle_t  gTimeQueue = {0};
-static time_command_t gCommand   = TIME_CMD_EMPTY;
-static time_t         gAlarm     = LONG_MAX;
+static QueueHandle_t     gTimeQueue     = {0};
+static SemaphoreHandle_t gScheduleMutex = NULL;
+static time_command_t    gCommand       = TIME_CMD_EMPTY;
+static time_t            gAlarm         = LONG_MAX;
+static weather_t         gWeather       = {0};
+/* The weather is sampled from the trace, otherwise it is the clear sky */
+static bool              gWeatherValid  = false;
+/* The DLI target of the plan (mmol/m2), the test plans by its own target */
+static uint32_t          gDliTarget     = TIME_DLI_TARGET;
 
 #if (1 == TIME_LOG)
 static const char * const gcPointDescription[] =
@@ -326,40 +328,20 @@ static uw_point_t gUwPoints[] =
 };
 
 
-static fan_tx_t gFanMorning = {CLIMATE_CMD_FAN, FAN_SPEED_LOW,    true, 0};
-static fan_tx_t gFanOff     = {CLIMATE_CMD_FAN, FAN_SPEED_NONE,  false, 0};
-static fan_tx_t gFanDay     = {CLIMATE_CMD_FAN, FAN_SPEED_MEDIUM, true, 0};
-static fan_tx_t gFanEvening = {CLIMATE_CMD_FAN, FAN_SPEED_LOW,    true, 0};
-
-static fan_point_t gFanPoints[] =
+/* The humidity setpoints at the time points (0.01 %), they change linearly in between. */
+/* The morning mist and the dry afternoon of the orchids habitat.                        */
+static const uint16_t gHumidityPoints[] =
 {
-    [TIME_IDX_MIDNIGHT]            = {&gFanMorning, 0},
-    [TIME_IDX_MORNING_BLUE_HOUR]   = {&gFanOff,     0},
-    [TIME_IDX_MORNING_GOLDEN_HOUR] = {NULL,         0},
-    [TIME_IDX_RISE]                = {NULL,         0},
-    [TIME_IDX_DAY]                 = {&gFanDay,     0},
-    [TIME_IDX_NOON]                = {NULL,         0},
-    [TIME_IDX_EVENING_GOLDEN_HOUR] = {&gFanOff,     0},
-    [TIME_IDX_SET]                 = {NULL,         0},
-    [TIME_IDX_EVENING_BLUE_HOUR]   = {NULL,         0},
-    [TIME_IDX_NIGHT]               = {&gFanEvening, 0},
-};
-
-static humidifier_tx_t gHumidifierOn  = {CLIMATE_CMD_HUMIDIFY,  true, false, 0};
-static humidifier_tx_t gHumidifierOff = {CLIMATE_CMD_HUMIDIFY, false, false, 0};
-
-static humidifier_point_t gHumidifierPoints[] =
-{
-    [TIME_IDX_MIDNIGHT]            = {&gHumidifierOff, 0},
-    [TIME_IDX_MORNING_BLUE_HOUR]   = {&gHumidifierOn,  0},
-    [TIME_IDX_MORNING_GOLDEN_HOUR] = {&gHumidifierOff, 0},
-    [TIME_IDX_RISE]                = {NULL,            0},
-    [TIME_IDX_DAY]                 = {NULL,            0},
-    [TIME_IDX_NOON]                = {NULL,            0},
-    [TIME_IDX_EVENING_GOLDEN_HOUR] = {NULL,            0},
-    [TIME_IDX_SET]                 = {NULL,            0},
-    [TIME_IDX_EVENING_BLUE_HOUR]   = {&gHumidifierOn,  0},
-    [TIME_IDX_NIGHT]               = {&gHumidifierOff, 0},
+    [TIME_IDX_MIDNIGHT]            = 8000,
+    [TIME_IDX_MORNING_BLUE_HOUR]   = 8500,
+    [TIME_IDX_MORNING_GOLDEN_HOUR] = 8500,
+    [TIME_IDX_RISE]                = 8000,
+    [TIME_IDX_DAY]                 = 7000,
+    [TIME_IDX_NOON]                = 6500,
+    [TIME_IDX_EVENING_GOLDEN_HOUR] = 7000,
+    [TIME_IDX_SET]                 = 7500,
+    [TIME_IDX_EVENING_BLUE_HOUR]   = 8000,
+    [TIME_IDX_NIGHT]               = 8000,
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -519,6 +501,8 @@ static void time_GetTimeRefs(time_t t, time_t * p_start_t, time_t * p_ref_t)
     dt.tm_sec      = 0;
     dt.tm_min      = 0;
     dt.tm_hour     = 0;
+    /* The midnight and the current time differ in DST on the switching days */
+    dt.tm_isdst    = -1;
     *p_start_t = mktime(&dt);
     strftime(string, sizeof(string), "%c", &dt);
     TIME_LOGI("%-26s : %10llu : %s", "Start of day time", *p_start_t, string);
@@ -538,8 +522,13 @@ static void time_TimePointsCalculate(time_t start_t, time_t ref_t)
     {
         if (TIME_IDX_NIGHT == point)
         {
+            /* The night lasts till the next midnight - the day is 23/25 hours long */
+            /* when the DST is switched                                           */
+            localtime_r(&start_t, &dt);
+            dt.tm_mday++;
+            dt.tm_isdst = -1;
             gTimePoints[point].start     = time_SunNight(ref_t);
-            gTimePoints[point].interval  = (start_t + TIME_FULL_DAY_DURATION_S);
+            gTimePoints[point].interval  = mktime(&dt);
             gTimePoints[point].interval -= gTimePoints[point].start;
         }
         else
@@ -625,6 +614,7 @@ static void time_RgbPointsCalculate(void)
 static void time_UwPointsCalculate(void)
 {
     uint32_t interval = 0;
+    int32_t  shift    = 0;
     int      point    = 0;
     int32_t  value    = 0;
 
@@ -636,7 +626,9 @@ static void time_UwPointsCalculate(void)
         interval += gTimePoints[point].interval;
         if (NULL != gUwPoints[point].transition)
         {
-            gUwPoints[point].interval = interval;
+            /* The transition lasts till the shifted start of the next one */
+            gUwPoints[point].interval = (interval + shift - gUwPoints[point].shift);
+            shift    = gUwPoints[point].shift;
             interval = 0;
         
             if (LED_CMD_UV_INDICATE_SINE == gUwPoints[point].transition->u_cmd)
@@ -676,225 +668,325 @@ static void time_UwPointsCalculate(void)
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_FanPointsCalculate(void)
+static void time_PointsCalculate(time_t t)
 {
-    uint32_t interval = 0;
-    int      point    = 0;
-    uint32_t value    = 0;
-
-    TIME_LOGI("Calculation of FAN points  : ----------------------");
-    TIME_LOGI("-------------------------- : - Interval :   S :   %%");
-
-    /* Set/calculate the FAN in time percents */
-    gFanMorning.percent = TIME_FAN_MORNING_PERCENT;
-    gFanEvening.percent = TIME_FAN_EVENING_PERCENT;
-    value  = gTimePoints[TIME_IDX_EVENING_GOLDEN_HOUR].start;
-    value -= gTimePoints[TIME_IDX_DAY].start;
-    value -= TIME_SHORTEST_DAY_DURATION_S;
-    value *= (TIME_FAN_DAY_PERCENT_MAX - TIME_FAN_DAY_PERCENT_MIN);
-    value /= (TIME_LONGEST_DAY_DURATION_S - TIME_SHORTEST_DAY_DURATION_S);
-    value += TIME_FAN_DAY_PERCENT_MIN;
-    gFanDay.percent = value;
+    time_t ref_utc_time   = t;
+    time_t start_day_time = 0;
+    int    point          = 0;
 
-    for (point = (TIME_IDX_MAX - 1); point >= 0; point--)
+    time_GetTimeRefs(t, &start_day_time, &ref_utc_time);
+
+    /* The points are sampled by the LED tasks */
+    (void)xSemaphoreTake(gScheduleMutex, portMAX_DELAY);
+
+    time_TimePointsCalculate(start_day_time, ref_utc_time);
+
+    time_RgbPointsCalculate();
+
+    /* The natural day, the DLI plan is applied after */
+    for (point = 0; point < TIME_IDX_MAX; point++)
     {
-        interval += gTimePoints[point].interval;
-        if (NULL != gFanPoints[point].transition)
-        {
-            gFanPoints[point].interval = interval;
-            interval = 0;
-            TIME_LOGI
-            (
-                "[%d] %-23s: %10lu : %3d : %3d",
-                point,
-                gcPointDescription[point],
-                gFanPoints[point].interval,
-                gFanPoints[point].transition->speed,
-                gFanPoints[point].transition->percent
-            );
-        }
+        gUwPoints[point].shift = 0;
     }
+    time_UwPointsCalculate();
+
+    (void)xSemaphoreGive(gScheduleMutex);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_HumidifierPointsCalculate(void)
+/* Samples the weather trace while the Sun is imitated. The failed read gives the clear sky */
+/* and the default targets, so the stale weather is never kept. The clouds are applied by   */
+/* the LED tasks on the next frame, the targets by the Climate task on the next sample.     */
+static void time_WeatherUpdate(time_t t)
 {
-    uint32_t interval = 0;
-    int      point    = 0;
-    uint32_t value    = 0;
+    weather_t weather = {0};
+    bool      valid   = false;
 
-    TIME_LOGI("Calculation of HUM points  : ----------------------");
-    TIME_LOGI("-------------------------- : - Interval :  On : Dur");
-
-    /* Calculate the Humidification duration */
-    value  = gTimePoints[TIME_IDX_EVENING_GOLDEN_HOUR].start;
-    value -= gTimePoints[TIME_IDX_DAY].start;
-    value -= TIME_SHORTEST_DAY_DURATION_S;
-    value *= (TIME_HUMIDIFIER_MAX_DURATION_S - TIME_HUMIDIFIER_MIN_DURATION_S);
-    value /= (TIME_LONGEST_DAY_DURATION_S - TIME_SHORTEST_DAY_DURATION_S);
-    value += TIME_HUMIDIFIER_MIN_DURATION_S;
-    gHumidifierOn.duration = value;
-
-    for (point = (TIME_IDX_MAX - 1); point >= 0; point--)
+    if (TIME_CMD_SUN_ENABLE != gCommand)
     {
-        interval += gTimePoints[point].interval;
-        if (NULL != gHumidifierPoints[point].transition)
-        {
-            gHumidifierPoints[point].interval = interval;
-            interval = 0;
-            TIME_LOGI
-            (
-                "[%d] %-23s: %10lu : %3d : %3d",
-                point,
-                gcPointDescription[point],
-                gHumidifierPoints[point].interval,
-                gHumidifierPoints[point].transition->on,
-                gHumidifierPoints[point].transition->duration
-            );
-        }
+        return;
     }
+    valid = (FW_SUCCESS == Weather_Get(t, &weather));
+    if (false == valid)
+    {
+        memset(&weather, 0, sizeof(weather));
+    }
+
+    (void)xSemaphoreTake(gScheduleMutex, portMAX_DELAY);
+    memcpy(&gWeather, &weather, sizeof(gWeather));
+    gWeatherValid = valid;
+    (void)xSemaphoreGive(gScheduleMutex);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_PointsCalculate(time_t t)
+static uint8_t time_WeatherLight(uint8_t value)
 {
-    time_t ref_utc_time   = t;
-    time_t start_day_time = 0;
+    uint32_t result = value;
 
-    time_GetTimeRefs(t, &start_day_time, &ref_utc_time);
+    /* The clear sky is used if the weather is not sampled */
+    if (true == gWeatherValid)
+    {
+        result *= (100 - (gWeather.cloud * TIME_WEATHER_CLOUD_ATTENUATION / 100));
+        result /= 100;
+    }
 
-    time_TimePointsCalculate(start_day_time, ref_utc_time);
+    return (uint8_t)result;
+}
 
-    time_RgbPointsCalculate();
+//-------------------------------------------------------------------------------------------------
 
-    time_UwPointsCalculate();
+static uint16_t time_WeatherHumidity(uint16_t setpoint)
+{
+    uint32_t result = setpoint;
 
-    time_FanPointsCalculate();
+    if ((true == gWeatherValid) && (0 < gWeather.humidity))
+    {
+        result *= gWeather.humidity;
+        result /= TIME_WEATHER_HUMIDITY_NOMINAL;
+        if (TIME_HUMIDITY_MIN > result)
+        {
+            result = TIME_HUMIDITY_MIN;
+        }
+        if (TIME_HUMIDITY_MAX < result)
+        {
+            result = TIME_HUMIDITY_MAX;
+        }
+    }
 
-    time_HumidifierPointsCalculate();
+    return (uint16_t)result;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_SunRgb(time_t t, FW_BOOLEAN pre_tx, led_message_p p_rgb_msg)
+/* Prepares the RGB message of the time point the time belongs to, returns the point index */
+static int time_SunRgb(time_t t, led_message_p p_rgb_msg)
 {
-    enum
-    {
-        TRANSITION_INTERVAL = 1200,
-    };
-    led_message_t pre_msg  = {0};
-    led_color_t   color    = {0};
-    int           point    = 0;
-    uint32_t      interval = UINT32_MAX;
-    uint32_t      duration = UINT32_MAX;
+    int point = 0;
 
     for (point = (TIME_IDX_MAX - 1); point >= 0; point--)
     {
         /* Find the appropriate time point */
         if ((t >= gTimePoints[point].start) && (NULL != gRgbPoints[point].transition))
         {
-            interval = (gRgbPoints[point].interval * 1000);
-            duration = ((t - gTimePoints[point].start) * 1000);
-            TIME_LOGI
-            (
-                "[%d] %-23s: %10lu : %8lu : RGB",
-                point,
-                gcPointDescription[point],
-                interval,
-                duration
-            );
-
             /* Prepare the indication message */
             p_rgb_msg->command         = gRgbPoints[point].transition->cmd;
             p_rgb_msg->src.color.dword = gRgbPoints[point].transition->src.dword;
             p_rgb_msg->dst.color.dword = gRgbPoints[point].transition->dst.dword;
-            p_rgb_msg->interval        = interval;
-            p_rgb_msg->duration        = duration;
+            p_rgb_msg->interval        = (gRgbPoints[point].interval * 1000);
+            p_rgb_msg->duration        = ((t - gTimePoints[point].start) * 1000);
 
-            if (FW_TRUE == pre_tx)
+            /* The clouds dim the day light. The source color is kept to join */
+            /* the golden hours without a jump.                                */
+            if (LED_CMD_RGB_INDICATE_SINE == p_rgb_msg->command)
             {
-                LED_Task_DetermineColor(p_rgb_msg, &color);
-                pre_msg.command         = LED_CMD_RGB_INDICATE_COLOR;
-                pre_msg.dst.color.dword = color.dword;
-                pre_msg.interval        = TRANSITION_INTERVAL;
-                LED_Task_SendMsg(&pre_msg);
+                p_rgb_msg->dst.color.r = time_WeatherLight(p_rgb_msg->dst.color.r);
+                p_rgb_msg->dst.color.g = time_WeatherLight(p_rgb_msg->dst.color.g);
+                p_rgb_msg->dst.color.b = time_WeatherLight(p_rgb_msg->dst.color.b);
             }
             /* Skip the rest of time points */
             break;
         }
     }
+
+    return point;
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_SunUw(time_t t, FW_BOOLEAN pre_tx, led_message_p p_u_msg, led_message_p p_w_msg)
+/* Prepares the U/W messages of the time point the time belongs to, returns the point index */
+static int time_SunUw(time_t t, led_message_p p_u_msg, led_message_p p_w_msg)
 {
-    enum
-    {
-        TRANSITION_INTERVAL = 1200,
-    };
-    led_message_t pre_msg  = {0};
-    led_color_t   color    = {0};
-    int           point    = 0;
-    uint32_t      interval = UINT32_MAX;
-    uint32_t      duration = UINT32_MAX;
+    int point = 0;
 
     for (point = (TIME_IDX_MAX - 1); point >= 0; point--)
     {
         /* Find the appropriate time point */
-        if ((t >= gTimePoints[point].start) && (NULL != gUwPoints[point].transition))
+        if ((NULL != gUwPoints[point].transition) &&
+            (t >= (gTimePoints[point].start + gUwPoints[point].shift)))
         {
-            interval = (gUwPoints[point].interval * 1000);
-            duration = ((t - gTimePoints[point].start) * 1000);
-            TIME_LOGI
-            (
-                "[%d] %-23s: %10lu : %8lu : U/W - %d/%d",
-                point,
-                gcPointDescription[point],
-                interval,
-                duration,
-                gUwPoints[point].transition->u_max,
-                gUwPoints[point].transition->w_max
-            );
-
             /* Prepare the indication message */
             p_u_msg->command          = gUwPoints[point].transition->u_cmd;
             p_u_msg->src.brightness.v = 0;
             p_u_msg->src.brightness.a = 1;
-            p_u_msg->dst.brightness.v = gUwPoints[point].transition->u_max;
+            p_u_msg->dst.brightness.v = time_WeatherLight(gUwPoints[point].transition->u_max);
             p_u_msg->dst.brightness.a = 1;
-            p_u_msg->interval         = interval;
-            p_u_msg->duration         = duration;
+            p_u_msg->interval         = (gUwPoints[point].interval * 1000);
+            p_u_msg->duration         = ((t - gTimePoints[point].start - gUwPoints[point].shift) * 1000);
 
             p_w_msg->command          = gUwPoints[point].transition->w_cmd;
             p_w_msg->src.brightness.v = 0;
             p_w_msg->src.brightness.a = 1;
-            p_w_msg->dst.brightness.v = gUwPoints[point].transition->w_max;
+            p_w_msg->dst.brightness.v = time_WeatherLight(gUwPoints[point].transition->w_max);
             p_w_msg->dst.brightness.a = 1;
-            p_w_msg->interval         = interval;
-            p_w_msg->duration         = duration;
-
-            if (FW_TRUE == pre_tx)
-            {
-                LED_Task_DetermineColor(p_u_msg, &color);
-                pre_msg.command          = LED_CMD_UV_INDICATE_BRIGHTNESS;
-                pre_msg.dst.brightness.v = color.a;
-                pre_msg.dst.brightness.a = 1;
-                pre_msg.interval         = TRANSITION_INTERVAL;
-                LED_Task_SendMsg(&pre_msg);
-
-                LED_Task_DetermineColor(p_w_msg, &color);
-                pre_msg.command          = LED_CMD_W_INDICATE_BRIGHTNESS;
-                pre_msg.dst.brightness.v = color.a;
-                pre_msg.dst.brightness.a = 1;
-                LED_Task_SendMsg(&pre_msg);
-            }
+            p_w_msg->interval         = p_u_msg->interval;
+            p_w_msg->duration         = p_u_msg->duration;
             /* Skip the rest of time points */
             break;
         }
     }
+
+    return point;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Determines the indication state of the message at the moment it is prepared for */
+static void time_SunSample(led_message_p p_msg, uint32_t ms, led_color_p p_color)
+{
+    p_msg->duration += ms;
+    /* The end of the transition belongs to the next time point */
+    if ((0 < p_msg->interval) && (p_msg->duration >= p_msg->interval))
+    {
+        p_msg->duration = (p_msg->interval - 1);
+    }
+    LED_Task_DetermineColor(p_msg, p_color);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Evaluates the light state at the time (t seconds + ms milliseconds) */
+static void time_EvaluateLeds(time_t t, uint32_t ms, led_state_p p_state)
+{
+    led_message_t rgb_msg = {0};
+    led_message_t u_msg   = {0};
+    led_message_t w_msg   = {0};
+    led_color_t   color   = {0};
+
+    memset(p_state, 0, sizeof(led_state_t));
+
+    if (0 <= time_SunRgb(t, &rgb_msg))
+    {
+        time_SunSample(&rgb_msg, ms, &p_state->rgb);
+    }
+
+    if (0 <= time_SunUw(t, &u_msg, &w_msg))
+    {
+        time_SunSample(&u_msg, ms, &color);
+        p_state->u = color.a;
+        time_SunSample(&w_msg, ms, &color);
+        p_state->w = color.a;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the light of the sine day phase from the elapsed time till its end (0.01 umol/m2) */
+static double time_DliRemainder(double ppfd, double elapsed, double interval)
+{
+    elapsed = MIN(MAX(elapsed, 0), interval);
+
+    return (ppfd * interval / gPi * (1.0 + cos(gPi * elapsed / interval)));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the light of the RGB schedule from the time till the end (0.01 umol/m2) */
+static double time_DliRgbRemainder(time_t t, time_t end)
+{
+    enum
+    {
+        STEP_S = 60,
+    };
+    led_message_t msg   = {0};
+    led_color_t   color = {0};
+    double        light = 0;
+
+    for (; t < end; t += STEP_S)
+    {
+        if (0 <= time_SunRgb(t, &msg))
+        {
+            time_SunSample(&msg, 0, &color);
+            light += ((double)LED_DLI_GetPpfd(&color, 0, 0, 0) * STEP_S);
+        }
+    }
+
+    return light;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Stretches or shortens the white/UV day phase, so the light of the day meets the target: */
+/* the phase end is solved for the remainder of the phase to give the light missing after  */
+/* the RGB schedule. The phase in progress is changed by the limited step, so the          */
+/* brightness does not jump. The clouds change is counted by the next plan as measured.    */
+static void time_DliPlan(time_t t, uint32_t dli)
+{
+    enum
+    {
+        ITERATIONS = 32,
+    };
+    uw_tx_p     p_day    = gUwPoints[TIME_IDX_DAY].transition;
+    led_color_t black    = {0};
+    double      start    = gTimePoints[TIME_IDX_DAY].start;
+    double      natural  = (gTimePoints[TIME_IDX_EVENING_GOLDEN_HOUR].start - start);
+    double      current  = (natural + gUwPoints[TIME_IDX_EVENING_GOLDEN_HOUR].shift);
+    double      elapsed  = (t - start);
+    double      midnight = (gTimePoints[TIME_IDX_NIGHT].start + gTimePoints[TIME_IDX_NIGHT].interval);
+    double      ppfd     = 0;
+    double      need     = 0;
+    double      low      = 0;
+    double      high     = 0;
+    double      interval = 0;
+    int         i        = 0;
+
+    /* The natural day or the phase is over */
+    if ((0 == gDliTarget) || (current <= elapsed))
+    {
+        return;
+    }
+
+    /* The peak light of the phase (0.01 umol/m2/s) and the missing light (0.01 umol/m2) */
+    ppfd  = LED_DLI_GetPpfd(&black, time_WeatherLight(p_day->u_max), time_WeatherLight(p_day->w_max), 0);
+    need  = (((double)gDliTarget - dli) * 100000);
+    need -= time_DliRgbRemainder(t, (time_t)midnight);
+
+    low  = (natural / 2);
+    high = MIN((natural + TIME_DLI_STRETCH_MAX_S), (midnight - TIME_DLI_NIGHT_RESERVE_S - start));
+    if (0 < elapsed)
+    {
+        low  = MAX(low, (current * (100 - TIME_DLI_REPLAN_STEP) / 100));
+        low  = MAX(low, elapsed);
+        high = MIN(high, (current * (100 + TIME_DLI_REPLAN_STEP) / 100));
+    }
+    high = MAX(high, low);
+
+    /* The remainder grows with the phase interval */
+    for (i = 0; i < ITERATIONS; i++)
+    {
+        interval = ((low + high) / 2);
+        if (time_DliRemainder(ppfd, elapsed, interval) < need)
+        {
+            low = interval;
+        }
+        else
+        {
+            high = interval;
+        }
+    }
+    gUwPoints[TIME_IDX_EVENING_GOLDEN_HOUR].shift = (int32_t)lround(((low + high) / 2) - natural);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Plans the white/UV day phase by the light the plants got since the midnight */
+static void time_Dli(time_t t)
+{
+    uint32_t dli = LED_DLI_Get();
+
+    (void)xSemaphoreTake(gScheduleMutex, portMAX_DELAY);
+    time_DliPlan(t, dli);
+    time_UwPointsCalculate();
+    (void)xSemaphoreGive(gScheduleMutex);
+
+    TIME_LOGI
+    (
+        "%-26s : %10lu : %+6ld",
+        "DLI (mmol/m2) : Shift",
+        dli,
+        (long)gUwPoints[TIME_IDX_EVENING_GOLDEN_HOUR].shift
+    );
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -913,160 +1005,141 @@ static void time_LogTime(time_t t, char * p_str)
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_Sun(time_t t, FW_BOOLEAN pre_transition)
+static void time_Sun(time_t t)
 {
-    enum
-    {
-        TRANSITION_TIMEOUT = (pdMS_TO_TICKS(1300)),
-    };
     led_message_t rgb_msg = {0};
     led_message_t u_msg   = {0};
     led_message_t w_msg   = {0};
+    int           point   = 0;
 
-    time_SunRgb(t, pre_transition, &rgb_msg);
-    time_SunUw(t, pre_transition, &u_msg, &w_msg);
+    time_WeatherUpdate(t);
 
-    if (FW_TRUE == pre_transition)
+    /* The messages are used for logging only - the LED tasks sample the schedule */
+    point = time_SunRgb(t, &rgb_msg);
+    if (0 <= point)
     {
-        if ((0 != rgb_msg.command) || (0 != u_msg.command) || (0 != w_msg.command))
-        {
-            vTaskDelay(TRANSITION_TIMEOUT);
-        }
+        TIME_LOGI
+        (
+            "[%d] %-23s: %10lu : %8lu : RGB",
+            point,
+            gcPointDescription[point],
+            rgb_msg.interval,
+            rgb_msg.duration
+        );
     }
-
-    if (LED_CMD_EMPTY != rgb_msg.command)
+    point = time_SunUw(t, &u_msg, &w_msg);
+    if (0 <= point)
     {
-        LED_Task_SendMsg(&rgb_msg);
-    } 
-    
-    if (LED_CMD_EMPTY != u_msg.command)
-    {
-        LED_Task_SendMsg(&u_msg);
-    } 
-    
-    if (LED_CMD_EMPTY != w_msg.command)
-    {
-        LED_Task_SendMsg(&w_msg);
+        TIME_LOGI
+        (
+            "[%d] %-23s: %10lu : %8lu : U/W - %d/%d",
+            point,
+            gcPointDescription[point],
+            u_msg.interval,
+            u_msg.duration,
+            u_msg.dst.brightness.v,
+            w_msg.dst.brightness.v
+        );
     }
+
+    /* The repeated requests do not restart the indication */
+    rgb_msg.command = LED_CMD_RGB_INDICATE_SCHEDULE;
+    LED_Task_SendMsg(&rgb_msg);
+    u_msg.command = LED_CMD_UW_INDICATE_SCHEDULE;
+    LED_Task_SendMsg(&u_msg);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_ClimateFan(time_t t, climate_message_p p_msg)
+/* Returns the humidity setpoint at the time (0.01 %) */
+static uint16_t time_Humidity(time_t t)
 {
-    uint8_t  count    = 0;
-    int      point    = 0;
-    uint32_t interval = UINT32_MAX;
-    uint32_t duration = UINT32_MAX;
+    int32_t  value   = gHumidityPoints[TIME_IDX_MIDNIGHT];
+    uint32_t elapsed = 0;
+    int      point   = 0;
+    int      next    = 0;
 
     for (point = (TIME_IDX_MAX - 1); point >= 0; point--)
     {
-        /* Find the appropriate time point */
-        if ((t >= gTimePoints[point].start) && (NULL != gFanPoints[point].transition))
+        if ((t >= gTimePoints[point].start) && (0 < gTimePoints[point].interval))
         {
-            /* Prepare the FAN message */
-            p_msg->command = gFanPoints[point].transition->cmd;
-            p_msg->speed   = gFanPoints[point].transition->speed;
-            p_msg->repeat  = gFanPoints[point].transition->repeat;
-
-            if (FAN_SPEED_NONE < gFanPoints[point].transition->speed)
-            {
-                /* The remaining time to the next time point */
-                interval = (gTimePoints[point].start + gFanPoints[point].interval - t);
-                /* Determine the count of remaining time slots */
-                count = (interval / TIME_FAN_SLOT_DURATION_S);
-                if (0 < count)
-                {
-                    /* Determine the FAN time interval */
-                    interval = (1000 * ((interval + TIME_FAN_MARGIN_DURATION_S) / count));
-                    /* Determine the FAN time duration */
-                    duration = ((gFanPoints[point].transition->percent * interval) / 100);
-                    /* Setup the message */
-                    p_msg->interval = interval;
-                    p_msg->duration = duration;
-                }
-                else
-                {
-                    p_msg->speed = FAN_SPEED_NONE;
-                }
-            }
-            TIME_LOGI
-            (
-                "[%d] %-23s: %10lu : %8lu : FAN - S: %d",
-                point,
-                gcPointDescription[point],
-                p_msg->interval,
-                p_msg->duration,
-                p_msg->speed
-            );
-            /* Skip the rest of time points */
+            /* The night ends at the setpoint of the next midnight */
+            next    = ((point + 1) % TIME_IDX_MAX);
+            elapsed = MIN((uint32_t)(t - gTimePoints[point].start), gTimePoints[point].interval);
+            value   = (gHumidityPoints[next] - gHumidityPoints[point]);
+            value  *= (int32_t)elapsed;
+            value  /= (int32_t)gTimePoints[point].interval;
+            value  += gHumidityPoints[point];
             break;
         }
     }
+
+    return time_WeatherHumidity((uint16_t)value);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_ClimateHumidifier(time_t t, climate_message_p p_msg)
+/* Evaluates the climate setpoints at the time */
+static void time_EvaluateClimate(time_t t, climate_setpoint_p p_setpoint)
 {
-    enum
+    p_setpoint->humidity    = time_Humidity(t);
+    p_setpoint->temperature = TIME_TEMPERATURE_TARGET;
+    if (true == gWeatherValid)
     {
-        HUMIDIFICATION_TIMEOUT_S = (8 * 60),
-    };
-    uint32_t interval = UINT32_MAX;
-    int      point    = 0;
-
-    for (point = (TIME_IDX_MAX - 1); point >= 0; point--)
-    {
-        /* Find the appropriate time point */
-        if ((t >= gTimePoints[point].start) && (NULL != gHumidifierPoints[point].transition))
-        {
-            /* The remaining time to the next time point */
-            interval = (gTimePoints[point].start + gHumidifierPoints[point].interval - t);
-            /* Prepare the Humidifier message */
-            p_msg->command = gHumidifierPoints[point].transition->cmd;
-            /* There should be at least a few minutes after the humidification */
-            if ((true == gHumidifierPoints[point].transition->on) &&
-                (HUMIDIFICATION_TIMEOUT_S < interval))
-            {
-                p_msg->on       = gHumidifierPoints[point].transition->on;
-                p_msg->repeat   = gHumidifierPoints[point].transition->repeat;
-                p_msg->interval = (gHumidifierPoints[point].interval * 1000);
-                p_msg->duration = (gHumidifierPoints[point].transition->duration * 1000);
-            }
-            TIME_LOGI
-            (
-                "[%d] %-23s: %10lu : %8lu : HUM - On: %d",
-                point,
-                gcPointDescription[point],
-                p_msg->interval,
-                p_msg->duration,
-                p_msg->on
-            );
-            /* Skip the rest of time points */
-            break;
-        }
+        p_setpoint->temperature = gWeather.temperature;
     }
 }
 
 //-------------------------------------------------------------------------------------------------
 
-static void time_Climate(time_t t)
+/* Evaluates the whole schedule state at the time (t seconds + ms milliseconds). The state */
+/* depends on the time only, so it can be sampled at any moment and any number of times.  */
+static void time_Evaluate(time_t t, uint32_t ms, time_state_p p_state)
 {
-    climate_message_t humidifier_msg = {0};
-    climate_message_t fan_msg        = {0};
+    time_EvaluateLeds(t, ms, &p_state->leds);
+    time_EvaluateClimate(t, &p_state->climate);
+}
 
-    time_ClimateFan(t, &fan_msg);
-    time_ClimateHumidifier(t, &humidifier_msg);
+//-------------------------------------------------------------------------------------------------
+
+/* Called by the LED tasks on every frame */
+static bool time_ScheduleSample(led_state_p p_state)
+{
+    struct timeval now = {0};
 
-    if (CLIMATE_CMD_EMPTY != fan_msg.command)
+    /* This call is not thread safe but this is acceptable */
+    if (TIME_CMD_SUN_ENABLE != gCommand)
     {
-        Climate_Task_SendMsg(&fan_msg);
+        return false;
     }
-    if (CLIMATE_CMD_EMPTY != humidifier_msg.command)
+    /* Keep the previous state while the points are recalculated */
+    if (pdTRUE != xSemaphoreTake(gScheduleMutex, 0))
     {
-        Climate_Task_SendMsg(&humidifier_msg);
+        return false;
     }
+    /* The linked enclosures show the schedule of the leader */
+    UDP_Link_GetTime(&now);
+    time_EvaluateLeds(now.tv_sec, (now.tv_usec / 1000), p_state);
+    (void)xSemaphoreGive(gScheduleMutex);
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Called by the Climate task on every sensors sample */
+static bool time_ClimateSchedule(time_t t, climate_setpoint_p p_setpoint)
+{
+    /* This call is not thread safe but this is acceptable */
+    if (TIME_CMD_SUN_ENABLE != gCommand)
+    {
+        return false;
+    }
+    (void)xSemaphoreTake(gScheduleMutex, portMAX_DELAY);
+    time_EvaluateClimate(t, p_setpoint);
+    (void)xSemaphoreGive(gScheduleMutex);
+
+    return true;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1100,10 +1173,11 @@ static void time_ProcessMsg(time_message_t * p_msg, time_t t)
     if (TIME_CMD_SUN_ENABLE == gCommand)
     {
         time_PointsCalculate(t);
+        LED_DLI_StartDay(gTimePoints[TIME_IDX_MIDNIGHT].start);
+        time_Dli(t);
         time_SetAlarm(t);
         TIME_LOGT(t, "Current local time");
-        time_Sun(t, FW_TRUE);
-        time_Climate(t);
+        time_Sun(t);
     }
 }
 
@@ -1124,10 +1198,11 @@ static void time_CheckForAlarms(time_t t)
             {
                 TIME_LOGT(t, "Midnight detected!");
                 time_PointsCalculate(t);
+                LED_DLI_StartDay(gTimePoints[TIME_IDX_MIDNIGHT].start);
+                time_Dli(t);
                 time_SetAlarm(t);
                 TIME_LOGT(t, "Current local time");
-                time_Sun(t, FW_TRUE);
-                time_Climate(t);
+                time_Sun(t);
             }
         }
         else
@@ -1136,10 +1211,14 @@ static void time_CheckForAlarms(time_t t)
             if (t >= gAlarm)
             {
                 TIME_LOGT(t, "Alarm detected!");
+                /* The light of the morning corrects the afternoon */
+                if (gTimePoints[TIME_IDX_NOON].start == gAlarm)
+                {
+                    time_Dli(t);
+                }
                 time_SetAlarm(t);
                 TIME_LOGT(t, "Current local time");
-                time_Sun(t, FW_TRUE);
-                time_Climate(t);
+                time_Sun(t);
             }
         }
     }
@@ -1158,13 +1237,27 @@ static void vTime_Task(void * pvParameters)
     time_t         now      = 0;
     struct tm      datetime = {0};
     uint32_t       retry    = 0;
+    FW_BOOLEAN     stepped  = FW_FALSE;
     static uint8_t sync_ok  = FW_FALSE;
 
-    /* Initialize the SNTP client which gets the time periodicaly */
     TIME_LOGI("Time Task Started...");
+
+    /* The last known time is restored, so the schedule is started without waiting for SNTP */
+    Time_Sync_Init();
+
+    /* Initialize the SNTP client which gets the time periodicaly */
     TIME_LOGI("Initializing SNTP");
     esp_sntp_setoperatingmode(SNTP_OPMODE_POLL);
-    esp_sntp_setservername(0, "pool.ntp.org");
+    if (0 < strlen(CONFIG_SNTP_PEER_SERVER))
+    {
+        /* The serving enclosure is asked first, the pool is the fallback */
+        esp_sntp_setservername(0, CONFIG_SNTP_PEER_SERVER);
+        esp_sntp_setservername(1, "pool.ntp.org");
+    }
+    else
+    {
+        esp_sntp_setservername(0, "pool.ntp.org");
+    }
     esp_sntp_init();
 
     /* Set the timezone */
@@ -1172,27 +1265,41 @@ static void vTime_Task(void * pvParameters)
     setenv("TZ", gTZ, 1);
     tzset();
 
+    /* The clear sky is imitated if the weather trace is absent */
+    (void)Weather_Init();
+
     while (FW_TRUE)
     {
+        /* Apply the SNTP corrections and the drift compensation */
+        stepped = Time_Sync_Process();
+
         /* Update the 'now' variable with current time */
         time(&now);
         localtime_r(&now, &datetime);
 
-        /* If time is already in sync with the server */
+        /* If time is already in sync with the server or restored */
         if ((2024 - 1900) <= datetime.tm_year)
         {
-            if (FW_FALSE == sync_ok)
+            if ((FW_FALSE == sync_ok) && (true == Time_Sync_IsSynced()))
             {
                 TIME_LOGT(now, "Sync OK!");
                 sync_ok = FW_TRUE;
             }
 
+            /* The time is stepped - the points and the alarm are not valid anymore */
+            if ((FW_TRUE == stepped) && (TIME_CMD_SUN_ENABLE == gCommand))
+            {
+                msg.command = TIME_CMD_SUN_ENABLE;
+                time_ProcessMsg(&msg, now);
+            }
+
             status = xQueueReceive(gTimeQueue, (void *)&msg, TIME_TASK_TICK_MS);
             if (pdTRUE == status)
             {
                 time_ProcessMsg(&msg, now);
             }
             time_CheckForAlarms(now);
+            time_WeatherUpdate(now);
         }
         else
         {
@@ -1215,7 +1322,14 @@ void Time_Task_Init(void)
 {
     time_message_t msg = {TIME_CMD_SUN_ENABLE};
 
-    gTimeQueue = xQueueCreate(20, sizeof(time_message_t));
+    gTimeQueue     = xQueueCreate(20, sizeof(time_message_t));
+    gScheduleMutex = xSemaphoreCreateMutex();
+    Profiler_AddQueue("TIME", gTimeQueue);
+
+    /* The LED tasks follow the Sun imitation schedule by sampling it */
+    LED_Task_SetSchedule(time_ScheduleSample);
+    /* The Climate task controls the FAN and the Humidifier by the schedule setpoints */
+    Climate_Task_SetSchedule(time_ClimateSchedule);
 
     /* SNTP service uses LwIP, large stack space should be allocated  */
     (void)xTaskCreatePinnedToCore(vTime_Task, "TIME", 4096, NULL, 3, NULL, CORE0);
@@ -1474,9 +1588,8 @@ static void time_Test_Alarm(void)
 
 static void time_Test_DayNight(void)
 {
-    led_message_t     led_msg = {0};
-    climate_message_t clt_msg = {0};
-    uint8_t           p       = 0;
+    led_message_t led_msg = {0};
+    uint8_t       p       = 0;
 
     /* Start             -    0 minutes */
     /* MorningBlueHour   -  429 minutes */
@@ -1581,42 +1694,6 @@ static void time_Test_DayNight(void)
         [TIME_IDX_NIGHT]               = {NULL,                 0},
     };
 
-    fan_tx_t fanMorning = {CLIMATE_CMD_FAN, FAN_SPEED_LOW,    true, 33};
-    fan_tx_t fanOff     = {CLIMATE_CMD_FAN, FAN_SPEED_NONE,  false,  0};
-    fan_tx_t fanDay     = {CLIMATE_CMD_FAN, FAN_SPEED_MEDIUM, true, 35};
-    fan_tx_t fanEvening = {CLIMATE_CMD_FAN, FAN_SPEED_LOW,    true, 35};
-
-    fan_point_t fan_points[] =
-    {
-        [TIME_IDX_MIDNIGHT]            = {&fanMorning, 429},
-        [TIME_IDX_MORNING_BLUE_HOUR]   = {&fanOff,      76},
-        [TIME_IDX_MORNING_GOLDEN_HOUR] = {NULL,          0},
-        [TIME_IDX_RISE]                = {NULL,          0},
-        [TIME_IDX_DAY]                 = {&fanDay,     572},
-        [TIME_IDX_NOON]                = {NULL,          0},
-        [TIME_IDX_EVENING_GOLDEN_HOUR] = {&fanOff,      77},
-        [TIME_IDX_SET]                 = {NULL,          0},
-        [TIME_IDX_EVENING_BLUE_HOUR]   = {NULL,          0},
-        [TIME_IDX_NIGHT]               = {&fanEvening, 287},
-    };
-
-    humidifier_tx_t humidifierOn  = {CLIMATE_CMD_HUMIDIFY,  true, false, 20};
-    humidifier_tx_t humidifierOff = {CLIMATE_CMD_HUMIDIFY, false, false,  0};
-
-    humidifier_point_t humidifier_points[] =
-    {
-        [TIME_IDX_MIDNIGHT]            = {&humidifierOff, 429},
-        [TIME_IDX_MORNING_BLUE_HOUR]   = {&humidifierOn,   13},
-        [TIME_IDX_MORNING_GOLDEN_HOUR] = {&humidifierOff, 699},
-        [TIME_IDX_RISE]                = {NULL,             0},
-        [TIME_IDX_DAY]                 = {NULL,             0},
-        [TIME_IDX_NOON]                = {NULL,             0},
-        [TIME_IDX_EVENING_GOLDEN_HOUR] = {NULL,             0},
-        [TIME_IDX_SET]                 = {NULL,             0},
-        [TIME_IDX_EVENING_BLUE_HOUR]   = {&humidifierOn,   13},
-        [TIME_IDX_NIGHT]               = {&humidifierOff, 287},
-    };
-
     for (p = 0; p < TIME_IDX_MAX; p++)
     {
         uint32_t timeout = (time_points[p].interval) * 100;
@@ -1648,28 +1725,6 @@ static void time_Test_DayNight(void)
             LED_Task_SendMsg(&led_msg);
         }
 
-        if (NULL != fan_points[p].transition)
-        {
-            memset(&clt_msg, 0, sizeof(clt_msg));
-            clt_msg.command  = fan_points[p].transition->cmd;
-            clt_msg.speed    = fan_points[p].transition->speed;
-            clt_msg.interval = 6000;
-            clt_msg.duration = 2000;
-            clt_msg.repeat   = fan_points[p].transition->repeat;
-            Climate_Task_SendMsg(&clt_msg);
-        }
-
-        if (NULL != humidifier_points[p].transition)
-        {
-            memset(&clt_msg, 0, sizeof(clt_msg));
-            clt_msg.command  = humidifier_points[p].transition->cmd;
-            clt_msg.on       = humidifier_points[p].transition->on;
-            clt_msg.interval = 6000;
-            clt_msg.duration = 3000;
-            clt_msg.repeat   = humidifier_points[p].transition->repeat;
-            Climate_Task_SendMsg(&clt_msg);
-        }
-
         vTaskDelay(pdMS_TO_TICKS(timeout));
     }
 }
@@ -1745,38 +1800,12 @@ do \
 } \
 while (0)
 
-#define CHECK_FAN(x,i,d,s) \
-do \
-{ \
-    if (i != x.interval) \
-    { \
-        TIME_LOGE("%-26s : %10d", "FAIL! Interval must be", i); \
-    } \
-    if (d != x.duration) \
-    { \
-        TIME_LOGE("%-26s : %10d", "FAIL! Duration must be", d); \
-    } \
-    if (s != x.speed) \
-    { \
-        TIME_LOGE("%-26s : %10d", "FAIL! Speed must be", s); \
-    } \
-} \
-while (0)
-
-#define CHECK_HUM(x,i,d,o) \
+#define CHECK_HUM(x,h) \
 do \
 { \
-    if (i != x.interval) \
+    if (h != x) \
     { \
-        TIME_LOGE("%-26s : %10d", "FAIL! Interval must be", i); \
-    } \
-    if (d != x.duration) \
-    { \
-        TIME_LOGE("%-26s : %10d", "FAIL! Duration must be", d); \
-    } \
-    if (o != x.on) \
-    { \
-        TIME_LOGE("%-26s : %10d", "FAIL! \"On\" must be", o); \
+        TIME_LOGE("%-26s : %10d", "FAIL! Humidity must be", h); \
     } \
 } \
 while (0)
@@ -1785,11 +1814,10 @@ static void time_Test_Point_Calculations(void)
 {
     typedef struct
     {
-        led_message_t     rgb;
-        led_message_t     u;
-        led_message_t     w;
-        climate_message_t fan;
-        climate_message_t hum;
+        led_message_t rgb;
+        led_message_t u;
+        led_message_t w;
+        uint16_t      hum;
     } test_msgs_t;
 
     test_msgs_t msgs      = {0};
@@ -1819,18 +1847,15 @@ static void time_Test_Point_Calculations(void)
     TIME_LOGI("-------------------------- : - Interval : Duration : Info");
     memset(&msgs, 0, sizeof(msgs));
 
-    time_SunRgb(now, FW_FALSE, &msgs.rgb);
+    time_SunRgb(now, &msgs.rgb);
     CHECK_RGB(msgs.rgb, 23895000, 11947000);
 
-    time_SunUw(now, FW_FALSE, &msgs.u, &msgs.w);
+    time_SunUw(now, &msgs.u, &msgs.w);
     CHECK_UW(msgs.u, 23895000, 11947000, 31);
     CHECK_UW(msgs.w, 23895000, 11947000, 173);
 
-    time_ClimateFan(now, &msgs.fan);
-    CHECK_FAN(msgs.fan, 2449000, 367350, FAN_SPEED_MEDIUM);
-
-    time_ClimateHumidifier(now, &msgs.hum);
-    CHECK_HUM(msgs.hum, 0, 0, 0);
+    msgs.hum = time_Humidity(now);
+    CHECK_HUM(msgs.hum, 6500);
 
 
     TIME_LOGI("---------------------------------------------------------");
@@ -1839,18 +1864,15 @@ static void time_Test_Point_Calculations(void)
     TIME_LOGI("-------------------------- : - Interval : Duration : Info");
     memset(&msgs, 0, sizeof(msgs));
 
-    time_SunRgb(now, FW_FALSE, &msgs.rgb);
+    time_SunRgb(now, &msgs.rgb);
     CHECK_RGB(msgs.rgb, 23895000, 23715000);
 
-    time_SunUw(now, FW_FALSE, &msgs.u, &msgs.w);
+    time_SunUw(now, &msgs.u, &msgs.w);
     CHECK_UW(msgs.u, 23895000, 23715000, 31);
     CHECK_UW(msgs.w, 23895000, 23715000, 173);
 
-    time_ClimateFan(now, &msgs.fan);
-    CHECK_FAN(msgs.fan, 0, 0, FAN_SPEED_NONE);
-
-    time_ClimateHumidifier(now, &msgs.hum);
-    CHECK_HUM(msgs.hum, 0, 0, 0);
+    msgs.hum = time_Humidity(now);
+    CHECK_HUM(msgs.hum, 6992);
 
     TIME_LOGI("---------------------------------------------------------");
     /* Nov 30 07:36:56 2024 - Just before Sun rise */
@@ -1858,37 +1880,261 @@ static void time_Test_Point_Calculations(void)
     TIME_LOGI("-------------------------- : - Interval : Duration : Info");
     memset(&msgs, 0, sizeof(msgs));
 
-    time_SunRgb(now, FW_FALSE, &msgs.rgb);
+    time_SunRgb(now, &msgs.rgb);
     CHECK_RGB(msgs.rgb, 844000, 833000);
 
-    time_SunUw(now, FW_FALSE, &msgs.u, &msgs.w);
+    time_SunUw(now, &msgs.u, &msgs.w);
     CHECK_UW(msgs.u, 32091000, 27416000, 0);
     CHECK_UW(msgs.w, 32091000, 27416000, 0);
 
-    time_ClimateFan(now, &msgs.fan);
-    CHECK_FAN(msgs.fan, 0, 0, FAN_SPEED_NONE);
-
-    time_ClimateHumidifier(now, &msgs.hum);
-    CHECK_HUM(msgs.hum, 0, 0, 0);
+    msgs.hum = time_Humidity(now);
+    CHECK_HUM(msgs.hum, 8500);
 
     TIME_LOGI("---------------------------------------------------------");
-    /* Nov 30 07:28:56 2024 - Enough for humidification */
+    /* Nov 30 07:28:56 2024 - Morning Blue Hour */
     GT(2024, 11, 30, 7, 28, 56, now, tz_offset);
     TIME_LOGI("-------------------------- : - Interval : Duration : Info");
     memset(&msgs, 0, sizeof(msgs));
 
-    time_SunRgb(now, FW_FALSE, &msgs.rgb);
+    time_SunRgb(now, &msgs.rgb);
     CHECK_RGB(msgs.rgb, 844000, 353000);
 
-    time_SunUw(now, FW_FALSE, &msgs.u, &msgs.w);
+    time_SunUw(now, &msgs.u, &msgs.w);
     CHECK_UW(msgs.u, 32091000, 26936000, 0);
     CHECK_UW(msgs.w, 32091000, 26936000, 0);
 
-    time_ClimateFan(now, &msgs.fan);
-    CHECK_FAN(msgs.fan, 0, 0, FAN_SPEED_NONE);
+    msgs.hum = time_Humidity(now);
+    CHECK_HUM(msgs.hum, 8500);
+}
+
+//-------------------------------------------------------------------------------------------------
 
-    time_ClimateHumidifier(now, &msgs.hum);
-    CHECK_HUM(msgs.hum, 844000, 25000, 1);
+static bool time_Test_IsClose(time_state_p p_a, time_state_p p_b)
+{
+    enum
+    {
+        /* The rounding of the Rainbow (HSV) transition */
+        TOLERANCE = 3,
+    };
+
+    return
+    (
+        (TOLERANCE >= abs(p_a->leds.rgb.r - p_b->leds.rgb.r)) &&
+        (TOLERANCE >= abs(p_a->leds.rgb.g - p_b->leds.rgb.g)) &&
+        (TOLERANCE >= abs(p_a->leds.rgb.b - p_b->leds.rgb.b)) &&
+        (TOLERANCE >= abs(p_a->leds.u - p_b->leds.u)) &&
+        (TOLERANCE >= abs(p_a->leds.w - p_b->leds.w))
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void time_Test_Continuity(void)
+{
+    enum
+    {
+        /* Nov 30, Mar 31 (DST starts), Jun 21, Oct 27 (DST ends) */
+        DAYS_COUNT = 4,
+    };
+    static const int days[DAYS_COUNT][3] =
+    {
+        {2024, 11, 30},
+        {2024,  3, 31},
+        {2024,  6, 21},
+        {2024, 10, 27},
+    };
+    time_state_t before    = {0};
+    time_state_t after     = {0};
+    time_state_t again     = {0};
+    time_t       now       = 0;
+    time_t       tz_offset = 0;
+    time_t       end       = 0;
+    int          day       = 0;
+    int          point     = 0;
+    bool         result    = true;
+
+    /* Set the timezone */
+    TIME_LOGI("%-26s : %s", "Set timezone to", gTZ);
+    setenv("TZ", gTZ, 1);
+    tzset();
+
+    for (day = 0; day < DAYS_COUNT; day++)
+    {
+        TIME_LOGI("---------------------------------------------------------");
+        GT(days[day][0], days[day][1], days[day][2], 12, 0, 0, now, tz_offset);
+        time_PointsCalculate(now);
+
+        /* The state just before the time point must be the same as at the time point */
+        for (point = (TIME_IDX_MIDNIGHT + 1); point < TIME_IDX_MAX; point++)
+        {
+            time_Evaluate((gTimePoints[point].start - 1), 999, &before);
+            time_Evaluate(gTimePoints[point].start, 0, &after);
+            if (false == time_Test_IsClose(&before, &after))
+            {
+                TIME_LOGE
+                (
+                    "[%d] %-23s: FAIL! RGB(%d,%d,%d) UW(%d,%d) -> RGB(%d,%d,%d) UW(%d,%d)",
+                    point,
+                    gcPointDescription[point],
+                    before.leds.rgb.r, before.leds.rgb.g, before.leds.rgb.b,
+                    before.leds.u, before.leds.w,
+                    after.leds.rgb.r, after.leds.rgb.g, after.leds.rgb.b,
+                    after.leds.u, after.leds.w
+                );
+                result = false;
+            }
+
+            /* The schedule does not depend on how many times it is sampled */
+            time_Evaluate(gTimePoints[point].start, 500, &after);
+            time_Evaluate(gTimePoints[point].start, 500, &again);
+            if (0 != memcmp(&after, &again, sizeof(after)))
+            {
+                TIME_LOGE("[%d] %-23s: FAIL! Not idempotent", point, gcPointDescription[point]);
+                result = false;
+            }
+        }
+
+        /* The end of the day must join the start of the next day */
+        end = (gTimePoints[TIME_IDX_NIGHT].start + gTimePoints[TIME_IDX_NIGHT].interval);
+        time_Evaluate((end - 1), 999, &before);
+        time_PointsCalculate(end);
+        time_Evaluate(end, 0, &after);
+        if ((end != gTimePoints[TIME_IDX_MIDNIGHT].start) ||
+            (false == time_Test_IsClose(&before, &after)))
+        {
+            TIME_LOGE("%-26s : FAIL!", "Midnight");
+            result = false;
+        }
+    }
+
+    TIME_LOGI("Time Schedule Continuity - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Integrates the light of the LEDs over the day with the 10 s frames (mmol/m2), the plan is */
+/* made at the midnight and corrected at the noon like the task does                         */
+static uint32_t time_Test_DliDay(time_t midnight, bool plan)
+{
+    enum
+    {
+        FRAME_S = 10,
+    };
+    led_state_t state  = {0};
+    uint64_t    light  = 0;
+    time_t      t      = 0;
+    time_t      end    = 0;
+    bool        noon   = false;
+
+    time_PointsCalculate(midnight);
+    if (true == plan)
+    {
+        time_DliPlan(midnight, 0);
+        time_UwPointsCalculate();
+    }
+    end = (gTimePoints[TIME_IDX_NIGHT].start + gTimePoints[TIME_IDX_NIGHT].interval);
+    for (t = midnight; t < end; t += FRAME_S)
+    {
+        if ((true == plan) && (false == noon) && (t >= gTimePoints[TIME_IDX_NOON].start))
+        {
+            time_DliPlan(t, (uint32_t)(light / 100000));
+            time_UwPointsCalculate();
+            noon = true;
+        }
+        time_EvaluateLeds(t, 0, &state);
+        light += ((uint64_t)LED_DLI_GetPpfd(&state.rgb, state.u, state.w, 0) * FRAME_S);
+    }
+
+    return (uint32_t)(light / 100000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void time_Test_Dli(void)
+{
+    enum
+    {
+        /* Dec 21, Nov 1, Jun 21 */
+        DAYS_COUNT = 3,
+        TARGET     = 5000,
+    };
+    static const int days[DAYS_COUNT][3] =
+    {
+        {2024, 12, 21},
+        {2024, 11,  1},
+        {2024,  6, 21},
+    };
+    time_t   now       = 0;
+    time_t   tz_offset = 0;
+    uint32_t natural   = 0;
+    uint32_t planned   = 0;
+    int32_t  shift     = 0;
+    int      day       = 0;
+    bool     result    = true;
+
+    /* Set the timezone */
+    TIME_LOGI("%-26s : %s", "Set timezone to", gTZ);
+    setenv("TZ", gTZ, 1);
+    tzset();
+
+    gDliTarget = TARGET;
+    for (day = 0; day < DAYS_COUNT; day++)
+    {
+        TIME_LOGI("---------------------------------------------------------");
+        GT(days[day][0], days[day][1], days[day][2], 0, 0, 0, now, tz_offset);
+        natural = time_Test_DliDay(now, false);
+        planned = time_Test_DliDay(now, true);
+        shift   = gUwPoints[TIME_IDX_EVENING_GOLDEN_HOUR].shift;
+        TIME_LOGI("%-26s : %10lu : %10lu : %+6ld", "DLI natural : planned", natural, planned, (long)shift);
+
+        /* The target is met within 3 % or the stretch is at its limit */
+        if (natural < TARGET)
+        {
+            result &= (natural < planned);
+            result &= ((planned >= (TARGET * 97 / 100)) || (TIME_DLI_STRETCH_MAX_S <= shift));
+            result &= ((TARGET * 103 / 100) >= planned);
+        }
+        else
+        {
+            result &= (natural > planned);
+            result &= ((planned <= (TARGET * 103 / 100)) && (planned >= (TARGET * 97 / 100)));
+        }
+
+        /* The natural day is kept without the target */
+        gDliTarget = 0;
+        result    &= (natural == time_Test_DliDay(now, true));
+        result    &= (0 == gUwPoints[TIME_IDX_EVENING_GOLDEN_HOUR].shift);
+        gDliTarget = TARGET;
+    }
+    gDliTarget = TIME_DLI_TARGET;
+
+    TIME_LOGI("Time DLI Plan - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The targets follow the sampled weather, even the dry one, and only it */
+static void time_Test_Weather(void)
+{
+    climate_setpoint_t setpoint = {0};
+    bool               result   = true;
+
+    gWeather.cloud       = 100;
+    gWeather.temperature = 2650;
+    gWeather.humidity    = 0;
+
+    gWeatherValid = true;
+    time_EvaluateClimate(0, &setpoint);
+    result &= (2650 == setpoint.temperature);
+    result &= (100 > time_WeatherLight(100));
+
+    gWeatherValid = false;
+    time_EvaluateClimate(0, &setpoint);
+    result &= (TIME_TEMPERATURE_TARGET == setpoint.temperature);
+    result &= (100 == time_WeatherLight(100));
+
+    memset(&gWeather, 0, sizeof(gWeather));
+    TIME_LOGI("Time Weather Targets - %s", (true == result) ? "PASS" : "FAIL");
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1899,6 +2145,37 @@ void Time_Task_Test(void)
     time_Test_Alarm();
     time_Test_DayNight();
     time_Test_Point_Calculations();
+    time_Test_Continuity();
+    time_Test_Dli();
+    time_Test_Weather();
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Benchmarks ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The sunrise and the sunset of the every day of the year */
+static void time_BenchSun(void * p_ctx, uint32_t count)
+{
+    volatile time_t * p_sum   = (volatile time_t *)p_ctx;
+    time_t            morning = 0;
+    time_t            evening = 0;
+    uint32_t          idx     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        time_SunCalculate((1704067200 + (time_t)(idx % 366) * 86400), -0.83, &morning, &evening);
+        *p_sum += (evening - morning);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Time_Task_Bench(void)
+{
+    volatile time_t sum = 0;
+
+    Bench_Run("time", "time_SunCalculate", time_BenchSun, (void *)&sum, NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -0,0 +1,495 @@
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+
+#include "types.h"
+#include "weather.h"
+
+//-------------------------------------------------------------------------------------------------
+
+/* The weather trace image (little endian, generated by utils/weather/weather_trace.py):     */
+/*                                                                                          */
+/* Offset : Size : Description                                                              */
+/*      0 :    4 : Magic "WTHR"                                                             */
+/*      4 :    1 : Version                                                                  */
+/*      5 :    1 : Slot duration (minutes)                                                  */
+/*      6 :    1 : Record size (bytes)                                                      */
+/*      7 :    1 : Reserved                                                                 */
+/*      8 :    4 : Records count                                                            */
+/*     12 :    4 : CRC32 of the records                                                     */
+/*     16 :  ... : Records - Cloud (%), Temperature (0.5 C, signed), Humidity (%)           */
+/*                                                                                          */
+/* The slot is determined by the local time from the start of the year, so the one day trace */
+/* is repeated every day and the whole year trace reproduces the seasons. The values are     */
+/* interpolated linearly between the records, so the weather is changed smoothly.           */
+
+#define WEATHER_MAGIC              (0x52485457)
+#define WEATHER_PARTITION_SUBTYPE  (0x40)
+
+#define WTHR_LOG  1
+
+#if (1 == WTHR_LOG)
+static const char * gTAG = "WEATHER";
+#    define WTHR_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define WTHR_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define WTHR_LOGW(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define WTHR_LOGI(...)
+#    define WTHR_LOGE(...)
+#    define WTHR_LOGW(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    WEATHER_VERSION          = 1,
+    WEATHER_HEADER_SIZE      = 16,
+    WEATHER_RECORD_SIZE      = 3,
+    WEATHER_CRC_CHUNK_SIZE   = 64,
+    WEATHER_TEMPERATURE_STEP = 50,
+    WEATHER_HUMIDITY_STEP    = 100,
+    WEATHER_PERCENT_MAX      = 100,
+};
+
+typedef FW_RESULT (* weather_read_fp_t)(const void * p_ctx, uint32_t offset, void * p_dst, uint32_t size);
+
+typedef struct
+{
+    weather_read_fp_t fp_read;
+    const void *      ctx;
+    uint32_t          offset;
+    uint32_t          count;
+    uint32_t          slot_s;
+    uint32_t          index;
+    weather_t         curr;
+    weather_t         next;
+} weather_decoder_t, * weather_decoder_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static weather_decoder_t gDecoder = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t weather_GetU32(const uint8_t * p_data)
+{
+    return ((uint32_t)p_data[0] | ((uint32_t)p_data[1] << 8) |
+            ((uint32_t)p_data[2] << 16) | ((uint32_t)p_data[3] << 24));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT weather_ReadPartition(const void * p_ctx, uint32_t offset, void * p_dst, uint32_t size)
+{
+    esp_err_t error = ESP_FAIL;
+
+    error = esp_partition_read((const esp_partition_t *)p_ctx, offset, p_dst, size);
+
+    return (ESP_OK == error) ? FW_SUCCESS : FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void weather_DecodeRecord(const uint8_t * p_record, weather_p p_weather)
+{
+    uint8_t cloud    = p_record[0];
+    uint8_t humidity = p_record[2];
+
+    if (WEATHER_PERCENT_MAX < cloud)
+    {
+        cloud = WEATHER_PERCENT_MAX;
+    }
+    if (WEATHER_PERCENT_MAX < humidity)
+    {
+        humidity = WEATHER_PERCENT_MAX;
+    }
+
+    p_weather->cloud       = cloud;
+    p_weather->temperature = ((int8_t)p_record[1] * WEATHER_TEMPERATURE_STEP);
+    p_weather->humidity    = (humidity * WEATHER_HUMIDITY_STEP);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT weather_Open(weather_decoder_p p_dec, weather_read_fp_t fp_read, const void * p_ctx)
+{
+    uint8_t   header[WEATHER_HEADER_SIZE]   = {0};
+    uint8_t   chunk[WEATHER_CRC_CHUNK_SIZE] = {0};
+    uint32_t  crc                           = 0;
+    uint32_t  size                          = 0;
+    uint32_t  offset                        = 0;
+    uint32_t  length                        = 0;
+    FW_RESULT result                        = FW_ERROR;
+
+    memset(p_dec, 0, sizeof(weather_decoder_t));
+    p_dec->index = UINT32_MAX;
+
+    result = fp_read(p_ctx, 0, header, sizeof(header));
+    if (FW_SUCCESS != result)
+    {
+        WTHR_LOGE("Header read error");
+        return FW_ERROR;
+    }
+
+    if ((WEATHER_MAGIC != weather_GetU32(&header[0])) ||
+        (WEATHER_VERSION != header[4]) ||
+        (0 == header[5]) ||
+        (WEATHER_RECORD_SIZE != header[6]) ||
+        (0 == weather_GetU32(&header[8])))
+    {
+        WTHR_LOGE("Invalid header");
+        return FW_ERROR;
+    }
+
+    /* Verify the records by chunks - the trace is never loaded into RAM as a whole */
+    size   = (weather_GetU32(&header[8]) * WEATHER_RECORD_SIZE);
+    offset = WEATHER_HEADER_SIZE;
+    while (0 < size)
+    {
+        length = (size < sizeof(chunk)) ? size : sizeof(chunk);
+        result = fp_read(p_ctx, offset, chunk, length);
+        if (FW_SUCCESS != result)
+        {
+            WTHR_LOGE("Records read error at %lu", offset);
+            return FW_ERROR;
+        }
+        crc     = esp_rom_crc32_le(crc, chunk, length);
+        offset += length;
+        size   -= length;
+    }
+    if (crc != weather_GetU32(&header[12]))
+    {
+        WTHR_LOGE("CRC error: %08lX != %08lX", crc, weather_GetU32(&header[12]));
+        return FW_ERROR;
+    }
+
+    p_dec->fp_read = fp_read;
+    p_dec->ctx     = p_ctx;
+    p_dec->offset  = WEATHER_HEADER_SIZE;
+    p_dec->count   = weather_GetU32(&header[8]);
+    p_dec->slot_s  = (header[5] * 60);
+
+    WTHR_LOGI("Trace: %lu records, %lu s per slot", p_dec->count, p_dec->slot_s);
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT weather_ReadRecord(weather_decoder_p p_dec, uint32_t index, weather_p p_weather)
+{
+    uint8_t   record[WEATHER_RECORD_SIZE] = {0};
+    FW_RESULT result                      = FW_ERROR;
+
+    result = p_dec->fp_read
+             (
+                 p_dec->ctx,
+                 (p_dec->offset + (index % p_dec->count) * WEATHER_RECORD_SIZE),
+                 record,
+                 sizeof(record)
+             );
+    if (FW_SUCCESS == result)
+    {
+        weather_DecodeRecord(record, p_weather);
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int32_t weather_Interpolate(int32_t a, int32_t b, uint32_t elapsed, uint32_t slot)
+{
+    return (a + (b - a) * (int32_t)elapsed / (int32_t)slot);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT weather_Decode(weather_decoder_p p_dec, time_t t, weather_p p_weather)
+{
+    struct tm dt      = {0};
+    uint32_t  seconds = 0;
+    uint32_t  index   = 0;
+    uint32_t  elapsed = 0;
+    FW_RESULT result  = FW_ERROR;
+
+    if (0 == p_dec->count)
+    {
+        return FW_ERROR;
+    }
+
+    /* The slot index from the start of the local year */
+    localtime_r(&t, &dt);
+    seconds = ((dt.tm_yday * 24 + dt.tm_hour) * 3600 + dt.tm_min * 60 + dt.tm_sec);
+    index   = ((seconds / p_dec->slot_s) % p_dec->count);
+    elapsed = (seconds % p_dec->slot_s);
+
+    /* The trace is streamed - only the next record is read when the slot is changed */
+    if (index != p_dec->index)
+    {
+        if ((UINT32_MAX != p_dec->index) && (((p_dec->index + 1) % p_dec->count) == index))
+        {
+            memcpy(&p_dec->curr, &p_dec->next, sizeof(weather_t));
+            result = weather_ReadRecord(p_dec, (index + 1), &p_dec->next);
+        }
+        else
+        {
+            result = weather_ReadRecord(p_dec, index, &p_dec->curr);
+            if (FW_SUCCESS == result)
+            {
+                result = weather_ReadRecord(p_dec, (index + 1), &p_dec->next);
+            }
+        }
+        if (FW_SUCCESS != result)
+        {
+            p_dec->index = UINT32_MAX;
+            return FW_ERROR;
+        }
+        p_dec->index = index;
+    }
+
+    /* The weather is changed smoothly inside the slot */
+    p_weather->cloud       = weather_Interpolate
+                             (p_dec->curr.cloud, p_dec->next.cloud, elapsed, p_dec->slot_s);
+    p_weather->temperature = weather_Interpolate
+                             (p_dec->curr.temperature, p_dec->next.temperature, elapsed, p_dec->slot_s);
+    p_weather->humidity    = weather_Interpolate
+                             (p_dec->curr.humidity, p_dec->next.humidity, elapsed, p_dec->slot_s);
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT Weather_Init(void)
+{
+    const esp_partition_t * p_part = NULL;
+
+    p_part = esp_partition_find_first
+             (
+                 ESP_PARTITION_TYPE_DATA,
+                 (esp_partition_subtype_t)WEATHER_PARTITION_SUBTYPE,
+                 "weather"
+             );
+    if (NULL == p_part)
+    {
+        WTHR_LOGE("Partition is absent - clear sky is used");
+        memset(&gDecoder, 0, sizeof(gDecoder));
+        return FW_ERROR;
+    }
+
+    return weather_Open(&gDecoder, weather_ReadPartition, p_part);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool Weather_IsAvailable(void)
+{
+    return (0 < gDecoder.count);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT Weather_Get(time_t t, weather_p p_weather)
+{
+    return weather_Decode(&gDecoder, t, p_weather);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    const uint8_t * data;
+    uint32_t        size;
+    uint32_t        reads;
+} weather_test_image_t, * weather_test_image_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT weather_Test_ReadImage(const void * p_ctx, uint32_t offset, void * p_dst, uint32_t size)
+{
+    weather_test_image_p p_image = (weather_test_image_p)p_ctx;
+
+    if ((offset + size) > p_image->size)
+    {
+        return FW_ERROR;
+    }
+    memcpy(p_dst, &p_image->data[offset], size);
+    p_image->reads++;
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void weather_Test_PutU32(uint8_t * p_data, uint32_t value)
+{
+    p_data[0] = (uint8_t)(value);
+    p_data[1] = (uint8_t)(value >> 8);
+    p_data[2] = (uint8_t)(value >> 16);
+    p_data[3] = (uint8_t)(value >> 24);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The same encoding as in utils/weather/weather_trace.py */
+static uint32_t weather_Test_Encode(const weather_t * p_src, uint32_t count, uint8_t * p_dst)
+{
+    uint32_t  idx      = 0;
+    uint8_t * p_record = &p_dst[WEATHER_HEADER_SIZE];
+
+    weather_Test_PutU32(&p_dst[0], WEATHER_MAGIC);
+    p_dst[4] = WEATHER_VERSION;
+    p_dst[5] = 10;
+    p_dst[6] = WEATHER_RECORD_SIZE;
+    p_dst[7] = 0;
+    weather_Test_PutU32(&p_dst[8], count);
+
+    for (idx = 0; idx < count; idx++)
+    {
+        p_record[0] = p_src[idx].cloud;
+        p_record[1] = (uint8_t)(int8_t)(p_src[idx].temperature / WEATHER_TEMPERATURE_STEP);
+        p_record[2] = (p_src[idx].humidity / WEATHER_HUMIDITY_STEP);
+        p_record   += WEATHER_RECORD_SIZE;
+    }
+    weather_Test_PutU32
+    (
+        &p_dst[12],
+        esp_rom_crc32_le(0, &p_dst[WEATHER_HEADER_SIZE], (count * WEATHER_RECORD_SIZE))
+    );
+
+    return (WEATHER_HEADER_SIZE + count * WEATHER_RECORD_SIZE);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void weather_Test_Decoder(void)
+{
+    enum
+    {
+        COUNT = 6,
+    };
+    const weather_t trace[COUNT] =
+    {
+        {  0,  2450, 7000},
+        { 20,  2300, 7500},
+        { 55, -1250, 8000},
+        {100,     0, 9900},
+        { 35,  3150, 6000},
+        { 80,  1800,  500},
+    };
+    uint8_t              data[WEATHER_HEADER_SIZE + COUNT * WEATHER_RECORD_SIZE] = {0};
+    weather_test_image_t image   = {data, 0, 0};
+    weather_decoder_t    decoder = {0};
+    weather_t            weather = {0};
+    const weather_t *    curr    = NULL;
+    const weather_t *    next    = NULL;
+    struct tm            dt      = {0};
+    time_t               t       = 0;
+    uint32_t             idx     = 0;
+    uint32_t             reads   = 0;
+    FW_RESULT            result  = FW_ERROR;
+    bool                 pass    = true;
+
+    image.size = weather_Test_Encode(trace, COUNT, data);
+
+    /* Round trip of every record, the day starts from the first one */
+    result = weather_Open(&decoder, weather_Test_ReadImage, &image);
+    pass   = (FW_SUCCESS == result);
+
+    dt.tm_mday  = 1;
+    dt.tm_year  = (2025 - 1900);
+    dt.tm_isdst = -1;
+    t = mktime(&dt);
+
+    /* The record itself at the start of the slot and the average in the middle of it */
+    for (idx = 0; (idx < (2 * COUNT)) && (true == pass); idx++)
+    {
+        curr   = &trace[idx % COUNT];
+        next   = &trace[(idx + 1) % COUNT];
+        result = weather_Decode(&decoder, (t + idx * 600), &weather);
+        pass   = ((FW_SUCCESS == result) &&
+                  (curr->cloud == weather.cloud) &&
+                  (curr->temperature == weather.temperature) &&
+                  (curr->humidity == weather.humidity));
+        result = weather_Decode(&decoder, (t + idx * 600 + 300), &weather);
+        pass  &= ((FW_SUCCESS == result) &&
+                  ((curr->cloud + (next->cloud - curr->cloud) / 2) == weather.cloud) &&
+                  ((curr->temperature + (next->temperature - curr->temperature) / 2) ==
+                   weather.temperature) &&
+                  ((curr->humidity + (next->humidity - curr->humidity) / 2) == weather.humidity));
+    }
+
+    /* The next slot reads the single record, the same slot must not touch the flash */
+    reads  = image.reads;
+    result = weather_Decode(&decoder, (t + 1), &weather);
+    result = weather_Decode(&decoder, (t + 2), &weather);
+    pass  &= ((FW_SUCCESS == result) && ((reads + 1) == image.reads));
+    result = weather_Decode(&decoder, (t + 600), &weather);
+    pass  &= ((FW_SUCCESS == result) && ((reads + 2) == image.reads));
+
+    if (true == pass)
+    {
+        WTHR_LOGI("Weather Decoder - PASS");
+    }
+    else
+    {
+        WTHR_LOGE("Weather Decoder - FAIL at %lu", idx);
+    }
+
+    /* The corrupted trace must be rejected */
+    data[WEATHER_HEADER_SIZE + 4] ^= 0x01;
+    result = weather_Open(&decoder, weather_Test_ReadImage, &image);
+    pass   = ((FW_ERROR == result) && (FW_ERROR == weather_Decode(&decoder, t, &weather)));
+    data[WEATHER_HEADER_SIZE + 4] ^= 0x01;
+
+    /* The truncated trace must be rejected */
+    image.size -= 1;
+    result = weather_Open(&decoder, weather_Test_ReadImage, &image);
+    pass  &= (FW_ERROR == result);
+
+    if (true == pass)
+    {
+        WTHR_LOGI("Weather Corrupted Trace - PASS");
+    }
+    else
+    {
+        WTHR_LOGE("Weather Corrupted Trace - FAIL");
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Weather_Test(void)
+{
+    weather_t weather = {0};
+    time_t    now     = 0;
+
+    weather_Test_Decoder();
+
+    /* Dump the current record of the flashed trace */
+    (void)Weather_Init();
+    time(&now);
+    if (FW_SUCCESS == Weather_Get(now, &weather))
+    {
+        WTHR_LOGI
+        (
+            "Now: Cloud %d %% : T %d : H %d",
+            weather.cloud,
+            weather.temperature,
+            weather.humidity
+        );
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -4,5 +4,7 @@
 void UDP_DNS_NotifyWiFiIsConnected(uint32_t ip);
 void UDP_DNS_NotifyWiFiIsDisconnected(void);
 void UDP_DNS_Task_Init(void);
+void UDP_DNS_Test(void);
+void UDP_DNS_Bench(void);
 
 #endif /* __UDP_DNS_SERVER_H__ */
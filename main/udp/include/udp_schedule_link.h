@@ -0,0 +1,18 @@
+#ifndef __UDP_SCHEDULE_LINK_H__
+#define __UDP_SCHEDULE_LINK_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+/* The enclosures side by side show the same Sun imitation: the leader multicasts its */
+/* schedule timeline, the followers phase-lock their LED timelines to it.             */
+
+void UDP_Link_NotifyWiFiIsConnected(uint32_t ip);
+void UDP_Link_NotifyWiFiIsDisconnected(void);
+void UDP_Link_GetTime(struct timeval * p_tv);
+bool UDP_Link_IsLocked(void);
+void UDP_Link_Task_Init(void);
+void UDP_Link_Test(void);
+
+#endif /* __UDP_SCHEDULE_LINK_H__ */
@@ -0,0 +1,9 @@
+#ifndef __UDP_SNTP_SERVER_H__
+#define __UDP_SNTP_SERVER_H__
+
+void UDP_SNTP_NotifyWiFiIsConnected(uint32_t ip);
+void UDP_SNTP_NotifyWiFiIsDisconnected(void);
+void UDP_SNTP_Task_Init(void);
+void UDP_SNTP_Test(void);
+
+#endif /* __UDP_SNTP_SERVER_H__ */
@@ -26,6 +26,9 @@
 #include "types.h"
 #include "led_strip.h"
 #include "udp_dns_server.h"
+#include "trace.h"
+#include "bench.h"
+#include "fuzz.h"
 
 //-------------------------------------------------------------------------------------------------
 
@@ -55,6 +58,8 @@
 
 /* Maximum domain name octet length without zero terminated char for this server. */
 #define DNS_MAX_OCTET_LEN 60
+/* Maximum label length, the upper bits of the length are the compression pointer. */
+#define DNS_MAX_LABEL_LEN 63
 
 #define DNS_LOG  0
 
@@ -150,62 +155,54 @@ static uint8_t            gDnsBuffer[1024] = {0};
 
 //-------------------------------------------------------------------------------------------------
 
-#if (2 == DNS_LOG)
-#define DNS_LOG_Q_BUF_DECL()      char log[DNS_MAX_OCTET_LEN] = {0}
-#define DNS_LOG_Q_BUF()           log
-#define DNS_LOG_Q_APPEND(idx,chr) log[idx] = chr
-#else
-#define DNS_LOG_Q_BUF_DECL()
-#define DNS_LOG_Q_BUF()
-#define DNS_LOG_Q_APPEND(...)
-#endif
-
-static int dns_ParseQuestion
+/* Returns the length of the question, 0 - it is malformed or the name does not fit */
+static uint16_t dns_ParseQuestion
 (
-    dns_packet_t * p_pkt,
+    const uint8_t * p_data,
     uint16_t size,
     char * p_name,
+    uint16_t name_size,
     uint16_t * p_type,
     uint16_t * p_class
 )
 {
-    uint16_t i, length, j;
-    char *   question               = p_pkt->data;
-
-    DNS_LOG_Q_BUF_DECL();
+    uint16_t pos    = 0;
+    uint16_t length = 0;
+    uint16_t out    = 0;
 
-    if (DNS_MAX_OCTET_LEN < size)
+    /* The labels are copied while both the question and the name have the room for them */
+    while (pos < size)
     {
-        return 0;
-    }
-
-    i = 0;
-    length = question[i++];
+        length = p_data[pos++];
+        if (0 == length)
+        {
+            break;
+        }
 
-    do
-    {
-        for (j = 0; j < length; j++)
+        /* The compression pointers (0xC0) are not expected in the question */
+        if ((DNS_MAX_LABEL_LEN < length) || ((size - pos) < length) || ((name_size - out) <= length))
         {
-            *p_name++ = question[i + j];
-            DNS_LOG_Q_APPEND(j, question[i + j]);
+            return 0;
         }
-        DNS_LOG_Q_APPEND(j, '\0');
-        DNS_LOGV("  - Size: %d - Question: %s", length, DNS_LOG_Q_BUF());
+        DNS_LOGV("  - Size: %d - Question: %.*s", length, length, (const char *)&p_data[pos]);
 
-        *p_name++ = '.';
-        i += length;
-        length = question[i++];
+        memcpy(&p_name[out], &p_data[pos], length);
+        out += length;
+        p_name[out++] = '.';
+        pos += length;
     }
-    while ((length != 0) && (i < size));
-    *--p_name = '\0';
 
-    *p_type = (question[i++] << 8);
-    *p_type += question[i++];
+    /* The root label, the type and the class */
+    if ((0 != length) || ((size - pos) < 4) || (0 == name_size))
+    {
+        return 0;
+    }
+    p_name[(0 < out) ? (out - 1) : 0] = '\0';
 
-    *p_class = (question[i++] << 8);
-    *p_class += question[i++];
+    *p_type  = ((p_data[pos] << 8) | p_data[pos + 1]);
+    *p_class = ((p_data[pos + 2] << 8) | p_data[pos + 3]);
 
-    return 1;
+    return (pos + 4);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -218,13 +215,21 @@ static int dns_ParseQuestion
 #define DNS_LOG_R_ID()
 #endif
 
-static int dns_ParseRequest(uint8_t * p_buf, int16_t size, char * p_name)
+/* Returns the length of the header and the question, 0 - the request is not answered */
+static int dns_ParseRequest(const uint8_t * p_buf, uint16_t size, char * p_name)
 {
-    dns_packet_t * p_pkt                   = (dns_packet_t *)p_buf;
-    uint16_t       qdcount                 = ntohs(p_pkt->header.qdcount);
-    uint16_t       type                    = 0;
-    uint16_t       class                   = 0;
-    int            result                  = 0;
+    const dns_packet_t * p_pkt   = (const dns_packet_t *)p_buf;
+    uint16_t             qdcount = 0;
+    uint16_t             type    = 0;
+    uint16_t             class   = 0;
+    uint16_t             length  = 0;
+    int                  result  = 0;
+
+    if (sizeof(dns_header_t) > size)
+    {
+        return 0;
+    }
+    qdcount = ntohs(p_pkt->header.qdcount);
 
     DNS_LOG_R_ID_DECL();
 
@@ -234,15 +239,21 @@ static int dns_ParseRequest(uint8_t * p_buf, int16_t size, char * p_name)
         DNS_LOGV("--- ID: %d - QR: %d - QD Count: %d", DNS_LOG_R_ID(), p_pkt->header.qr, qdcount);
         DNS_LOGV("  - Data Size: %d", (int)(size - sizeof(p_pkt->header)));
 
-        size = (size - sizeof(p_pkt->header));
-
-        dns_ParseQuestion(p_pkt, size, p_name, &type, &class);
-
-        if ((DNS_TYPE_A == type) || (DNS_TYPE_PTR == type))
+        length = dns_ParseQuestion
+                 (
+                     &p_buf[sizeof(dns_header_t)],
+                     (size - sizeof(dns_header_t)),
+                     p_name,
+                     DNS_MAX_OCTET_LEN,
+                     &type,
+                     &class
+                 );
+
+        if ((0 < length) && ((DNS_TYPE_A == type) || (DNS_TYPE_PTR == type)))
         {
             DNS_LOGI("  - Name: %s", p_name);
 
-            result = 1;
+            result = (sizeof(dns_header_t) + length);
         }
     }
 
@@ -340,6 +351,8 @@ static int dns_PrepareAnswer(uint8_t * p_buf, uint16_t size, uint32_t ip, const
 
 //-------------------------------------------------------------------------------------------------
 
+/* The answer follows the question, the records after it are dropped. */
+/* The question is limited by the name, so the answer always fits the buffer. */
 static int dns_ProcessRequest(uint8_t * p_buf, uint16_t size)
 {
     char           name[DNS_MAX_OCTET_LEN] = {0};
@@ -348,7 +361,9 @@ static int dns_ProcessRequest(uint8_t * p_buf, uint16_t size)
     int            result                  = 0;
     int            idx                     = 0;
 
-    if (dns_ParseRequest(gDnsBuffer, size, name))
+    TRACE_SPAN(TRACE_DNS_REQUEST);
+    size = dns_ParseRequest(p_buf, size, name);
+    if (0 < size)
     {
         do
         {
@@ -357,7 +372,7 @@ static int dns_ProcessRequest(uint8_t * p_buf, uint16_t size)
             DNS_LOGV("  - Reversed IP: %s, %08X", addr, (int)rip);
             if (NULL != strstr(name, addr))
             {
-                result = dns_PrepareAnswer(gDnsBuffer, size, gIpAddr, gURL[0]);
+                result = dns_PrepareAnswer(p_buf, size, gIpAddr, gURL[0]);
                 break;
             }
 
@@ -366,7 +381,7 @@ static int dns_ProcessRequest(uint8_t * p_buf, uint16_t size)
             {
                 if (NULL != strstr(name, gURL[idx]))
                 {
-                    result = dns_PrepareAnswer(gDnsBuffer, size, gIpAddr, NULL);
+                    result = dns_PrepareAnswer(p_buf, size, gIpAddr, NULL);
                     break;
                 }
             }
@@ -537,4 +552,180 @@ void UDP_DNS_Task_Init(void)
 }
 
 //-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t  buf[sizeof(gDnsBuffer)];
+    uint32_t answers;
+} dns_test_t;
+
+//-------------------------------------------------------------------------------------------------
+
+/* The query as the client sends it, returns its size */
+static uint16_t dns_TestQuery(uint8_t * p_buf, const char * p_name, uint8_t type)
+{
+    dns_packet_t * p_pkt = (dns_packet_t *)p_buf;
+    uint16_t       pos   = sizeof(dns_header_t);
+
+    memset(p_buf, 0, sizeof(dns_header_t));
+    p_pkt->header.id      = htons(0x1234);
+    p_pkt->header.rd      = 1;
+    p_pkt->header.qdcount = htons(1);
+    pos += dns_PrepareName(&p_buf[pos], p_name);
+    p_buf[pos++] = 0x00;
+    p_buf[pos++] = type;
+    p_buf[pos++] = 0x00;
+    p_buf[pos++] = 0x01;
+
+    return pos;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The query with the EDNS record (OPT) after the question, returns its size */
+static uint16_t dns_TestQueryEdns(uint8_t * p_buf, const char * p_name)
+{
+    static const uint8_t opt[] = {0x00, 0x00, 0x29, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    dns_packet_t *       p_pkt = (dns_packet_t *)p_buf;
+    uint16_t             size  = dns_TestQuery(p_buf, p_name, DNS_TYPE_A);
+
+    p_pkt->header.arcount = htons(1);
+    memcpy(&p_buf[size], opt, sizeof(opt));
+
+    return (size + sizeof(opt));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The name fits its buffer, the answer follows the question and fits the receive buffer */
+static bool dns_TestFuzz(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    dns_test_t * p_test                      = (dns_test_t *)p_ctx;
+    char         name[DNS_MAX_OCTET_LEN + 1] = {0};
+    int          length                      = 0;
+    int          result                      = 0;
+    bool         pass                        = true;
+
+    name[DNS_MAX_OCTET_LEN] = '#';
+    length = dns_ParseRequest(p_data, size, name);
+    pass  &= ((0 <= length) && (size >= length));
+    pass  &= ('#' == name[DNS_MAX_OCTET_LEN]);
+    pass  &= ((0 == length) || (DNS_MAX_OCTET_LEN > strlen(name)));
+
+    memcpy(p_test->buf, p_data, size);
+    result = dns_ProcessRequest(p_test->buf, size);
+    pass  &= ((0 == result) || ((0 < length) && (length < result) && ((int)sizeof(p_test->buf) >= result)));
+    p_test->answers += (0 < result) ? 1 : 0;
+
+    return pass;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_DNS_Test(void)
+{
+    static dns_test_t test;
+    static uint8_t    queries[4][128];
+    fuzz_seed_t       seeds[4]                       = {0};
+    char              name[DNS_MAX_OCTET_LEN + 1]    = {0};
+    char              longest[DNS_MAX_OCTET_LEN + 1] = {0};
+    uint16_t          size                           = 0;
+    bool              pass                           = true;
+
+    /* The captive portal probes, the reverse lookup of the site name and the EDNS query */
+    seeds[0].p_data = queries[0];
+    seeds[0].size   = dns_TestQuery(queries[0], "connectivitycheck.gstatic.com", DNS_TYPE_A);
+    seeds[1].p_data = queries[1];
+    seeds[1].size   = dns_TestQuery(queries[1], "www.msftncsi.com", DNS_TYPE_A);
+    seeds[2].p_data = queries[2];
+    seeds[2].size   = dns_TestQuery(queries[2], "1.4.168.192.in-addr.arpa", DNS_TYPE_PTR);
+    seeds[3].p_data = queries[3];
+    seeds[3].size   = dns_TestQueryEdns(queries[3], "home.local");
+
+    pass &= (0 == dns_ParseRequest(queries[0], (seeds[0].size - 4), name));
+    pass &= (seeds[0].size == dns_ParseRequest(queries[0], seeds[0].size, name));
+    pass &= (0 == strcmp(name, "connectivitycheck.gstatic.com"));
+
+    /* The answer follows the question, the EDNS record is dropped */
+    memcpy(test.buf, queries[3], seeds[3].size);
+    size  = (seeds[3].size - 11);
+    pass &= ((int)(size + 2 + sizeof(dns_answer_t) + 4) == dns_ProcessRequest(test.buf, seeds[3].size));
+
+    /* The longest name fits, the longer one and the compression pointer do not */
+    memset(longest, 'a', (DNS_MAX_OCTET_LEN - 1));
+    longest[29] = '.';
+    size  = dns_TestQuery(test.buf, longest, DNS_TYPE_A);
+    pass &= (size == dns_ParseRequest(test.buf, size, name));
+    pass &= (0 == strcmp(name, longest));
+    longest[DNS_MAX_OCTET_LEN - 1] = 'a';
+    size  = dns_TestQuery(test.buf, longest, DNS_TYPE_A);
+    pass &= (0 == dns_ParseRequest(test.buf, size, name));
+    size  = dns_TestQuery(test.buf, "home.local", DNS_TYPE_A);
+    test.buf[sizeof(dns_header_t)] = 0xC0;
+    pass &= (0 == dns_ParseRequest(test.buf, size, name));
+    pass &= (0 == dns_ParseRequest(test.buf, (sizeof(dns_header_t) - 1), name));
+
+    pass &= (0 == Fuzz_Run("dns", seeds, 4, dns_TestFuzz, &test, 20000));
+    pass &= (0 < test.answers);
+
+    DNS_LOGI("DNS - %s", (true == pass) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Benchmarks ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t           query[64];
+    uint8_t           buf[128];
+    uint16_t          size;
+    volatile uint32_t sum;
+} dns_bench_t, * dns_bench_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static void dns_BenchParse(void * p_ctx, uint32_t count)
+{
+    dns_bench_p p_bench                 = (dns_bench_p)p_ctx;
+    char        name[DNS_MAX_OCTET_LEN] = {0};
+    uint32_t    idx                     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        p_bench->sum += dns_ParseRequest(p_bench->query, p_bench->size, name);
+        p_bench->sum += (uint8_t)name[idx & 7];
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The answer is made in place, so the query is copied every time */
+static void dns_BenchAnswer(void * p_ctx, uint32_t count)
+{
+    dns_bench_p p_bench = (dns_bench_p)p_ctx;
+    uint32_t    idx     = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        memcpy(p_bench->buf, p_bench->query, p_bench->size);
+        p_bench->sum += dns_PrepareAnswer(p_bench->buf, p_bench->size, (0x0104A8C0 + idx), NULL);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_DNS_Bench(void)
+{
+    static dns_bench_t bench;
+
+    memset(&bench, 0, sizeof(bench));
+    bench.size = dns_TestQuery(bench.query, "connectivitycheck.gstatic.com", DNS_TYPE_A);
+    Bench_Run("dns", "dns_ParseRequest", dns_BenchParse, &bench, NULL);
+    Bench_Run("dns", "dns_PrepareAnswer", dns_BenchAnswer, &bench, NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,727 @@
+#include <string.h>
+#include <sys/param.h>
+#include <sys/time.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_system.h"
+#include "esp_log.h"
+
+#include "lwip/err.h"
+#include "lwip/sockets.h"
+#include "lwip/sys.h"
+
+#include "types.h"
+#include "time_sync.h"
+#include "udp_schedule_link.h"
+
+//-------------------------------------------------------------------------------------------------
+
+/* The leader multicasts its schedule timeline every second. The follower estimates the     */
+/* offset and the frequency of the leader timeline relative to its own clock (PI loop), so  */
+/* its LED tasks sample the schedule at the leader time even when some packets are lost.    */
+/* The network delay (~1-3 ms on WiFi) is not compensated, it is far below the LED frame.   */
+
+#define PORT                     5123
+#define GROUP                    "239.255.77.1"
+#define EVT_WIFI_CONNECTED       BIT0
+
+#define LINK_LOG  1
+
+#if (1 == LINK_LOG)
+static const char * gTAG = "LINK";
+#    define LINK_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define LINK_LOGE(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define LINK_LOGV(...)
+#elif (2 == LINK_LOG)
+static const char * gTAG = "LINK";
+#    define LINK_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define LINK_LOGE(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define LINK_LOGV(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#else
+#    define LINK_LOGI(...)
+#    define LINK_LOGE(...)
+#    define LINK_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+/* The link packet (big endian):                                      */
+/*                                                                    */
+/* Offset : Size : Description                                        */
+/*      0 :    2 : Magic ("OR")                                       */
+/*      2 :    1 : Version                                            */
+/*      3 :    1 : Flags                                              */
+/*      4 :    4 : Leader node identifier (IP address)                */
+/*      8 :    4 : Sequence number                                    */
+/*     12 :    4 : Schedule epoch - the local midnight (Unix seconds) */
+/*     16 :    4 : Frame timestamp - since the epoch (milliseconds)   */
+
+enum
+{
+    LINK_PACKET_SIZE      = 20,
+    LINK_MAGIC            = 0x4F52,
+    LINK_VERSION          = 1,
+    LINK_OFFSET_VERSION   = 2,
+    LINK_OFFSET_FLAGS     = 3,
+    LINK_OFFSET_NODE      = 4,
+    LINK_OFFSET_SEQUENCE  = 8,
+    LINK_OFFSET_EPOCH     = 12,
+    LINK_OFFSET_FRAME     = 16,
+    /* The leader time is synchronized with SNTP */
+    LINK_FLAG_SYNCED      = 0x01,
+    LINK_PERIOD_MS        = 1000,
+    /* The leader is lost after this time, the timeline is kept by the last estimation */
+    LINK_TIMEOUT_US       = 10000000,
+    /* The leader time is stepped (SNTP, restart) - the estimation is started again */
+    LINK_STEP_US          = 500000,
+    LINK_LOCK_SAMPLES     = 4,
+    /* The loop gains (critically damped): the phase error part applied on every packet. */
+    /* The delay jitter is averaged over ~16 packets, the lock takes ~1 minute.           */
+    LINK_KP_DIV           = 8,
+    LINK_KI_DIV           = 256,
+    /* The crystals are +/-50 ppm, the wider estimation means the wrong samples */
+    LINK_FREQ_MAX_PPB     = 500000,
+};
+
+typedef struct
+{
+    uint8_t  flags;
+    uint32_t node;
+    uint32_t sequence;
+    uint32_t epoch;
+    uint32_t frame;
+} link_packet_t, * link_packet_p;
+
+typedef struct
+{
+    /* The leader timeline minus the local time at the reference (us) */
+    int64_t  offset;
+    /* The local time of the last update (us) */
+    int64_t  ref;
+    /* The leader timeline rate relative to the local clock (ppb) */
+    int32_t  freq;
+    uint32_t samples;
+    uint32_t node;
+    uint32_t sequence;
+} link_pll_t, * link_pll_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static EventGroupHandle_t gLinkEvents                       = NULL;
+static SemaphoreHandle_t  gLinkMutex                        = NULL;
+static uint32_t           gIpAddr                           = 0;
+static link_pll_t         gLinkPll                          = {0};
+static uint8_t            gLinkBuffer[LINK_PACKET_SIZE * 2] = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static void link_PutU32(uint8_t * p_data, uint32_t value)
+{
+    p_data[0] = (uint8_t)(value >> 24);
+    p_data[1] = (uint8_t)(value >> 16);
+    p_data[2] = (uint8_t)(value >> 8);
+    p_data[3] = (uint8_t)(value);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t link_GetU32(const uint8_t * p_data)
+{
+    return (((uint32_t)p_data[0] << 24) | ((uint32_t)p_data[1] << 16) |
+            ((uint32_t)p_data[2] << 8) | (uint32_t)p_data[3]);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int link_Encode(uint8_t * p_buf, const link_packet_t * p_packet)
+{
+    p_buf[0] = (uint8_t)(LINK_MAGIC >> 8);
+    p_buf[1] = (uint8_t)(LINK_MAGIC);
+    p_buf[LINK_OFFSET_VERSION] = LINK_VERSION;
+    p_buf[LINK_OFFSET_FLAGS] = p_packet->flags;
+    link_PutU32(&p_buf[LINK_OFFSET_NODE], p_packet->node);
+    link_PutU32(&p_buf[LINK_OFFSET_SEQUENCE], p_packet->sequence);
+    link_PutU32(&p_buf[LINK_OFFSET_EPOCH], p_packet->epoch);
+    link_PutU32(&p_buf[LINK_OFFSET_FRAME], p_packet->frame);
+
+    return LINK_PACKET_SIZE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_BOOLEAN link_Decode(const uint8_t * p_buf, int size, link_packet_p p_packet)
+{
+    /* The packet size is fixed, the newer versions are not compatible */
+    if ((LINK_PACKET_SIZE != size) ||
+        ((uint8_t)(LINK_MAGIC >> 8) != p_buf[0]) ||
+        ((uint8_t)(LINK_MAGIC) != p_buf[1]) ||
+        (LINK_VERSION != p_buf[LINK_OFFSET_VERSION]))
+    {
+        return FW_FALSE;
+    }
+
+    p_packet->flags    = p_buf[LINK_OFFSET_FLAGS];
+    p_packet->node     = link_GetU32(&p_buf[LINK_OFFSET_NODE]);
+    p_packet->sequence = link_GetU32(&p_buf[LINK_OFFSET_SEQUENCE]);
+    p_packet->epoch    = link_GetU32(&p_buf[LINK_OFFSET_EPOCH]);
+    p_packet->frame    = link_GetU32(&p_buf[LINK_OFFSET_FRAME]);
+
+    return FW_TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Splits the leader time (us) into the schedule epoch and the frame timestamp */
+static void link_Frame(int64_t time, link_packet_p p_packet)
+{
+    time_t    t  = (time_t)(time / 1000000);
+    struct tm dt = {0};
+
+    /* The same start of the day as the schedule has */
+    localtime_r(&t, &dt);
+    dt.tm_hour  = 0;
+    dt.tm_min   = 0;
+    dt.tm_sec   = 0;
+    dt.tm_isdst = -1;
+
+    p_packet->epoch = (uint32_t)mktime(&dt);
+    p_packet->frame = (uint32_t)((time - (int64_t)p_packet->epoch * 1000000) / 1000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int64_t link_LeaderTime(const link_packet_t * p_packet)
+{
+    /* The frame is truncated to milliseconds by the leader, the middle is taken */
+    return ((int64_t)p_packet->epoch * 1000000 + (int64_t)p_packet->frame * 1000 + 500);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int64_t link_Now(void)
+{
+    struct timeval now = {0};
+
+    gettimeofday(&now, NULL);
+
+    return ((int64_t)now.tv_sec * 1000000 + now.tv_usec);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the leader timeline at the local time (us) */
+static int64_t link_PllPredict(const link_pll_t * p_pll, int64_t local)
+{
+    if (0 == p_pll->samples)
+    {
+        return local;
+    }
+
+    return (local + p_pll->offset + ((int64_t)p_pll->freq * (local - p_pll->ref)) / 1000000000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool link_PllIsLocked(const link_pll_t * p_pll, int64_t local)
+{
+    return ((LINK_LOCK_SAMPLES <= p_pll->samples) && (LINK_TIMEOUT_US >= (local - p_pll->ref)));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Applies the leader timeline sample received at the local time (us) */
+static FW_BOOLEAN link_PllUpdate(link_pll_p p_pll, int64_t local, const link_packet_t * p_packet)
+{
+    int64_t leader = link_LeaderTime(p_packet);
+    int64_t dt     = (local - p_pll->ref);
+    int64_t error  = 0;
+    int64_t freq   = 0;
+
+    if (0 < p_pll->samples)
+    {
+        /* The lost leader is replaced by any other one */
+        if (LINK_TIMEOUT_US < dt)
+        {
+            p_pll->samples = 0;
+        }
+        /* Only one leader is followed */
+        else if (p_pll->node != p_packet->node)
+        {
+            return FW_FALSE;
+        }
+        /* The duplicated and the reordered packets are dropped */
+        else if ((0 >= (int32_t)(p_packet->sequence - p_pll->sequence)) || (0 >= dt))
+        {
+            return FW_FALSE;
+        }
+    }
+
+    if (0 < p_pll->samples)
+    {
+        error = (leader - link_PllPredict(p_pll, local));
+    }
+
+    if (0 == p_pll->samples)
+    {
+        p_pll->offset = (leader - local);
+        p_pll->freq   = 0;
+    }
+    else if ((LINK_STEP_US < error) || (-LINK_STEP_US > error))
+    {
+        /* The clocks rate is not changed by the step, only the phase is locked again */
+        p_pll->offset  = (leader - local);
+        p_pll->samples = 0;
+    }
+    else
+    {
+        p_pll->offset = (link_PllPredict(p_pll, local) - local + (error / LINK_KP_DIV));
+        freq = ((int64_t)p_pll->freq + (error * 1000000000 / dt) / LINK_KI_DIV);
+        freq = MIN(freq, LINK_FREQ_MAX_PPB);
+        freq = MAX(freq, -LINK_FREQ_MAX_PPB);
+        p_pll->freq = (int32_t)freq;
+    }
+    p_pll->ref      = local;
+    p_pll->node     = p_packet->node;
+    p_pll->sequence = p_packet->sequence;
+    p_pll->samples++;
+
+    return FW_TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static EventBits_t link_WaitFor(EventBits_t events, TickType_t timeout)
+{
+    EventBits_t bits = 0;
+
+    /* Waiting until either specified event is set */
+    bits = xEventGroupWaitBits
+           (
+               gLinkEvents,
+               events,       /* Bits To Wait For */
+               pdFALSE,      /* Clear On Exit */
+               pdFALSE,      /* Wait For All Bits */
+               pdMS_TO_TICKS(timeout)
+           );
+
+    return bits;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+#ifdef CONFIG_SCHEDULE_LINK_LEADER
+static void link_Lead(int sock)
+{
+    struct sockaddr_in grpAddr  = {0};
+    link_packet_t      packet   = {0};
+    int                datalen  = 0;
+    int                error    = 0;
+
+    grpAddr.sin_addr.s_addr = inet_addr(GROUP);
+    grpAddr.sin_family = AF_INET;
+    grpAddr.sin_port = htons(PORT);
+
+    packet.node = gIpAddr;
+    while (FW_TRUE)
+    {
+        packet.flags = (true == Time_Sync_IsSynced()) ? LINK_FLAG_SYNCED : 0;
+        packet.sequence++;
+        link_Frame(link_Now(), &packet);
+        datalen = link_Encode(gLinkBuffer, &packet);
+        error   = sendto
+                  (
+                      sock,
+                      gLinkBuffer,
+                      datalen,
+                      0,
+                      (struct sockaddr *)&grpAddr,
+                      sizeof(grpAddr)
+                  );
+        if (error < 0)
+        {
+            LINK_LOGE("Error occured during sending: errno %d", errno);
+            break;
+        }
+
+        if (0 == (EVT_WIFI_CONNECTED & link_WaitFor(EVT_WIFI_CONNECTED, 0)))
+        {
+            LINK_LOGI("WiFi connection is lost...");
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LINK_PERIOD_MS));
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+#ifdef CONFIG_SCHEDULE_LINK_FOLLOWER
+static void link_Follow(int sock)
+{
+    struct sockaddr_in cltAddr  = {0};
+    link_packet_t      packet   = {0};
+    socklen_t          socklen  = 0;
+    int64_t            local    = 0;
+    int                datalen  = 0;
+    bool               locked   = false;
+
+    while (FW_TRUE)
+    {
+        socklen = sizeof(cltAddr);
+        datalen = recvfrom
+                  (
+                      sock,
+                      gLinkBuffer,
+                      sizeof(gLinkBuffer),
+                      0,
+                      (struct sockaddr *)&cltAddr,
+                      &socklen
+                  );
+        /* The receive time is taken as close to the reception as possible */
+        local = link_Now();
+
+        if (FW_TRUE == link_Decode(gLinkBuffer, datalen, &packet))
+        {
+            (void)xSemaphoreTake(gLinkMutex, portMAX_DELAY);
+            (void)link_PllUpdate(&gLinkPll, local, &packet);
+            (void)xSemaphoreGive(gLinkMutex);
+            LINK_LOGV
+            (
+                "Leader %08X : %lu : %+lld us : %+ld ppb",
+                (int)packet.node,
+                packet.sequence,
+                gLinkPll.offset,
+                gLinkPll.freq
+            );
+        }
+
+        if (locked != UDP_Link_IsLocked())
+        {
+            locked = !locked;
+            LINK_LOGI("Leader is %s", (true == locked) ? "locked" : "lost");
+        }
+
+        if (0 == (EVT_WIFI_CONNECTED & link_WaitFor(EVT_WIFI_CONNECTED, 0)))
+        {
+            LINK_LOGI("WiFi connection is lost...");
+            break;
+        }
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+static void vLink_Task(void * pvParameters)
+{
+    struct sockaddr_in svrAddr      = {0};
+    struct ip_mreq     mreq         = {0};
+    char               addr_str[16] = {0};
+    struct timeval     timeouts     = {0};
+    uint8_t            ttl          = 1;
+    int                error        = 0;
+    int                sock         = -1;
+
+    while (FW_TRUE)
+    {
+        LINK_LOGI("Waiting for WiFi connection...");
+        (void)link_WaitFor(EVT_WIFI_CONNECTED, portMAX_DELAY);
+
+        /* Create the socket */
+        svrAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+        svrAddr.sin_family = AF_INET;
+        svrAddr.sin_port = htons(PORT);
+        inet_ntoa_r(gIpAddr, addr_str, sizeof(addr_str) - 1);
+        LINK_LOGI("Creating socket, IP: %s, %08X", addr_str, (int)gIpAddr);
+
+        sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+        if (sock < 0)
+        {
+            LINK_LOGE("Unable to create socket: errno %d", errno);
+            break;
+        }
+        LINK_LOGI("Socket created");
+
+        /* Set timeouts */
+        timeouts.tv_sec = 1;
+        timeouts.tv_usec = 0;
+        error = setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeouts, sizeof(timeouts));
+        if (error < 0)
+        {
+            LINK_LOGE("Unable to set socket timeouts: errno %d", errno);
+            closesocket(sock);
+            break;
+        }
+
+        error = bind(sock, (struct sockaddr *)&svrAddr, sizeof(svrAddr));
+        if (error < 0)
+        {
+            LINK_LOGE("Socket unable to bind: errno %d", errno);
+            closesocket(sock);
+            break;
+        }
+        LINK_LOGI("Socket binded");
+
+        /* The packets stay in the local network. The leader never reads the socket, so it */
+        /* does not join the group and its own packets are not queued to it.               */
+        mreq.imr_multiaddr.s_addr = inet_addr(GROUP);
+        mreq.imr_interface.s_addr = gIpAddr;
+        error  = setsockopt(sock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+        error |= setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &mreq.imr_interface, sizeof(struct in_addr));
+#if defined(CONFIG_SCHEDULE_LINK_FOLLOWER)
+        error |= setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq));
+#endif
+        if (error < 0)
+        {
+            LINK_LOGE("Unable to join the group: errno %d", errno);
+            closesocket(sock);
+            break;
+        }
+
+#if defined(CONFIG_SCHEDULE_LINK_LEADER)
+        link_Lead(sock);
+#elif defined(CONFIG_SCHEDULE_LINK_FOLLOWER)
+        link_Follow(sock);
+#endif
+
+        LINK_LOGE("Shutting down socket and restarting...");
+        closesocket(sock);
+        sock = -1;
+    }
+    vTaskDelete(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_Link_NotifyWiFiIsConnected(uint32_t ip)
+{
+    gIpAddr = ip;
+
+    xEventGroupSetBits(gLinkEvents, EVT_WIFI_CONNECTED);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_Link_NotifyWiFiIsDisconnected(void)
+{
+    xEventGroupClearBits(gLinkEvents, EVT_WIFI_CONNECTED);
+
+    gIpAddr = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the schedule time - the leader timeline on the follower, the local time otherwise */
+void UDP_Link_GetTime(struct timeval * p_tv)
+{
+    int64_t time = link_Now();
+
+    if (NULL != gLinkMutex)
+    {
+        (void)xSemaphoreTake(gLinkMutex, portMAX_DELAY);
+        time = link_PllPredict(&gLinkPll, time);
+        (void)xSemaphoreGive(gLinkMutex);
+    }
+
+    p_tv->tv_sec  = (time_t)(time / 1000000);
+    p_tv->tv_usec = (suseconds_t)(time % 1000000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+bool UDP_Link_IsLocked(void)
+{
+    return link_PllIsLocked(&gLinkPll, link_Now());
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_Link_Task_Init(void)
+{
+    /* Create the events group for UDP task */
+    gLinkEvents = xEventGroupCreate();
+    gLinkMutex  = xSemaphoreCreateMutex();
+
+    (void)xTaskCreatePinnedToCore(vLink_Task, "LINK", 3072, NULL, 6, NULL, CORE0);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t link_Test_Random(uint32_t * p_seed)
+{
+    *p_seed = (*p_seed * 1103515245 + 12345);
+
+    return (*p_seed >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The local clock of the follower at the leader time (us) */
+static int64_t link_Test_Local(int64_t time, int64_t base, int32_t offset, int32_t drift_ppm)
+{
+    return (time + offset + (time - base) * drift_ppm / 1000000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void link_Test_Codec(void)
+{
+    link_packet_t tx                       = {LINK_FLAG_SYNCED, 0xC0A80105, 0xFFFFFFFE, 0, 0};
+    link_packet_t rx                       = {0};
+    uint8_t       packet[LINK_PACKET_SIZE] = {0};
+    bool          result                   = true;
+
+    link_Frame(((int64_t)1735732800 * 1000000 + 123456789), &tx);
+    result &= (LINK_PACKET_SIZE == link_Encode(packet, &tx));
+    result &= (FW_TRUE == link_Decode(packet, sizeof(packet), &rx));
+    result &= ((tx.flags == rx.flags) && (tx.node == rx.node) && (tx.sequence == rx.sequence));
+    result &= ((tx.epoch == rx.epoch) && (tx.frame == rx.frame));
+    result &= (((int64_t)1735732800 * 1000000 + 123456500) == link_LeaderTime(&rx));
+    result &= (86400000 > rx.frame);
+
+    result &= (FW_FALSE == link_Decode(packet, (sizeof(packet) - 1), &rx));
+    result &= (FW_FALSE == link_Decode(packet, -1, &rx));
+    packet[LINK_OFFSET_VERSION] = (LINK_VERSION + 1);
+    result &= (FW_FALSE == link_Decode(packet, sizeof(packet), &rx));
+    packet[LINK_OFFSET_VERSION] = LINK_VERSION;
+    packet[0] = 0;
+    result &= (FW_FALSE == link_Decode(packet, sizeof(packet), &rx));
+
+    LINK_LOGI("Link Packet - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The followers with the different clocks receive the leader packets with the random delay */
+/* and the losses. The phase error is the difference between the follower timeline and the */
+/* leader one at the middle between the packets, when the LED tasks sample the schedule.    */
+static void link_Test_Nodes(void)
+{
+    enum
+    {
+        NODES          = 6,
+        DURATION_S     = 3600,
+        LOCK_TIME_S    = 120,
+        LOSS_PERCENT   = 30,
+        DELAY_MIN_US   = 1000,
+        DELAY_MAX_US   = 4000,
+        /* The leader is switched off for a minute */
+        OUTAGE_START_S = 1800,
+        OUTAGE_END_S   = 1860,
+        /* The leader time is stepped by SNTP */
+        STEP_S         = 2400,
+        STEP_US        = 3000000,
+        MAX_ERROR_US   = 5000,
+    };
+    static const int32_t offsets[NODES] = {-300000, -120000, 0, 4000, 90000, 250000};
+    static const int32_t drifts[NODES]  = {-45, -20, 0, 7, 31, 50};
+    const int64_t base      = ((int64_t)1735732800 * 1000000);
+    link_pll_t    pll       = {0};
+    link_packet_t packet    = {0};
+    uint32_t      seed      = 1;
+    uint32_t      received  = 0;
+    int64_t       leader    = 0;
+    int64_t       step      = 0;
+    int64_t       error     = 0;
+    int64_t       max_error = 0;
+    int           node      = 0;
+    int           s         = 0;
+    bool          result    = true;
+
+    for (node = 0; node < NODES; node++)
+    {
+        memset(&pll, 0, sizeof(pll));
+        max_error = 0;
+        received  = 0;
+        step      = 0;
+        packet.node = 0xC0A80105;
+        packet.sequence = 0;
+
+        for (s = 0; s < DURATION_S; s++)
+        {
+            if (STEP_S == s)
+            {
+                step = STEP_US;
+            }
+            /* The leader sends the packet */
+            leader = (base + (int64_t)s * 1000000);
+            link_Frame((leader + step), &packet);
+            packet.sequence++;
+            if (((OUTAGE_START_S > s) || (OUTAGE_END_S <= s)) &&
+                (LOSS_PERCENT <= (link_Test_Random(&seed) % 100)))
+            {
+                leader += (DELAY_MIN_US + link_Test_Random(&seed) % (DELAY_MAX_US - DELAY_MIN_US));
+                (void)link_PllUpdate(&pll, link_Test_Local(leader, base, offsets[node], drifts[node]), &packet);
+                received++;
+            }
+
+            /* The LED tasks sample the schedule */
+            leader = (base + (int64_t)s * 1000000 + 500000);
+            error  = link_PllPredict(&pll, link_Test_Local(leader, base, offsets[node], drifts[node]));
+            error -= (leader + step);
+            if ((LOCK_TIME_S <= s) && ((STEP_S > s) || ((STEP_S + 10) <= s)))
+            {
+                error     = (0 > error) ? -error : error;
+                max_error = MAX(max_error, error);
+            }
+        }
+
+        result &= (MAX_ERROR_US > max_error);
+        result &= link_PllIsLocked(&pll, pll.ref);
+        LINK_LOGI
+        (
+            "Node %d: %+7ld us, %+3ld ppm : received %4lu : max phase error %5lld us : %+7ld ppb",
+            node,
+            offsets[node],
+            drifts[node],
+            received,
+            max_error,
+            pll.freq
+        );
+    }
+
+    LINK_LOGI("Link Phase Lock - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void link_Test_Leaders(void)
+{
+    link_pll_t    pll    = {0};
+    link_packet_t first  = {0, 0xC0A80105, 100, 1735689600, 43200000};
+    link_packet_t second = {0, 0xC0A80106, 5, 1735689600, 43200000};
+    int64_t       local  = ((int64_t)1735732800 * 1000000);
+    bool          result = true;
+
+    result &= (FW_TRUE == link_PllUpdate(&pll, local, &first));
+    /* The duplicate and the other leader are ignored */
+    result &= (FW_FALSE == link_PllUpdate(&pll, (local + 1000000), &first));
+    result &= (FW_FALSE == link_PllUpdate(&pll, (local + 1000000), &second));
+    /* The other leader is followed when the first one is lost */
+    second.frame += (LINK_TIMEOUT_US / 1000 + 1000);
+    result &= (FW_TRUE == link_PllUpdate(&pll, (local + LINK_TIMEOUT_US + 1000000), &second));
+    result &= (second.node == pll.node);
+    result &= (false == link_PllIsLocked(&pll, pll.ref));
+
+    LINK_LOGI("Link Leaders - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_Link_Test(void)
+{
+    link_Test_Codec();
+    link_Test_Nodes();
+    link_Test_Leaders();
+}
+
+//-------------------------------------------------------------------------------------------------
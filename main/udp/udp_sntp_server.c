@@ -0,0 +1,396 @@
+#include <string.h>
+#include <sys/param.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_system.h"
+#include "esp_log.h"
+
+#include "lwip/err.h"
+#include "lwip/sockets.h"
+#include "lwip/sys.h"
+
+#include "types.h"
+#include "time_sync.h"
+#include "udp_sntp_server.h"
+
+//-------------------------------------------------------------------------------------------------
+
+/* The SNTP server (RFC 4330) for the other enclosures on the local network. The time is */
+/* served only when it is synchronized with the upstream server at least once, otherwise */
+/* the requests are not answered and the clients ask their next server.                   */
+
+#define PORT                     123
+#define EVT_WIFI_CONNECTED       BIT0
+
+/* The seconds between the NTP (1900) and the Unix (1970) epochs */
+#define SNTP_EPOCH_OFFSET        (2208988800UL)
+
+#define SNTP_LOG  1
+
+#if (1 == SNTP_LOG)
+static const char * gTAG = "SNTP";
+#    define SNTP_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SNTP_LOGE(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SNTP_LOGV(...)
+#elif (2 == SNTP_LOG)
+static const char * gTAG = "SNTP";
+#    define SNTP_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SNTP_LOGE(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define SNTP_LOGV(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#else
+#    define SNTP_LOGI(...)
+#    define SNTP_LOGE(...)
+#    define SNTP_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+/* The SNTP packet (big endian):                             */
+/*                                                           */
+/* Offset : Size : Description                               */
+/*      0 :    1 : Leap Indicator (2), Version (3), Mode (3) */
+/*      1 :    1 : Stratum                                   */
+/*      2 :    1 : Poll interval (log2 seconds)              */
+/*      3 :    1 : Precision (log2 seconds)                  */
+/*      4 :    4 : Root delay (16.16 seconds)                */
+/*      8 :    4 : Root dispersion (16.16 seconds)           */
+/*     12 :    4 : Reference identifier                      */
+/*     16 :    8 : Reference timestamp (32.32 seconds)       */
+/*     24 :    8 : Originate timestamp                       */
+/*     32 :    8 : Receive timestamp                         */
+/*     40 :    8 : Transmit timestamp                        */
+
+enum
+{
+    SNTP_PACKET_SIZE      = 48,
+    SNTP_OFFSET_ROOT      = 4,
+    SNTP_OFFSET_REFERENCE = 16,
+    SNTP_OFFSET_ORIGINATE = 24,
+    SNTP_OFFSET_RECEIVE   = 32,
+    SNTP_OFFSET_TRANSMIT  = 40,
+    SNTP_MODE_CLIENT      = 3,
+    SNTP_MODE_SERVER      = 4,
+    SNTP_VERSION_MIN      = 1,
+    SNTP_VERSION_MAX      = 4,
+    /* The upstream server stratum is not known, the public ones are usually 1 */
+    SNTP_STRATUM          = 2,
+    /* The system time resolution is 1 us ~ 2^-20 s */
+    SNTP_PRECISION        = -20,
+    /* The dispersion of the disciplined clock ~ 1 ms (16.16 seconds) */
+    SNTP_ROOT_DISPERSION  = 66,
+};
+
+//-------------------------------------------------------------------------------------------------
+
+static EventGroupHandle_t gSntpEvents                       = NULL;
+static uint32_t           gIpAddr                           = 0;
+static uint8_t            gSntpBuffer[SNTP_PACKET_SIZE * 2] = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static void sntp_PutU32(uint8_t * p_data, uint32_t value)
+{
+    p_data[0] = (uint8_t)(value >> 24);
+    p_data[1] = (uint8_t)(value >> 16);
+    p_data[2] = (uint8_t)(value >> 8);
+    p_data[3] = (uint8_t)(value);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t sntp_GetU32(const uint8_t * p_data)
+{
+    return (((uint32_t)p_data[0] << 24) | ((uint32_t)p_data[1] << 16) |
+            ((uint32_t)p_data[2] << 8) | (uint32_t)p_data[3]);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void sntp_PutTimestamp(uint8_t * p_data, const struct timeval * p_tv)
+{
+    /* The seconds are wrapped in 2036 (NTP era 1) as all the SNTP clients expect */
+    sntp_PutU32(&p_data[0], (uint32_t)((uint32_t)p_tv->tv_sec + SNTP_EPOCH_OFFSET));
+    sntp_PutU32(&p_data[4], (uint32_t)(((uint64_t)p_tv->tv_usec << 32) / 1000000));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_BOOLEAN sntp_IsRequest(const uint8_t * p_buf, int size)
+{
+    uint8_t version = 0;
+    uint8_t mode    = 0;
+
+    /* The extension fields and the authenticator are ignored */
+    if (SNTP_PACKET_SIZE > size)
+    {
+        return FW_FALSE;
+    }
+
+    version = ((p_buf[0] >> 3) & 0x07);
+    mode    = (p_buf[0] & 0x07);
+
+    return ((SNTP_MODE_CLIENT == mode) &&
+            (SNTP_VERSION_MIN <= version) &&
+            (SNTP_VERSION_MAX >= version)) ? FW_TRUE : FW_FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Converts the request in the buffer to the response, returns the response size */
+static int sntp_PrepareResponse
+(
+    uint8_t * p_buf,
+    const struct timeval * p_rx,
+    const struct timeval * p_tx,
+    time_t reference
+)
+{
+    struct timeval ref_tv = {reference, 0};
+
+    /* No leap second warning, the same version as in the request */
+    p_buf[0] = ((p_buf[0] & 0x38) | SNTP_MODE_SERVER);
+    p_buf[1] = SNTP_STRATUM;
+    /* The poll interval is copied from the request */
+    p_buf[3] = (uint8_t)SNTP_PRECISION;
+    sntp_PutU32(&p_buf[SNTP_OFFSET_ROOT], 0);
+    sntp_PutU32(&p_buf[SNTP_OFFSET_ROOT + 4], SNTP_ROOT_DISPERSION);
+    sntp_PutU32(&p_buf[SNTP_OFFSET_ROOT + 8], 0);
+
+    /* The client matches the response by its transmit timestamp */
+    memmove(&p_buf[SNTP_OFFSET_ORIGINATE], &p_buf[SNTP_OFFSET_TRANSMIT], 8);
+    sntp_PutTimestamp(&p_buf[SNTP_OFFSET_REFERENCE], &ref_tv);
+    sntp_PutTimestamp(&p_buf[SNTP_OFFSET_RECEIVE], p_rx);
+    sntp_PutTimestamp(&p_buf[SNTP_OFFSET_TRANSMIT], p_tx);
+
+    return SNTP_PACKET_SIZE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static EventBits_t sntp_WaitFor(EventBits_t events, TickType_t timeout)
+{
+    EventBits_t bits = 0;
+
+    /* Waiting until either specified event is set */
+    bits = xEventGroupWaitBits
+           (
+               gSntpEvents,
+               events,       /* Bits To Wait For */
+               pdFALSE,      /* Clear On Exit */
+               pdFALSE,      /* Wait For All Bits */
+               pdMS_TO_TICKS(timeout)
+           );
+
+    return bits;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void vSNTP_Task(void * pvParameters)
+{
+    struct sockaddr_in svrAddr      = {0};
+    struct sockaddr_in cltAddr      = {0};
+    char               addr_str[16] = {0};
+    struct timeval     timeouts     = {0};
+    struct timeval     rx_time      = {0};
+    struct timeval     tx_time      = {0};
+    socklen_t          socklen      = 0;
+    int                datalen      = 0;
+    int                error        = 0;
+    int                sock         = -1;
+
+    while (FW_TRUE)
+    {
+        SNTP_LOGI("Waiting for WiFi connection...");
+        (void)sntp_WaitFor(EVT_WIFI_CONNECTED, portMAX_DELAY);
+
+        /* Create the socket */
+        svrAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+        svrAddr.sin_family = AF_INET;
+        svrAddr.sin_port = htons(PORT);
+        inet_ntoa_r(gIpAddr, addr_str, sizeof(addr_str) - 1);
+        SNTP_LOGI("Creating socket, IP: %s, %08X", addr_str, (int)gIpAddr);
+
+        sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+        if (sock < 0)
+        {
+            SNTP_LOGE("Unable to create socket: errno %d", errno);
+            break;
+        }
+        SNTP_LOGI("Socket created");
+
+        /* Set timeouts */
+        timeouts.tv_sec = 1;
+        timeouts.tv_usec = 0;
+        error = setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeouts, sizeof(timeouts));
+        if (error < 0)
+        {
+            SNTP_LOGE("Unable to set socket timeouts: errno %d", errno);
+            closesocket(sock);
+            break;
+        }
+
+        error = bind(sock, (struct sockaddr *)&svrAddr, sizeof(svrAddr));
+        if (error < 0)
+        {
+            SNTP_LOGE("Socket unable to bind: errno %d", errno);
+            closesocket(sock);
+            break;
+        }
+        SNTP_LOGI("Socket binded");
+
+        while (FW_TRUE)
+        {
+            socklen = sizeof(cltAddr);
+            datalen = recvfrom
+                      (
+                          sock,
+                          gSntpBuffer,
+                          sizeof(gSntpBuffer),
+                          0,
+                          (struct sockaddr *)&cltAddr,
+                          &socklen
+                      );
+            /* The receive timestamp is taken as close to the reception as possible */
+            gettimeofday(&rx_time, NULL);
+
+            if ((FW_TRUE == sntp_IsRequest(gSntpBuffer, datalen)) && (true == Time_Sync_IsSynced()))
+            {
+                gettimeofday(&tx_time, NULL);
+                datalen = sntp_PrepareResponse(gSntpBuffer, &rx_time, &tx_time, Time_Sync_GetLastSync());
+                error   = sendto
+                          (
+                              sock,
+                              gSntpBuffer,
+                              datalen,
+                              0,
+                              (struct sockaddr *)&cltAddr,
+                              sizeof(cltAddr)
+                          );
+                if (error < 0)
+                {
+                    SNTP_LOGE("Error occured during sending: errno %d", errno);
+                    break;
+                }
+                inet_ntoa_r(cltAddr.sin_addr.s_addr, addr_str, sizeof(addr_str) - 1);
+                SNTP_LOGV("Served %s", addr_str);
+            }
+
+            if (0 == (EVT_WIFI_CONNECTED & sntp_WaitFor(EVT_WIFI_CONNECTED, 0)))
+            {
+                SNTP_LOGI("WiFi connection is lost...");
+                break;
+            }
+        }
+
+        SNTP_LOGE("Shutting down socket and restarting...");
+        closesocket(sock);
+        sock = -1;
+    }
+    vTaskDelete(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_SNTP_NotifyWiFiIsConnected(uint32_t ip)
+{
+    gIpAddr = ip;
+
+    xEventGroupSetBits(gSntpEvents, EVT_WIFI_CONNECTED);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_SNTP_NotifyWiFiIsDisconnected(void)
+{
+    xEventGroupClearBits(gSntpEvents, EVT_WIFI_CONNECTED);
+
+    gIpAddr = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_SNTP_Task_Init(void)
+{
+    /* Create the events group for UDP task */
+    gSntpEvents = xEventGroupCreate();
+
+    (void)xTaskCreatePinnedToCore(vSNTP_Task, "SNTP", 3072, NULL, 6, NULL, CORE0);
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static bool sntp_Test_Timestamp(const uint8_t * p_data, const struct timeval * p_tv)
+{
+    uint32_t seconds  = sntp_GetU32(&p_data[0]);
+    uint32_t fraction = sntp_GetU32(&p_data[4]);
+    uint32_t usec     = (uint32_t)(((uint64_t)fraction * 1000000 + 0x80000000) >> 32);
+
+    /* The client converts the fraction back with 1 us resolution */
+    return ((((uint32_t)p_tv->tv_sec + SNTP_EPOCH_OFFSET) == seconds) && (p_tv->tv_usec == usec));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void UDP_SNTP_Test(void)
+{
+    static const uint8_t transmit[8] = {0xE8, 0xFE, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC};
+    uint8_t        packet[SNTP_PACKET_SIZE] = {0};
+    struct timeval rx                       = {1700000000, 500000};
+    struct timeval tx                       = {1700000000, 999999};
+    struct timeval ref                      = {1699996400, 0};
+    bool           result                   = true;
+    uint32_t       usec                     = 0;
+
+    /* The SNTPv4 client request */
+    packet[0] = ((4 << 3) | SNTP_MODE_CLIENT);
+    packet[2] = 6;
+    memcpy(&packet[SNTP_OFFSET_TRANSMIT], transmit, sizeof(transmit));
+
+    result &= (FW_TRUE == sntp_IsRequest(packet, sizeof(packet)));
+    result &= (SNTP_PACKET_SIZE == sntp_PrepareResponse(packet, &rx, &tx, ref.tv_sec));
+    result &= (((4 << 3) | SNTP_MODE_SERVER) == packet[0]);
+    result &= (SNTP_STRATUM == packet[1]);
+    result &= (6 == packet[2]);
+    result &= (0 == memcmp(&packet[SNTP_OFFSET_ORIGINATE], transmit, sizeof(transmit)));
+    result &= sntp_Test_Timestamp(&packet[SNTP_OFFSET_REFERENCE], &ref);
+    result &= sntp_Test_Timestamp(&packet[SNTP_OFFSET_RECEIVE], &rx);
+    result &= sntp_Test_Timestamp(&packet[SNTP_OFFSET_TRANSMIT], &tx);
+    /* 0.5 s is exactly the half of the fraction */
+    result &= (0x80000000 == sntp_GetU32(&packet[SNTP_OFFSET_RECEIVE + 4]));
+    SNTP_LOGI("SNTP Response - %s", (true == result) ? "PASS" : "FAIL");
+
+    /* The fraction keeps the microseconds */
+    result = true;
+    for (usec = 0; usec < 1000000; usec += 997)
+    {
+        rx.tv_usec = usec;
+        sntp_PutTimestamp(packet, &rx);
+        result &= sntp_Test_Timestamp(packet, &rx);
+    }
+    SNTP_LOGI("SNTP Timestamp - %s", (true == result) ? "PASS" : "FAIL");
+
+    /* The response, the short packet and the unknown version are not answered */
+    result = true;
+    memset(packet, 0, sizeof(packet));
+    packet[0] = ((4 << 3) | SNTP_MODE_SERVER);
+    result &= (FW_FALSE == sntp_IsRequest(packet, sizeof(packet)));
+    packet[0] = ((4 << 3) | SNTP_MODE_CLIENT);
+    result &= (FW_FALSE == sntp_IsRequest(packet, (sizeof(packet) - 1)));
+    result &= (FW_FALSE == sntp_IsRequest(packet, -1));
+    packet[0] = ((5 << 3) | SNTP_MODE_CLIENT);
+    result &= (FW_FALSE == sntp_IsRequest(packet, sizeof(packet)));
+    packet[0] = ((1 << 3) | SNTP_MODE_CLIENT);
+    result &= (FW_TRUE == sntp_IsRequest(packet, sizeof(packet)));
+    SNTP_LOGI("SNTP Request Filter - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,373 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "bench.h"
+
+#ifdef ESP_PLATFORM
+#    include "freertos/FreeRTOS.h"
+#    include "freertos/task.h"
+#    include "esp_attr.h"
+#    include "esp_timer.h"
+#    include "esp_heap_caps.h"
+#else
+#    include <time.h>
+#    define IRAM_ATTR
+#endif
+#include "sdkconfig.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define BENCH_LOG  0
+
+#if (1 == BENCH_LOG)
+static const char * gTAG = "BENCH";
+#    define BENCH_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define BENCH_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define BENCH_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define BENCH_LOGI(...)
+#    define BENCH_LOGE(...)
+#    define BENCH_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    /* The run of the slow operation is not doubled over */
+    BENCH_COUNT_MAX = 0x1000000,
+};
+
+typedef struct
+{
+    /* The task which allocations are counted, NULL - none */
+    void   * p_task;
+    uint32_t allocs;
+    uint32_t bytes;
+} bench_heap_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static volatile bench_heap_t gBenchHeap = {0};
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The task which runs the benchmark, the host runs them on the single thread */
+static inline void * bench_GetTask(void)
+{
+#ifdef ESP_PLATFORM
+    return (void *)xTaskGetCurrentTaskHandle();
+#else
+    return (void *)&gBenchHeap;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
+#ifdef CONFIG_BENCH_ENABLE
+
+/* The heap hooks (CONFIG_BENCH_ENABLE selects CONFIG_HEAP_USE_HOOKS) are called on every allocation, */
+/* the host calls them from the wrappers of malloc() ("test/bench/bench_heap.c")                      */
+IRAM_ATTR void esp_heap_trace_alloc_hook(void * ptr, size_t size, uint32_t caps)
+{
+    (void)ptr;
+    (void)caps;
+    if ((NULL != gBenchHeap.p_task) && (gBenchHeap.p_task == bench_GetTask()))
+    {
+        gBenchHeap.allocs++;
+        gBenchHeap.bytes += size;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+IRAM_ATTR void esp_heap_trace_free_hook(void * ptr)
+{
+    (void)ptr;
+}
+
+#endif /* CONFIG_BENCH_ENABLE */
+
+//-------------------------------------------------------------------------------------------------
+
+static bool bench_IsCounting(void)
+{
+#ifdef CONFIG_BENCH_ENABLE
+    return true;
+#else
+    return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void bench_CountStart(void)
+{
+    gBenchHeap.p_task = bench_GetTask();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void bench_CountStop(void)
+{
+    gBenchHeap.p_task = NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint64_t bench_GetMicros(void)
+{
+#ifdef ESP_PLATFORM
+    return (uint64_t)esp_timer_get_time();
+#else
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000);
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Lets the lower priority tasks and the idle task run between the runs */
+static void bench_Yield(void)
+{
+#ifdef ESP_PLATFORM
+    vTaskDelay(1);
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint64_t bench_Time(bench_fn_t fp_op, void * p_ctx, uint32_t count)
+{
+    uint64_t start = bench_GetMicros();
+
+    fp_op(p_ctx, count);
+
+    return (bench_GetMicros() - start);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The insertion sort of the few runs */
+static void bench_Sort(uint64_t * p_values, uint8_t count)
+{
+    uint64_t value = 0;
+    uint8_t  idx   = 0;
+    uint8_t  pos   = 0;
+
+    for (idx = 1; idx < count; idx++)
+    {
+        value = p_values[idx];
+        for (pos = idx; (0 < pos) && (p_values[pos - 1] > value); pos--)
+        {
+            p_values[pos] = p_values[pos - 1];
+        }
+        p_values[pos] = value;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The runs (us) to 0.001 ns per operation */
+static void bench_Summarize(uint64_t * p_runs, uint32_t count, uint32_t allocs, uint32_t bytes, bench_result_p p_result)
+{
+    uint8_t idx = 0;
+
+    for (idx = 0; idx < BENCH_RUNS; idx++)
+    {
+        p_runs[idx] = (p_runs[idx] * 1000000ULL / count);
+    }
+    bench_Sort(p_runs, BENCH_RUNS);
+
+    p_result->count  = count;
+    p_result->min    = p_runs[0];
+    p_result->median = p_runs[BENCH_RUNS / 2];
+    p_result->max    = p_runs[BENCH_RUNS - 1];
+    p_result->allocs = -1;
+    p_result->bytes  = -1;
+    if (true == bench_IsCounting())
+    {
+        p_result->allocs = ((int64_t)allocs * 1000 / ((int64_t)count * BENCH_RUNS));
+        p_result->bytes  = ((int64_t)bytes * 1000 / ((int64_t)count * BENCH_RUNS));
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static bool bench_Append(char * p_buf, size_t size, size_t * p_len, const char * p_format, ...)
+{
+    va_list args;
+    int     res = 0;
+
+    va_start(args, p_format);
+    res = vsnprintf(&p_buf[*p_len], (size - *p_len), p_format, args);
+    va_end(args);
+    if ((0 > res) || ((size - *p_len) <= (size_t)res))
+    {
+        return false;
+    }
+    *p_len += (size_t)res;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The fixed point number of 0.001 units, the negative value is unknown */
+static bool bench_AppendMilli(char * p_buf, size_t size, size_t * p_len, const char * p_key, int64_t value)
+{
+    if (0 > value)
+    {
+        return bench_Append(p_buf, size, p_len, ",\"%s\":null", p_key);
+    }
+    return bench_Append
+    (
+        p_buf,
+        size,
+        p_len,
+        ",\"%s\":%llu.%03u",
+        p_key,
+        (unsigned long long)(value / 1000),
+        (unsigned int)(value % 1000)
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void Bench_Run(const char * p_suite, const char * p_name, bench_fn_t fp_op, void * p_ctx, bench_result_p p_result)
+{
+    static char    line[BENCH_LINE_MAX];
+    bench_result_t result           = {0};
+    uint64_t       runs[BENCH_RUNS] = {0};
+    uint32_t       count            = 1;
+    uint8_t        idx              = 0;
+
+    /* The warm up (caches, lazy initialization) and the count of the run */
+    while ((BENCH_RUN_US > bench_Time(fp_op, p_ctx, count)) && (BENCH_COUNT_MAX > count))
+    {
+        count *= 2;
+    }
+    bench_Yield();
+
+    gBenchHeap.allocs = 0;
+    gBenchHeap.bytes  = 0;
+    for (idx = 0; idx < BENCH_RUNS; idx++)
+    {
+        bench_CountStart();
+        runs[idx] = bench_Time(fp_op, p_ctx, count);
+        bench_CountStop();
+        bench_Yield();
+    }
+    bench_Summarize(runs, count, gBenchHeap.allocs, gBenchHeap.bytes, &result);
+
+    /* This call is not thread safe but this is acceptable: the benchmarks are run one by one */
+    if (0 < Bench_Format(p_suite, p_name, &result, line, sizeof(line)))
+    {
+#ifdef ESP_PLATFORM
+        BENCH_LOGI("%s", line);
+#else
+        /* The host prints the JSON lines alone, the logs go to stderr */
+        printf("%s\n", line);
+#endif
+    }
+    else
+    {
+        BENCH_LOGE("The name is too long: %s", p_name);
+    }
+
+    if (NULL != p_result)
+    {
+        *p_result = result;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Bench_Format(const char * p_suite, const char * p_name, const bench_result_t * p_result, char * p_buf, size_t size)
+{
+    size_t len    = 0;
+    bool   result = false;
+
+    result = bench_Append
+    (
+        p_buf,
+        size,
+        &len,
+        "{\"suite\":\"%s\",\"name\":\"%s\",\"ops\":%lu,\"runs\":%u",
+        p_suite,
+        p_name,
+        (unsigned long)p_result->count,
+        (unsigned int)BENCH_RUNS
+    );
+    result = result && bench_AppendMilli(p_buf, size, &len, "ns_per_op", (int64_t)p_result->median);
+    result = result && bench_AppendMilli(p_buf, size, &len, "ns_min", (int64_t)p_result->min);
+    result = result && bench_AppendMilli(p_buf, size, &len, "ns_max", (int64_t)p_result->max);
+    result = result && bench_AppendMilli(p_buf, size, &len, "allocs_per_op", p_result->allocs);
+    result = result && bench_AppendMilli(p_buf, size, &len, "bytes_per_op", p_result->bytes);
+    result = result && bench_Append(p_buf, size, &len, "}");
+
+    return (true == result) ? len : 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static void bench_TestSpin(void * p_ctx, uint32_t count)
+{
+    volatile uint32_t * p_sum = (volatile uint32_t *)p_ctx;
+    uint32_t            idx   = 0;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        *p_sum += idx;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Bench_Test(void)
+{
+    char              line[BENCH_LINE_MAX] = {0};
+    bench_result_t    result               = {0};
+    uint64_t          runs[BENCH_RUNS]     = {4000, 1000, 2000, 100000, 3000};
+    volatile uint32_t sum                  = 0;
+    size_t            len                  = 0;
+    bool              pass                 = true;
+
+    /* The median is not moved by the preempted run */
+    bench_Summarize(runs, 1000, 10, 2048, &result);
+    pass &= ((3000000 == result.median) && (1000000 == result.min) && (100000000 == result.max));
+    pass &= (true == bench_IsCounting()) ? ((2 == result.allocs) && (409 == result.bytes)) :
+                                           ((-1 == result.allocs) && (-1 == result.bytes));
+
+    result.allocs = 1500;
+    result.bytes  = -1;
+    len   = Bench_Format("dns", "dns_ParseRequest", &result, line, sizeof(line));
+    pass &= (len == strlen(line));
+    pass &= (0 == strcmp(line, "{\"suite\":\"dns\",\"name\":\"dns_ParseRequest\",\"ops\":1000,\"runs\":5,"
+                               "\"ns_per_op\":3000.000,\"ns_min\":1000.000,\"ns_max\":100000.000,"
+                               "\"allocs_per_op\":1.500,\"bytes_per_op\":null}"));
+    pass &= (0 == Bench_Format("dns", "dns_ParseRequest", &result, line, len));
+    pass &= (len == Bench_Format("dns", "dns_ParseRequest", &result, line, (len + 1)));
+
+    /* The run takes the minimal time at least */
+    Bench_Run("bench", "spin", bench_TestSpin, (void *)&sum, &result);
+    pass &= ((1 < result.count) && (result.min <= result.median) && (result.median <= result.max));
+    pass &= ((BENCH_RUN_US * 1000000ULL / result.count) <= result.max);
+    pass &= (0 >= result.allocs);
+
+    BENCH_LOGI("Bench - %s", (true == pass) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
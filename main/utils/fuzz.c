@@ -0,0 +1,330 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "fuzz.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define FUZZ_LOG  0
+
+#if (1 == FUZZ_LOG)
+static const char * gTAG = "FUZZ";
+#    define FUZZ_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define FUZZ_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define FUZZ_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#    define FUZZ_LOG_HEX(buf, len)  ESP_LOG_BUFFER_HEX(gTAG, buf, len)
+#else
+#    define FUZZ_LOGI(...)
+#    define FUZZ_LOGE(...)
+#    define FUZZ_LOGV(...)
+#    define FUZZ_LOG_HEX(buf, len)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    FUZZ_SEED       = 0x2545F491,
+    /* The mutations of one input */
+    FUZZ_STACK_MAX  = 4,
+    FUZZ_INSERT_MAX = 8,
+    FUZZ_GUARD_BYTE = 0xA5,
+};
+
+typedef enum
+{
+    FUZZ_FLIP_BIT = 0,
+    FUZZ_SET_BYTE,
+    FUZZ_SET_SPECIAL,
+    FUZZ_ERASE,
+    FUZZ_INSERT,
+    FUZZ_TRUNCATE,
+    FUZZ_SPLICE,
+    FUZZ_MUTATIONS,
+} fuzz_mutation_t;
+
+typedef struct
+{
+    uint32_t seed;
+    uint16_t size;
+    /* The mutated input, the target gets its copy */
+    uint8_t  data[FUZZ_DATA_MAX];
+#ifdef ESP_PLATFORM
+    uint8_t  input[FUZZ_DATA_MAX + FUZZ_GUARD];
+#endif
+} fuzz_t, * fuzz_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static fuzz_t gFuzz = {0};
+
+/* The lengths, the separators and the bounds of the parsers */
+static const uint8_t gcFuzzSpecial[] =
+{
+    0x00, 0x01, 0x0A, 0x0D, 0x20, 0x2E, 0x3F, 0x40, 0x7D, 0x7E, 0x7F, 0x80, 0xC0, 0xFE, 0xFF
+};
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t fuzz_Random(uint32_t * p_seed)
+{
+    *p_seed = (*p_seed * 1664525 + 1013904223);
+    return (*p_seed >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint8_t fuzz_RandomByte(uint32_t * p_seed)
+{
+    uint32_t value = fuzz_Random(p_seed);
+
+    /* The special byte every second time, the random values rarely hit the bounds */
+    if (0 == (value & 0x100))
+    {
+        return gcFuzzSpecial[(value >> 9) % sizeof(gcFuzzSpecial)];
+    }
+    return (uint8_t)value;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void fuzz_Mutate(fuzz_p p_fuzz, const fuzz_seed_t * p_seeds, uint8_t count)
+{
+    const fuzz_seed_t * p_other = NULL;
+    uint8_t *           p_data  = p_fuzz->data;
+    uint16_t            size    = p_fuzz->size;
+    uint16_t            pos     = 0;
+    uint16_t            len     = 0;
+    uint16_t            idx     = 0;
+
+    switch (fuzz_Random(&p_fuzz->seed) % FUZZ_MUTATIONS)
+    {
+        case FUZZ_FLIP_BIT:
+            if (0 < size)
+            {
+                pos = (fuzz_Random(&p_fuzz->seed) % size);
+                p_data[pos] ^= (1 << (fuzz_Random(&p_fuzz->seed) % 8));
+            }
+            break;
+
+        case FUZZ_SET_BYTE:
+            if (0 < size)
+            {
+                pos = (fuzz_Random(&p_fuzz->seed) % size);
+                p_data[pos] = (uint8_t)fuzz_Random(&p_fuzz->seed);
+            }
+            break;
+
+        case FUZZ_SET_SPECIAL:
+            if (0 < size)
+            {
+                pos = (fuzz_Random(&p_fuzz->seed) % size);
+                p_data[pos] = gcFuzzSpecial[fuzz_Random(&p_fuzz->seed) % sizeof(gcFuzzSpecial)];
+            }
+            break;
+
+        case FUZZ_ERASE:
+            if (0 < size)
+            {
+                pos = (fuzz_Random(&p_fuzz->seed) % size);
+                len = (1 + fuzz_Random(&p_fuzz->seed) % MIN((size - pos), FUZZ_INSERT_MAX));
+                memmove(&p_data[pos], &p_data[pos + len], (size - pos - len));
+                size -= len;
+            }
+            break;
+
+        case FUZZ_INSERT:
+            if (FUZZ_DATA_MAX > size)
+            {
+                pos = (fuzz_Random(&p_fuzz->seed) % (size + 1));
+                len = (1 + fuzz_Random(&p_fuzz->seed) % MIN((FUZZ_DATA_MAX - size), FUZZ_INSERT_MAX));
+                memmove(&p_data[pos + len], &p_data[pos], (size - pos));
+                for (idx = pos; idx < (pos + len); idx++)
+                {
+                    p_data[idx] = fuzz_RandomByte(&p_fuzz->seed);
+                }
+                size += len;
+            }
+            break;
+
+        case FUZZ_TRUNCATE:
+            if (0 < size)
+            {
+                size = (fuzz_Random(&p_fuzz->seed) % size);
+            }
+            break;
+
+        case FUZZ_SPLICE:
+            /* The head of the input and the tail of the other seed */
+            p_other = &p_seeds[fuzz_Random(&p_fuzz->seed) % count];
+            pos     = (fuzz_Random(&p_fuzz->seed) % (size + 1));
+            idx     = (fuzz_Random(&p_fuzz->seed) % (p_other->size + 1));
+            len     = MIN((p_other->size - idx), (FUZZ_DATA_MAX - pos));
+            memcpy(&p_data[pos], &p_other->p_data[idx], len);
+            size = (pos + len);
+            break;
+
+        default:
+            break;
+    }
+
+    p_fuzz->size = size;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The target gets the copy of the input, it may change the input in place */
+static bool fuzz_Call(fuzz_p p_fuzz, fuzz_fn_t fp_target, void * p_ctx)
+{
+    uint8_t * p_input = NULL;
+    bool      result  = false;
+    uint16_t  idx     = 0;
+
+#ifdef ESP_PLATFORM
+    p_input = p_fuzz->input;
+    memcpy(p_input, p_fuzz->data, p_fuzz->size);
+    memset(&p_input[p_fuzz->size], FUZZ_GUARD_BYTE, (sizeof(p_fuzz->input) - p_fuzz->size));
+
+    result = fp_target(p_ctx, p_input, p_fuzz->size);
+
+    for (idx = p_fuzz->size; idx < sizeof(p_fuzz->input); idx++)
+    {
+        if (FUZZ_GUARD_BYTE != p_input[idx])
+        {
+            FUZZ_LOGE("The write after the input: %u", idx);
+            result = false;
+            break;
+        }
+    }
+#else
+    /* The sanitizers catch any access after the input */
+    (void)idx;
+    p_input = malloc(MAX(p_fuzz->size, 1));
+    if (NULL != p_input)
+    {
+        memcpy(p_input, p_fuzz->data, p_fuzz->size);
+        result = fp_target(p_ctx, p_input, p_fuzz->size);
+        free(p_input);
+    }
+#endif
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+uint32_t Fuzz_Run(const char * p_name, const fuzz_seed_t * p_seeds, uint8_t count, fuzz_fn_t fp_target, void * p_ctx, uint32_t runs)
+{
+    const fuzz_seed_t * p_seed   = NULL;
+    uint32_t            failures = 0;
+    uint32_t            run      = 0;
+    uint8_t             stack    = 0;
+
+    (void)p_name;
+    gFuzz.seed = FUZZ_SEED;
+    for (run = 0; run < runs; run++)
+    {
+        /* The seeds are run as they are first */
+        p_seed = (run < count) ? &p_seeds[run] : &p_seeds[fuzz_Random(&gFuzz.seed) % count];
+        gFuzz.size = MIN(p_seed->size, FUZZ_DATA_MAX);
+        memcpy(gFuzz.data, p_seed->p_data, gFuzz.size);
+        if (count <= run)
+        {
+            for (stack = (1 + fuzz_Random(&gFuzz.seed) % FUZZ_STACK_MAX); 0 < stack; stack--)
+            {
+                fuzz_Mutate(&gFuzz, p_seeds, count);
+            }
+        }
+
+        if (false == fuzz_Call(&gFuzz, fp_target, p_ctx))
+        {
+            FUZZ_LOGE("%s: run %lu is failed, size %u", p_name, (unsigned long)run, gFuzz.size);
+            FUZZ_LOG_HEX(gFuzz.data, gFuzz.size);
+            failures++;
+        }
+    }
+    FUZZ_LOGI("%s: %lu runs, %lu failed", p_name, (unsigned long)runs, (unsigned long)failures);
+
+    return failures;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint16_t min;
+    uint16_t max;
+    uint32_t changed;
+} fuzz_test_t;
+
+static const uint8_t gcFuzzTestSeed[] = "GET /index.html HTTP/1.1\r\n\r\n";
+
+//-------------------------------------------------------------------------------------------------
+
+static bool fuzz_TestSizes(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    fuzz_test_t * p_test = (fuzz_test_t *)p_ctx;
+
+    p_test->min      = MIN(p_test->min, size);
+    p_test->max      = MAX(p_test->max, size);
+    p_test->changed += (((sizeof(gcFuzzTestSeed) - 1) != size) || (0 != memcmp(p_data, gcFuzzTestSeed, size))) ? 1 : 0;
+
+    return (FUZZ_DATA_MAX >= size);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The parser which does not accept the compression pointer */
+static bool fuzz_TestPointer(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    (void)p_ctx;
+    return (NULL == memchr(p_data, 0xC0, size));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+#ifdef ESP_PLATFORM
+static bool fuzz_TestOverrun(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    (void)p_ctx;
+    p_data[size] = '\0';
+    return true;
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+void Fuzz_Test(void)
+{
+    const fuzz_seed_t seeds[] = {{gcFuzzTestSeed, (sizeof(gcFuzzTestSeed) - 1)}};
+    fuzz_test_t       test    = {UINT16_MAX, 0, 0};
+    uint32_t          failed  = 0;
+    bool              pass    = true;
+
+    /* The inputs are changed, shrunk and grown within the limit */
+    pass &= (0 == Fuzz_Run("sizes", seeds, 1, fuzz_TestSizes, &test, 4000));
+    pass &= ((0 == test.min) && ((sizeof(gcFuzzTestSeed) - 1) < test.max) && (FUZZ_DATA_MAX >= test.max));
+    pass &= ((3000 < test.changed) && (4000 > test.changed));
+
+    /* The broken invariant is caught and the runs are the same every time */
+    failed = Fuzz_Run("pointer", seeds, 1, fuzz_TestPointer, NULL, 4000);
+    pass  &= ((0 < failed) && (4000 > failed));
+    pass  &= (failed == Fuzz_Run("pointer", seeds, 1, fuzz_TestPointer, NULL, 4000));
+
+#ifdef ESP_PLATFORM
+    pass &= (100 == Fuzz_Run("overrun", seeds, 1, fuzz_TestOverrun, NULL, 100));
+#endif
+
+    FUZZ_LOGI("Fuzz - %s", (true == pass) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -10,7 +10,8 @@
 //-------------------------------------------------------------------------------------------------
 
 #define I2C_PORT_NUMBER  (-1)
-#define I2C_TIMEOUT      (-1)
+/* 26 bytes at 100 kHz take ~3 ms, at 400 kHz ~0.7 ms */
+#define I2C_TIMEOUT_MS   (10)
 
 #define I2C_DEBUG  0
 
@@ -62,23 +63,50 @@ i2c_device_p I2C_AddDevice(i2c_device_config_t * p_config)
 
 //-------------------------------------------------------------------------------------------------
 
-void I2C_Tx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz)
+static FW_RESULT i2c_Result(esp_err_t status)
 {
-    I2C_ERROR_CHECK(i2c_master_transmit(p_dvc, p_tx, tx_sz, I2C_TIMEOUT));
+    FW_RESULT result = FW_SUCCESS;
+
+    if (ESP_ERR_TIMEOUT == status)
+    {
+        result = FW_TIMEOUT;
+    }
+    else if (ESP_OK != status)
+    {
+        result = FW_ERROR;
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT I2C_Tx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz)
+{
+    return i2c_Result(i2c_master_transmit(p_dvc, p_tx, tx_sz, I2C_TIMEOUT_MS));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT I2C_Rx(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz)
+{
+    return i2c_Result(i2c_master_receive(p_dvc, p_rx, rx_sz, I2C_TIMEOUT_MS));
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void I2C_Rx(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz)
+FW_RESULT I2C_TxRx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz)
 {
-    I2C_ERROR_CHECK(i2c_master_receive(p_dvc, p_rx, rx_sz, I2C_TIMEOUT));
+    return i2c_Result(i2c_master_transmit_receive(p_dvc, p_tx, tx_sz, p_rx, rx_sz, I2C_TIMEOUT_MS));
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void I2C_TxRx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz)
+/* Releases the bus held by the slave in the middle of the byte: the clock pulses make the   */
+/* slave to shift the byte out, then the STOP condition is generated                        */
+void I2C_Recover(void)
 {
-    I2C_ERROR_CHECK(i2c_master_transmit_receive(p_dvc, p_tx, tx_sz, p_rx, rx_sz, I2C_TIMEOUT));
+    (void)i2c_master_bus_reset(gI2CBusHandle);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -110,7 +138,7 @@ void I2C_Test(void)
     uint8_t rx[RX_SIZE]           = {0};
     uint8_t tx[TX_SIZE + RX_SIZE] = {0};
 
-    I2C_TxRx(p_dvc, offs, sizeof(offs), rx, sizeof(rx));
+    (void)I2C_TxRx(p_dvc, offs, sizeof(offs), rx, sizeof(rx));
     ESP_LOGI
     (
         iTag,
@@ -127,11 +155,11 @@ void I2C_Test(void)
     tx[6] = 0x11; /* Month */
     tx[7] = 0x24; /* Year */
     tx[8] = 0x00; /* Control */
-    I2C_Tx(p_dvc, tx, sizeof(tx));
+    (void)I2C_Tx(p_dvc, tx, sizeof(tx));
 
     vTaskDelay(pdMS_TO_TICKS(1000 * SECONDS_DIFF));
 
-    I2C_TxRx(p_dvc, offs, sizeof(offs), rx, sizeof(rx));
+    (void)I2C_TxRx(p_dvc, offs, sizeof(offs), rx, sizeof(rx));
     ESP_LOGI
     (
         iTag,
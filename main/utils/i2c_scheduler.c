@@ -0,0 +1,539 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "types.h"
+#include "i2c.h"
+#include "i2c_scheduler.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define I2CS_LOG  0
+
+#if (1 == I2CS_LOG)
+static const char * gTAG = "I2CS";
+#    define I2CS_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define I2CS_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#else
+#    define I2CS_LOGI(...)
+#    define I2CS_LOGE(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    I2CS_CLIENTS_MAX = 8,
+    I2CS_QUEUE_SIZE  = 16,
+};
+
+typedef struct
+{
+    FW_RESULT (* tx)(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz);
+    FW_RESULT (* rx)(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz);
+    FW_RESULT (* txrx)(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz);
+} i2cs_bus_t;
+
+typedef struct
+{
+    i2c_client_p clients[I2CS_CLIENTS_MAX];
+    i2c_xfer_p   queue[I2CS_QUEUE_SIZE];
+    uint8_t      count;
+    /* The round robin start of the clients */
+    uint8_t      next;
+    uint8_t      head;
+    uint8_t      queued;
+} i2cs_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static i2cs_t gScheduler = {0};
+
+static const i2cs_bus_t gcI2CBus = {I2C_Tx, I2C_Rx, I2C_TxRx};
+static const i2cs_bus_t * gBus   = &gcI2CBus;
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t i2cs_Now(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The write-read is made by one transaction with the repeated START */
+static FW_RESULT i2cs_Transfer(i2c_xfer_p p_xfer)
+{
+    if ((0 < p_xfer->tx_sz) && (0 < p_xfer->rx_sz))
+    {
+        return gBus->txrx(p_xfer->p_dvc, p_xfer->p_tx, p_xfer->tx_sz, p_xfer->p_rx, p_xfer->rx_sz);
+    }
+    if (0 < p_xfer->rx_sz)
+    {
+        return gBus->rx(p_xfer->p_dvc, p_xfer->p_rx, p_xfer->rx_sz);
+    }
+
+    return gBus->tx(p_xfer->p_dvc, p_xfer->p_tx, p_xfer->tx_sz);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Returns the time (ms) till the next bus work */
+static uint32_t i2cs_Wait(uint32_t now)
+{
+    i2c_client_p p_client = NULL;
+    uint32_t     result   = UINT32_MAX;
+    int32_t      wait     = 0;
+    uint8_t      idx      = 0;
+
+    if (0 < gScheduler.queued)
+    {
+        return 0;
+    }
+
+    for (idx = 0; idx < gScheduler.count; idx++)
+    {
+        p_client = gScheduler.clients[idx];
+        if (true == p_client->idle)
+        {
+            continue;
+        }
+        wait   = (int32_t)(p_client->due - now);
+        wait   = MAX(wait, 0);
+        result = MIN(result, (uint32_t)wait);
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void i2cs_Schedule(i2c_client_p p_client, uint32_t now, uint32_t wait)
+{
+    /* The client is polled by its period even if it is waiting for nothing */
+    if (0 < p_client->period)
+    {
+        wait = MIN(wait, p_client->period);
+    }
+
+    p_client->idle = (UINT32_MAX == wait);
+    p_client->due  = (now + wait);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void I2C_Scheduler_AddClient(i2c_client_p p_client)
+{
+    uint8_t idx = 0;
+
+    for (idx = 0; idx < gScheduler.count; idx++)
+    {
+        if (p_client == gScheduler.clients[idx])
+        {
+            return;
+        }
+    }
+    if (I2CS_CLIENTS_MAX <= gScheduler.count)
+    {
+        I2CS_LOGE("No room for the client!");
+        return;
+    }
+
+    p_client->due  = i2cs_Now();
+    p_client->idle = false;
+    gScheduler.clients[gScheduler.count++] = p_client;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The client is stepped by the next process call */
+void I2C_Scheduler_Wake(i2c_client_p p_client)
+{
+    p_client->due  = i2cs_Now();
+    p_client->idle = false;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Queues the transfer: FW_INPROGRESS - it is queued already, FW_FULL - no room in the queue */
+FW_RESULT I2C_Scheduler_Submit(i2c_xfer_p p_xfer)
+{
+    if (FW_INPROGRESS == p_xfer->result)
+    {
+        return FW_INPROGRESS;
+    }
+    if (I2CS_QUEUE_SIZE <= gScheduler.queued)
+    {
+        return FW_FULL;
+    }
+
+    p_xfer->result = FW_INPROGRESS;
+    gScheduler.queue[(gScheduler.head + gScheduler.queued) % I2CS_QUEUE_SIZE] = p_xfer;
+    gScheduler.queued++;
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Makes one bus transaction at most, returns the time (ms) till the next call is needed */
+uint32_t I2C_Scheduler_Process(void)
+{
+    uint32_t     now      = i2cs_Now();
+    i2c_xfer_p   p_xfer   = NULL;
+    i2c_client_p p_client = NULL;
+    uint32_t     wait     = 0;
+    int32_t      late     = -1;
+    uint8_t      found    = I2CS_CLIENTS_MAX;
+    uint8_t      idx      = 0;
+    uint8_t      client   = 0;
+
+    /* The queued transfers go first, the clients waiting for them are not delayed */
+    if (0 < gScheduler.queued)
+    {
+        p_xfer          = gScheduler.queue[gScheduler.head];
+        gScheduler.head = ((gScheduler.head + 1) % I2CS_QUEUE_SIZE);
+        gScheduler.queued--;
+
+        p_xfer->result = i2cs_Transfer(p_xfer);
+        if (FW_SUCCESS != p_xfer->result)
+        {
+            I2CS_LOGE("Transfer - Error: %04X", p_xfer->result);
+        }
+        if (NULL != p_xfer->fp_done)
+        {
+            p_xfer->fp_done(p_xfer, p_xfer->p_ctx);
+        }
+
+        return i2cs_Wait(i2cs_Now());
+    }
+
+    /* The latest client is stepped, the ties are resolved round robin */
+    for (idx = 0; idx < gScheduler.count; idx++)
+    {
+        client   = ((gScheduler.next + idx) % gScheduler.count);
+        p_client = gScheduler.clients[client];
+        if ((false == p_client->idle) && (late < (int32_t)(now - p_client->due)))
+        {
+            late  = (int32_t)(now - p_client->due);
+            found = client;
+        }
+    }
+
+    if (I2CS_CLIENTS_MAX != found)
+    {
+        p_client        = gScheduler.clients[found];
+        gScheduler.next = ((found + 1) % gScheduler.count);
+        wait            = p_client->fp_step(p_client->p_ctx);
+        i2cs_Schedule(p_client, now, wait);
+    }
+
+    return i2cs_Wait(i2cs_Now());
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The simulated bus: one device with the auto incremented register pointer */
+enum
+{
+    I2CS_TEST_REGISTERS = 16,
+    I2CS_TEST_LOG       = 4,
+};
+
+typedef enum
+{
+    I2CS_TEST_TX = 1,
+    I2CS_TEST_RX,
+    I2CS_TEST_TXRX,
+} i2cs_test_kind_t;
+
+typedef struct
+{
+    uint8_t          registers[I2CS_TEST_REGISTERS];
+    uint8_t          pointer;
+    uint32_t         transactions;
+    uint32_t         nacks;
+    i2cs_test_kind_t log[I2CS_TEST_LOG];
+} i2cs_test_bus_t;
+
+static i2cs_test_bus_t gTestBus = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT i2cs_TestLog(i2cs_test_kind_t kind)
+{
+    gTestBus.log[gTestBus.transactions % I2CS_TEST_LOG] = kind;
+    gTestBus.transactions++;
+    if (0 < gTestBus.nacks)
+    {
+        gTestBus.nacks--;
+        return FW_ERROR;
+    }
+
+    return FW_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void i2cs_TestWrite(uint8_t * p_tx, uint8_t tx_sz)
+{
+    uint8_t idx = 0;
+
+    gTestBus.pointer = (p_tx[0] % I2CS_TEST_REGISTERS);
+    for (idx = 1; idx < tx_sz; idx++)
+    {
+        gTestBus.registers[gTestBus.pointer] = p_tx[idx];
+        gTestBus.pointer = ((gTestBus.pointer + 1) % I2CS_TEST_REGISTERS);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void i2cs_TestRead(uint8_t * p_rx, uint8_t rx_sz)
+{
+    uint8_t idx = 0;
+
+    for (idx = 0; idx < rx_sz; idx++)
+    {
+        p_rx[idx]        = gTestBus.registers[gTestBus.pointer];
+        gTestBus.pointer = ((gTestBus.pointer + 1) % I2CS_TEST_REGISTERS);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT i2cs_TestTx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz)
+{
+    i2cs_TestWrite(p_tx, tx_sz);
+    return i2cs_TestLog(I2CS_TEST_TX);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT i2cs_TestRx(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz)
+{
+    i2cs_TestRead(p_rx, rx_sz);
+    return i2cs_TestLog(I2CS_TEST_RX);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static FW_RESULT i2cs_TestTxRx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz)
+{
+    i2cs_TestWrite(p_tx, tx_sz);
+    i2cs_TestRead(p_rx, rx_sz);
+    return i2cs_TestLog(I2CS_TEST_TXRX);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void i2cs_TestDone(i2c_xfer_p p_xfer, void * p_ctx)
+{
+    (*(uint32_t *)p_ctx)++;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The transfers are made in order, one bus transaction per process call */
+static bool i2cs_TestTransfers(void)
+{
+    uint8_t    write[]                = {0x02, 0xA5, 0x5A};
+    uint8_t    pointer[]              = {0x02};
+    uint8_t    combined[2]            = {0};
+    uint8_t    read[2]                = {0};
+    uint32_t   done                   = 0;
+    i2c_xfer_t xfers[]                =
+    {
+        {NULL, write, NULL, sizeof(write), 0, FW_SUCCESS, i2cs_TestDone, &done},
+        {NULL, pointer, combined, sizeof(pointer), sizeof(combined), FW_SUCCESS, i2cs_TestDone, &done},
+        {NULL, NULL, read, 0, sizeof(read), FW_SUCCESS, i2cs_TestDone, &done},
+    };
+    i2c_xfer_t queue[I2CS_QUEUE_SIZE] = {0};
+    uint32_t   transactions           = 0;
+    uint8_t    idx                    = 0;
+    bool       result                 = true;
+
+    for (idx = 0; idx < I2CS_TEST_REGISTERS; idx++)
+    {
+        gTestBus.registers[idx] = (idx * 0x11);
+    }
+    for (idx = 0; idx < (sizeof(xfers) / sizeof(xfers[0])); idx++)
+    {
+        result &= (FW_SUCCESS == I2C_Scheduler_Submit(&xfers[idx]));
+    }
+    result &= (FW_INPROGRESS == I2C_Scheduler_Submit(&xfers[0]));
+
+    for (idx = 0; idx < (sizeof(xfers) / sizeof(xfers[0])); idx++)
+    {
+        transactions = gTestBus.transactions;
+        (void)I2C_Scheduler_Process();
+        result &= ((transactions + 1) == gTestBus.transactions);
+        result &= (FW_SUCCESS == xfers[idx].result);
+    }
+    result &= (UINT32_MAX == I2C_Scheduler_Process());
+    result &= (I2CS_TEST_TX == gTestBus.log[0]);
+    result &= (I2CS_TEST_TXRX == gTestBus.log[1]);
+    result &= (I2CS_TEST_RX == gTestBus.log[2]);
+    result &= (3 == done);
+    result &= ((0xA5 == combined[0]) && (0x5A == combined[1]));
+    result &= ((0x44 == read[0]) && (0x55 == read[1]));
+
+    /* The full queue rejects the transfer, the NACK is reported by the result */
+    for (idx = 0; idx < I2CS_QUEUE_SIZE; idx++)
+    {
+        queue[idx].p_rx  = read;
+        queue[idx].rx_sz = sizeof(read);
+        result &= (FW_SUCCESS == I2C_Scheduler_Submit(&queue[idx]));
+    }
+    result &= (FW_FULL == I2C_Scheduler_Submit(&xfers[0]));
+    gTestBus.nacks = 1;
+    for (idx = 0; idx < I2CS_QUEUE_SIZE; idx++)
+    {
+        (void)I2C_Scheduler_Process();
+    }
+    result &= (FW_ERROR == queue[0].result);
+    result &= (FW_SUCCESS == queue[I2CS_QUEUE_SIZE - 1].result);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint32_t   steps;
+    uint32_t   done;
+    i2c_xfer_t xfers[2];
+    uint8_t    rx[2];
+} i2cs_test_client_t, * i2cs_test_client_p;
+
+//-------------------------------------------------------------------------------------------------
+
+/* The polled sensor reads its registers by one transaction per period */
+static uint32_t i2cs_TestPoll(void * p_ctx)
+{
+    uint8_t pointer = 0;
+    uint8_t rx[2]   = {0};
+
+    ((i2cs_test_client_p)p_ctx)->steps++;
+    (void)gBus->txrx(NULL, &pointer, sizeof(pointer), rx, sizeof(rx));
+
+    return UINT32_MAX;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The woken sensor queues its transfers and waits for the next wake */
+static uint32_t i2cs_TestEvent(void * p_ctx)
+{
+    i2cs_test_client_p p_client = (i2cs_test_client_p)p_ctx;
+    uint8_t            idx      = 0;
+
+    p_client->steps++;
+    for (idx = 0; idx < (sizeof(p_client->xfers) / sizeof(p_client->xfers[0])); idx++)
+    {
+        p_client->xfers[idx].fp_done = i2cs_TestDone;
+        p_client->xfers[idx].p_ctx   = &p_client->done;
+        p_client->xfers[idx].p_rx    = p_client->rx;
+        p_client->xfers[idx].rx_sz   = sizeof(p_client->rx);
+        (void)I2C_Scheduler_Submit(&p_client->xfers[idx]);
+    }
+
+    return UINT32_MAX;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The clients are stepped by their periods, every call makes one transaction at most */
+static bool i2cs_TestClients(void)
+{
+    enum
+    {
+        RUN_MS  = 1000,
+        CLIENTS = 3,
+        EVENTS  = 2,
+    };
+    static const uint32_t periods[CLIENTS] = {50, 100, 200};
+    i2cs_test_client_t contexts[CLIENTS + 1] = {0};
+    i2c_client_t       clients[CLIENTS + 1]  = {0};
+    uint32_t           start                 = 0;
+    uint32_t           wait                  = 0;
+    uint32_t           transactions          = 0;
+    uint32_t           calls                 = 0;
+    uint32_t           burst                 = 0;
+    uint8_t            idx                   = 0;
+    bool               result                = true;
+
+    for (idx = 0; idx < CLIENTS; idx++)
+    {
+        clients[idx].fp_step = i2cs_TestPoll;
+        clients[idx].p_ctx   = &contexts[idx];
+        clients[idx].period  = periods[idx];
+        I2C_Scheduler_AddClient(&clients[idx]);
+    }
+    clients[CLIENTS].fp_step = i2cs_TestEvent;
+    clients[CLIENTS].p_ctx   = &contexts[CLIENTS];
+    I2C_Scheduler_AddClient(&clients[CLIENTS]);
+
+    start = i2cs_Now();
+    while (RUN_MS > (i2cs_Now() - start))
+    {
+        /* The event client is woken in the middle of the run */
+        if ((EVENTS > contexts[CLIENTS].steps) && ((RUN_MS / 2) < (i2cs_Now() - start)))
+        {
+            I2C_Scheduler_Wake(&clients[CLIENTS]);
+        }
+        transactions = gTestBus.transactions;
+        wait         = I2C_Scheduler_Process();
+        burst        = MAX(burst, (gTestBus.transactions - transactions));
+        calls++;
+        if (0 < wait)
+        {
+            vTaskDelay(pdMS_TO_TICKS(MIN(wait, 10)) + 1);
+        }
+    }
+    while (0 == I2C_Scheduler_Process()) {};
+
+    for (idx = 0; idx < CLIENTS; idx++)
+    {
+        I2CS_LOGI("Client %u - period %lu ms - steps %lu", idx, periods[idx], contexts[idx].steps);
+        result &= ((RUN_MS / periods[idx] * 3 / 4) <= contexts[idx].steps);
+        result &= ((RUN_MS / periods[idx] + 1) >= contexts[idx].steps);
+    }
+    result &= (EVENTS == contexts[CLIENTS].steps);
+    result &= ((EVENTS * 2) == contexts[CLIENTS].done);
+    result &= (1 == burst);
+    I2CS_LOGI("Clients - calls %lu - transactions %lu", calls, gTestBus.transactions);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void I2C_Scheduler_Test(void)
+{
+    static const i2cs_bus_t test_bus = {i2cs_TestTx, i2cs_TestRx, i2cs_TestTxRx};
+    i2cs_t scheduler = gScheduler;
+    bool   result    = true;
+
+    memset(&gTestBus, 0, sizeof(gTestBus));
+    memset(&gScheduler, 0, sizeof(gScheduler));
+    gBus = &test_bus;
+
+    result = i2cs_TestTransfers();
+    I2CS_LOGI("Scheduler Transfers - %s", (true == result) ? "PASS" : "FAIL");
+    result = i2cs_TestClients();
+    I2CS_LOGI("Scheduler Clients - %s", (true == result) ? "PASS" : "FAIL");
+
+    gBus       = &gcI2CBus;
+    gScheduler = scheduler;
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,45 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* This interface measures the pure logic of the modules to track the regressions:          */
+/*  - the operation count of the run is doubled till the run takes 20 ms at least;          */
+/*  - the result is the median of 5 runs, the preemptions hit the min and the max only;     */
+/*  - the heap allocations of the benchmark task are counted by the heap hooks;             */
+/*  - every benchmark logs one JSON line ("BENCH: {...}"), grep them from the monitor log.  */
+/* The benchmarks are run by "Module_Bench()" calls in "app_main" like the tests, the lines */
+/* are logged when BENCH_LOG is set, the heap is counted when CONFIG_BENCH_ENABLE is set.   */
+/* The host build ("test/bench") runs them too and prints the lines to stdout.              */
+
+enum
+{
+    BENCH_RUNS     = 5,
+    BENCH_RUN_US   = 20000,
+    BENCH_LINE_MAX = 256,
+};
+
+/* Makes the operation "count" times */
+typedef void (* bench_fn_t)(void * p_ctx, uint32_t count);
+
+typedef struct
+{
+    /* The operations of every run */
+    uint32_t count;
+    /* 0.001 ns per operation */
+    uint64_t median;
+    uint64_t min;
+    uint64_t max;
+    /* 0.001 per operation, -1 - the heap hooks are disabled */
+    int64_t  allocs;
+    int64_t  bytes;
+} bench_result_t, * bench_result_p;
+
+/* Measures and prints the result, p_result may be NULL */
+void   Bench_Run(const char * p_suite, const char * p_name, bench_fn_t fp_op, void * p_ctx, bench_result_p p_result);
+/* Returns the length of the JSON line, 0 - it does not fit */
+size_t Bench_Format(const char * p_suite, const char * p_name, const bench_result_t * p_result, char * p_buf, size_t size);
+void   Bench_Test(void);
+
+#endif /* __BENCH_H__ */
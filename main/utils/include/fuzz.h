@@ -0,0 +1,36 @@
+#ifndef __FUZZ_H__
+#define __FUZZ_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/* This interface feeds the network parsers with the malformed inputs to find the crashes:   */
+/*  - the input is the seed (the valid request) mutated by the random bit flips, the special */
+/*    bytes, the erased, inserted and truncated parts and the splices of the other seeds;   */
+/*  - the random sequence is fixed, the failed run is the same on every start;              */
+/*  - the target checks the invariants of its parser, the writes after the input are caught */
+/*    by the guard bytes, the host build allocates the input by its size for the sanitizers. */
+/* The fuzzers are run by "Module_Test()" calls in "app_main".                               */
+
+enum
+{
+    /* The mutations do not grow the input over */
+    FUZZ_DATA_MAX = 512,
+    FUZZ_GUARD    = 16,
+};
+
+typedef struct
+{
+    const uint8_t * p_data;
+    uint16_t        size;
+} fuzz_seed_t;
+
+/* Parses the input, returns false when the invariant of the parser is broken */
+typedef bool (* fuzz_fn_t)(void * p_ctx, uint8_t * p_data, uint16_t size);
+
+/* Returns the count of the failed runs */
+uint32_t Fuzz_Run(const char * p_name, const fuzz_seed_t * p_seeds, uint8_t count, fuzz_fn_t fp_target, void * p_ctx, uint32_t runs);
+void     Fuzz_Test(void);
+
+#endif /* __FUZZ_H__ */
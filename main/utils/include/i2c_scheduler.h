@@ -0,0 +1,48 @@
+#ifndef __I2C_SCHEDULER_H__
+#define __I2C_SCHEDULER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "i2c.h"
+#include "types.h"
+
+/* This interface shares the I2C bus between the sensors without blocking the Climate task: */
+/*  - the drivers queue the transfer descriptors, the write-read is one combined transfer;  */
+/*  - the clients (the sensors state machines) are stepped by their poll period or wait;    */
+/*  - every process call makes one bus transaction at most, so the latency is bounded.      */
+/* The interface is used from the Climate task context only.                                */
+
+typedef struct i2c_xfer_s
+{
+    i2c_device_p p_dvc;
+    uint8_t    * p_tx;
+    uint8_t    * p_rx;
+    uint8_t      tx_sz;
+    uint8_t      rx_sz;
+    /* FW_INPROGRESS till the transfer is made */
+    FW_RESULT    result;
+    /* Called when the transfer is made, it may be NULL */
+    void      (* fp_done)(struct i2c_xfer_s * p_xfer, void * p_ctx);
+    void       * p_ctx;
+} i2c_xfer_t, * i2c_xfer_p;
+
+typedef struct
+{
+    /* Makes one bus transaction at most, returns the time (ms) till the next step is needed */
+    uint32_t (* fp_step)(void * p_ctx);
+    void     * p_ctx;
+    /* The client is stepped at least once per period (ms), 0 - only by its wait or wake */
+    uint32_t   period;
+    /* The time (ms) of the next step */
+    uint32_t   due;
+    bool       idle;
+} i2c_client_t, * i2c_client_p;
+
+void      I2C_Scheduler_AddClient(i2c_client_p p_client);
+void      I2C_Scheduler_Wake(i2c_client_p p_client);
+FW_RESULT I2C_Scheduler_Submit(i2c_xfer_p p_xfer);
+uint32_t  I2C_Scheduler_Process(void);
+void      I2C_Scheduler_Test(void);
+
+#endif /* __I2C_SCHEDULER_H__ */
@@ -0,0 +1,34 @@
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+/* This interface profiles the tasks to right-size their stacks and to find the CPU hogs:     */
+/*  - every window the run time of every task is taken as the share of its core;             */
+/*  - the stack high water marks and the depths of the registered queues are sampled;        */
+/*  - the latency of the timer interrupt shows how long the interrupts are masked on core 0; */
+/*  - the report is the compact record, it is logged and streamed by the "/stream" socket.   */
+/* The run time stats and the trace facility of FreeRTOS are enabled by "sdkconfig.defaults". */
+
+enum
+{
+    PROFILER_TASKS      = 32,
+    PROFILER_QUEUES     = 8,
+    PROFILER_CORES      = 2,
+    PROFILER_RECORD_MAX = 1024,
+};
+
+void     Profiler_Init(void);
+/* The queue is registered once after its creation */
+void     Profiler_AddQueue(const char * p_name, QueueHandle_t queue);
+/* Called every second, the report is made once per window */
+void     Profiler_Process(void);
+/* Copies the record of the report newer than the sequence, returns its length, 0 - no new report */
+size_t   Profiler_GetRecord(uint32_t * p_sequence, char * p_buf, size_t size);
+void     Profiler_Test(void);
+
+#endif /* __PROFILER_H__ */
@@ -0,0 +1,81 @@
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef ESP_PLATFORM
+#    include "sdkconfig.h"
+#endif
+
+/* This interface traces the hot paths to see where the time goes between the tasks:       */
+/*  - the span is scoped, it takes the CPU cycle counter (CCOUNT) when it begins and ends;  */
+/*  - the span is written to the ring of its core with the interrupts of the core masked;  */
+/*  - the timer time is added to the ring now and then to turn the cycles to microseconds; */
+/*  - the rings are dumped as the Chrome trace JSON ("/trace.json"), chrome://tracing.      */
+/* The spans are compiled out till CONFIG_TRACE_ENABLE is set (menuconfig).                */
+
+enum
+{
+    TRACE_CORES    = 2,
+    /* Per core, the power of 2 */
+    TRACE_EVENTS   = 256,
+    TRACE_LINE_MAX = 192,
+    /* The JSON of the dump: the head, the events of the rings and the tail */
+    TRACE_DUMP_MAX = ((TRACE_CORES * TRACE_EVENTS + 2) * TRACE_LINE_MAX),
+};
+
+/* The static IDs of the spans, the names are in "gcTraceNames" */
+typedef enum
+{
+    /* The cycles and the time to convert the cycles of the following events */
+    TRACE_SYNC = 0,
+    TRACE_RGB_PROCESS,
+    TRACE_WEBSOCKET_PARSE,
+    TRACE_DNS_REQUEST,
+    TRACE_BME280_READOUT,
+    TRACE_HTTP_SEND,
+    TRACE_IDS,
+} trace_id_t;
+
+typedef struct
+{
+    uint32_t start;
+    uint8_t  id;
+    uint8_t  core;
+} trace_span_t, * trace_span_p;
+
+/* The state of the dump, the rings are read while they are written */
+typedef struct
+{
+    uint32_t index[TRACE_CORES];
+    uint32_t end[TRACE_CORES];
+    uint32_t sync_cycles[TRACE_CORES];
+    uint64_t sync_us[TRACE_CORES];
+    bool     synced[TRACE_CORES];
+    uint32_t cycles_per_us;
+    uint32_t events;
+    uint8_t  core;
+    uint8_t  stage;
+    uint16_t line_len;
+    uint16_t line_pos;
+    char     line[TRACE_LINE_MAX];
+} trace_dump_t, * trace_dump_p;
+
+#ifdef CONFIG_TRACE_ENABLE
+/* The span lasts till the end of the scope */
+#    define TRACE_SPAN(id)  trace_span_t trace_span __attribute__((cleanup(Trace_End))) = Trace_Begin(id)
+#else
+#    define TRACE_SPAN(id)
+#endif
+
+trace_span_t Trace_Begin(trace_id_t id);
+void         Trace_End(trace_span_p p_span);
+/* Takes the current ends of the rings, the older events are dumped */
+void         Trace_DumpInit(trace_dump_p p_dump);
+/* Renders the next part of the JSON, returns its length, 0 - the end */
+size_t       Trace_DumpRead(trace_dump_p p_dump, char * p_buf, size_t size);
+void         Trace_Test(void);
+
+#endif /* __TRACE_H__ */
@@ -0,0 +1,584 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "driver/gptimer.h"
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "types.h"
+#include "profiler.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define PROFILER_LOG  0
+
+#if (1 == PROFILER_LOG)
+static const char * gTAG = "PROFILER";
+#    define PROF_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define PROF_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define PROF_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define PROF_LOGI(...)
+#    define PROF_LOGE(...)
+#    define PROF_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    /* The report window (ms) */
+    PROF_WINDOW_MS    = 10000,
+    /* The share of the core is in 0.01 % */
+    PROF_CPU_FULL     = 10000,
+    /* The timer ticks are 0.1 us */
+    PROF_TIMER_HZ     = 10000000,
+    /* The timer interrupt is every 10 ms */
+    PROF_TIMER_PERIOD = (PROF_TIMER_HZ / 100),
+    PROF_NAME_LEN     = configMAX_TASK_NAME_LEN,
+    /* The task is not pinned */
+    PROF_CORE_ANY     = 0xFF,
+};
+
+typedef struct
+{
+    char     name[PROF_NAME_LEN];
+    /* The minimum free stack since the task start (bytes) */
+    uint32_t stack;
+    /* The share of the core in the window (0.01 %) */
+    uint16_t cpu;
+    uint8_t  core;
+} prof_task_t, * prof_task_p;
+
+typedef struct
+{
+    const char  * p_name;
+    QueueHandle_t queue;
+    uint16_t      depth;
+    /* The maximum depth sampled in the window */
+    uint16_t      peak;
+    uint16_t      length;
+} prof_queue_t, * prof_queue_p;
+
+typedef struct
+{
+    uint64_t sum;
+    uint32_t count;
+    /* 0.1 us */
+    uint32_t max;
+} prof_isr_t, * prof_isr_p;
+
+typedef struct
+{
+    uint32_t number;
+    uint32_t runtime;
+} prof_counter_t, * prof_counter_p;
+
+typedef struct
+{
+    /* The run time counters at the window start */
+    prof_counter_t counters[PROFILER_TASKS];
+    uint32_t       count;
+    uint32_t       total;
+} prof_acc_t, * prof_acc_p;
+
+typedef struct
+{
+    /* 0 - no report */
+    uint32_t     sequence;
+    /* ms */
+    uint32_t     window;
+    /* The share of the core not spent by its idle task (0.01 %) */
+    uint16_t     load[PROFILER_CORES];
+    /* The timer interrupt latency (0.1 us) */
+    uint32_t     isr_mean;
+    uint32_t     isr_max;
+    uint32_t     tasks_count;
+    uint32_t     queues_count;
+    prof_task_t  tasks[PROFILER_TASKS];
+    prof_queue_t queues[PROFILER_QUEUES];
+} prof_report_t, * prof_report_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static prof_queue_t      gProfQueues[PROFILER_QUEUES] = {0};
+static uint32_t          gProfQueuesCount             = 0;
+static TaskStatus_t      gProfStatus[PROFILER_TASKS]  = {0};
+static uint8_t           gProfCores[PROFILER_TASKS]   = {0};
+static prof_acc_t        gProfAcc                     = {0};
+static prof_report_t     gProfReport                  = {0};
+static int64_t           gProfStart                   = 0;
+static SemaphoreHandle_t gProfMutex                   = NULL;
+/* The latency is summed by the timer interrupt */
+static prof_isr_t        gProfIsr                     = {0};
+static portMUX_TYPE      gProfLock                    = portMUX_INITIALIZER_UNLOCKED;
+
+//-------------------------------------------------------------------------------------------------
+
+static void IRAM_ATTR prof_IsrAdd(prof_isr_p p_isr, uint32_t latency)
+{
+    p_isr->sum += latency;
+    p_isr->count++;
+    p_isr->max  = MAX(p_isr->max, latency);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The timer counts on, so the latency is the count at the interrupt over the alarm count */
+static bool IRAM_ATTR prof_TimerCallback
+(
+    gptimer_handle_t                   timer,
+    const gptimer_alarm_event_data_t * p_data,
+    void *                             p_ctx
+)
+{
+    gptimer_alarm_config_t alarm =
+    {
+        .alarm_count = (p_data->alarm_value + PROF_TIMER_PERIOD),
+    };
+
+    portENTER_CRITICAL_ISR(&gProfLock);
+    prof_IsrAdd(&gProfIsr, (uint32_t)(p_data->count_value - p_data->alarm_value));
+    portEXIT_CRITICAL_ISR(&gProfLock);
+
+    /* The missed alarms are skipped */
+    if (alarm.alarm_count <= p_data->count_value)
+    {
+        alarm.alarm_count = (p_data->count_value + PROF_TIMER_PERIOD);
+    }
+    (void)gptimer_set_alarm_action(timer, &alarm);
+
+    return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The interrupt is allocated on the core of the caller */
+static void prof_TimerInit(void)
+{
+    gptimer_handle_t       timer  = NULL;
+    gptimer_config_t       config =
+    {
+        .clk_src       = GPTIMER_CLK_SRC_DEFAULT,
+        .direction     = GPTIMER_COUNT_UP,
+        .resolution_hz = PROF_TIMER_HZ,
+    };
+    gptimer_event_callbacks_t callbacks =
+    {
+        .on_alarm = prof_TimerCallback,
+    };
+    gptimer_alarm_config_t alarm =
+    {
+        .alarm_count = PROF_TIMER_PERIOD,
+    };
+
+    ESP_ERROR_CHECK(gptimer_new_timer(&config, &timer));
+    ESP_ERROR_CHECK(gptimer_register_event_callbacks(timer, &callbacks, NULL));
+    ESP_ERROR_CHECK(gptimer_enable(timer));
+    ESP_ERROR_CHECK(gptimer_set_alarm_action(timer, &alarm));
+    ESP_ERROR_CHECK(gptimer_start(timer));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The tasks are taken by their run time counters since the window start, the counters wrap */
+static void prof_Account
+(
+    prof_acc_p           p_acc,
+    const TaskStatus_t * p_status,
+    const uint8_t      * p_cores,
+    uint32_t             count,
+    uint32_t             total,
+    const TaskHandle_t * p_idle,
+    prof_report_p        p_report
+)
+{
+    prof_counter_t counters[PROFILER_TASKS] = {0};
+    prof_task_t    task                     = {0};
+    uint32_t       elapsed                  = (total - p_acc->total);
+    uint32_t       start                    = 0;
+    uint32_t       i                        = 0;
+    uint32_t       j                        = 0;
+    uint8_t        c                        = 0;
+
+    count = MIN(count, PROFILER_TASKS);
+    for (c = 0; c < PROFILER_CORES; c++)
+    {
+        p_report->load[c] = 0;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        /* The task created in the window starts from 0 */
+        start = 0;
+        for (j = 0; j < p_acc->count; j++)
+        {
+            if (p_acc->counters[j].number == p_status[i].xTaskNumber)
+            {
+                start = p_acc->counters[j].runtime;
+                break;
+            }
+        }
+
+        strlcpy(p_report->tasks[i].name, p_status[i].pcTaskName, PROF_NAME_LEN);
+        p_report->tasks[i].stack = p_status[i].usStackHighWaterMark;
+        p_report->tasks[i].core  = p_cores[i];
+        p_report->tasks[i].cpu   = 0;
+        if (0 < elapsed)
+        {
+            p_report->tasks[i].cpu = (uint16_t)MIN(((uint64_t)(p_status[i].ulRunTimeCounter - start) * PROF_CPU_FULL / elapsed), PROF_CPU_FULL);
+        }
+
+        for (c = 0; c < PROFILER_CORES; c++)
+        {
+            if (p_idle[c] == p_status[i].xHandle)
+            {
+                p_report->load[c] = (PROF_CPU_FULL - p_report->tasks[i].cpu);
+            }
+        }
+
+        counters[i].number  = p_status[i].xTaskNumber;
+        counters[i].runtime = p_status[i].ulRunTimeCounter;
+    }
+    p_report->tasks_count = count;
+
+    /* The CPU hogs go first */
+    for (i = 1; i < count; i++)
+    {
+        task = p_report->tasks[i];
+        for (j = i; (0 < j) && (p_report->tasks[j - 1].cpu < task.cpu); j--)
+        {
+            p_report->tasks[j] = p_report->tasks[j - 1];
+        }
+        p_report->tasks[j] = task;
+    }
+
+    memcpy(p_acc->counters, counters, sizeof(counters));
+    p_acc->count = count;
+    p_acc->total = total;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void prof_QueueUpdate(prof_queue_p p_queue, uint16_t depth, uint16_t spaces)
+{
+    p_queue->depth  = depth;
+    p_queue->peak   = MAX(p_queue->peak, depth);
+    p_queue->length = (depth + spaces);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Appends the entry to the record, false - the entry does not fit and it is dropped */
+static bool prof_Append(char * p_buf, size_t size, size_t * p_len, const char * p_fmt, ...)
+{
+    va_list args;
+    int     len = 0;
+
+    va_start(args, p_fmt);
+    len = vsnprintf(&p_buf[*p_len], (size - *p_len), p_fmt, args);
+    va_end(args);
+
+    if ((0 > len) || ((size - *p_len) <= (size_t)len))
+    {
+        p_buf[*p_len] = 0;
+        return false;
+    }
+    *p_len += (size_t)len;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The record is one line: the window, the cores load, the interrupt latency, the tasks by */
+/* their CPU share (name@core share stack) and the queues (name depth/peak/length):        */
+/* "#12 10.0s load 12.34% 3.10% isr 2.1/14.7us | Climate@0 0.52% 1024B | q Climate 0/3/20"  */
+static size_t prof_Format(const prof_report_t * p_report, char * p_buf, size_t size)
+{
+    size_t   len    = 0;
+    uint32_t i      = 0;
+    bool     result = true;
+
+    if (0 == size)
+    {
+        return 0;
+    }
+    p_buf[0] = 0;
+
+    result = prof_Append
+    (
+        p_buf, size, &len,
+        "#%lu %lu.%lus load %u.%02u%% %u.%02u%% isr %lu.%lu/%lu.%luus",
+        (unsigned long)p_report->sequence,
+        (unsigned long)(p_report->window / 1000),
+        (unsigned long)((p_report->window % 1000) / 100),
+        (p_report->load[0] / 100), (p_report->load[0] % 100),
+        (p_report->load[1] / 100), (p_report->load[1] % 100),
+        (unsigned long)(p_report->isr_mean / 10), (unsigned long)(p_report->isr_mean % 10),
+        (unsigned long)(p_report->isr_max / 10), (unsigned long)(p_report->isr_max % 10)
+    );
+
+    for (i = 0; (true == result) && (i < p_report->tasks_count); i++)
+    {
+        result = prof_Append
+        (
+            p_buf, size, &len,
+            (PROF_CORE_ANY == p_report->tasks[i].core) ? " | %s@%c %u.%02u%% %luB" : " | %s@%u %u.%02u%% %luB",
+            p_report->tasks[i].name,
+            (PROF_CORE_ANY == p_report->tasks[i].core) ? '-' : p_report->tasks[i].core,
+            (p_report->tasks[i].cpu / 100), (p_report->tasks[i].cpu % 100),
+            (unsigned long)p_report->tasks[i].stack
+        );
+    }
+
+    for (i = 0; (true == result) && (i < p_report->queues_count); i++)
+    {
+        result = prof_Append
+        (
+            p_buf, size, &len,
+            " | q %s %u/%u/%u",
+            p_report->queues[i].p_name,
+            p_report->queues[i].depth,
+            p_report->queues[i].peak,
+            p_report->queues[i].length
+        );
+    }
+
+    return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void prof_Report(int64_t now)
+{
+    TaskHandle_t idle[PROFILER_CORES] = {NULL};
+    prof_isr_t   isr                  = {0};
+    uint32_t     total                = 0;
+    uint32_t     count                = 0;
+    uint32_t     i                    = 0;
+    BaseType_t   core                 = 0;
+
+    /* The count is 0 if the tasks do not fit */
+    count = uxTaskGetSystemState(gProfStatus, PROFILER_TASKS, &total);
+    if (0 == count)
+    {
+        PROF_LOGE("More than %u tasks", PROFILER_TASKS);
+        return;
+    }
+    for (i = 0; i < count; i++)
+    {
+        core          = xTaskGetCoreID(gProfStatus[i].xHandle);
+        gProfCores[i] = ((0 <= core) && (PROFILER_CORES > core)) ? (uint8_t)core : PROF_CORE_ANY;
+    }
+    for (core = 0; (core < PROFILER_CORES) && (core < CONFIG_FREERTOS_NUMBER_OF_CORES); core++)
+    {
+        idle[core] = xTaskGetIdleTaskHandleForCore(core);
+    }
+
+    portENTER_CRITICAL(&gProfLock);
+    isr = gProfIsr;
+    memset(&gProfIsr, 0, sizeof(gProfIsr));
+    portEXIT_CRITICAL(&gProfLock);
+
+    (void)xSemaphoreTake(gProfMutex, portMAX_DELAY);
+    prof_Account(&gProfAcc, gProfStatus, gProfCores, count, total, idle, &gProfReport);
+    gProfReport.sequence++;
+    gProfReport.window   = (uint32_t)((now - gProfStart) / 1000);
+    gProfReport.isr_mean = (0 == isr.count) ? 0 : (uint32_t)(isr.sum / isr.count);
+    gProfReport.isr_max  = isr.max;
+    for (i = 0; i < gProfQueuesCount; i++)
+    {
+        gProfReport.queues[i] = gProfQueues[i];
+        gProfQueues[i].peak   = gProfQueues[i].depth;
+    }
+    gProfReport.queues_count = gProfQueuesCount;
+    (void)xSemaphoreGive(gProfMutex);
+
+    gProfStart = now;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Profiler_Init(void)
+{
+    if (NULL == gProfMutex)
+    {
+        gProfMutex = xSemaphoreCreateMutex();
+        prof_TimerInit();
+    }
+    gProfStart = esp_timer_get_time();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Profiler_AddQueue(const char * p_name, QueueHandle_t queue)
+{
+    /* The queues are registered by the tasks init, before the profiling */
+    if (PROFILER_QUEUES > gProfQueuesCount)
+    {
+        gProfQueues[gProfQueuesCount].p_name = p_name;
+        gProfQueues[gProfQueuesCount].queue  = queue;
+        gProfQueuesCount++;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Profiler_Process(void)
+{
+    int64_t  now = esp_timer_get_time();
+    uint32_t i   = 0;
+#if (1 == PROFILER_LOG)
+    static char record[PROFILER_RECORD_MAX];
+    uint32_t    sequence = 0;
+#endif
+
+    for (i = 0; i < gProfQueuesCount; i++)
+    {
+        prof_QueueUpdate
+        (
+            &gProfQueues[i],
+            (uint16_t)uxQueueMessagesWaiting(gProfQueues[i].queue),
+            (uint16_t)uxQueueSpacesAvailable(gProfQueues[i].queue)
+        );
+    }
+
+    if ((PROF_WINDOW_MS * 1000LL) <= (now - gProfStart))
+    {
+        prof_Report(now);
+#if (1 == PROFILER_LOG)
+        if (0 < Profiler_GetRecord(&sequence, record, sizeof(record)))
+        {
+            PROF_LOGI("%s", record);
+        }
+#endif
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Profiler_GetRecord(uint32_t * p_sequence, char * p_buf, size_t size)
+{
+    size_t len = 0;
+
+    if (NULL == gProfMutex)
+    {
+        return 0;
+    }
+
+    (void)xSemaphoreTake(gProfMutex, portMAX_DELAY);
+    if (*p_sequence != gProfReport.sequence)
+    {
+        len         = prof_Format(&gProfReport, p_buf, size);
+        *p_sequence = gProfReport.sequence;
+    }
+    (void)xSemaphoreGive(gProfMutex);
+
+    return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void Profiler_Test(void)
+{
+    static prof_report_t report = {0};
+    static char          record[PROFILER_RECORD_MAX];
+    prof_acc_t           acc       = {0};
+    prof_isr_t           isr       = {0};
+    prof_queue_t         queue     = {.p_name = "Climate"};
+    TaskStatus_t         status[4] =
+    {
+        {.xHandle = (TaskHandle_t)0x10, .pcTaskName = "IDLE0",   .xTaskNumber = 1, .usStackHighWaterMark = 900},
+        {.xHandle = (TaskHandle_t)0x20, .pcTaskName = "IDLE1",   .xTaskNumber = 2, .usStackHighWaterMark = 800},
+        {.xHandle = (TaskHandle_t)0x30, .pcTaskName = "Climate", .xTaskNumber = 7, .usStackHighWaterMark = 1024},
+        {.xHandle = (TaskHandle_t)0x40, .pcTaskName = "LED RGB", .xTaskNumber = 9, .usStackHighWaterMark = 812},
+    };
+    const uint8_t        cores[4] = {0, 1, 0, 1};
+    const TaskHandle_t   idle[PROFILER_CORES] = {(TaskHandle_t)0x10, (TaskHandle_t)0x20};
+    const char         * p_head = "#12 10.0s load 50.00% 50.00% isr 2.1/14.7us | IDLE0@0 50.00% 900B";
+    uint32_t             total  = 0;
+    size_t               len    = 0;
+    bool                 result = true;
+
+    /* The first window is since the boot: the core 0 is 25 % busy, the core 1 is 50 % busy */
+    status[0].ulRunTimeCounter = 750000;
+    status[1].ulRunTimeCounter = 500000;
+    status[2].ulRunTimeCounter = 250000;
+    status[3].ulRunTimeCounter = 500000;
+    total                      = 1000000;
+    prof_Account(&acc, status, cores, 4, total, idle, &report);
+    result &= ((2500 == report.load[0]) && (5000 == report.load[1]));
+    result &= ((4 == report.tasks_count) && (0 == strcmp(report.tasks[3].name, "Climate")));
+    result &= ((7500 == report.tasks[0].cpu) && (2500 == report.tasks[3].cpu) && (1024 == report.tasks[3].stack));
+
+    /* The next window is by the counters since the previous one, they wrap */
+    acc.total                  = (UINT32_MAX - 99999);
+    acc.counters[2].runtime    = (UINT32_MAX - 9999);
+    status[0].ulRunTimeCounter = (750000 + 100000);
+    status[2].ulRunTimeCounter = 90000;
+    status[3].ulRunTimeCounter = (500000 + 200000);
+    total                      = 100000;
+    prof_Account(&acc, status, cores, 4, total, idle, &report);
+    result &= ((0 == strcmp(report.tasks[0].name, "LED RGB")) && (PROF_CPU_FULL == report.tasks[0].cpu));
+    result &= ((0 == strcmp(report.tasks[2].name, "Climate")) && (5000 == report.tasks[2].cpu));
+    result &= ((5000 == report.load[0]) && (PROF_CPU_FULL == report.load[1]));
+
+    /* The new task is counted from 0, the deleted task is gone */
+    status[0].ulRunTimeCounter = (850000 + 50000);
+    status[1].ulRunTimeCounter = (500000 + 50000);
+    status[2].ulRunTimeCounter = (90000 + 50000);
+    status[3].xTaskNumber      = 11;
+    status[3].ulRunTimeCounter = 50000;
+    total                      = 200000;
+    prof_Account(&acc, status, cores, 4, total, idle, &report);
+    result &= ((5000 == report.tasks[0].cpu) && (5000 == report.tasks[3].cpu));
+    result &= ((5000 == report.load[0]) && (5000 == report.load[1]));
+    result &= ((4 == acc.count) && (11 == acc.counters[3].number));
+
+    /* The interrupt latency and the queue peak */
+    prof_IsrAdd(&isr, 21);
+    prof_IsrAdd(&isr, 147);
+    prof_IsrAdd(&isr, 12);
+    result &= ((180 == isr.sum) && (3 == isr.count) && (147 == isr.max));
+    prof_QueueUpdate(&queue, 3, 17);
+    prof_QueueUpdate(&queue, 0, 20);
+    result &= ((0 == queue.depth) && (3 == queue.peak) && (20 == queue.length));
+
+    /* The record */
+    report.sequence      = 12;
+    report.window        = 10040;
+    report.isr_mean      = 21;
+    report.isr_max       = 147;
+    report.tasks[3].core = PROF_CORE_ANY;
+    report.queues[0]     = queue;
+    report.queues_count  = 1;
+    len = prof_Format(&report, record, sizeof(record));
+    result &= (len == strlen(record));
+    result &= (0 == strncmp(record, p_head, strlen(p_head)));
+    result &= (NULL != strstr(record, " | Climate@0 50.00% 1024B"));
+    result &= (NULL != strstr(record, "@- "));
+    result &= (NULL != strstr(record, " | q Climate 0/3/20"));
+    PROF_LOGI("%s", record);
+
+    /* The record is cut by the entries */
+    len = prof_Format(&report, record, 60);
+    result &= ((len == strlen(record)) && (60 > len) && (' ' != record[len - 1]));
+    result &= (0 == prof_Format(&report, record, 10));
+
+    PROF_LOGI("Profiler - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
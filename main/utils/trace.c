@@ -0,0 +1,479 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "types.h"
+#include "trace.h"
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#include "freertos/FreeRTOS.h"
+
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define TRACE_LOG  0
+
+#if (1 == TRACE_LOG)
+static const char * gTAG = "TRACE";
+#    define TRACE_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define TRACE_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#    define TRACE_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
+#else
+#    define TRACE_LOGI(...)
+#    define TRACE_LOGE(...)
+#    define TRACE_LOGV(...)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+enum
+{
+    /* The time is added to the ring every 64 events ... */
+    TRACE_SYNC_EVENTS = 64,
+    /* ... or when the cycles since the last sync are close to the half of the counter range */
+    TRACE_SYNC_CYCLES = 0x40000000,
+};
+
+typedef enum
+{
+    TRACE_STAGE_HEAD = 0,
+    TRACE_STAGE_EVENTS,
+    TRACE_STAGE_TAIL,
+    TRACE_STAGE_DONE,
+} trace_stage_t;
+
+/* The sync event keeps the cycles in "start" and the time (us) in "value" and "high" */
+typedef struct
+{
+    uint32_t start;
+    /* The span cycles */
+    uint32_t value;
+    /* The index of the event + 1, 0 - the event is being written */
+    uint32_t sequence;
+    uint16_t high;
+    uint8_t  id;
+} trace_event_t, * trace_event_p;
+
+typedef struct
+{
+    /* The index of the next event */
+    uint32_t      head;
+    uint32_t      sync_cycles;
+    bool          synced;
+    trace_event_t events[TRACE_EVENTS];
+} trace_ring_t, * trace_ring_p;
+
+//-------------------------------------------------------------------------------------------------
+
+static trace_ring_t gTraceRings[TRACE_CORES];
+
+static const char * gcTraceNames[TRACE_IDS] =
+{
+    [TRACE_SYNC]            = "sync",
+    [TRACE_RGB_PROCESS]     = "rgb_Process",
+    [TRACE_WEBSOCKET_PARSE] = "websocket_parse",
+    [TRACE_DNS_REQUEST]     = "dns_ProcessRequest",
+    [TRACE_BME280_READOUT]  = "bme280_Readout",
+    [TRACE_HTTP_SEND]       = "http_send",
+};
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t trace_GetCycles(void)
+{
+    return (uint32_t)esp_cpu_get_cycle_count();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint64_t trace_GetMicros(void)
+{
+    return (uint64_t)esp_timer_get_time();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint8_t trace_GetCore(void)
+{
+    return (uint8_t)esp_cpu_get_core_id();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static uint32_t trace_GetCyclesPerMicro(void)
+{
+    return esp_rom_get_cpu_ticks_per_us();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The ring is written by its core only with the interrupts masked, the sequence of the slot */
+/* lets the other core dump it meanwhile                                                     */
+static void trace_Put(trace_ring_p p_ring, uint8_t id, uint32_t start, uint32_t value, uint16_t high)
+{
+    uint32_t      index  = __atomic_fetch_add(&p_ring->head, 1, __ATOMIC_RELAXED);
+    trace_event_p p_slot = &p_ring->events[index & (TRACE_EVENTS - 1)];
+
+    /* The readers skip the slot till its sequence is set again */
+    __atomic_store_n(&p_slot->sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    p_slot->start = start;
+    p_slot->value = value;
+    p_slot->high  = high;
+    p_slot->id    = id;
+    __atomic_store_n(&p_slot->sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The copy of the slot is valid when its sequence is the same before and after the copy */
+static bool trace_Load(trace_ring_p p_ring, uint32_t index, trace_event_p p_event)
+{
+    trace_event_p p_slot = &p_ring->events[index & (TRACE_EVENTS - 1)];
+
+    if ((index + 1) != __atomic_load_n(&p_slot->sequence, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+    p_event->start = p_slot->start;
+    p_event->value = p_slot->value;
+    p_event->high  = p_slot->high;
+    p_event->id    = p_slot->id;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    return ((index + 1) == __atomic_load_n(&p_slot->sequence, __ATOMIC_RELAXED));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void trace_Sync(trace_ring_p p_ring)
+{
+    uint32_t cycles = trace_GetCycles();
+    uint64_t us     = trace_GetMicros();
+
+    p_ring->sync_cycles = cycles;
+    p_ring->synced      = true;
+    trace_Put(p_ring, TRACE_SYNC, cycles, (uint32_t)us, (uint16_t)(us >> 32));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void trace_Record(uint8_t core, uint8_t id, uint32_t start, uint32_t end)
+{
+    trace_ring_p p_ring = &gTraceRings[core];
+
+    if ((false == p_ring->synced) ||
+        (TRACE_SYNC_CYCLES <= (end - p_ring->sync_cycles)) ||
+        (0 == (__atomic_load_n(&p_ring->head, __ATOMIC_RELAXED) & (TRACE_SYNC_EVENTS - 1))))
+    {
+        trace_Sync(p_ring);
+    }
+    trace_Put(p_ring, id, start, (end - start), 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void trace_Convert(uint32_t cycles, uint32_t cycles_per_us, uint32_t * p_us, uint16_t * p_ns)
+{
+    uint64_t ns = ((uint64_t)cycles * 1000 / cycles_per_us);
+
+    *p_us = (uint32_t)(ns / 1000);
+    *p_ns = (uint16_t)(ns % 1000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Renders the next line of the JSON, false - the end */
+static bool trace_DumpNext(trace_dump_p p_dump)
+{
+    trace_ring_p  p_ring = NULL;
+    trace_event_t event  = {0};
+    int64_t       ns     = 0;
+    uint32_t      dur_us = 0;
+    uint16_t      dur_ns = 0;
+    int           len    = 0;
+
+    switch (p_dump->stage)
+    {
+        case TRACE_STAGE_HEAD:
+            len = snprintf
+            (
+                p_dump->line,
+                sizeof(p_dump->line),
+                "{\"traceEvents\":["
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"CPU 0\"}},"
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU 1\"}}"
+            );
+            p_dump->stage = TRACE_STAGE_EVENTS;
+            break;
+
+        case TRACE_STAGE_EVENTS:
+            while (TRACE_CORES > p_dump->core)
+            {
+                p_ring = &gTraceRings[p_dump->core];
+                if (p_dump->index[p_dump->core] == p_dump->end[p_dump->core])
+                {
+                    p_dump->core++;
+                    continue;
+                }
+                if (false == trace_Load(p_ring, p_dump->index[p_dump->core]++, &event))
+                {
+                    /* The event is overwritten or is being written */
+                    continue;
+                }
+                if (TRACE_SYNC == event.id)
+                {
+                    p_dump->sync_cycles[p_dump->core] = event.start;
+                    p_dump->sync_us[p_dump->core]     = (((uint64_t)event.high << 32) | event.value);
+                    p_dump->synced[p_dump->core]      = true;
+                    continue;
+                }
+                if ((false == p_dump->synced[p_dump->core]) || (TRACE_IDS <= event.id))
+                {
+                    /* The sync of the event is overwritten */
+                    continue;
+                }
+
+                /* The span may begin before the sync */
+                ns  = ((int64_t)p_dump->sync_us[p_dump->core] * 1000);
+                ns += ((int64_t)(int32_t)(event.start - p_dump->sync_cycles[p_dump->core]) * 1000 /
+                       (int64_t)p_dump->cycles_per_us);
+                ns  = (0 > ns) ? 0 : ns;
+                trace_Convert(event.value, p_dump->cycles_per_us, &dur_us, &dur_ns);
+                len = snprintf
+                (
+                    p_dump->line,
+                    sizeof(p_dump->line),
+                    ",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03u,\"dur\":%lu.%03u}",
+                    gcTraceNames[event.id],
+                    (unsigned int)p_dump->core,
+                    (unsigned long long)(ns / 1000),
+                    (unsigned int)(ns % 1000),
+                    (unsigned long)dur_us,
+                    (unsigned int)dur_ns
+                );
+                p_dump->events++;
+                break;
+            }
+            if (TRACE_CORES == p_dump->core)
+            {
+                len           = snprintf(p_dump->line, sizeof(p_dump->line), "]}");
+                p_dump->stage = TRACE_STAGE_DONE;
+                TRACE_LOGI("Dumped %lu events", (unsigned long)p_dump->events);
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    p_dump->line_len = (uint16_t)len;
+    p_dump->line_pos = 0;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* The cycles and the core are taken with the interrupts masked, so the task is not moved */
+/* to the other core between them                                                         */
+trace_span_t Trace_Begin(trace_id_t id)
+{
+    trace_span_t span  = {0};
+    UBaseType_t  state = 0;
+
+    state      = portSET_INTERRUPT_MASK_FROM_ISR();
+    span.start = trace_GetCycles();
+    span.core  = trace_GetCore();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+    span.id    = (uint8_t)id;
+
+    return span;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The cycles, the core and the ring write are of the same core: the task is not moved and */
+/* not preempted by the other writer of the ring till the interrupts are unmasked          */
+void Trace_End(trace_span_p p_span)
+{
+    UBaseType_t state = 0;
+    uint32_t    end   = 0;
+    uint8_t     core  = 0;
+
+    state = portSET_INTERRUPT_MASK_FROM_ISR();
+    end   = trace_GetCycles();
+    core  = trace_GetCore();
+    /* The cycle counters of the cores differ, the span of the migrated task is dropped */
+    if ((core == p_span->core) && (TRACE_CORES > core))
+    {
+        trace_Record(core, p_span->id, p_span->start, end);
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Trace_DumpInit(trace_dump_p p_dump)
+{
+    uint32_t head = 0;
+    uint8_t  core = 0;
+
+    memset(p_dump, 0, sizeof(trace_dump_t));
+    for (core = 0; core < TRACE_CORES; core++)
+    {
+        head                = __atomic_load_n(&gTraceRings[core].head, __ATOMIC_ACQUIRE);
+        p_dump->end[core]   = head;
+        p_dump->index[core] = (TRACE_EVENTS < head) ? (head - TRACE_EVENTS) : 0;
+    }
+    p_dump->cycles_per_us = trace_GetCyclesPerMicro();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Trace_DumpRead(trace_dump_p p_dump, char * p_buf, size_t size)
+{
+    size_t len   = 0;
+    size_t chunk = 0;
+
+    while (len < size)
+    {
+        if (p_dump->line_pos == p_dump->line_len)
+        {
+            if (false == trace_DumpNext(p_dump))
+            {
+                break;
+            }
+        }
+        chunk = MIN((size_t)(p_dump->line_len - p_dump->line_pos), (size - len));
+        memcpy(&p_buf[len], &p_dump->line[p_dump->line_pos], chunk);
+        p_dump->line_pos += (uint16_t)chunk;
+        len              += chunk;
+    }
+
+    return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+/* Dumps by the small parts to cross the lines, the JSON over the buffer is dropped */
+static size_t trace_DumpAll(trace_dump_p p_dump, char * p_buf, size_t size)
+{
+    char   part[7] = {0};
+    size_t len     = 0;
+    size_t chunk   = 0;
+
+    do
+    {
+        chunk = Trace_DumpRead(p_dump, part, sizeof(part));
+        if ((len + chunk) < size)
+        {
+            memcpy(&p_buf[len], part, chunk);
+        }
+        len += chunk;
+    }
+    while (0 < chunk);
+    p_buf[MIN(len, (size - 1))] = '\0';
+
+    return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void Trace_Test(void)
+{
+    static trace_dump_t dump = {0};
+    static char         json[1024];
+    const char        * p_expected =
+        "{\"traceEvents\":["
+        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"CPU 0\"}},"
+        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU 1\"}}"
+        ",{\"name\":\"rgb_Process\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":5010.000,\"dur\":2.500}"
+        ",{\"name\":\"http_send\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":4999.000,\"dur\":0.004}"
+        ",{\"name\":\"bme280_Readout\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":4294967296.000,\"dur\":17895697.062}"
+        "]}";
+    trace_event_t       event  = {0};
+    uint32_t            idx    = 0;
+    size_t              len    = 0;
+    bool                result = true;
+
+    memset(gTraceRings, 0, sizeof(gTraceRings));
+
+    /* The sync at 5 ms, the span before it, the event being written and the event of the unknown ID */
+    trace_Put(&gTraceRings[0], TRACE_SYNC, 1000, 5000, 0);
+    trace_Put(&gTraceRings[0], TRACE_RGB_PROCESS, 1000 + 240 * 10, 600, 0);
+    trace_Put(&gTraceRings[0], TRACE_HTTP_SEND, 1000 - 240, 1, 0);
+    trace_Put(&gTraceRings[0], TRACE_DNS_REQUEST, 2000, 100, 0);
+    gTraceRings[0].events[3].sequence = 0;
+    trace_Put(&gTraceRings[0], TRACE_IDS, 2000, 100, 0);
+    /* The span before the first sync, the cycles wrap between the sync and the span */
+    trace_Put(&gTraceRings[1], TRACE_BME280_READOUT, 10, 0xFFFFFFFF, 0);
+    trace_Put(&gTraceRings[1], TRACE_SYNC, 0xFFFFFFF0, 0xFFFFFFFF, 0);
+    trace_Put(&gTraceRings[1], TRACE_BME280_READOUT, 0xFFFFFFF0 + 240, 0xFFFFFFFF, 0);
+
+    Trace_DumpInit(&dump);
+    dump.cycles_per_us = 240;
+    len     = trace_DumpAll(&dump, json, sizeof(json));
+    result &= ((len == strlen(p_expected)) && (0 == strcmp(json, p_expected)));
+    result &= (3 == dump.events);
+    result &= (0 == Trace_DumpRead(&dump, json, sizeof(json)));
+
+    /* The ring is overwritten: the events before the first kept sync are dropped */
+    memset(gTraceRings, 0, sizeof(gTraceRings));
+    for (idx = 0; idx < (TRACE_EVENTS + 100); idx++)
+    {
+        if (0 == (idx % TRACE_SYNC_EVENTS))
+        {
+            trace_Put(&gTraceRings[1], TRACE_SYNC, idx, idx, 1);
+        }
+        else
+        {
+            trace_Put(&gTraceRings[1], TRACE_WEBSOCKET_PARSE, idx, 1, 0);
+        }
+    }
+    Trace_DumpInit(&dump);
+    dump.cycles_per_us = 240;
+    len     = trace_DumpAll(&dump, json, sizeof(json));
+    /* The events 100..355 are kept, the first kept sync is 128 */
+    result &= ((TRACE_EVENTS + 100 - 128 - 4) == dump.events);
+    result &= (sizeof(json) < len);
+    /* The sync time over 32 bits: 2^32 + 128 us and 1 cycle */
+    result &= (NULL != strstr(json, "\"ts\":4294967424.004,"));
+
+    /* The span of the scope: the first span adds the sync */
+    memset(gTraceRings, 0, sizeof(gTraceRings));
+    {
+        TRACE_SPAN(TRACE_DNS_REQUEST);
+        for (idx = 0; idx < 1000; idx++)
+        {
+            __asm__ __volatile__("" ::: "memory");
+        }
+    }
+    idx     = trace_GetCore();
+    result &= (2 == gTraceRings[idx].head);
+    result &= ((true == trace_Load(&gTraceRings[idx], 0, &event)) && (TRACE_SYNC == event.id));
+    result &= ((true == trace_Load(&gTraceRings[idx], 1, &event)) && (TRACE_DNS_REQUEST == event.id));
+    result &= ((0 < event.value) && (TRACE_SYNC_CYCLES > event.value));
+    Trace_DumpInit(&dump);
+    len     = trace_DumpAll(&dump, json, sizeof(json));
+    result &= ((1 == dump.events) && (NULL != strstr(json, "\"dns_ProcessRequest\"")));
+    TRACE_LOGI("%s", json);
+
+    memset(gTraceRings, 0, sizeof(gTraceRings));
+    TRACE_LOGI("Trace - %s", (true == result) ? "PASS" : "FAIL");
+}
+
+//-------------------------------------------------------------------------------------------------
+
+#endif /* CONFIG_TRACE_ENABLE */
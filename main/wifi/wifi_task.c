@@ -22,6 +22,8 @@
 #include "types.h"
 #include "wifi_task.h"
 #include "udp_dns_server.h"
+#include "udp_sntp_server.h"
+#include "udp_schedule_link.h"
 #include "http_server.h"
 #include "led_task.h"
 
@@ -278,6 +280,30 @@ static void wifi_mDNS_Init(void)
 
 //-------------------------------------------------------------------------------------------------
 
+static void wifi_StationIsConnected(uint32_t ip)
+{
+#ifdef CONFIG_SNTP_SERVER_ENABLE
+    UDP_SNTP_NotifyWiFiIsConnected(ip);
+#endif
+#ifndef CONFIG_SCHEDULE_LINK_NONE
+    UDP_Link_NotifyWiFiIsConnected(ip);
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void wifi_StationIsDisconnected(void)
+{
+#ifdef CONFIG_SNTP_SERVER_ENABLE
+    UDP_SNTP_NotifyWiFiIsDisconnected();
+#endif
+#ifndef CONFIG_SCHEDULE_LINK_NONE
+    UDP_Link_NotifyWiFiIsDisconnected();
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
 static void wifi_Start(void)
 {
     esp_netif_t *       p_esp_netif  = NULL;
@@ -320,8 +346,8 @@ static void wifi_Start(void)
         memcpy(wifi_config.sta.ssid, gWiFiParams.ssid.data, gWiFiParams.ssid.length);
         memcpy(wifi_config.sta.password, gWiFiParams.pswd.data, gWiFiParams.pswd.length);
 
-        gWiFiParams.notify_connected    = NULL;
-        gWiFiParams.notify_disconnected = NULL;
+        gWiFiParams.notify_connected    = wifi_StationIsConnected;
+        gWiFiParams.notify_disconnected = wifi_StationIsDisconnected;
         gWiFiParams.count               = 7;
 
         wifi_mDNS_Init();
@@ -490,9 +516,6 @@ static bool wifi_LoadParams(wifi_params_t * p_params)
     esp_err_t     status                     = ESP_OK;
     bool          result                     = false;
 
-    status = nvs_flash_init();
-    ESP_ERROR_CHECK(status);
-
     status = nvs_open("wifi", NVS_READONLY, &h_nvs);
     if (ESP_OK == status)
     {
@@ -659,9 +682,6 @@ bool WiFi_SaveParams(wifi_string_p p_ssid, wifi_string_p p_pswd, wifi_string_p p
     nvs_handle h_nvs  = 0;
     esp_err_t  status = ESP_OK;
 
-    status = nvs_flash_init();
-    ESP_ERROR_CHECK(status);
-
     status = nvs_open("wifi", NVS_READWRITE, &h_nvs);
     ESP_ERROR_CHECK(status);
 
@@ -739,6 +759,16 @@ void WiFi_Task_Init(void)
     }
     WIFI_LOGI("Config = %d", (WIFI_BOOT_CONNECT_TO_AP != gWiFiBoot));
     HTTP_Server_Init((WIFI_BOOT_CONNECT_TO_AP != gWiFiBoot));
+    /* The enclosure is linked with the others only in station mode */
+    if (WIFI_BOOT_CONNECT_TO_AP == gWiFiBoot)
+    {
+#ifdef CONFIG_SNTP_SERVER_ENABLE
+        UDP_SNTP_Task_Init();
+#endif
+#ifndef CONFIG_SCHEDULE_LINK_NONE
+        UDP_Link_Task_Init();
+#endif
+    }
 
     /* Create the events group for WiFi task */
     gWiFiEvents = xEventGroupCreate();
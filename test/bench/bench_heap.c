@@ -0,0 +1,67 @@
+/* The heap of the host benchmarks: the linker passes malloc() and the others of the modules */
+/* to these wrappers ("-Wl,--wrap=malloc"), they call the heap hooks of "bench.c" like the   */
+/* heap of ESP-IDF does with CONFIG_HEAP_USE_HOOKS. The allocations of libc are not counted. */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_heap_caps.h"
+
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t n, size_t size);
+void * __real_realloc(void * ptr, size_t size);
+void   __real_free(void * ptr);
+
+void * __wrap_malloc(size_t size);
+void * __wrap_calloc(size_t n, size_t size);
+void * __wrap_realloc(void * ptr, size_t size);
+void   __wrap_free(void * ptr);
+
+//-------------------------------------------------------------------------------------------------
+
+void * __wrap_malloc(size_t size)
+{
+    void * ptr = __real_malloc(size);
+
+    if (NULL != ptr)
+    {
+        esp_heap_trace_alloc_hook(ptr, size, 0);
+    }
+    return ptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void * __wrap_calloc(size_t n, size_t size)
+{
+    void * ptr = __real_calloc(n, size);
+
+    if (NULL != ptr)
+    {
+        esp_heap_trace_alloc_hook(ptr, (n * size), 0);
+    }
+    return ptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void * __wrap_realloc(void * ptr, size_t size)
+{
+    void * result = __real_realloc(ptr, size);
+
+    if (NULL != result)
+    {
+        esp_heap_trace_alloc_hook(result, size, 0);
+    }
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void __wrap_free(void * ptr)
+{
+    if (NULL != ptr)
+    {
+        esp_heap_trace_free_hook(ptr);
+    }
+    __real_free(ptr);
+}
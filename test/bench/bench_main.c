@@ -0,0 +1,60 @@
+/* The host run of the benchmarks of the modules: every benchmark prints one JSON line with  */
+/* the ns per operation and the heap allocations per operation ("bench.c"), the lines go to  */
+/* stdout or to the file of the first argument, the logs of the modules go to stderr.        */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "udp_dns_server.h"
+#include "httpd.h"
+#include "climate_history.h"
+#include "led_task.h"
+#include "humidifier.h"
+
+//-------------------------------------------------------------------------------------------------
+
+static void * volatile gBenchMainPtr = NULL;
+
+//-------------------------------------------------------------------------------------------------
+
+/* Every operation allocates once, it shows the allocations of the modules are counted */
+static void bench_main_Alloc(void * p_ctx, uint32_t count)
+{
+    uint32_t idx = 0;
+
+    (void)p_ctx;
+    for (idx = 0; idx < count; idx++)
+    {
+        gBenchMainPtr = malloc(64);
+        free(gBenchMainPtr);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    bench_result_t result = {0};
+
+    if ((1 < argc) && (NULL == freopen(argv[1], "w", stdout)))
+    {
+        fprintf(stderr, "Can't open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    Bench_Run("bench", "malloc_64", bench_main_Alloc, NULL, &result);
+    if ((1000 != result.allocs) || (64000 != result.bytes))
+    {
+        fprintf(stderr, "The heap is not counted\n");
+        return EXIT_FAILURE;
+    }
+
+    UDP_DNS_Bench();
+    HTTPD_Bench();
+    Climate_History_Bench();
+    LED_Task_Bench();
+    Humidifier_Bench();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,31 @@
+/* The fuzz target of the DNS server, the module is included for its static parser.          */
+/* The invariants are of "dns_TestFuzz": the name fits its buffer and the answer follows the */
+/* question within the receive buffer.                                                       */
+#include "udp_dns_server.c"
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size);
+
+//-------------------------------------------------------------------------------------------------
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size)
+{
+    static dns_test_t test;
+    uint8_t *         p_input = NULL;
+
+    /* The datagram is received to the buffer of the task */
+    if (FUZZ_DATA_MAX < size)
+    {
+        return 0;
+    }
+
+    /* The copy is of the size of the input, so the sanitizers catch any access after it */
+    p_input = malloc(MAX(size, 1));
+    memcpy(p_input, p_data, size);
+    if (false == dns_TestFuzz(&test, p_input, (uint16_t)size))
+    {
+        abort();
+    }
+    free(p_input);
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+/* The fuzz target of the HTTP request scan, the daemon is included for its static parser.   */
+/* The invariants are of "httpd_TestFuzzRequest": the bounds of the URI and the WebSocket key*/
+/* are within the request.                                                                   */
+#include "httpd.c"
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size);
+
+//-------------------------------------------------------------------------------------------------
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size)
+{
+    uint8_t * p_input = NULL;
+
+    /* The request is not received over LWIP_HTTPD_MAX_REQ_LENGTH */
+    if (FUZZ_DATA_MAX < size)
+    {
+        return 0;
+    }
+
+    p_input = malloc(LWIP_MAX(size, 1));
+    memcpy(p_input, p_data, size);
+    if (false == httpd_TestFuzzRequest(NULL, p_input, (u16_t)size))
+    {
+        abort();
+    }
+    free(p_input);
+
+    return 0;
+}
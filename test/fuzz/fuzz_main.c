@@ -0,0 +1,169 @@
+/* The driver of the fuzz targets when libFuzzer is not there (GCC):                         */
+/*  - every file of the arguments (the directory is read by the names) is run once;          */
+/*  - then the files are the seeds of "Fuzz_Run" which mutates them "-runs=N" times;         */
+/*  - the broken invariant aborts the target, the sanitizers abort it on the bad access.     */
+/* The arguments are of libFuzzer, so ctest runs the same command with both drivers.         */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "fuzz.h"
+
+enum
+{
+    FUZZ_MAIN_SEEDS = 64,
+    FUZZ_MAIN_PATH  = 512,
+};
+
+typedef struct
+{
+    fuzz_seed_t seeds[FUZZ_MAIN_SEEDS];
+    uint8_t     data[FUZZ_MAIN_SEEDS][FUZZ_DATA_MAX];
+    uint8_t     count;
+    uint32_t    files;
+} fuzz_main_t;
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size);
+
+//-------------------------------------------------------------------------------------------------
+
+static fuzz_main_t gFuzzMain = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+static bool fuzz_main_Target(void * p_ctx, uint8_t * p_data, uint16_t size)
+{
+    (void)p_ctx;
+    (void)LLVMFuzzerTestOneInput(p_data, size);
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* Runs the file and keeps it as the seed, the seeds over the limit are run only */
+static bool fuzz_main_RunFile(const char * p_path)
+{
+    FILE *    p_file = fopen(p_path, "rb");
+    uint8_t * p_data = NULL;
+    long      size   = 0;
+
+    if (NULL == p_file)
+    {
+        printf("Can't open %s\n", p_path);
+        return false;
+    }
+    fseek(p_file, 0, SEEK_END);
+    size = ftell(p_file);
+    fseek(p_file, 0, SEEK_SET);
+
+    /* The input is of its size for the sanitizers */
+    p_data = malloc((0 < size) ? size : 1);
+    if ((NULL == p_data) || (size != (long)fread(p_data, 1, size, p_file)))
+    {
+        printf("Can't read %s\n", p_path);
+        free(p_data);
+        fclose(p_file);
+        return false;
+    }
+    fclose(p_file);
+
+    (void)LLVMFuzzerTestOneInput(p_data, (size_t)size);
+    gFuzzMain.files++;
+
+    if ((FUZZ_MAIN_SEEDS > gFuzzMain.count) && (FUZZ_DATA_MAX >= size))
+    {
+        memcpy(gFuzzMain.data[gFuzzMain.count], p_data, size);
+        gFuzzMain.seeds[gFuzzMain.count].p_data = gFuzzMain.data[gFuzzMain.count];
+        gFuzzMain.seeds[gFuzzMain.count].size   = (uint16_t)size;
+        gFuzzMain.count++;
+    }
+    free(p_data);
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static int fuzz_main_CompareNames(const void * p_a, const void * p_b)
+{
+    return strcmp(*(char * const *)p_a, *(char * const *)p_b);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The files are run by their names, so the seeds and the runs are the same every time */
+static bool fuzz_main_RunDir(const char * p_path)
+{
+    DIR *           p_dir     = opendir(p_path);
+    struct dirent * p_entry   = NULL;
+    char **         pp_names  = NULL;
+    char            path[FUZZ_MAIN_PATH];
+    size_t          count     = 0;
+    size_t          idx       = 0;
+    bool            result    = true;
+
+    if (NULL == p_dir)
+    {
+        return fuzz_main_RunFile(p_path);
+    }
+    while (NULL != (p_entry = readdir(p_dir)))
+    {
+        if ('.' != p_entry->d_name[0])
+        {
+            pp_names          = realloc(pp_names, (count + 1) * sizeof(char *));
+            pp_names[count++] = strdup(p_entry->d_name);
+        }
+    }
+    closedir(p_dir);
+
+    if (0 < count)
+    {
+        qsort(pp_names, count, sizeof(char *), fuzz_main_CompareNames);
+    }
+    for (idx = 0; idx < count; idx++)
+    {
+        (void)snprintf(path, sizeof(path), "%s/%s", p_path, pp_names[idx]);
+        result &= fuzz_main_RunFile(path);
+        free(pp_names[idx]);
+    }
+    free(pp_names);
+
+    return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    const char * p_name = strrchr(argv[0], '/');
+    uint32_t     runs   = 0;
+    bool         result = true;
+    int          idx    = 0;
+
+    p_name = (NULL != p_name) ? (p_name + 1) : argv[0];
+    for (idx = 1; idx < argc; idx++)
+    {
+        if (0 == strncmp(argv[idx], "-runs=", 6))
+        {
+            runs = (uint32_t)strtoul(&argv[idx][6], NULL, 10);
+        }
+        else if ('-' != argv[idx][0])
+        {
+            result &= fuzz_main_RunDir(argv[idx]);
+        }
+    }
+    printf("%s: %lu files\n", p_name, (unsigned long)gFuzzMain.files);
+
+    if ((0 < runs) && (0 < gFuzzMain.count))
+    {
+        (void)Fuzz_Run(p_name, gFuzzMain.seeds, gFuzzMain.count, fuzz_main_Target, NULL, runs);
+        printf("%s: %lu runs\n", p_name, (unsigned long)runs);
+    }
+
+    return (true == result) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
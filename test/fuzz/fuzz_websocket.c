@@ -0,0 +1,36 @@
+/* The fuzz target of the WebSocket frames, the daemon is included for its static parser.    */
+/* The header is parsed alone first, then the frame is unmasked and its payload is passed to */
+/* the handler which checks it is within the frame ("httpd_TestFuzzFrame").                  */
+#include "httpd.c"
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size);
+
+//-------------------------------------------------------------------------------------------------
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size)
+{
+    struct websocket_frame frame   = {0};
+    uint8_t *              p_input = NULL;
+
+    if (FUZZ_DATA_MAX < size)
+    {
+        return 0;
+    }
+
+    p_input = malloc(LWIP_MAX(size, 1));
+    memcpy(p_input, p_data, size);
+    if ((ERR_OK == websocket_parse_header(p_input, (u16_t)size, &frame)) &&
+        ((size < frame.offset) || ((size - frame.offset) < frame.len)))
+    {
+        abort();
+    }
+
+    websocket_cb = httpd_TestWsCb;
+    if (false == httpd_TestFuzzFrame(NULL, p_input, (u16_t)size))
+    {
+        abort();
+    }
+    free(p_input);
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/* The drivers of the modules which the pure logic calls on the host: the LED strips keep    */
+/* the brightness they are set to, the pixels and the profiler are not there.                */
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "led_task.h"
+#include "led_strip_rgb.h"
+#include "led_strip_uwf.h"
+#include "profiler.h"
+#include "i2c.h"
+#include "i2c_scheduler.h"
+
+typedef struct
+{
+    uint8_t u;
+    uint8_t w;
+    uint8_t f;
+} drivers_uwf_t;
+
+//-------------------------------------------------------------------------------------------------
+
+static drivers_uwf_t gDriversUwf = {0};
+
+//-------------------------------------------------------------------------------------------------
+//--- LED strips ----------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_Init(uint8_t * leds, uint16_t count)
+{
+    (void)leds;
+    (void)count;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_Update(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_SetPixelColor(uint16_t pixel, led_color_p p_color)
+{
+    (void)pixel;
+    (void)p_color;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_Rotate(bool direction)
+{
+    (void)direction;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_Clear(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_SetColor(led_color_p p_color)
+{
+    (void)p_color;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_GetAverageColor(led_color_p p_color)
+{
+    memset(p_color, 0, sizeof(*p_color));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_RGB_PowerOn(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_UWF_Init(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_U_SetBrightness(uint8_t value)
+{
+    gDriversUwf.u = value;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t LED_Strip_U_GetBrightness(void)
+{
+    return gDriversUwf.u;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_W_SetBrightness(uint8_t value)
+{
+    gDriversUwf.w = value;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t LED_Strip_W_GetBrightness(void)
+{
+    return gDriversUwf.w;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_F_SetBrightness(uint8_t value)
+{
+    gDriversUwf.f = value;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint8_t LED_Strip_F_GetBrightness(void)
+{
+    return gDriversUwf.f;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- Profiler ------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void Profiler_AddQueue(const char * p_name, QueueHandle_t queue)
+{
+    (void)p_name;
+    (void)queue;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- I2C -----------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+void I2C_Init(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+
+i2c_device_p I2C_AddDevice(i2c_device_config_t * p_config)
+{
+    (void)p_config;
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void I2C_Scheduler_AddClient(i2c_client_p p_client)
+{
+    (void)p_client;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void I2C_Scheduler_Wake(i2c_client_p p_client)
+{
+    (void)p_client;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT I2C_Tx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz)
+{
+    (void)p_dvc;
+    (void)p_tx;
+    (void)tx_sz;
+    return FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT I2C_Rx(i2c_device_p p_dvc, uint8_t * p_rx, uint8_t rx_sz)
+{
+    (void)p_dvc;
+    (void)p_rx;
+    (void)rx_sz;
+    return FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+FW_RESULT I2C_TxRx(i2c_device_p p_dvc, uint8_t * p_tx, uint8_t tx_sz, uint8_t * p_rx, uint8_t rx_sz)
+{
+    (void)p_dvc;
+    (void)p_tx;
+    (void)tx_sz;
+    (void)p_rx;
+    (void)rx_sz;
+    return FW_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void I2C_Recover(void)
+{
+}
@@ -0,0 +1,25 @@
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef enum
+{
+    GPIO_MODE_DISABLE = 0,
+    GPIO_MODE_INPUT   = 1,
+    GPIO_MODE_OUTPUT  = 2,
+} gpio_mode_t;
+
+typedef struct
+{
+    uint64_t    pin_bit_mask;
+    gpio_mode_t mode;
+} gpio_config_t;
+
+/* The pins are not there on the host */
+esp_err_t gpio_config(const gpio_config_t * pGPIOConfig);
+esp_err_t gpio_set_level(int gpio_num, uint32_t level);
+
+#endif /* __GPIO_H__ */
@@ -0,0 +1,24 @@
+#ifndef __I2C_MASTER_H__
+#define __I2C_MASTER_H__
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef void * i2c_master_bus_handle_t;
+typedef void * i2c_master_dev_handle_t;
+
+typedef enum
+{
+    I2C_ADDR_BIT_LEN_7 = 0,
+} i2c_addr_bit_len_t;
+
+typedef struct
+{
+    i2c_addr_bit_len_t dev_addr_length;
+    uint16_t           device_address;
+    uint32_t           scl_speed_hz;
+    uint32_t           scl_wait_us;
+} i2c_device_config_t;
+
+#endif /* __I2C_MASTER_H__ */
@@ -0,0 +1,9 @@
+#ifndef __ESP_ATTR_H__
+#define __ESP_ATTR_H__
+
+/* The host has the single memory */
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_NOINIT_ATTR
+
+#endif /* __ESP_ATTR_H__ */
@@ -0,0 +1,9 @@
+#ifndef __ESP_CPU_H__
+#define __ESP_CPU_H__
+
+#include <stdint.h>
+
+/* The cycles of the host are its nanoseconds */
+uint32_t esp_cpu_get_cycle_count(void);
+
+#endif /* __ESP_CPU_H__ */
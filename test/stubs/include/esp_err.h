@@ -0,0 +1,13 @@
+#ifndef __ESP_ERR_H__
+#define __ESP_ERR_H__
+
+#include <stdint.h>
+#include <assert.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK                 0
+#define ESP_FAIL               -1
+#define ESP_ERROR_CHECK(x)     assert(ESP_OK == (x))
+
+#endif /* __ESP_ERR_H__ */
@@ -0,0 +1,6 @@
+#ifndef __ESP_EVENT_H__
+#define __ESP_EVENT_H__
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __ESP_EVENT_H__ */
@@ -0,0 +1,17 @@
+#ifndef __ESP_HEAP_CAPS_H__
+#define __ESP_HEAP_CAPS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT    (1 << 2)
+#define MALLOC_CAP_SPIRAM  (1 << 10)
+
+/* The host has the single heap, the capabilities are not checked */
+void * heap_caps_calloc_prefer(size_t n, size_t size, size_t num, ...);
+
+/* The heap hooks of the benchmarks ("bench.c"), the host calls them from the wrappers of malloc() */
+void   esp_heap_trace_alloc_hook(void * ptr, size_t size, uint32_t caps);
+void   esp_heap_trace_free_hook(void * ptr);
+
+#endif /* __ESP_HEAP_CAPS_H__ */
@@ -0,0 +1,13 @@
+#ifndef __ESP_LOG_H__
+#define __ESP_LOG_H__
+
+#include <stdio.h>
+
+/* The host log goes to stderr, stdout is left for the results */
+#define ESP_LOGE(tag, format, ...)  fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  fprintf(stderr, "W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  fprintf(stderr, "I %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)
+#define ESP_LOGV(tag, format, ...)
+
+#endif /* __ESP_LOG_H__ */
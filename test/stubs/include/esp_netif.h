@@ -0,0 +1,6 @@
+#ifndef __ESP_NETIF_H__
+#define __ESP_NETIF_H__
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __ESP_NETIF_H__ */
@@ -0,0 +1,11 @@
+#ifndef __ESP_SYSTEM_H__
+#define __ESP_SYSTEM_H__
+
+#include <stdint.h>
+
+#include "esp_attr.h"
+
+/* The host heap is not measured */
+uint32_t esp_get_free_heap_size(void);
+
+#endif /* __ESP_SYSTEM_H__ */
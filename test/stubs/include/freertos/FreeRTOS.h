@@ -0,0 +1,27 @@
+#ifndef __FREERTOS_H__
+#define __FREERTOS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sdkconfig.h"
+
+/* The host has the single thread, the types and the constants are enough to build the modules */
+typedef int32_t    BaseType_t;
+typedef uint32_t   UBaseType_t;
+typedef uint32_t   TickType_t;
+
+#define pdFALSE                  ((BaseType_t)0)
+#define pdTRUE                   ((BaseType_t)1)
+#define pdPASS                   (pdTRUE)
+#define pdFAIL                   (pdFALSE)
+#define portMAX_DELAY            ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS       ((TickType_t)1000 / CONFIG_FREERTOS_HZ)
+#define pdMS_TO_TICKS(ms)        ((TickType_t)(((TickType_t)(ms) * CONFIG_FREERTOS_HZ) / 1000))
+#define tskNO_AFFINITY           (0x7FFFFFFF)
+
+#define portSET_INTERRUPT_MASK_FROM_ISR()       (0)
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)    ((void)(x))
+
+#endif /* __FREERTOS_H__ */
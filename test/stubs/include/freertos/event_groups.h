@@ -0,0 +1,21 @@
+#ifndef __EVENT_GROUPS_H__
+#define __EVENT_GROUPS_H__
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *   EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+#define BIT0  (0x00000001)
+#define BIT1  (0x00000002)
+#define BIT2  (0x00000004)
+#define BIT3  (0x00000008)
+
+EventGroupHandle_t xEventGroupCreate(void);
+EventBits_t        xEventGroupWaitBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToWaitFor,
+                                       const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits,
+                                       TickType_t xTicksToWait);
+EventBits_t        xEventGroupSetBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet);
+EventBits_t        xEventGroupClearBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear);
+
+#endif /* __EVENT_GROUPS_H__ */
@@ -0,0 +1,13 @@
+#ifndef __QUEUE_H__
+#define __QUEUE_H__
+
+#include "freertos/FreeRTOS.h"
+
+/* The host has the single thread, the queues are always empty */
+typedef void * QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize);
+BaseType_t    xQueueSendToBack(QueueHandle_t xQueue, const void * pvItemToQueue, TickType_t xTicksToWait);
+BaseType_t    xQueueReceive(QueueHandle_t xQueue, void * pvBuffer, TickType_t xTicksToWait);
+
+#endif /* __QUEUE_H__ */
@@ -0,0 +1,8 @@
+#ifndef __RINGBUF_H__
+#define __RINGBUF_H__
+
+#include "freertos/FreeRTOS.h"
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __RINGBUF_H__ */
@@ -0,0 +1,13 @@
+#ifndef __SEMPHR_H__
+#define __SEMPHR_H__
+
+#include "freertos/FreeRTOS.h"
+
+/* The host has the single thread, the mutex is always taken */
+typedef void * SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t xSemaphore);
+
+#endif /* __SEMPHR_H__ */
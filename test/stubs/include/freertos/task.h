@@ -0,0 +1,18 @@
+#ifndef __TASK_H__
+#define __TASK_H__
+
+#include "freertos/FreeRTOS.h"
+
+typedef void * TaskHandle_t;
+typedef void (* TaskFunction_t)(void * pvParameters);
+
+/* The tasks are not started on the host */
+BaseType_t   xTaskCreatePinnedToCore(TaskFunction_t pxTaskCode, const char * pcName, uint32_t usStackDepth,
+                                     void * pvParameters, UBaseType_t uxPriority, TaskHandle_t * pxCreatedTask,
+                                     BaseType_t xCoreID);
+void         vTaskDelete(TaskHandle_t xTaskToDelete);
+void         vTaskDelay(TickType_t xTicksToDelay);
+TickType_t   xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+#endif /* __TASK_H__ */
@@ -0,0 +1,6 @@
+#ifndef __LED_STRIP_H__
+#define __LED_STRIP_H__
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __LED_STRIP_H__ */
@@ -0,0 +1,6 @@
+#ifndef __LWIP_DEBUG_H__
+#define __LWIP_DEBUG_H__
+
+#include "lwip/opt.h"
+
+#endif /* __LWIP_DEBUG_H__ */
@@ -0,0 +1,10 @@
+#ifndef __LWIP_MEM_H__
+#define __LWIP_MEM_H__
+
+#include "lwip/opt.h"
+
+/* The heap of lwIP is the host heap */
+void * mem_malloc(mem_size_t size);
+void   mem_free(void * rmem);
+
+#endif /* __LWIP_MEM_H__ */
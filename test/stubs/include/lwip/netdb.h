@@ -0,0 +1,6 @@
+#ifndef __NETDB_H__
+#define __NETDB_H__
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __NETDB_H__ */
@@ -0,0 +1,49 @@
+#ifndef __LWIP_OPT_H__
+#define __LWIP_OPT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "sdkconfig.h"
+
+/* The types and the options of lwIP the modules are built with, the values are of "sdkconfig" */
+typedef uint8_t   u8_t;
+typedef int8_t    s8_t;
+typedef uint16_t  u16_t;
+typedef int16_t   s16_t;
+typedef uint32_t  u32_t;
+typedef int32_t   s32_t;
+typedef size_t    mem_size_t;
+
+#define U16_F                    PRIu16
+#define S16_F                    PRId16
+#define X16_F                    PRIx16
+#define U32_F                    PRIu32
+#define S32_F                    PRId32
+#define X32_F                    PRIx32
+#define SZT_F                    "zu"
+
+#define LWIP_TCP                 1
+#define TCP_MSS                  1440
+#define TCP_SND_BUF              5760
+#define TCP_SND_QUEUELEN         ((4 * TCP_SND_BUF + (TCP_MSS - 1)) / TCP_MSS)
+#define TCP_OVERSIZE             TCP_MSS
+#define PBUF_POOL_BUFSIZE        1536
+
+#define LWIP_MIN(x, y)           (((x) < (y)) ? (x) : (y))
+#define LWIP_MAX(x, y)           (((x) > (y)) ? (x) : (y))
+#define LWIP_UNUSED_ARG(x)       (void)(x)
+#define MEMCPY(dst, src, len)    memcpy(dst, src, len)
+
+#define LWIP_DBG_OFF             0x00
+#define LWIP_DBG_ON              0x80
+#define LWIP_DBG_TRACE           0x40
+#define LWIP_DEBUGF(debug, message)
+#define LWIP_ASSERT(message, assertion)  assert(assertion)
+
+#include <assert.h>
+
+#endif /* __LWIP_OPT_H__ */
@@ -0,0 +1,23 @@
+#ifndef __LWIP_PBUF_H__
+#define __LWIP_PBUF_H__
+
+#include "lwip/err.h"
+
+struct pbuf
+{
+    struct pbuf * next;
+    void *        payload;
+    u16_t         tot_len;
+    u16_t         len;
+    u8_t          type_internal;
+    u8_t          flags;
+    u16_t         ref;
+};
+
+u8_t  pbuf_free(struct pbuf * p);
+u16_t pbuf_clen(const struct pbuf * p);
+void  pbuf_cat(struct pbuf * head, struct pbuf * tail);
+u8_t  pbuf_header(struct pbuf * p, s16_t header_size);
+u16_t pbuf_copy_partial(const struct pbuf * p, void * dataptr, u16_t len, u16_t offset);
+
+#endif /* __LWIP_PBUF_H__ */
@@ -0,0 +1,16 @@
+#ifndef __LWIP_TCP_PRIV_H__
+#define __LWIP_TCP_PRIV_H__
+
+#include "lwip/tcp.h"
+
+/* The segment queued by the stub of tcp_write(), the pbuf is allocated with its data */
+struct tcp_seg
+{
+    struct tcp_seg * next;
+    struct pbuf *    p;
+    u16_t            len;
+};
+
+void tcp_segs_free(struct tcp_seg * seg);
+
+#endif /* __LWIP_TCP_PRIV_H__ */
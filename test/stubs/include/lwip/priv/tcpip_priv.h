@@ -0,0 +1,16 @@
+#ifndef __LWIP_TCPIP_PRIV_H__
+#define __LWIP_TCPIP_PRIV_H__
+
+#include "lwip/err.h"
+
+/* The host has no TCP thread, the call is run by the caller */
+struct tcpip_api_call_data
+{
+    err_t err;
+};
+
+typedef err_t (* tcpip_api_call_fn)(struct tcpip_api_call_data * call);
+
+err_t tcpip_api_call(tcpip_api_call_fn fn, struct tcpip_api_call_data * call);
+
+#endif /* __LWIP_TCPIP_PRIV_H__ */
@@ -0,0 +1,14 @@
+#ifndef __SOCKETS_H__
+#define __SOCKETS_H__
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+/* The host sockets, lwIP names them the other way */
+#define closesocket(s)                   close(s)
+#define inet_ntoa_r(addr, buf, buflen)   inet_ntop(AF_INET, &(addr), (buf), (buflen))
+
+#endif /* __SOCKETS_H__ */
@@ -0,0 +1,6 @@
+#ifndef __LWIP_STATS_H__
+#define __LWIP_STATS_H__
+
+#include "lwip/opt.h"
+
+#endif /* __LWIP_STATS_H__ */
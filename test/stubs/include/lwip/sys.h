@@ -0,0 +1,6 @@
+#ifndef __SYS_H__
+#define __SYS_H__
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __SYS_H__ */
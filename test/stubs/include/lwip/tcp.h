@@ -0,0 +1,89 @@
+#ifndef __LWIP_TCP_H__
+#define __LWIP_TCP_H__
+
+#include "lwip/err.h"
+#include "lwip/pbuf.h"
+#include "lwip/mem.h"
+
+#define TCP_WRITE_FLAG_COPY  0x01
+#define TCP_WRITE_FLAG_MORE  0x02
+#define TCP_PRIO_MIN         1
+#define TCP_PRIO_NORMAL      64
+#define TCP_PRIO_MAX         127
+
+enum tcp_state
+{
+    CLOSED      = 0,
+    LISTEN      = 1,
+    SYN_SENT    = 2,
+    SYN_RCVD    = 3,
+    ESTABLISHED = 4,
+    FIN_WAIT_1  = 5,
+    FIN_WAIT_2  = 6,
+    CLOSE_WAIT  = 7,
+    CLOSING     = 8,
+    LAST_ACK    = 9,
+    TIME_WAIT   = 10,
+};
+
+typedef struct
+{
+    u32_t addr;
+} ip_addr_t;
+
+extern const ip_addr_t ip_addr_any;
+#define IP_ADDR_ANY          (&ip_addr_any)
+
+struct tcp_pcb;
+struct tcp_seg;
+
+typedef err_t (* tcp_accept_fn)(void * arg, struct tcp_pcb * newpcb, err_t err);
+typedef err_t (* tcp_recv_fn)(void * arg, struct tcp_pcb * tpcb, struct pbuf * p, err_t err);
+typedef err_t (* tcp_sent_fn)(void * arg, struct tcp_pcb * tpcb, u16_t len);
+typedef err_t (* tcp_poll_fn)(void * arg, struct tcp_pcb * tpcb);
+typedef void  (* tcp_err_fn)(void * arg, err_t err);
+
+/* The fields the modules read, the queue is counted by the stub of tcp_write() */
+struct tcp_pcb
+{
+    enum tcp_state   state;
+    void *           callback_arg;
+    struct tcp_seg * unsent;
+    u16_t            snd_buf;
+    u16_t            snd_queuelen;
+    u16_t            mss;
+    u16_t            unsent_oversize;
+    u8_t             prio;
+};
+
+struct tcp_pcb_listen
+{
+    enum tcp_state state;
+};
+
+#define tcp_sndbuf(pcb)          ((pcb)->snd_buf)
+#define tcp_sndqueuelen(pcb)     ((pcb)->snd_queuelen)
+#define tcp_mss(pcb)             ((pcb)->mss)
+#define tcp_accepted(pcb)        LWIP_UNUSED_ARG(pcb)
+#define tcp_listen(pcb)          tcp_listen_with_backlog(pcb, 0xFF)
+
+struct tcp_pcb * tcp_new(void);
+struct tcp_pcb * tcp_listen_with_backlog(struct tcp_pcb * pcb, u8_t backlog);
+err_t            tcp_bind(struct tcp_pcb * pcb, const ip_addr_t * ipaddr, u16_t port);
+void             tcp_arg(struct tcp_pcb * pcb, void * arg);
+void             tcp_accept(struct tcp_pcb * pcb, tcp_accept_fn accept);
+void             tcp_recv(struct tcp_pcb * pcb, tcp_recv_fn recv);
+void             tcp_sent(struct tcp_pcb * pcb, tcp_sent_fn sent);
+void             tcp_poll(struct tcp_pcb * pcb, tcp_poll_fn poll, u8_t interval);
+void             tcp_err(struct tcp_pcb * pcb, tcp_err_fn err);
+void             tcp_setprio(struct tcp_pcb * pcb, u8_t prio);
+void             tcp_recved(struct tcp_pcb * pcb, u16_t len);
+err_t            tcp_write(struct tcp_pcb * pcb, const void * dataptr, u16_t len, u8_t apiflags);
+err_t            tcp_output(struct tcp_pcb * pcb);
+err_t            tcp_close(struct tcp_pcb * pcb);
+void             tcp_abort(struct tcp_pcb * pcb);
+const char *     tcp_debug_state_str(enum tcp_state s);
+
+u32_t            sys_now(void);
+
+#endif /* __LWIP_TCP_H__ */
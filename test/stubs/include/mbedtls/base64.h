@@ -0,0 +1,10 @@
+#ifndef __MBEDTLS_BASE64_H__
+#define __MBEDTLS_BASE64_H__
+
+#include <stddef.h>
+
+#define MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL  -0x002A
+
+int mbedtls_base64_encode(unsigned char * dst, size_t dlen, size_t * olen, const unsigned char * src, size_t slen);
+
+#endif /* __MBEDTLS_BASE64_H__ */
@@ -0,0 +1,8 @@
+#ifndef __MBEDTLS_SHA1_H__
+#define __MBEDTLS_SHA1_H__
+
+#include <stddef.h>
+
+int mbedtls_sha1(const unsigned char * input, size_t ilen, unsigned char output[20]);
+
+#endif /* __MBEDTLS_SHA1_H__ */
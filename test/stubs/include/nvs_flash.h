@@ -0,0 +1,6 @@
+#ifndef __NVS_FLASH_H__
+#define __NVS_FLASH_H__
+
+/* Nothing of it is used by the pure logic */
+
+#endif /* __NVS_FLASH_H__ */
@@ -0,0 +1,13 @@
+#ifndef __SDKCONFIG_H__
+#define __SDKCONFIG_H__
+
+/* The host build has the defaults of "sdkconfig" which the pure logic depends on */
+#define CONFIG_FREERTOS_NUMBER_OF_CORES  2
+#define CONFIG_FREERTOS_HZ               100
+#define CONFIG_CLIMATE_HISTORY_DAYS      7
+#define CONFIG_HUMIDIFIER_POWER_GPIO     5
+#define CONFIG_HUMIDIFIER_BUTTON_GPIO    32
+/* The heap of the benchmarks is counted by the wrappers of malloc() ("test/bench") */
+#define CONFIG_BENCH_ENABLE              1
+
+#endif /* __SDKCONFIG_H__ */
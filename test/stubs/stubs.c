@@ -0,0 +1,637 @@
+/* The calls of ESP-IDF, FreeRTOS, lwIP and mbedTLS which the modules make on the host,      */
+/* the drivers of the modules are in "drivers.c":                                            */
+/*  - the tasks are not started and the events are not waited, the host runs the logic only; */
+/*  - the heap of lwIP is the host heap, the segments are queued on the pcb as lwIP does;    */
+/*  - the calls of the TCP thread are run by the caller;                                     */
+/*  - the file system and the crypto are not there, the calls fail.                          */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "driver/gpio.h"
+#include "lwip/tcp.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "mbedtls/sha1.h"
+#include "mbedtls/base64.h"
+#include "fs.h"
+
+//-------------------------------------------------------------------------------------------------
+//--- FreeRTOS ------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pxTaskCode, const char * pcName, uint32_t usStackDepth,
+                                   void * pvParameters, UBaseType_t uxPriority, TaskHandle_t * pxCreatedTask,
+                                   BaseType_t xCoreID)
+{
+    (void)pxTaskCode;
+    (void)pcName;
+    (void)usStackDepth;
+    (void)pvParameters;
+    (void)uxPriority;
+    (void)pxCreatedTask;
+    (void)xCoreID;
+    return pdFAIL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void vTaskDelete(TaskHandle_t xTaskToDelete)
+{
+    (void)xTaskToDelete;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void vTaskDelay(TickType_t xTicksToDelay)
+{
+    (void)xTicksToDelay;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)pdMS_TO_TICKS(sys_now());
+}
+
+//-------------------------------------------------------------------------------------------------
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    return calloc(1, sizeof(EventBits_t));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToWaitFor,
+                                const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits,
+                                TickType_t xTicksToWait)
+{
+    (void)uxBitsToWaitFor;
+    (void)xClearOnExit;
+    (void)xWaitForAllBits;
+    (void)xTicksToWait;
+    return (NULL != xEventGroup) ? *(EventBits_t *)xEventGroup : 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet)
+{
+    if (NULL != xEventGroup)
+    {
+        *(EventBits_t *)xEventGroup |= uxBitsToSet;
+    }
+    return xEventGroupWaitBits(xEventGroup, 0, pdFALSE, pdFALSE, 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear)
+{
+    EventBits_t bits = xEventGroupWaitBits(xEventGroup, 0, pdFALSE, pdFALSE, 0);
+
+    if (NULL != xEventGroup)
+    {
+        *(EventBits_t *)xEventGroup &= ~uxBitsToClear;
+    }
+    return bits;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return calloc(1, sizeof(BaseType_t));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+    (void)xBlockTime;
+    return (NULL != xSemaphore) ? pdTRUE : pdFALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    return (NULL != xSemaphore) ? pdTRUE : pdFALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+    (void)uxQueueLength;
+    (void)uxItemSize;
+    return calloc(1, sizeof(UBaseType_t));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void * pvItemToQueue, TickType_t xTicksToWait)
+{
+    (void)xQueue;
+    (void)pvItemToQueue;
+    (void)xTicksToWait;
+    return pdFAIL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void * pvBuffer, TickType_t xTicksToWait)
+{
+    (void)xQueue;
+    (void)pvBuffer;
+    (void)xTicksToWait;
+    return pdFALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- ESP-IDF -------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+int64_t esp_timer_get_time(void)
+{
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000 + (int64_t)ts.tv_nsec / 1000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+uint32_t esp_get_free_heap_size(void)
+{
+    return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void * heap_caps_calloc_prefer(size_t n, size_t size, size_t num, ...)
+{
+    (void)num;
+    return calloc(n, size);
+}
+
+uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+esp_err_t gpio_config(const gpio_config_t * pGPIOConfig)
+{
+    (void)pGPIOConfig;
+    return ESP_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+esp_err_t gpio_set_level(int gpio_num, uint32_t level)
+{
+    (void)gpio_num;
+    (void)level;
+    return ESP_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- lwIP ----------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+const ip_addr_t ip_addr_any = {0};
+
+//-------------------------------------------------------------------------------------------------
+
+u32_t sys_now(void)
+{
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+const char * lwip_strerr(err_t err)
+{
+    (void)err;
+    return "err";
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void * mem_malloc(mem_size_t size)
+{
+    return malloc(size);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void mem_free(void * rmem)
+{
+    free(rmem);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+u8_t pbuf_free(struct pbuf * p)
+{
+    (void)p;
+    return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+u16_t pbuf_clen(const struct pbuf * p)
+{
+    u16_t count = 0;
+
+    for (; NULL != p; p = p->next)
+    {
+        count++;
+    }
+    return count;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void pbuf_cat(struct pbuf * head, struct pbuf * tail)
+{
+    for (; NULL != head->next; head = head->next)
+    {
+        head->tot_len += tail->tot_len;
+    }
+    head->tot_len += tail->tot_len;
+    head->next     = tail;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+u8_t pbuf_header(struct pbuf * p, s16_t header_size)
+{
+    (void)p;
+    (void)header_size;
+    return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+u16_t pbuf_copy_partial(const struct pbuf * p, void * dataptr, u16_t len, u16_t offset)
+{
+    u16_t copied = 0;
+    u16_t part   = 0;
+
+    for (; (NULL != p) && (copied < len); p = p->next)
+    {
+        if (offset >= p->len)
+        {
+            offset -= p->len;
+            continue;
+        }
+        part = LWIP_MIN((u16_t)(p->len - offset), (u16_t)(len - copied));
+        memcpy(&((u8_t *)dataptr)[copied], &((const u8_t *)p->payload)[offset], part);
+        copied += part;
+        offset  = 0;
+    }
+    return copied;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The pcb is connected to nothing, it is written by the benchmarks only */
+struct tcp_pcb * tcp_new(void)
+{
+    struct tcp_pcb * pcb = calloc(1, sizeof(struct tcp_pcb));
+
+    if (NULL != pcb)
+    {
+        pcb->snd_buf = TCP_SND_BUF;
+        pcb->mss     = TCP_MSS;
+        pcb->prio    = TCP_PRIO_NORMAL;
+    }
+    return pcb;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+struct tcp_pcb * tcp_listen_with_backlog(struct tcp_pcb * pcb, u8_t backlog)
+{
+    (void)backlog;
+    return pcb;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+err_t tcp_bind(struct tcp_pcb * pcb, const ip_addr_t * ipaddr, u16_t port)
+{
+    (void)pcb;
+    (void)ipaddr;
+    (void)port;
+    return ERR_USE;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_arg(struct tcp_pcb * pcb, void * arg)
+{
+    if (NULL != pcb)
+    {
+        pcb->callback_arg = arg;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_accept(struct tcp_pcb * pcb, tcp_accept_fn accept)
+{
+    (void)pcb;
+    (void)accept;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_recv(struct tcp_pcb * pcb, tcp_recv_fn recv)
+{
+    (void)pcb;
+    (void)recv;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_sent(struct tcp_pcb * pcb, tcp_sent_fn sent)
+{
+    (void)pcb;
+    (void)sent;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_poll(struct tcp_pcb * pcb, tcp_poll_fn poll, u8_t interval)
+{
+    (void)pcb;
+    (void)poll;
+    (void)interval;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_err(struct tcp_pcb * pcb, tcp_err_fn err)
+{
+    (void)pcb;
+    (void)err;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_setprio(struct tcp_pcb * pcb, u8_t prio)
+{
+    if (NULL != pcb)
+    {
+        pcb->prio = prio;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_recved(struct tcp_pcb * pcb, u16_t len)
+{
+    (void)pcb;
+    (void)len;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The data is queued as lwIP does it with TCP_OVERSIZE, so the heap churn is of the device: */
+/*  - the copy fills the room left in the last segment first;                                */
+/*  - every new segment takes the segment and the pbuf with its data from the heap, the room */
+/*    of the MSS is allocated when more data follows (TCP_WRITE_FLAG_MORE);                  */
+/*  - the data which is not copied is referenced by the pbuf.                                */
+err_t tcp_write(struct tcp_pcb * pcb, const void * dataptr, u16_t len, u8_t apiflags)
+{
+    const u8_t *     p_data = (const u8_t *)dataptr;
+    struct tcp_seg * p_last = NULL;
+    struct tcp_seg * p_seg  = NULL;
+    struct pbuf *    p_pbuf = NULL;
+    u16_t            pos    = 0;
+    u16_t            part   = 0;
+    u16_t            alloc  = 0;
+
+    if ((NULL == pcb) || (NULL == dataptr) || (ESTABLISHED != pcb->state))
+    {
+        return ERR_CONN;
+    }
+    if ((len > pcb->snd_buf) || (TCP_SND_QUEUELEN <= pcb->snd_queuelen))
+    {
+        return ERR_MEM;
+    }
+
+    for (p_last = pcb->unsent; (NULL != p_last) && (NULL != p_last->next); p_last = p_last->next)
+    {
+    }
+    if ((NULL != p_last) && (0 < pcb->unsent_oversize) && (0 != (apiflags & TCP_WRITE_FLAG_COPY)))
+    {
+        part = LWIP_MIN(len, pcb->unsent_oversize);
+        memcpy(&((u8_t *)p_last->p->payload)[p_last->len], p_data, part);
+        p_last->len          += part;
+        p_last->p->len       += part;
+        p_last->p->tot_len   += part;
+        pcb->unsent_oversize -= part;
+        pos                   = part;
+    }
+
+    while (pos < len)
+    {
+        part   = LWIP_MIN((u16_t)(len - pos), pcb->mss);
+        alloc  = (0 == (apiflags & TCP_WRITE_FLAG_COPY)) ? 0 :
+                 (0 != (apiflags & TCP_WRITE_FLAG_MORE)) ? pcb->mss : part;
+        p_seg  = malloc(sizeof(struct tcp_seg));
+        p_pbuf = malloc(sizeof(struct pbuf) + alloc);
+        if ((NULL == p_seg) || (NULL == p_pbuf))
+        {
+            free(p_seg);
+            free(p_pbuf);
+            return ERR_MEM;
+        }
+        memset(p_pbuf, 0, sizeof(struct pbuf));
+        if (0 < alloc)
+        {
+            p_pbuf->payload = &p_pbuf[1];
+            memcpy(p_pbuf->payload, &p_data[pos], part);
+        }
+        else
+        {
+            p_pbuf->payload = (void *)&p_data[pos];
+        }
+        p_pbuf->len     = part;
+        p_pbuf->tot_len = part;
+        p_pbuf->ref     = 1;
+        p_seg->next     = NULL;
+        p_seg->p        = p_pbuf;
+        p_seg->len      = part;
+
+        if (NULL == p_last)
+        {
+            pcb->unsent = p_seg;
+        }
+        else
+        {
+            p_last->next = p_seg;
+        }
+        p_last               = p_seg;
+        pcb->unsent_oversize = (0 < alloc) ? (u16_t)(alloc - part) : 0;
+        pcb->snd_queuelen++;
+        pos += part;
+    }
+    pcb->snd_buf -= len;
+
+    return ERR_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/* The queue is sent and acknowledged at once */
+err_t tcp_output(struct tcp_pcb * pcb)
+{
+    if (NULL != pcb)
+    {
+        tcp_segs_free(pcb->unsent);
+        pcb->unsent          = NULL;
+        pcb->unsent_oversize = 0;
+        pcb->snd_buf         = TCP_SND_BUF;
+        pcb->snd_queuelen    = 0;
+    }
+    return ERR_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+err_t tcp_close(struct tcp_pcb * pcb)
+{
+    if (NULL != pcb)
+    {
+        tcp_segs_free(pcb->unsent);
+    }
+    free(pcb);
+    return ERR_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_abort(struct tcp_pcb * pcb)
+{
+    (void)tcp_close(pcb);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void tcp_segs_free(struct tcp_seg * seg)
+{
+    struct tcp_seg * next = NULL;
+
+    for (; NULL != seg; seg = next)
+    {
+        next = seg->next;
+        free(seg->p);
+        free(seg);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+const char * tcp_debug_state_str(enum tcp_state s)
+{
+    (void)s;
+    return "state";
+}
+
+//-------------------------------------------------------------------------------------------------
+
+err_t tcpip_api_call(tcpip_api_call_fn fn, struct tcpip_api_call_data * call)
+{
+    call->err = fn(call);
+    return call->err;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- mbedTLS -------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+int mbedtls_sha1(const unsigned char * input, size_t ilen, unsigned char output[20])
+{
+    (void)input;
+    (void)ilen;
+    memset(output, 0, 20);
+    return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int mbedtls_base64_encode(unsigned char * dst, size_t dlen, size_t * olen, const unsigned char * src, size_t slen)
+{
+    (void)dst;
+    (void)dlen;
+    (void)src;
+    (void)slen;
+    *olen = 0;
+    return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+}
+
+//-------------------------------------------------------------------------------------------------
+//--- File system ---------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+err_t fs_open(struct fs_file * file, const char * name)
+{
+    (void)file;
+    (void)name;
+    return ERR_VAL;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void fs_close(struct fs_file * file)
+{
+    (void)file;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int fs_read(struct fs_file * file, char * buffer, int count)
+{
+    (void)file;
+    (void)buffer;
+    (void)count;
+    return -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+int fs_bytes_left(struct fs_file * file)
+{
+    (void)file;
+    return 0;
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+SNTP client to check the time served by the enclosure (CONFIG_SNTP_SERVER_ENABLE).
+
+Usage:
+    sntp_client.py <host> [--port PORT] [--count COUNT] [--interval SECONDS]
+
+The clock offset and the round-trip delay are calculated as in RFC 4330:
+    offset = ((T2 - T1) + (T3 - T4)) / 2
+    delay  = (T4 - T1) - (T3 - T2)
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+EPOCH_OFFSET = 2208988800
+PACKET = struct.Struct('>BBbbIII8s8s8s8s')
+MODE_CLIENT = 3
+MODE_SERVER = 4
+
+
+def to_ntp(t):
+    seconds = int(t)
+    fraction = int((t - seconds) * (1 << 32)) & 0xFFFFFFFF
+    return struct.pack('>II', (seconds + EPOCH_OFFSET) & 0xFFFFFFFF, fraction)
+
+
+def from_ntp(data):
+    seconds, fraction = struct.unpack('>II', data)
+    return seconds - EPOCH_OFFSET + fraction / float(1 << 32)
+
+
+def query(host, port, timeout=1.0):
+    """Returns (offset, delay, stratum) in seconds or raises socket.timeout."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(timeout)
+    try:
+        t1 = time.time()
+        request = PACKET.pack((4 << 3) | MODE_CLIENT, 0, 6, 0, 0, 0, 0,
+                              bytes(8), bytes(8), bytes(8), to_ntp(t1))
+        sock.sendto(request, (host, port))
+        data, _ = sock.recvfrom(512)
+        t4 = time.time()
+    finally:
+        sock.close()
+
+    if len(data) < PACKET.size:
+        raise ValueError('Short response: %d bytes' % len(data))
+    fields = PACKET.unpack_from(data)
+    if (fields[0] & 0x07) != MODE_SERVER:
+        raise ValueError('Not a server response')
+    if fields[8] != request[40:48]:
+        raise ValueError('Originate timestamp mismatch')
+    t2 = from_ntp(fields[9])
+    t3 = from_ntp(fields[10])
+    offset = ((t2 - t1) + (t3 - t4)) / 2
+    delay = (t4 - t1) - (t3 - t2)
+    return offset, delay, fields[1]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('host')
+    parser.add_argument('--port', type=int, default=123)
+    parser.add_argument('--count', type=int, default=1)
+    parser.add_argument('--interval', type=float, default=1.0)
+    args = parser.parse_args()
+
+    failed = 0
+    for idx in range(args.count):
+        if idx:
+            time.sleep(args.interval)
+        try:
+            offset, delay, stratum = query(args.host, args.port)
+            print('offset %+9.3f ms  delay %7.3f ms  stratum %d' % (offset * 1000, delay * 1000, stratum))
+        except (socket.timeout, ValueError) as error:
+            print('no response: %s' % (error or 'timeout'))
+            failed += 1
+    return 1 if failed == args.count else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
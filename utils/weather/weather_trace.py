@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+Encoder/decoder of the weather trace image for the "weather" flash partition.
+
+The trace consists of records per slot (10 minutes by default):
+    cloud cover (%), temperature target (C, 0.5 C step), humidity target (%).
+
+Usage:
+    weather_trace.py encode <trace.csv> <weather.bin> [--slot MINUTES]
+    weather_trace.py synth <weather.bin> [--days DAYS] [--seed SEED]
+    weather_trace.py decode <weather.bin> [<trace.csv>]
+    weather_trace.py test
+
+The CSV file has one record per line: "cloud,temperature,humidity".
+The image is flashed to the "weather" partition by "idf.py flash" when
+"weather.bin" is placed in the project directory.
+"""
+
+import argparse
+import csv
+import math
+import random
+import struct
+import sys
+import zlib
+
+MAGIC = 0x52485457
+VERSION = 1
+RECORD_SIZE = 3
+HEADER = struct.Struct('<IBBBBII')
+RECORD = struct.Struct('<BbB')
+PARTITION_SIZE = 0x40000
+
+
+def encode(records, slot=10):
+    """Encode the list of (cloud, temperature, humidity) tuples to the image."""
+    body = bytearray()
+    for cloud, temperature, humidity in records:
+        cloud = min(max(int(round(cloud)), 0), 100)
+        temperature = min(max(int(round(temperature * 2)), -128), 127)
+        humidity = min(max(int(round(humidity)), 0), 100)
+        body += RECORD.pack(cloud, temperature, humidity)
+    if not records:
+        raise ValueError('The trace is empty')
+    image = HEADER.pack(MAGIC, VERSION, slot, RECORD_SIZE, 0, len(records), zlib.crc32(body))
+    image += body
+    if len(image) > PARTITION_SIZE:
+        raise ValueError('The trace does not fit the partition: %d bytes' % len(image))
+    return bytes(image)
+
+
+def decode(image):
+    """Decode the image, the records are yielded one by one as the firmware does."""
+    if len(image) < HEADER.size:
+        raise ValueError('The image is too short')
+    magic, version, slot, size, _, count, crc = HEADER.unpack_from(image, 0)
+    if (magic != MAGIC) or (version != VERSION) or (size != RECORD_SIZE) or (0 == slot):
+        raise ValueError('Invalid header')
+    body = image[HEADER.size:HEADER.size + count * RECORD_SIZE]
+    if (len(body) != count * RECORD_SIZE) or (zlib.crc32(body) != crc):
+        raise ValueError('CRC error')
+    for offset in range(0, len(body), RECORD_SIZE):
+        cloud, temperature, humidity = RECORD.unpack_from(body, offset)
+        yield (min(cloud, 100), temperature / 2.0, min(humidity, 100))
+
+
+def synthesize(days, slot=10, seed=1):
+    """Generate the seasonal trace: cloud fronts, daily temperature/humidity swings."""
+    rnd = random.Random(seed)
+    slots = (24 * 60) // slot
+    cloud = 30.0
+    records = []
+    for day in range(days):
+        season = math.cos(2 * math.pi * (day - 172) / 365.0)
+        for idx in range(slots):
+            hour = idx * slot / 60.0
+            daily = math.cos(2 * math.pi * (hour - 14.0) / 24.0)
+            cloud += rnd.gauss(0.0, 4.0) + 0.02 * (40.0 - cloud)
+            cloud = min(max(cloud, 0.0), 100.0)
+            temperature = 22.0 + 3.0 * season + 4.0 * daily - 2.0 * cloud / 100.0
+            humidity = 70.0 - 10.0 * daily + 15.0 * cloud / 100.0
+            records.append((cloud, temperature, humidity))
+    return records
+
+
+def self_test():
+    records = [(0, 24.5, 70), (20, 23.0, 75), (55, -12.5, 80), (100, 0.0, 99), (35, 31.5, 60)]
+    image = encode(records)
+    assert list(decode(image)) == records, 'Round trip'
+
+    records = synthesize(days=365)
+    image = encode(records)
+    assert len(image) <= PARTITION_SIZE, 'Partition size'
+    for (c, t, h), (dc, dt, dh) in zip(records, decode(image)):
+        assert (abs(c - dc) <= 0.5) and (abs(t - dt) <= 0.25) and (abs(h - dh) <= 0.5), 'Quantization'
+
+    broken = bytearray(image)
+    broken[HEADER.size] ^= 0x01
+    try:
+        list(decode(bytes(broken)))
+        assert False, 'Corrupted trace'
+    except ValueError:
+        pass
+
+    print('Weather trace - PASS (%d bytes per year)' % len(image))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+
+    cmd = commands.add_parser('encode')
+    cmd.add_argument('csv')
+    cmd.add_argument('bin')
+    cmd.add_argument('--slot', type=int, default=10)
+
+    cmd = commands.add_parser('synth')
+    cmd.add_argument('bin')
+    cmd.add_argument('--days', type=int, default=365)
+    cmd.add_argument('--seed', type=int, default=1)
+
+    cmd = commands.add_parser('decode')
+    cmd.add_argument('bin')
+    cmd.add_argument('csv', nargs='?')
+
+    commands.add_parser('test')
+
+    args = parser.parse_args()
+
+    if 'encode' == args.command:
+        with open(args.csv, newline='') as f:
+            records = [tuple(float(v) for v in row[:3]) for row in csv.reader(f) if row]
+        with open(args.bin, 'wb') as f:
+            f.write(encode(records, args.slot))
+    elif 'synth' == args.command:
+        with open(args.bin, 'wb') as f:
+            f.write(encode(synthesize(args.days, seed=args.seed)))
+    elif 'decode' == args.command:
+        with open(args.bin, 'rb') as f:
+            records = decode(f.read())
+            out = open(args.csv, 'w', newline='') if args.csv else sys.stdout
+            writer = csv.writer(out)
+            for record in records:
+                writer.writerow(record)
+    else:
+        self_test()
+
+
+if __name__ == '__main__':
+    main()